@@ -10,10 +10,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <strings.h>
 #include <sys/stat.h>
 #include <haut/haut.h>
 #include <haut/tag.h>
+#include <haut/attr.h>
 
 /* Usage:
  * getlinks_curl [url]
@@ -23,11 +23,12 @@
  */
 
 /* This function is called everytime the parser has processed an attribute.
- * Arguments are a pointer to the parser object, the key and the value of the attribute.
+ * Arguments are a pointer to the parser object, the key decoded to one of the
+ * standard HTML5 attributes in haut/attr.h, the key itself and the value of the attribute.
  * In case of a void-attribute, value may contain a null-pointer.
  */
 void
-myAttribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+myAttribute( haut_t* p, haut_attr_t attr, strfragment_t* key, strfragment_t* value ) {
     
     /* We need to know what element this attribute belongs to,
      * for this we use haut_currentElementTag(), which returns an
@@ -37,7 +38,7 @@ myAttribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
      */
     if( haut_currentElementTag( p ) == TAG_A ) {
         // So this is a link, now we're interested in the HREF attribute
-        if( strncasecmp( key->data, "href", key->size ) == 0 && value && value->data )
+        if( attr == ATTR_HREF && value && value->data )
             printf( "%.*s\n", (int)value->size, value->data );
 
         /* Note that key and value are both char-pointer
@@ -109,7 +110,7 @@ main( int argc, char** argv ) {
      * If the parser encounters one of these events it will let us know by using the callback.
      * In this case, we are only interesting in attributes (<a href=...>)
      */
-    p.events.attribute =myAttribute; // function pointer of type attribute_event
+    p.events.attribute_id =myAttribute; // function pointer of type attribute_id_event
 
     /* Begin streaming chunks of data to the parser.
      * This is a more realistic scenario of (networked) applications where the data is not
@@ -12,18 +12,23 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <ctype.h>
+#include <time.h>
 #include <haut/haut.h>
 #include <haut/tag.h>
 #include <haut/string_util.h>
 
 /* Usage:
- * html2text <html-file>
+ * html2text [-w] [-s] <html-file>
  *
  * Parses an HTML-document and outputs the contents of all textnodes 
  * inside the <BODY> element. This is just a simple example of extracting
  * human-readable text from HTML, which could be greatly expanded by 
  * adding support for nested lists, indentation, tables etc.
  * The demo takes a filename from the command-line or reads from stdin.
+ *
+ * -w   Receive every word of the text separately, instead of every run of text between tags
+ * -s   Print the number of innertext events and the throughput of the parser to stderr
  */
 
 #define BUFFER_SIZE 1024
@@ -35,6 +40,7 @@
 typedef struct {
     bool inBody;
     bool insideLine;
+    size_t textEvents;
 } user_data_t;
 
 /* This function is called everytime the parser has processed an opening element.
@@ -105,19 +111,21 @@ myElementClose( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
 
 /* This function is called for every piece of 'inner-text' (non-HTML inside a textnode).
  * Arguments are a pointer to the parser @p and the resulting @text.
- * @text is always at most one token which is ended when any whitespace is encountered.
- * This means all words of a sentence are received separately.
+ * With FLAG_ACCUMULATE_INNERTEXT, @text is all text between two tags, 
+ * otherwise it is a single word and all words of a sentence are received separately.
+ * Either way, it does not begin or end with whitespace.
  */
 void 
 myTextnode( haut_t* p, strfragment_t* text ) {
     user_data_t* user_data =(user_data_t*)p->userdata;
+    user_data->textEvents++;
    
     /* Only extract text from the <BODY> element */
     if( !user_data->inBody ) return;
     /* Although Haut does not emit the contents of <script> and <style> elements, 
      * we filter them here anyway just to be sure */
     if( haut_currentElementTag( p ) == TAG_STYLE || haut_currentElementTag( p ) == TAG_SCRIPT ) return;
-    /* We receive the seperate words from each text node, which means we must add
+    /* We receive the text nodes without the whitespace around them, which means we must add
      * whitespace when necessary. */
     if( user_data->insideLine ) { 
         printf( " " );
@@ -125,17 +133,35 @@ myTextnode( haut_t* p, strfragment_t* text ) {
         user_data->insideLine =true;
     }
 
-    printf( "%.*s", (int)text->size, text->data );
+    /* Newlines and indentation inside the text are printed as a single space */
+    for( size_t i =0; i < text->size; i++ ) {
+        if( !isspace( (unsigned char)text->data[i] ) )
+            putchar( text->data[i] );
+        else if( i > 0 && !isspace( (unsigned char)text->data[i-1] ) )
+            putchar( ' ' );
+    }
 }
 
 int
 main( int argc, char** argv ) {
     
     FILE* input_file = stdin;
+    bool words =false, stats =false;
+    int arg =1;
     
-    /* First the dull part; read the filename from the command-line and read its contents */
-    if( argc >= 2 ) {
-        const char* filename = argv[1];
+    /* First the dull part; read the options and the filename from the command-line and read its contents */
+    for( ; arg < argc && argv[arg][0] == '-'; arg++ ) {
+        if( strcmp( argv[arg], "-w" ) == 0 )
+            words =true;
+        else if( strcmp( argv[arg], "-s" ) == 0 )
+            stats =true;
+        else {
+            fprintf( stderr, "Usage: %s [-w] [-s] <html-file>\n", argv[0] );
+            return -1;
+        }
+    }
+    if( arg < argc ) {
+        const char* filename = argv[arg];
 
         /* Open the given file and write it to our buffer */
         input_file =fopen( filename, "r" );
@@ -150,6 +176,9 @@ main( int argc, char** argv ) {
      */
     haut_t p;
     haut_init( &p );
+    /* Receive all text between two tags at once, unless we asked for separate words */
+    if( !words )
+        haut_enable( &p, FLAG_ACCUMULATE_INNERTEXT );
 
     user_data_t user_data;
     memset( &user_data, 0, sizeof( user_data_t ) );
@@ -166,6 +195,8 @@ main( int argc, char** argv ) {
 
     /* Begin the parsing */
     char buffer[BUFFER_SIZE];
+    size_t total =0;
+    clock_t parse_time =0;
 
     while( !feof( input_file ) ) {
         /* Here we read chunks of the file and feed it to the parser piece by piece */
@@ -174,10 +205,22 @@ main( int argc, char** argv ) {
             fprintf( stderr, "ERROR: read error\n" );
             return 1;
         }
+        clock_t start =clock();
         haut_parseChunk( &p, buffer, length );
+        parse_time +=clock() - start;
+        total +=length;
     }
+    /* An empty chunk ends the document, which delivers the text after the last tag */
+    haut_parseChunk( &p, buffer, 0 );
     printf( "\n" );
 
+    if( stats ) {
+        /* The time includes that of the event handlers, so of printing the text */
+        double seconds =(double)parse_time / CLOCKS_PER_SEC;
+        fprintf( stderr, "%zu bytes, %zu innertext events, %.1f MB/s\n", 
+                 total, user_data.textEvents, seconds > 0 ? total / seconds / 1e6 : 0.0 );
+    }
+
     /* Clean up */
     haut_destroy( &p );
     if( input_file != stdin )
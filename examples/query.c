@@ -0,0 +1,83 @@
+/*
+ * query - Example program using Haut
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <haut/haut.h>
+#include <haut/query.h>
+
+/* Usage:
+ * query [selectors] [html-file]
+ *
+ * Prints the attributes and text of all elements that match a CSS selector,
+ * for example: query "nav a[href], h1" page.html
+ * If no file is given, the page is read from stdin.
+ */
+
+#define CHUNK_SIZE 4096
+
+/* This function is called for every element that matched, once it has been closed.
+ * The data in the match is only valid during this function */
+void
+myMatch( haut_query_t* q, const haut_match_t* match, void* userdata ) {
+    printf( "%d: <%.*s", match->selector, (int)match->name.size, match->name.data );
+    for( size_t i =0; i < match->attribute_count; i++ ) {
+        const haut_query_attribute_t* a =&match->attributes[i];
+        printf( " %.*s", (int)a->key.size, a->key.data );
+        if( a->value.data )
+            printf( "=\"%.*s\"", (int)a->value.size, a->value.data );
+    }
+    printf( "> %.*s\n", (int)match->text.size, match->text.data );
+}
+
+int
+main( int argc, char** argv ) {
+    FILE* input_file =stdin;
+
+    if( argc < 2 || argc > 3 ) {
+        fprintf( stderr, "Usage: %s [selectors] [html-file]\n", argv[0] );
+        return -1;
+    }
+    if( argc == 3 ) {
+        input_file =fopen( argv[2], "r" );
+        if( !input_file ) {
+            fprintf( stderr, "ERROR: Could not open `%s'\n", argv[2] );
+            return -1;
+        }
+    }
+
+    /* Compile the selectors to a query, this fails on a syntax error */
+    haut_query_t* q =haut_queryCompile( argv[1], myMatch, NULL );
+    if( !q ) {
+        fprintf( stderr, "ERROR: Invalid selector `%s'\n", argv[1] );
+        return -1;
+    }
+
+    /* The query installs its own event handlers in the parser */
+    haut_t p;
+    haut_init( &p );
+    haut_queryAttach( q, &p );
+
+    /* Parse the input in chunks, the query keeps its state in between */
+    char buffer[CHUNK_SIZE];
+    size_t len;
+    while( (len =fread( buffer, 1, CHUNK_SIZE, input_file )) > 0 )
+        haut_parseChunk( &p, buffer, len );
+
+    /* Report the elements that were still open at the end */
+    haut_queryFinish( q );
+
+    haut_destroy( &p );
+    haut_queryFree( q );
+    if( input_file != stdin )
+        fclose( input_file );
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_ARENA_H
+#define HAUT_ARENA_H
+
+/**
+ * This header defines a bump allocator for the parser. An arena hands out memory
+ * from large blocks and never frees individual allocations: all of it is released
+ * at once by haut_arenaReset(), which keeps the blocks for the next document.
+ * A parser that uses an arena therefore does not touch the global heap once
+ * the arena has grown to the size its documents need.
+ *
+ * Typical use, for every document:
+ *
+ *     haut_arenaReset( arena );
+ *     haut_initOpts( &p, opts );      // with opts from haut_arenaOpts()
+ *     ...
+ *     haut_destroy( &p );
+ *
+ * An arena is not thread-safe, use one arena per thread. The options of haut_arenaOpts()
+ * give every worker thread of haut_parseBatch() and haut_parseParallel() an arena of its own.
+ */
+
+#include "haut.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct haut_arena haut_arena_t;
+
+/** Create an arena that allocates blocks of @block_size bytes from the heap,
+ *  or a default size if @block_size is zero. Larger allocations get a block of their own */
+haut_arena_t*
+haut_arenaCreate( size_t block_size );
+
+/** Free all blocks of @a. Everything that was allocated from @a becomes invalid */
+void
+haut_arenaDestroy( haut_arena_t* a );
+
+/** Make all memory of @a available again, without returning it to the heap.
+ *  Everything that was allocated from @a becomes invalid, including parsers */
+void
+haut_arenaReset( haut_arena_t* a );
+
+/** Returns the number of bytes that have been allocated from @a since it was reset */
+size_t
+haut_arenaUsed( const haut_arena_t* a );
+
+/** An allocatorfunc and deallocatorfunc that take an arena as their userdata.
+ *  Deallocation does nothing, the memory is reclaimed by haut_arenaReset() */
+void*
+haut_arenaAllocate( void* arena, size_t size );
+
+void
+haut_arenaDeallocate( void* arena, void* ptr );
+
+/** An allocatorforkfunc and allocatorjoinfunc that create an empty arena with the block size of
+ *  @arena and destroy it again */
+void*
+haut_arenaFork( void* arena );
+
+void
+haut_arenaJoin( void* arena );
+
+/** Returns @opts with its allocator set to @a, and its allocator_fork and allocator_join
+ *  to haut_arenaFork() and haut_arenaJoin() */
+haut_opts_t
+haut_arenaOpts( haut_arena_t* a, haut_opts_t opts );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
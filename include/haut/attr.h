@@ -0,0 +1,206 @@
+/* This file was automatically generated by gen_tags.c from `../html5_attrs.in' 
+ * Please do not edit this file in any way 
+ */
+
+#ifndef ______INCLUDE_HAUT_ATTR_H
+#define ______INCLUDE_HAUT_ATTR_H
+
+#define ATTR_NONE 0
+#define ATTR_ID 1
+#define ATTR_CLASS 2
+#define ATTR_STYLE 3
+#define ATTR_TITLE 4
+#define ATTR_LANG 5
+#define ATTR_DIR 6
+#define ATTR_HIDDEN 7
+#define ATTR_TABINDEX 8
+#define ATTR_ACCESSKEY 9
+#define ATTR_CONTENTEDITABLE 10
+#define ATTR_DRAGGABLE 11
+#define ATTR_SPELLCHECK 12
+#define ATTR_TRANSLATE 13
+#define ATTR_AUTOFOCUS 14
+#define ATTR_AUTOCAPITALIZE 15
+#define ATTR_ENTERKEYHINT 16
+#define ATTR_INPUTMODE 17
+#define ATTR_IS 18
+#define ATTR_ITEMID 19
+#define ATTR_ITEMPROP 20
+#define ATTR_ITEMREF 21
+#define ATTR_ITEMSCOPE 22
+#define ATTR_ITEMTYPE 23
+#define ATTR_NONCE 24
+#define ATTR_POPOVER 25
+#define ATTR_SLOT 26
+#define ATTR_ROLE 27
+#define ATTR_HREF 28
+#define ATTR_SRC 29
+#define ATTR_SRCSET 30
+#define ATTR_SIZES 31
+#define ATTR_ALT 32
+#define ATTR_REL 33
+#define ATTR_TARGET 34
+#define ATTR_TYPE 35
+#define ATTR_NAME 36
+#define ATTR_CONTENT 37
+#define ATTR_CHARSET 38
+#define ATTR_HTTP_EQUIV 39
+#define ATTR_MEDIA 40
+#define ATTR_HREFLANG 41
+#define ATTR_DOWNLOAD 42
+#define ATTR_PING 43
+#define ATTR_REFERRERPOLICY 44
+#define ATTR_CROSSORIGIN 45
+#define ATTR_INTEGRITY 46
+#define ATTR_LOADING 47
+#define ATTR_DECODING 48
+#define ATTR_FETCHPRIORITY 49
+#define ATTR_ASYNC 50
+#define ATTR_DEFER 51
+#define ATTR_NOMODULE 52
+#define ATTR_BLOCKING 53
+#define ATTR_AS 54
+#define ATTR_WIDTH 55
+#define ATTR_HEIGHT 56
+#define ATTR_USEMAP 57
+#define ATTR_ISMAP 58
+#define ATTR_COORDS 59
+#define ATTR_SHAPE 60
+#define ATTR_ACTION 61
+#define ATTR_METHOD 62
+#define ATTR_ENCTYPE 63
+#define ATTR_ACCEPT 64
+#define ATTR_ACCEPT_CHARSET 65
+#define ATTR_AUTOCOMPLETE 66
+#define ATTR_NOVALIDATE 67
+#define ATTR_FOR 68
+#define ATTR_FORM 69
+#define ATTR_FORMACTION 70
+#define ATTR_FORMENCTYPE 71
+#define ATTR_FORMMETHOD 72
+#define ATTR_FORMNOVALIDATE 73
+#define ATTR_FORMTARGET 74
+#define ATTR_VALUE 75
+#define ATTR_CHECKED 76
+#define ATTR_DISABLED 77
+#define ATTR_READONLY 78
+#define ATTR_REQUIRED 79
+#define ATTR_MULTIPLE 80
+#define ATTR_SELECTED 81
+#define ATTR_PLACEHOLDER 82
+#define ATTR_PATTERN 83
+#define ATTR_MIN 84
+#define ATTR_MAX 85
+#define ATTR_STEP 86
+#define ATTR_MINLENGTH 87
+#define ATTR_MAXLENGTH 88
+#define ATTR_SIZE 89
+#define ATTR_LIST 90
+#define ATTR_DIRNAME 91
+#define ATTR_LABEL 92
+#define ATTR_COLS 93
+#define ATTR_ROWS 94
+#define ATTR_WRAP 95
+#define ATTR_COLSPAN 96
+#define ATTR_ROWSPAN 97
+#define ATTR_HEADERS 98
+#define ATTR_SCOPE 99
+#define ATTR_ABBR 100
+#define ATTR_SPAN 101
+#define ATTR_START 102
+#define ATTR_REVERSED 103
+#define ATTR_DATETIME 104
+#define ATTR_CITE 105
+#define ATTR_OPEN 106
+#define ATTR_CONTROLS 107
+#define ATTR_AUTOPLAY 108
+#define ATTR_LOOP 109
+#define ATTR_MUTED 110
+#define ATTR_PLAYSINLINE 111
+#define ATTR_POSTER 112
+#define ATTR_PRELOAD 113
+#define ATTR_KIND 114
+#define ATTR_SRCLANG 115
+#define ATTR_DEFAULT 116
+#define ATTR_DATA 117
+#define ATTR_SANDBOX 118
+#define ATTR_ALLOW 119
+#define ATTR_ALLOWFULLSCREEN 120
+#define ATTR_SRCDOC 121
+#define ATTR_FRAMEBORDER 122
+#define ATTR_SCROLLING 123
+#define ATTR_MANIFEST 124
+#define ATTR_XMLNS 125
+#define ATTR_XML_LANG 126
+#define ATTR_XLINK_HREF 127
+#define ATTR_VIEWBOX 128
+#define ATTR_FILL 129
+#define ATTR_STROKE 130
+#define ATTR_D 131
+#define ATTR_ALIGN 132
+#define ATTR_VALIGN 133
+#define ATTR_BGCOLOR 134
+#define ATTR_BACKGROUND 135
+#define ATTR_BORDER 136
+#define ATTR_CELLPADDING 137
+#define ATTR_CELLSPACING 138
+#define ATTR_COLOR 139
+#define ATTR_FACE 140
+#define ATTR_NOWRAP 141
+#define ATTR_LANGUAGE 142
+#define ATTR_ONABORT 143
+#define ATTR_ONBLUR 144
+#define ATTR_ONCANCEL 145
+#define ATTR_ONCANPLAY 146
+#define ATTR_ONCHANGE 147
+#define ATTR_ONCLICK 148
+#define ATTR_ONCLOSE 149
+#define ATTR_ONCONTEXTMENU 150
+#define ATTR_ONDBLCLICK 151
+#define ATTR_ONDRAG 152
+#define ATTR_ONDRAGEND 153
+#define ATTR_ONDRAGENTER 154
+#define ATTR_ONDRAGLEAVE 155
+#define ATTR_ONDRAGOVER 156
+#define ATTR_ONDRAGSTART 157
+#define ATTR_ONDROP 158
+#define ATTR_ONERROR 159
+#define ATTR_ONFOCUS 160
+#define ATTR_ONINPUT 161
+#define ATTR_ONINVALID 162
+#define ATTR_ONKEYDOWN 163
+#define ATTR_ONKEYPRESS 164
+#define ATTR_ONKEYUP 165
+#define ATTR_ONLOAD 166
+#define ATTR_ONMOUSEDOWN 167
+#define ATTR_ONMOUSEENTER 168
+#define ATTR_ONMOUSELEAVE 169
+#define ATTR_ONMOUSEMOVE 170
+#define ATTR_ONMOUSEOUT 171
+#define ATTR_ONMOUSEOVER 172
+#define ATTR_ONMOUSEUP 173
+#define ATTR_ONRESET 174
+#define ATTR_ONRESIZE 175
+#define ATTR_ONSCROLL 176
+#define ATTR_ONSELECT 177
+#define ATTR_ONSUBMIT 178
+#define ATTR_ONUNLOAD 179
+#define ATTR_ARIA_LABEL 180
+#define ATTR_ARIA_LABELLEDBY 181
+#define ATTR_ARIA_DESCRIBEDBY 182
+#define ATTR_ARIA_HIDDEN 183
+#define ATTR_ARIA_EXPANDED 184
+#define ATTR_ARIA_CONTROLS 185
+#define ATTR_ARIA_CURRENT 186
+#define ATTR_ARIA_HASPOPUP 187
+#define ATTR_ARIA_LIVE 188
+#define ATTR_UNKNOWN 189
+
+#define ATTR__N 190
+#define ATTR__N_INPUTS 79
+#define ATTR__EOF 0
+#define ATTR__FIRST_CHAR 44
+#define ATTR__LAST_CHAR 122
+#define ATTR__HASH 0x0da0adabu
+/* */
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_BATCH_H
+#define HAUT_BATCH_H
+
+/**
+ * This header defines the batch API, that parses many (small) documents
+ * on a pool of worker threads. Each worker owns a single parser that is reused
+ * for all documents it parses; no parser state is shared between threads.
+ */
+
+#include "haut.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A single document in a batch */
+typedef struct {
+    const char* buffer;
+    size_t length;
+    void* userdata;             // haut_t.userdata while this document is parsed
+} haut_document_t;
+
+/** Aggregate statistics of a call to haut_parseBatch() */
+typedef struct {
+    size_t documents;
+    size_t bytes;
+    double seconds;             // Wall clock time of the entire batch
+    double throughput;          // In MB/s
+    int threads;                // Number of threads that were actually used
+    size_t steals;              // Number of times a worker took documents from another worker
+} haut_batch_stats_t;
+
+/** Parse the @count documents in @docs using up to @nthreads threads.
+ *  Every document is parsed as if by haut_setInput() and haut_parse() on a fresh parser,
+ *  with @events (the default handlers if NULL), @opts and the document's userdata.
+ *  The handlers are called from the worker threads, so they must be thread-safe;
+ *  the events of a single document are emitted in order by one thread.
+ *  Documents are not parsed in any particular order.
+ *  The worker in the calling thread allocates with the allocator of @opts, the other workers
+ *  with an instance of their own from opts.allocator_fork, if it is set (see haut_opts_t).
+ *  If @stats is not NULL, it receives the statistics of the batch.
+ *  Requires POSIX threads, on other platforms all documents are parsed by the calling thread */
+void
+haut_parseBatch( const haut_document_t* docs, size_t count,
+                 const haut_event_handler_t* events, haut_opts_t opts,
+                 int nthreads, haut_batch_stats_t* stats );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_DOM_H
+#define HAUT_DOM_H
+
+/**
+ * This header defines a compact DOM, that is built from the events of a parser.
+ * Nodes are 32-bit indices into parallel arrays (a struct of arrays), node 0 is the document:
+ *
+ *     haut_dom_t dom;
+ *     haut_domInit( &dom, NULL );
+ *     haut_parseToDom( &p, buffer, len, &dom );
+ *     for( haut_node_t n =dom.first_child[0]; n != DOM_NONE; n =dom.next_sibling[n] )
+ *         if( dom.kind[n] == DOM_ELEMENT && dom.tag[n] == TAG_HTML ) ...
+ *
+ * The nodes, the attributes and the characters of both are kept in a single block of memory,
+ * so the DOM does not depend on the input and is freed with a single deallocation.
+ * Offsets and lengths are 32-bit, so documents are limited to 4 GiB.
+ *
+ * The tree follows the tags as they appear in the document: void elements are closed
+ * immediately, a close tag closes all elements that were opened after the matching start tag
+ * and a close tag without a start tag is ignored. The common implied end tags are inferred:
+ * those of <p>, <li>, <dt>, <dd>, <option>, <optgroup> and of the elements of a table.
+ * Other tree construction rules of HTML5 (such as foster parenting) are not applied.
+ */
+
+#include "haut.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t haut_node_t;
+
+/* No node, for example the parent of the document or the next sibling of a last child */
+#define DOM_NONE ((haut_node_t)0xffffffff)
+
+/** Kinds of nodes */
+typedef enum {
+    DOM_DOCUMENT =0,
+    DOM_ELEMENT,                // text is the name of the element
+    DOM_TEXT,                   // Innertext, CDATA or the text of a script
+    DOM_COMMENT,
+    DOM_DOCTYPE
+} haut_dom_kind_t;
+
+/** Characters in the string area of a DOM */
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+} haut_dom_span_t;
+
+typedef struct {
+    /* Nodes */
+    size_t count;
+    size_t capacity;
+    uint8_t* kind;              // One of haut_dom_kind_t
+    uint16_t* tag;              // The tag of an element, TAG_NONE otherwise
+    haut_node_t* parent;
+    haut_node_t* first_child;
+    haut_node_t* next_sibling;
+    haut_dom_span_t* text;
+    uint32_t* first_attr;       // The attributes of node n are first_attr[n] up to first_attr[n] + attr_count[n]
+    uint32_t* attr_count;
+
+    /* Attributes */
+    size_t attr_total;
+    size_t attr_capacity;
+    uint16_t* attr_id;          // The attribute (ATTR_...)
+    haut_dom_span_t* attr_key;
+    haut_dom_span_t* attr_value;    // offset is DOM_NONE for an attribute without a value
+
+    /* String area */
+    char* strings;
+    size_t strings_size;
+    size_t strings_capacity;
+
+    void* block;                // All of the above arrays
+    strallocator_t allocator;
+} haut_dom_t;
+
+/** Initialize an empty DOM that allocates its memory with @allocator,
+ *  or malloc() if @allocator is NULL */
+void
+haut_domInit( haut_dom_t* d, const strallocator_t* allocator );
+
+/** Free all memory of @d at once */
+void
+haut_domFree( haut_dom_t* d );
+
+/** Parse the document of @len bytes in @buffer with @p, as haut_setInput() and haut_parse() would,
+ *  and replace the contents of @d by its tree. The event handlers of @p are not called.
+ *  The memory of @d is reused if it is large enough.
+ *  Returns false if @d ran out of memory, in which case it contains the tree up to that point */
+bool
+haut_parseToDom( haut_t* p, const char* buffer, size_t len, haut_dom_t* d );
+
+/** Returns the characters of @span in @d */
+static inline strfragment_t
+haut_domString( const haut_dom_t* d, haut_dom_span_t span ) {
+    strfragment_t f;
+    f.data =d->strings + span.offset;
+    f.size =span.length;
+    return f;
+}
+
+/** Returns the first attribute of @node with the id @attr, or DOM_NONE if it has none */
+uint32_t
+haut_domFindAttribute( const haut_dom_t* d, haut_node_t node, haut_attr_t attr );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -26,11 +26,10 @@ typedef enum haut_error haut_error_t;
 
 /* List of possible standard HTML5 tags is defined in haut/tag.h */
 typedef int haut_tag_t;
+/* List of possible standard HTML5 attributes is defined in haut/attr.h */
+typedef int haut_attr_t;
 struct haut;
 
-typedef void*           (*allocatorfunc)         ( void* userdata, size_t size );
-typedef void            (*deallocatorfunc)       ( void* userdata, void* ptr );
-
 /* Function definitions for event handlers */
 typedef void            (*document_begin_event)  ( struct haut* );
 typedef void            (*document_end_event)    ( struct haut* );
@@ -39,6 +38,8 @@ typedef void            (*element_open_event)    ( struct haut*, haut_tag_t tag,
 typedef void            (*element_close_event)   ( struct haut*, haut_tag_t tag, strfragment_t* name );
 
 typedef void            (*attribute_event)       ( struct haut*, strfragment_t* key, strfragment_t* value );
+/* Like attribute_event, with the key decoded to one of ATTR_... Called before attribute_event, may be NULL */
+typedef void            (*attribute_id_event)    ( struct haut*, haut_attr_t attr, strfragment_t* key, strfragment_t* value );
 
 typedef void            (*comment_event)         ( struct haut*, strfragment_t* text );
 typedef void            (*innertext_event)       ( struct haut*, strfragment_t* text );
@@ -61,16 +62,47 @@ typedef struct {
     doctype_event       doctype;
     script_event        script;
     error_event         error;
+    attribute_id_event  attribute_id;   // Last, so that positional initializers of the other fields remain valid
 } haut_event_handler_t;
 
 extern const haut_event_handler_t DEFAULT_EVENT_HANDLER;
 
+/** Event mask: the kinds of tokens the parser has to materialize.
+ *  Tokens of a kind that is not in the mask are never begun, stored or decoded
+ *  and their events are not emitted. Element names are always needed by the parser,
+ *  so EVENT_ELEMENT is implied. The other events (document begin/end, errors) are not affected */
+typedef enum {
+    EVENT_AUTO          = 0,    // Subscribe to every event whose handler differs from DEFAULT_EVENT_HANDLER
+    EVENT_ELEMENT       = 1,    // element_open and element_close
+    EVENT_ATTRIBUTE     = 2,    // attribute and attribute_id
+    EVENT_COMMENT       = 4,
+    EVENT_INNERTEXT     = 8,
+    EVENT_CDATA         = 16,
+    EVENT_DOCTYPE       = 32,
+    EVENT_SCRIPT        = 64,
+    EVENT_ALL           = 127
+} haut_event_mask_t;
+
+/** Create the allocator_data of a new, independent instance of an allocator from that of an existing one.
+ *  Returns NULL on failure */
+typedef void*           (*allocatorforkfunc)     ( void* allocator_data );
+/** Release an instance that was created by an allocatorforkfunc, together with all memory allocated from it */
+typedef void            (*allocatorjoinfunc)     ( void* forked_data );
+
 /** This structure is used to pass optional options to the parser.
- *  It is reserved for future use */
+ *  All memory of a parser is allocated with allocator and deallocator,
+ *  which are called with allocator_data. They are fixed by haut_initOpts().
+ *  The worker threads of haut_parseBatch() and haut_parseParallel() each allocate from an instance
+ *  of their own, created by allocator_fork and released by allocator_join, if these are set.
+ *  Otherwise the workers share the allocator, which must then be thread-safe (as the default is) */
 typedef struct {
     allocatorfunc       allocator;
     deallocatorfunc     deallocator;
+    void*               allocator_data;
     int                 flags;
+    int                 event_mask;     // See haut_event_mask_t, EVENT_AUTO by default
+    allocatorforkfunc   allocator_fork; // NULL by default
+    allocatorjoinfunc   allocator_join;
 } haut_opts_t;
 
 extern const haut_opts_t DEFAULT_PARSER_OPTS;
@@ -78,7 +110,15 @@ extern const haut_opts_t DEFAULT_PARSER_OPTS;
 /** List of optional flags to the parser */
 typedef enum {
     FLAG_NONE                   = 0,
-    FLAG_ACCUMULATE_INNERTEXT   = 1 // Reserved for future use
+    FLAG_ACCUMULATE_INNERTEXT   = 1, // Deliver a run of text between tags as a single innertext event,
+                                     // instead of every word separately. Whitespace between the words is kept,
+                                     // before the first and after the last word it is left out.
+                                     // A run is delivered once the markup after it begins,
+                                     // or at the end of the document
+    FLAG_LAZY_POSITION          = 2, // Only maintain position.offset while parsing, 
+                                     // row and col are computed by haut_position() on demand
+    FLAG_SEGMENTED_TOKENS       = 4  // Tokens that span chunks of haut_parseChunk() are not copied,
+                                     // see haut_tokenSegments() and haut_retainsInput()
 } haut_flag_t;
 
 typedef struct {
@@ -110,29 +150,128 @@ typedef struct haut haut_t;
 void
 haut_init(  haut_t* p );
 
+/** Initialize @p with the options @opts. The allocator in @opts is used for all memory
+ *  of @p until haut_destroy(), changing it afterwards with haut_setOpts() has no effect.
+ *  See haut/arena.h for an allocator that can be reset per document */
+void
+haut_initOpts( haut_t* p, haut_opts_t opts );
+
 void
 haut_destroy( haut_t* p );
 
+/** Prepare @p for the next document, as if it was destroyed and initialized again,
+ *  but keep its options, event handlers, userdata and the memory of its buffers.
+ *  A parser that is reused this way does not allocate anything once its buffers have grown
+ *  to the size its documents need, see also haut_trim() */
+void
+haut_reset( haut_t* p );
+
 void
 haut_setInput( haut_t* p, const char* buffer, size_t len );
 
 void
 haut_parse( haut_t* p );
 
+/** Parse the next @len bytes of the document in @buffer, continuing where the previous chunk ended.
+ *  An empty chunk (@len is 0) ends the document, so that a run of text at its end is delivered
+ *  with FLAG_ACCUMULATE_INNERTEXT */
 void
 haut_parseChunk( haut_t* p, const char* buffer, size_t len );
 
+/** Parse the entire document in @buffer using up to @nthreads threads.
+ *  The buffer is split into segments that are parsed speculatively by worker threads,
+ *  while all events are emitted from the calling thread in document order.
+ *  The events are identical to those of haut_setInput() followed by haut_parse().
+ *  Small documents, or @nthreads < 2, are parsed by the calling thread only.
+ *  Requires POSIX threads, on other platforms this is equivalent to haut_parse() */
+void
+haut_parseParallel( haut_t* p, const char* buffer, size_t len, int nthreads );
+
+/** Stop parsing from inside an event handler. The parser returns from haut_parse() or haut_parseChunk()
+ *  right after the current event, and ignores all input that is passed to it afterwards */
+void
+haut_stop( haut_t* p );
+
+/** Pause parsing from inside an event handler. The parser returns right after the current event,
+ *  with its state and position intact. Calling haut_parse() again continues where it left off.
+ *  If the parser was paused inside haut_parseChunk(), the rest of that chunk is continued with
+ *  haut_parse(), so the chunk must remain valid until then and before the next chunk is passed.
+ *  haut_parseParallel() cannot be resumed and treats this as haut_stop() */
+void
+haut_pause( haut_t* p );
+
+/** Skip the element that is being opened, when called from the element_open handler.
+ *  The parser fast-forwards to the matching close tag without emitting any events in between,
+ *  including the attributes of the element itself, and then emits element_close as usual.
+ *  Only the nesting of elements with the same name is tracked and comments and CDATA are skipped,
+ *  so an element that contains its own tags inside a script or attribute value may end early or late.
+ *  A skipped script only suppresses its script event, its content is lexed as before.
+ *  Self-closing and void elements have no content and are not skipped.
+ *  Returns false if the element cannot be skipped, for example outside element_open or
+ *  during the replay of haut_parseParallel() */
+bool
+haut_skipElement( haut_t* p );
+
+/** Returns true if @tag is a void element, that never has content or a close tag */
+bool
+haut_isVoidElement( haut_tag_t tag );
+
 haut_tag_t
 haut_currentElementTag( haut_t* p );
 
+/** Returns the segments of the current token, when called from the attribute (for the value),
+ *  innertext or script handler, and stores their number in @count.
+ *  Normally a token is a single segment, that is equal to the fragment passed to the handler.
+ *  With FLAG_SEGMENTED_TOKENS, a value or text that spans chunks of haut_parseChunk() 
+ *  is not copied, but consists of a segment in each of these chunks. The fragment that is 
+ *  passed to the handler is then only its first segment.
+ *  The segments are valid until the handler returns */
+const strfragment_t*
+haut_tokenSegments( haut_t* p, size_t* count );
+
+/** Returns the current token as a single fragment, like haut_tokenSegments(). 
+ *  If it has more than one segment, they are copied to the parser's buffer first,
+ *  after which the fragment that was passed to the handler also refers to the entire token */
+strfragment_t
+haut_flattenToken( haut_t* p );
+
+/** Returns true if @p still refers to the chunks of previous calls to haut_parseChunk(),
+ *  which is only possible with FLAG_SEGMENTED_TOKENS. In that case, the caller must keep every chunk
+ *  since the last time this returned false valid, until it returns false after a later chunk */
+bool
+haut_retainsInput( const haut_t* p );
+
+/** Returns the current position in the input, including row and column.
+ *  Use this function instead of reading p->position when FLAG_LAZY_POSITION is enabled:
+ *  in that case p->position.row and col are only brought up to date here and at the end of haut_parse() */
+haut_position_t
+haut_position( haut_t* p );
+
+/** Returns the number of times @p has allocated memory since haut_init(), for its state and buffers.
+ *  The buffers keep the largest size they have needed, so this stops increasing
+ *  once the parser has seen its largest token */
+size_t
+haut_allocations( const haut_t* p );
+
+/** Release the memory of the buffers of @p above @high_water bytes each,
+ *  for example after a document with an exceptionally large token.
+ *  Only call this between documents, not while a document is being parsed */
+void
+haut_trim( haut_t* p, size_t high_water );
+
 void
 haut_setOpts( haut_t* p, haut_opts_t opts );
 
 void
 haut_setEventHandler( haut_t* p, haut_event_handler_t e );
 
+/** Set the event mask of @p explicitly, see haut_event_mask_t.
+ *  Pass EVENT_AUTO to derive it from the event handlers again */
+void
+haut_setEventMask( haut_t* p, int mask );
+
 
-// These functions are reserved for future use
+// Enable or disable one of the optional flags in haut_flag_t
 
 void
 haut_enable( haut_t* p, haut_flag_t flag );
@@ -0,0 +1,59 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_POOL_H
+#define HAUT_POOL_H
+
+/**
+ * This header defines a pool of parsers for every thread, for programs that parse
+ * many documents with short-lived parsers. A parser that is released to the pool
+ * is reused by the next acquire of the same thread, with haut_reset() instead of
+ * haut_destroy() and haut_init(), so that setting up a parser does not allocate.
+ *
+ * Typical use, for every document:
+ *
+ *     haut_t* p =haut_poolAcquire( DEFAULT_PARSER_OPTS );
+ *     p->events =...;
+ *     haut_setInput( p, buffer, len );
+ *     haut_parse( p );
+ *     haut_poolRelease( p );
+ *
+ * Pools are not shared between threads: a parser must be released by the thread that acquired it.
+ */
+
+#include "haut.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The number of parsers that are kept in the pool of each thread */
+#define HAUT_POOL_SIZE 4
+
+/** Returns a parser from the pool of the calling thread with the same allocator as @opts,
+ *  or a new one if there is none. The parser is in the same state as after haut_initOpts( p, opts ),
+ *  but keeps the memory of its buffers. Returns NULL if a new parser could not be allocated */
+haut_t*
+haut_poolAcquire( haut_opts_t opts );
+
+/** Return @p, which was acquired by the calling thread, to its pool.
+ *  If the pool is full, @p is destroyed instead */
+void
+haut_poolRelease( haut_t* p );
+
+/** Destroy all parsers in the pool of the calling thread, for example before it exits */
+void
+haut_poolClear( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
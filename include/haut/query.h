@@ -0,0 +1,84 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_QUERY_H
+#define HAUT_QUERY_H
+
+/**
+ * This header defines the query API, that matches CSS selectors against the events
+ * of a parser while it runs, without building a DOM. The selectors are compiled to a small
+ * automaton, whose state is kept for each element on a stack of open elements.
+ *
+ * The supported subset of CSS is: `tag', `*', `.class', `#id', `[attr]', `[attr=value]'
+ * (the value may be quoted), the descendant (` ') and child (`>') combinators
+ * and groups of selectors separated by `,'. At most 64 compound selectors
+ * (such as `div.content') can be used in a single query.
+ * Pseudo-classes and pseudo-elements (such as `a:hover') are not supported and are
+ * rejected as a syntax error, as are the `+' and `~' combinators.
+ *
+ * The stack follows the tags as they appear in the document: void elements are closed
+ * immediately, a close tag closes all elements that were opened after the matching start tag
+ * and a close tag without a start tag is ignored. Implied end tags (such as those of <p> and <li>)
+ * are not inferred.
+ */
+
+#include "haut.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct haut_query haut_query_t;
+
+/** An attribute of a matched element */
+typedef struct {
+    strfragment_t key;
+    strfragment_t value;        // value.data is NULL for an attribute without a value
+} haut_query_attribute_t;
+
+/** An element that matched one of the selectors of a query */
+typedef struct {
+    int selector;               // Index of the selector that matched in the group, starting at zero
+    haut_tag_t tag;
+    strfragment_t name;
+    const haut_query_attribute_t* attributes;
+    size_t attribute_count;
+    strfragment_t text;         // The innertext of the element and its descendants, words are separated by a space
+} haut_match_t;
+
+/** Called when an element that matched has been closed.
+ *  The match and all of its data are only valid during this call */
+typedef void            (*haut_match_event)      ( haut_query_t* q, const haut_match_t* match, void* userdata );
+
+/** Compile the comma separated list of selectors in @selectors.
+ *  For every element that matches, @callback is called with @userdata.
+ *  Returns NULL if @selectors contains a syntax error or too many compound selectors */
+haut_query_t*
+haut_queryCompile( const char* selectors, haut_match_event callback, void* userdata );
+
+void
+haut_queryFree( haut_query_t* q );
+
+/** Install the event handlers of @q in @p, so that the document that is parsed by @p is queried.
+ *  This replaces the element_open, element_close, attribute and innertext handlers
+ *  and the userdata of @p. Any previous document that was queried by @q is discarded */
+void
+haut_queryAttach( haut_query_t* q, haut_t* p );
+
+/** Report the matches of elements that have not been closed at the end of the document.
+ *  After this, @q can be attached to a parser again */
+void
+haut_queryFinish( haut_query_t* q );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_SERIAL_H
+#define HAUT_SERIAL_H
+
+/**
+ * This header defines a compact binary format for the events of a document, so that a parsed
+ * document can be stored and its events replayed later without parsing it again:
+ *
+ *     strbuffer_t stream;
+ *     strbuffer_init( &stream );
+ *     haut_parseToSerial( &p, buffer, len, &stream );
+ *     ... store stream.data, stream.size and map or read it back ...
+ *     haut_serialReplay( data, size, &p );
+ *
+ * A stream contains its own copy of all characters, so it does not depend on the input.
+ * It is read in place and has no alignment requirements, so it can be replayed directly
+ * from a memory-mapped file. The format is as follows, a varint is an unsigned LEB128 number
+ * (7 bits per byte, least significant first, the high bit is set on all but the last byte)
+ * and a string is a varint length followed by that many bytes:
+ *
+ *     header:  "HAUT"  format version (1 byte)  TAG__HASH (4 bytes)  ATTR__HASH (4 bytes)
+ *     records: kind (1 byte) followed by the fields of that kind, see haut_serial_kind_t
+ *     end:     SERIAL_END (1 byte)
+ *
+ * The 32-bit hashes are little-endian. They identify the numbering of haut/tag.h and haut/attr.h,
+ * a stream is only read by a library that numbers the tags and attributes in the same way.
+ */
+
+#include "haut.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Version of the format, which is changed whenever the records are */
+#define HAUT_SERIAL_VERSION 1
+
+/* Size of the header of a stream */
+#define HAUT_SERIAL_HEADER_SIZE 13
+
+/** Kinds of records in a stream, and their fields */
+typedef enum {
+    SERIAL_END =0,              // End of the stream
+    SERIAL_ELEMENT_OPEN,        // tag (varint), name (string)
+    SERIAL_ELEMENT_CLOSE,       // tag (varint), name (string)
+    SERIAL_ATTRIBUTE,           // attribute (varint), key (string), value (string)
+    SERIAL_ATTRIBUTE_VOID,      // attribute (varint), key (string)
+    SERIAL_COMMENT,             // text (string)
+    SERIAL_INNERTEXT,           // text (string)
+    SERIAL_CDATA,               // text (string)
+    SERIAL_DOCTYPE,             // text (string)
+    SERIAL_SCRIPT,              // text (string)
+    SERIAL_ERROR,               // error (varint), offset in the input (varint)
+    SERIAL_DOCUMENT_BEGIN,
+    SERIAL_DOCUMENT_END
+} haut_serial_kind_t;
+
+/** Result of reading a stream */
+typedef enum {
+    SERIAL_OK =0,
+    SERIAL_BAD_MAGIC,           // The data is not a stream
+    SERIAL_BAD_VERSION,         // The stream has another version of the format
+    SERIAL_BAD_NUMBERING,       // The stream numbers the tags or attributes differently
+    SERIAL_BAD_RECORD           // The stream is truncated or corrupt
+} haut_serial_status_t;
+
+/** A record that was read from a stream. The strings point into the stream */
+typedef struct {
+    haut_serial_kind_t kind;
+    uint32_t id;                // The tag, attribute or error
+    size_t offset;              // The position of an error in the input
+    strfragment_t text;         // The name, key or text
+    strfragment_t value;        // The value of an attribute
+} haut_serial_record_t;
+
+typedef struct {
+    const uint8_t* ptr;
+    const uint8_t* end;
+    haut_serial_status_t status;
+} haut_serial_reader_t;
+
+/** Parse the document of @len bytes in @buffer with @p, as haut_setInput() and haut_parse() would,
+ *  and append a stream of its events to @out. The event handlers of @p are not called,
+ *  events are stored if they are in the event mask of @p (all of them, unless it was set with haut_setEventMask()) */
+void
+haut_parseToSerial( haut_t* p, const char* buffer, size_t len, strbuffer_t* out );
+
+/** Begin reading the stream of @size bytes at @data with @r.
+ *  Returns SERIAL_OK if its header is valid, otherwise the stream can not be read */
+haut_serial_status_t
+haut_serialOpen( haut_serial_reader_t* r, const void* data, size_t size );
+
+/** Read the next record of @r into @rec. Returns false at the end of the stream,
+ *  or if it is invalid, in which case r->status is not SERIAL_OK */
+bool
+haut_serialNext( haut_serial_reader_t* r, haut_serial_record_t* rec );
+
+/** Call the event handlers of @p for the records of the stream of @size bytes at @data,
+ *  until a handler calls haut_stop(). The position of @p is not maintained while doing so.
+ *  Returns SERIAL_OK if the entire stream was valid */
+haut_serial_status_t
+haut_serialReplay( const void* data, size_t size, haut_t* p );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -9,6 +9,7 @@
 #define STATE_MACHINE_H
 
 #include <sys/types.h>
+#include <stdint.h>
 #include "string_util.h"
 
 #ifdef __cplusplus
@@ -33,13 +34,56 @@ int lexer_next_state( int lexer_state, char c );
  */
 const char* parser_next_state( int lexer_state, int next_lexer_state );
 
-/* Given a string @str, iterate the HTML5 tag-accepting-FSM @len times.
- * Return value is one of TAG_... defined in tag.h
- * Note that ALL characters in @str must be on the interval
- * [TAG__FIRST_CHAR, TAG__LAST_CHAR] 
+/* Run the fused lexer/parser FSM over at most @len characters of @buf, 
+ * starting in (and updating) @lexer_state. Stops at the first character whose
+ * transition requires a parser action, which is then stored in @transition
+ * without being applied to @lexer_state.
+ * The run also stops right after entering a state that can be skipped by lexer_skip(),
+ * in which case @transition is set to zero.
+ * Returns the number of characters consumed; if this equals @len, no action was found.
+ * See FUSED_NEXT_STATE() and FUSED_ACTION() in state.h for the layout of @transition 
+ */
+size_t lexer_fused_run( int* lexer_state, const char* buf, size_t len, uint32_t* transition );
+
+/* Maximum number of streams for lexer_fused_run_interleaved() */
+#define LEXER_MAX_STREAMS 8
+
+/* A single input of lexer_fused_run_interleaved() */
+typedef struct {
+    int state;                  // Lexer state
+    const char* buf;            // Next character to be lexed
+    const char* end;            // End of the input
+    uint32_t transition;        // Set when the stream stops, as by lexer_fused_run()
+} lexer_stream_t;
+
+/* Run the fused lexer/parser FSM over the @n independent @streams in lockstep,
+ * interleaving their lookups. Stops as soon as one of the streams stops, for the same
+ * reasons as lexer_fused_run() or because it reached its end, and returns its index. 
+ * For the other streams, the state and buf reflect the characters consumed so far.
+ * Always uses the transition tables, regardless of HAUT_LEXER_CODEGEN 
+ */
+int lexer_fused_run_interleaved( lexer_stream_t* streams, int n );
+
+/* Returns the number of characters at the start of @buf (at most @len) that keep 
+ * the lexer in @lexer_state without requiring a parser action. 
+ * Only states that loop on themselves for nearly every character are skipped this way,
+ * for all other states zero is returned 
+ */
+size_t lexer_skip( int lexer_state, const char* buf, size_t len );
+
+/* Given a string @str, iterate the HTML5 tag-accepting-FSM @len times,
+ * or look it up in the perfect hash of HTML5 tag names if built with HAUT_TAG_HASH=1.
+ * Return value is one of TAG_... defined in tag.h, TAG_UNKNOWN for names that contain
+ * characters outside of [TAG__FIRST_CHAR, TAG__LAST_CHAR]
  */
 int decode_tag( const char* str, size_t len );
 
+/* Given a string @str, iterate the HTML5 attribute-accepting-FSM @len times.
+ * Return value is one of ATTR_... defined in attr.h,
+ * ATTR_UNKNOWN if @str contains characters outside [ATTR__FIRST_CHAR, ATTR__LAST_CHAR] 
+ */
+int decode_attr( const char* str, size_t len );
+
 /* Given a string @str, iterate the HTML5 entity-accepting-FSM @len times.
  * Return value is the corresponding Unicode codepoint, or zero.
  * All characters in @str must be on the interval
@@ -47,6 +91,12 @@ int decode_tag( const char* str, size_t len );
  */
 char32_t decode_entity( const char* str, size_t len );
 
+/* Like decode_entity(), but returns the UTF-8 encoding of the entity from a pre-encoded table
+ * and stores its length in @utf8_len. Some entities consist of two codepoints, these are both encoded.
+ * Returns NULL if @str is not an entity
+ */
+const char* decode_entity_utf8( const char* str, size_t len, size_t* utf8_len );
+
 #ifdef __cplusplus
 }
 #endif
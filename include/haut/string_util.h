@@ -38,6 +38,18 @@ bool strfragment_ncmp( strfragment_t* str1, const char* str2, size_t len );
 bool strfragment_icmp( strfragment_t* str1, const char* str2 );
 bool strfragment_nicmp( strfragment_t* str1, const char* str2, size_t len );
 
+typedef void*           (*allocatorfunc)         ( void* userdata, size_t size );
+typedef void            (*deallocatorfunc)       ( void* userdata, void* ptr );
+
+/**
+ * A pair of allocation functions plus the userdata that is passed to them
+ */
+typedef struct {
+    allocatorfunc allocate;
+    deallocatorfunc deallocate;
+    void* userdata;
+} strallocator_t;
+
 /**
  * A mutable string type that supports growing
  */
@@ -45,6 +57,8 @@ typedef struct {
     char *data;
     size_t size;
     size_t capacity;
+    const strallocator_t* allocator;    // NULL for malloc(), realloc() and free()
+    size_t allocations;                 // Number of times memory was (re)allocated for this buffer
 } strbuffer_t;
 
 /* We also add some rudimentary Unicode support. Therefore we must ensure that
@@ -62,10 +76,24 @@ typedef uint16_t char16_t;
 
 void strbuffer_init( strbuffer_t* d );
 
+/**
+ * Initialize @d to allocate all of its memory with @allocator, which must remain valid
+ * until strbuffer_free(). If @allocator is NULL, this is equivalent to strbuffer_init()
+ */
+void strbuffer_initAllocator( strbuffer_t* d, const strallocator_t* allocator );
+
 void strbuffer_free( strbuffer_t* d );
 
+/**
+ * Make @d empty. Its memory is kept for reuse, so its capacity is the largest it has been
+ */
 void strbuffer_clear( strbuffer_t* d );
 
+/**
+ * Release the memory of @d above @high_water bytes (rounded up), but never the memory of its contents
+ */
+void strbuffer_trim( strbuffer_t* d, size_t high_water );
+
 size_t strbuffer_grow( strbuffer_t* d, size_t add );
 
 size_t strbuffer_reserve( strbuffer_t* d, size_t total );
@@ -93,6 +121,12 @@ bool u32toUTF8( strbuffer_t* d, char32_t c );
 
 bool u32toUTF8_at( strbuffer_t* d, int offset, char32_t c );
 
+/**
+ * Append the UTF-8 encoding of the Unicode codepoint @c to the initialized buffer @d.
+ * Returns false if @c is not a valid codepoint
+ */
+bool strbuffer_appendUTF8( strbuffer_t* d, char32_t c );
+
 #ifdef __cplusplus
 }
 #endif
@@ -159,9 +159,10 @@
 #define TAG_UNKNOWN 151
 
 #define TAG__N 152
-#define TAG__N_INPUTS 75
+#define TAG__N_INPUTS 76
 #define TAG__EOF 0
 #define TAG__FIRST_CHAR 47
 #define TAG__LAST_CHAR 122
+#define TAG__HASH 0x7fd91553u
 /* */
 #endif
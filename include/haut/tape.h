@@ -0,0 +1,128 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#ifndef HAUT_TAPE_H
+#define HAUT_TAPE_H
+
+/**
+ * This header defines the tape API, that parses a document to a flat array of fixed-size records,
+ * one for every token, instead of calling an event handler for it. The records can then be
+ * processed in a simple loop:
+ *
+ *     haut_tape_t tape;
+ *     haut_tapeInit( &tape, NULL );
+ *     haut_parseToTape( &p, buffer, len, &tape );
+ *     for( size_t i =0; i < tape.count; i++ ) {
+ *         const haut_tape_record_t* r =&tape.records[i];
+ *         if( r->kind == TAPE_ELEMENT_OPEN && r->id == TAG_A ) ...
+ *     }
+ *
+ * A record refers to its characters by offset: into the input, if they appear there unchanged,
+ * or into the string area of the tape if they were decoded (entities) or otherwise copied
+ * by the parser. Use haut_tapeString() to get them as a fragment.
+ * Offsets and lengths are 32-bit, so documents are limited to 4 GiB.
+ */
+
+#include "haut.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Kinds of records on a tape */
+typedef enum {
+    TAPE_ELEMENT_OPEN =1,       // id is the tag, the characters are its name
+    TAPE_ELEMENT_CLOSE,
+    TAPE_ATTRIBUTE,             // id is the attribute (ATTR_...), the characters are its key
+    TAPE_VALUE,                 // Value of the preceding attribute, unless that has TAPE_VOID
+    TAPE_COMMENT,
+    TAPE_INNERTEXT,
+    TAPE_CDATA,
+    TAPE_DOCTYPE,
+    TAPE_SCRIPT,
+    TAPE_ERROR,                 // id is the error, offset is the position in the input
+    TAPE_DOCUMENT_BEGIN,        // offset is the position in the input
+    TAPE_DOCUMENT_END
+} haut_tape_kind_t;
+
+/** Flags of records on a tape */
+typedef enum {
+    TAPE_STRING =1,             // offset refers to the string area instead of the input
+    TAPE_VOID   =2              // An attribute without a value
+} haut_tape_flag_t;
+
+typedef struct {
+    uint8_t kind;               // One of haut_tape_kind_t
+    uint8_t flags;              // See haut_tape_flag_t
+    uint16_t id;
+    uint32_t offset;
+    uint32_t length;
+} haut_tape_record_t;
+
+typedef struct {
+    haut_tape_record_t* records;
+    size_t count;
+    size_t capacity;
+    char* strings;              // The string area
+    size_t strings_size;
+    size_t strings_capacity;
+    bool fixed;                 // The buffers were provided by the caller and do not grow
+    bool truncated;             // The tape ran out of space, see haut_parseToTape()
+    strallocator_t allocator;
+} haut_tape_t;
+
+/** Initialize an empty tape that allocates its buffers with @allocator,
+ *  or malloc() if @allocator is NULL. See haut/arena.h for an allocator that can be reset per document */
+void
+haut_tapeInit( haut_tape_t* t, const strallocator_t* allocator );
+
+/** Initialize an empty tape that uses the buffers @records and @strings, which hold @capacity records
+ *  and @strings_capacity bytes. The tape does not grow beyond them */
+void
+haut_tapeInitFixed( haut_tape_t* t, haut_tape_record_t* records, size_t capacity, char* strings, size_t strings_capacity );
+
+/** Free the buffers of @t, unless they were provided by the caller */
+void
+haut_tapeFree( haut_tape_t* t );
+
+/** Remove all records from @t, but keep its buffers */
+void
+haut_tapeClear( haut_tape_t* t );
+
+/** Parse the document of @len bytes in @buffer with @p, as haut_setInput() and haut_parse() would,
+ *  and append a record for each of its tokens to @t. The event handlers of @p are not called,
+ *  tokens are recorded if they are in the event mask of @p (all of them, unless it was set with haut_setEventMask()).
+ *  Returns false if @t ran out of space or memory, in which case parsing was stopped and the
+ *  records up to that point are kept, or if @len is 4 GiB or more, in which case nothing is recorded.
+ *  Either way, t->truncated is set. @buffer must remain valid as long as the records are used */
+bool
+haut_parseToTape( haut_t* p, const char* buffer, size_t len, haut_tape_t* t );
+
+/** Returns the characters of record @r on @t, with @input the buffer it was parsed from */
+static inline strfragment_t
+haut_tapeString( const haut_tape_t* t, const char* input, const haut_tape_record_t* r ) {
+    strfragment_t f;
+    f.data =(r->flags & TAPE_STRING ? t->strings : input) + r->offset;
+    f.size =r->length;
+    return f;
+}
+
+/** Call the event handlers of @p for the records on @t, as if @input was parsed by @p,
+ *  until a handler calls haut_stop(). Only the events in the event mask of @p are emitted.
+ *  The position of @p is not maintained while doing so */
+void
+haut_tapeReplay( const haut_tape_t* t, const char* input, haut_t* p );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#include "../include/haut/arena.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+#define ARENA_ALIGN 16
+#define ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+#define ALIGN_UP(n) (((n) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+typedef struct block {
+    struct block* next;
+    size_t size;                // Usable bytes after the header
+    size_t used;
+} block_t;
+
+#define BLOCK_HEADER ALIGN_UP( sizeof( block_t ) )
+#define BLOCK_DATA(b) ((char*)(b) + BLOCK_HEADER)
+
+struct haut_arena {
+    block_t* first;
+    block_t* current;           // Blocks after this one are empty, NULL if there are no blocks
+    size_t block_size;
+    size_t used;
+};
+
+/** Allocate a block for at least @size bytes and insert it after the current block of @a */
+static block_t*
+new_block( haut_arena_t* a, size_t size ) {
+    if( size < a->block_size )
+        size =a->block_size;
+    block_t* b =(block_t*)malloc( BLOCK_HEADER + size );
+    if( !b ) return NULL;
+    b->size =size;
+    b->used =0;
+    if( a->current ) {
+        b->next =a->current->next;
+        a->current->next =b;
+    } else {
+        b->next =a->first;
+        a->first =b;
+    }
+    return b;
+}
+
+haut_arena_t*
+haut_arenaCreate( size_t block_size ) {
+    haut_arena_t* a =(haut_arena_t*)malloc( sizeof( haut_arena_t ) );
+    if( !a ) return NULL;
+    a->first =a->current =NULL;
+    a->block_size =block_size ? ALIGN_UP( block_size ) : ARENA_DEFAULT_BLOCK_SIZE;
+    a->used =0;
+    return a;
+}
+
+void
+haut_arenaDestroy( haut_arena_t* a ) {
+    block_t* b =a->first;
+    while( b ) {
+        block_t* next =b->next;
+        free( b );
+        b =next;
+    }
+    free( a );
+}
+
+void
+haut_arenaReset( haut_arena_t* a ) {
+    for( block_t* b =a->first; b; b =b->next )
+        b->used =0;
+    a->current =a->first;
+    a->used =0;
+}
+
+size_t
+haut_arenaUsed( const haut_arena_t* a ) {
+    return a->used;
+}
+
+void*
+haut_arenaAllocate( void* arena, size_t size ) {
+    haut_arena_t* a =(haut_arena_t*)arena;
+    size =ALIGN_UP( size );
+    block_t* b =a->current;
+    if( !b || b->size - b->used < size ) {
+        // Move on to the next (empty) block, unless it is too small
+        if( b && b->next && b->next->size >= size )
+            b =b->next;
+        else
+            b =new_block( a, size );
+        if( !b ) return NULL;
+        a->current =b;
+    }
+    void* ptr =BLOCK_DATA( b ) + b->used;
+    b->used +=size;
+    a->used +=size;
+    return ptr;
+}
+
+void
+haut_arenaDeallocate( void* arena, void* ptr ) {
+    (void)arena; (void)ptr;
+}
+
+void*
+haut_arenaFork( void* arena ) {
+    return haut_arenaCreate( ((haut_arena_t*)arena)->block_size );
+}
+
+void
+haut_arenaJoin( void* arena ) {
+    haut_arenaDestroy( (haut_arena_t*)arena );
+}
+
+haut_opts_t
+haut_arenaOpts( haut_arena_t* a, haut_opts_t opts ) {
+    opts.allocator =haut_arenaAllocate;
+    opts.deallocator =haut_arenaDeallocate;
+    opts.allocator_data =a;
+    opts.allocator_fork =haut_arenaFork;
+    opts.allocator_join =haut_arenaJoin;
+    return opts;
+}
@@ -0,0 +1,249 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements haut_parseBatch(): parsing many documents on a pool of threads.
+ *
+ * The documents are divided in equal ranges, one per worker. A worker takes documents
+ * from the front of its own range. When it runs out, it steals the back half of
+ * the largest remaining range of another worker, so that a few large documents
+ * do not leave the other workers idle.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "../include/haut/batch.h"
+#include "haut_state.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if !defined(_WIN32)
+#define HAUT_THREADS
+#include <pthread.h>
+#endif
+
+struct batch;
+
+typedef struct {
+#ifdef HAUT_THREADS
+    pthread_t thread;
+    bool started;
+    pthread_mutex_t lock;       // Protects @next and @end
+#endif
+    size_t next, end;           // The range of documents that this worker has yet to parse
+    haut_t parser;
+    bool ready;                 // Whether the parser has been initialized
+    void* forked_data;          // The allocator instance of this worker, if it has one of its own
+    struct batch* batch;
+
+    size_t documents, bytes, steals;
+} worker_t;
+
+typedef struct batch {
+    const haut_document_t* docs;
+    worker_t* workers;
+    int nworkers;
+} batch_t;
+
+static void
+lock( worker_t* w ) {
+#ifdef HAUT_THREADS
+    pthread_mutex_lock( &w->lock );
+#endif
+}
+
+static void
+unlock( worker_t* w ) {
+#ifdef HAUT_THREADS
+    pthread_mutex_unlock( &w->lock );
+#endif
+}
+
+static double
+now( void ) {
+#ifdef HAUT_THREADS
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/** Take the next document from the range of @w. Returns false if the range is empty */
+static bool
+take_document( worker_t* w, size_t* index ) {
+    bool found =false;
+    lock( w );
+    if( w->next < w->end ) {
+        *index =w->next++;
+        found =true;
+    }
+    unlock( w );
+    return found;
+}
+
+/** Move the back half of the largest range of the other workers to @w.
+ *  Returns false if there was nothing left to steal */
+static bool
+steal_documents( worker_t* w ) {
+    batch_t* b =w->batch;
+    for( ;; ) {
+        worker_t* victim =NULL;
+        size_t largest =0;
+        for( int i =0; i < b->nworkers; i++ ) {
+            worker_t* v =&b->workers[i];
+            if( v == w )
+                continue;
+            lock( v );
+            size_t remaining =v->end - v->next;
+            unlock( v );
+            if( remaining > largest ) {
+                largest =remaining;
+                victim =v;
+            }
+        }
+        if( !victim )
+            return false;
+
+        size_t begin =0, end =0;
+        lock( victim );
+        if( victim->next < victim->end ) {
+            end =victim->end;
+            begin =end - (end - victim->next + 1) / 2;
+            victim->end =begin;
+        }
+        unlock( victim );
+        // Otherwise, the victim finished its range in the meantime; try again
+        if( begin == end )
+            continue;
+
+        lock( w );
+        w->next =begin;
+        w->end =end;
+        unlock( w );
+        w->steals++;
+        return true;
+    }
+}
+
+static void
+parse_document( worker_t* w, const haut_document_t* doc ) {
+    haut_t* p =&w->parser;
+    haut_reset( p );
+    p->userdata =doc->userdata;
+    haut_setInput( p, doc->buffer, doc->length );
+    haut_parse( p );
+    w->documents++;
+    w->bytes +=doc->length;
+}
+
+static void*
+run_worker( void* arg ) {
+    worker_t* w =(worker_t*)arg;
+    size_t index;
+    do {
+        while( take_document( w, &index ) )
+            parse_document( w, &w->batch->docs[index] );
+    } while( steal_documents( w ) );
+    return NULL;
+}
+
+void
+haut_parseBatch( const haut_document_t* docs, size_t count,
+                 const haut_event_handler_t* events, haut_opts_t opts,
+                 int nthreads, haut_batch_stats_t* stats ) {
+    double begin =now();
+#ifndef HAUT_THREADS
+    nthreads =1;
+#endif
+    if( nthreads < 1 )
+        nthreads =1;
+    if( (size_t)nthreads > count )
+        nthreads =count ? count : 1;
+
+    batch_t batch;
+    worker_t single;
+    batch.docs =docs;
+    batch.nworkers =nthreads;
+    batch.workers =(worker_t*)opts.allocator( opts.allocator_data, nthreads * sizeof( worker_t ) );
+    if( !batch.workers ) {
+        // Parse all documents in the calling thread
+        batch.workers =&single;
+        batch.nworkers =nthreads =1;
+    }
+    memset( batch.workers, 0, nthreads * sizeof( worker_t ) );
+
+    for( int i =0; i < nthreads; i++ ) {
+        worker_t* w =&batch.workers[i];
+        w->batch =&batch;
+        w->next =count * i / nthreads;
+        w->end =count * (i+1) / nthreads;
+#ifdef HAUT_THREADS
+        pthread_mutex_init( &w->lock, NULL );
+#endif
+        /* The other workers allocate from an instance of their own, if there is a fork function.
+         * A worker whose instance could not be created is not started, its range is stolen by the others */
+        haut_opts_t worker_opts =opts;
+        if( i > 0 && opts.allocator_fork ) {
+            w->forked_data =worker_opts.allocator_data =opts.allocator_fork( opts.allocator_data );
+            if( !w->forked_data )
+                continue;
+        }
+        haut_initOpts( &w->parser, worker_opts );
+        if( events )
+            haut_setEventHandler( &w->parser, *events );
+        w->ready =true;
+    }
+
+    /* Worker zero is the calling thread */
+#ifdef HAUT_THREADS
+    for( int i =1; i < nthreads; i++ ) {
+        worker_t* w =&batch.workers[i];
+        w->started =w->ready && pthread_create( &w->thread, NULL, run_worker, w ) == 0;
+    }
+#endif
+    run_worker( &batch.workers[0] );
+
+    haut_batch_stats_t total;
+    memset( &total, 0, sizeof( haut_batch_stats_t ) );
+    total.threads =1;
+
+#ifdef HAUT_THREADS
+    // The range of a worker that could not be started has been stolen by the others
+    for( int i =1; i < nthreads; i++ ) {
+        worker_t* w =&batch.workers[i];
+        if( w->started ) {
+            pthread_join( w->thread, NULL );
+            total.threads++;
+        }
+    }
+#endif
+
+    for( int i =0; i < nthreads; i++ ) {
+        worker_t* w =&batch.workers[i];
+#ifdef HAUT_THREADS
+        pthread_mutex_destroy( &w->lock );
+#endif
+        total.documents +=w->documents;
+        total.bytes +=w->bytes;
+        total.steals +=w->steals;
+        if( w->ready )
+            haut_destroy( &w->parser );
+        if( w->forked_data )
+            opts.allocator_join( w->forked_data );
+    }
+    if( batch.workers != &single )
+        opts.deallocator( opts.allocator_data, batch.workers );
+
+    total.seconds =now() - begin;
+    if( total.seconds > 0.0 )
+        total.throughput =(total.bytes / (1024.0 * 1024.0)) / total.seconds;
+    if( stats )
+        *stats =total;
+}
@@ -0,0 +1,378 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements the DOM builder: a set of internal event handlers that append
+ * the nodes to the arrays of the DOM in document order.
+ *
+ * No stack of open elements is kept: the parent array is the stack. Because nodes are appended
+ * in document order, the last child of an element is known whenever it is the current element:
+ * it is the last node that was appended to it, or the element that was closed most recently.
+ */
+
+#include "../include/haut/dom.h"
+#include "../include/haut/tag.h"
+#include "haut_state.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* The userdata of the parser while it builds a DOM */
+typedef struct {
+    haut_dom_t* dom;
+    haut_node_t current;        // The innermost open element, or the document
+    haut_node_t last;           // The last child of current, or DOM_NONE
+    haut_node_t start_tag;      // The element that receives the attributes
+    bool failed;
+} builder_t;
+
+static void*
+heap_allocate( void* userdata, size_t size ) {
+    return malloc( size );
+}
+
+static void
+heap_deallocate( void* userdata, void* ptr ) {
+    free( ptr );
+}
+
+/** Let the arrays of @d point into @block, for @nodes nodes, @attrs attributes and @strings bytes.
+ *  Returns the size of the block. If @block is NULL, only the size is computed */
+static size_t
+layout( haut_dom_t* d, char* block, size_t nodes, size_t attrs, size_t strings ) {
+    size_t offs =0;
+#define PLACE( field, n ) \
+    if( block ) d->field =(void*)(block + offs); \
+    offs +=(n) * sizeof( *d->field );
+
+    // Ordered by alignment, so that every array is aligned if the block is
+    PLACE( parent, nodes );
+    PLACE( first_child, nodes );
+    PLACE( next_sibling, nodes );
+    PLACE( text, nodes );
+    PLACE( first_attr, nodes );
+    PLACE( attr_count, nodes );
+    PLACE( attr_key, attrs );
+    PLACE( attr_value, attrs );
+    PLACE( tag, nodes );
+    PLACE( attr_id, attrs );
+    PLACE( kind, nodes );
+    PLACE( strings, strings );
+#undef PLACE
+    return offs;
+}
+
+/** Returns the capacity of an array of @capacity elements after it has grown to hold @needed */
+static size_t
+grown( size_t capacity, size_t needed ) {
+    if( needed <= capacity )
+        return capacity;
+    return needed > capacity * 2 ? needed : capacity * 2;
+}
+
+/** Make room in @d for at least @nodes nodes, @attrs attributes and @strings bytes.
+ *  All arrays are moved to a single new block if one of them is too small. Returns false if out of memory */
+static bool
+reserve( haut_dom_t* d, size_t nodes, size_t attrs, size_t strings ) {
+    if( d->block && nodes <= d->capacity && attrs <= d->attr_capacity && strings <= d->strings_capacity )
+        return true;
+    nodes =grown( d->capacity, nodes );
+    attrs =grown( d->attr_capacity, attrs );
+    strings =grown( d->strings_capacity, strings );
+
+    haut_dom_t n =*d;
+    char* block =(char*)d->allocator.allocate( d->allocator.userdata, layout( &n, NULL, nodes, attrs, strings ) );
+    if( !block )
+        return false;
+    layout( &n, block, nodes, attrs, strings );
+    if( d->block ) {
+#define COPY( field, count ) memcpy( n.field, d->field, (count) * sizeof( *d->field ) );
+        COPY( kind, d->count );
+        COPY( tag, d->count );
+        COPY( parent, d->count );
+        COPY( first_child, d->count );
+        COPY( next_sibling, d->count );
+        COPY( text, d->count );
+        COPY( first_attr, d->count );
+        COPY( attr_count, d->count );
+        COPY( attr_id, d->attr_total );
+        COPY( attr_key, d->attr_total );
+        COPY( attr_value, d->attr_total );
+        COPY( strings, d->strings_size );
+#undef COPY
+        d->allocator.deallocate( d->allocator.userdata, d->block );
+    }
+    n.block =block;
+    n.capacity =nodes;
+    n.attr_capacity =attrs;
+    n.strings_capacity =strings;
+    *d =n;
+    return true;
+}
+
+/** Make room in the DOM of @p, or stop parsing if that fails */
+static bool
+reserve_or_stop( haut_t* p, size_t nodes, size_t attrs, size_t strings ) {
+    builder_t* b =(builder_t*)p->userdata;
+    if( reserve( b->dom, nodes, attrs, strings ) )
+        return true;
+    b->failed =true;
+    haut_stop( p );
+    return false;
+}
+
+/** Copy @f to the string area of @d, which must have room for it */
+static haut_dom_span_t
+store( haut_dom_t* d, const strfragment_t* f ) {
+    haut_dom_span_t s ={ (uint32_t)d->strings_size, (uint32_t)f->size };
+    if( f->size )
+        memcpy( d->strings + d->strings_size, f->data, f->size );
+    d->strings_size +=f->size;
+    return s;
+}
+
+/** Append a node to the current element of @p. Returns DOM_NONE if out of memory */
+static haut_node_t
+new_node( haut_t* p, int kind, haut_tag_t tag, const strfragment_t* text ) {
+    builder_t* b =(builder_t*)p->userdata;
+    haut_dom_t* d =b->dom;
+    if( !reserve_or_stop( p, d->count + 1, d->attr_total, d->strings_size + text->size ) )
+        return DOM_NONE;
+
+    haut_node_t n =d->count++;
+    d->kind[n] =kind;
+    d->tag[n] =tag;
+    d->parent[n] =b->current;
+    d->first_child[n] =DOM_NONE;
+    d->next_sibling[n] =DOM_NONE;
+    d->text[n] =store( d, text );
+    d->first_attr[n] =d->attr_total;
+    d->attr_count[n] =0;
+    if( b->last == DOM_NONE )
+        d->first_child[b->current] =n;
+    else
+        d->next_sibling[b->last] =n;
+    b->last =n;
+    return n;
+}
+
+/** Close the open element @n and all elements in it */
+static void
+close_element( builder_t* b, haut_node_t n ) {
+    b->current =b->dom->parent[n];
+    b->last =n;
+}
+
+static bool
+same_name( const char* a, size_t a_size, const char* b, size_t b_size ) {
+    if( a_size != b_size )
+        return false;
+    for( size_t i =0; i < a_size; i++ )
+        if( tolower( (unsigned char)a[i] ) != tolower( (unsigned char)b[i] ) )
+            return false;
+    return true;
+}
+
+static bool
+is_table_section( haut_tag_t tag ) {
+    return tag == TAG_THEAD || tag == TAG_TBODY || tag == TAG_TFOOT;
+}
+
+/** Returns true if a start tag of @tag implies the end tag of the open element @open */
+static bool
+implies_end( haut_tag_t open, haut_tag_t tag ) {
+    switch( open ) {
+        case TAG_P:
+            switch( tag ) {
+                case TAG_ADDRESS: case TAG_ARTICLE: case TAG_ASIDE: case TAG_BLOCKQUOTE: case TAG_CENTER:
+                case TAG_DETAILS: case TAG_DIV: case TAG_DL: case TAG_DD: case TAG_DT: case TAG_FIELDSET:
+                case TAG_FIGCAPTION: case TAG_FIGURE: case TAG_FOOTER: case TAG_FORM: case TAG_H1: case TAG_H2:
+                case TAG_H3: case TAG_H4: case TAG_H5: case TAG_H6: case TAG_HEADER: case TAG_HGROUP: case TAG_HR:
+                case TAG_LI: case TAG_MAIN: case TAG_MENU: case TAG_NAV: case TAG_OL: case TAG_P: case TAG_PRE:
+                case TAG_SECTION: case TAG_SUMMARY: case TAG_TABLE: case TAG_UL:
+                    return true;
+                default:
+                    return false;
+            }
+        case TAG_LI:
+            return tag == TAG_LI;
+        case TAG_DT: case TAG_DD:
+            return tag == TAG_DT || tag == TAG_DD;
+        case TAG_OPTION:
+            return tag == TAG_OPTION || tag == TAG_OPTGROUP;
+        case TAG_OPTGROUP:
+            return tag == TAG_OPTGROUP;
+        case TAG_TD: case TAG_TH:
+            return tag == TAG_TD || tag == TAG_TH || tag == TAG_TR || is_table_section( tag );
+        case TAG_TR:
+            return tag == TAG_TR || is_table_section( tag );
+        case TAG_THEAD: case TAG_TBODY: case TAG_TFOOT:
+            return is_table_section( tag );
+        default:
+            return false;
+    }
+}
+
+/* Building event handlers */
+
+static void
+build_element_open( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    builder_t* b =(builder_t*)p->userdata;
+    haut_dom_t* d =b->dom;
+    while( b->current != 0 && implies_end( d->tag[b->current], tag ) )
+        close_element( b, b->current );
+
+    haut_node_t n =new_node( p, DOM_ELEMENT, tag, name );
+    b->start_tag =n;
+    // A void element has no content, so it does not become the current element
+    if( n != DOM_NONE && !haut_isVoidElement( tag ) ) {
+        b->current =n;
+        b->last =DOM_NONE;
+    }
+}
+
+static void
+build_element_close( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    builder_t* b =(builder_t*)p->userdata;
+    haut_dom_t* d =b->dom;
+    for( haut_node_t n =b->current; n != 0; n =d->parent[n] ) {
+        if( d->tag[n] == tag && (tag != TAG_UNKNOWN
+                || same_name( d->strings + d->text[n].offset, d->text[n].length, name->data, name->size )) ) {
+            close_element( b, n );
+            return;
+        }
+    }
+}
+
+static void
+build_attribute_id( haut_t* p, haut_attr_t attr, strfragment_t* key, strfragment_t* value ) {
+    builder_t* b =(builder_t*)p->userdata;
+    haut_dom_t* d =b->dom;
+    if( b->start_tag == DOM_NONE
+            || !reserve_or_stop( p, d->count, d->attr_total + 1, d->strings_size + key->size + (value ? value->size : 0) ) )
+        return;
+
+    size_t a =d->attr_total++;
+    d->attr_id[a] =attr;
+    d->attr_key[a] =store( d, key );
+    if( value )
+        d->attr_value[a] =store( d, value );
+    else {
+        d->attr_value[a].offset =DOM_NONE;
+        d->attr_value[a].length =0;
+    }
+    d->attr_count[b->start_tag]++;
+}
+
+static void
+build_text( haut_t* p, strfragment_t* text ) {
+    new_node( p, DOM_TEXT, TAG_NONE, text );
+}
+
+static void
+build_comment( haut_t* p, strfragment_t* text ) {
+    new_node( p, DOM_COMMENT, TAG_NONE, text );
+}
+
+static void
+build_doctype( haut_t* p, strfragment_t* text ) {
+    new_node( p, DOM_DOCTYPE, TAG_NONE, text );
+}
+
+static void
+build_script( haut_t* p, strfragment_t* text ) {
+    builder_t* b =(builder_t*)p->userdata;
+    new_node( p, DOM_TEXT, TAG_NONE, text );
+    // The close tag of a script does not emit an event
+    if( b->current != 0 && b->dom->tag[b->current] == TAG_SCRIPT )
+        close_element( b, b->current );
+}
+
+static void
+build_ignore( haut_t* p ) {}
+
+static void
+build_ignore_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    // Built by build_attribute_id()
+}
+
+static void
+build_ignore_error( haut_t* p, haut_error_t err ) {}
+
+static const haut_event_handler_t DOM_EVENT_HANDLER = {
+    .document_begin=build_ignore,
+    .document_end  =build_ignore,
+    .element_open  =build_element_open,
+    .element_close =build_element_close,
+    .attribute     =build_ignore_attribute,
+    .comment       =build_comment,
+    .innertext     =build_text,
+    .doctype       =build_doctype,
+    .script        =build_script,
+    .cdata         =build_text,
+    .error         =build_ignore_error,
+    .attribute_id  =build_attribute_id,
+};
+
+/* */
+
+void
+haut_domInit( haut_dom_t* d, const strallocator_t* allocator ) {
+    memset( d, 0, sizeof( haut_dom_t ) );
+    if( allocator )
+        d->allocator =*allocator;
+    else {
+        d->allocator.allocate =heap_allocate;
+        d->allocator.deallocate =heap_deallocate;
+    }
+}
+
+void
+haut_domFree( haut_dom_t* d ) {
+    strallocator_t allocator =d->allocator;
+    if( d->block )
+        allocator.deallocate( allocator.userdata, d->block );
+    haut_domInit( d, &allocator );
+}
+
+bool
+haut_parseToDom( haut_t* p, const char* buffer, size_t len, haut_dom_t* d ) {
+    d->count =d->attr_total =d->strings_size =0;
+    // These estimates fit most documents, so that the block rarely has to grow while parsing
+    if( !reserve( d, len / 16 + 16, len / 64 + 16, len + 1 ) )
+        return false;
+
+    d->count =1;
+    d->kind[0] =DOM_DOCUMENT;
+    d->tag[0] =TAG_NONE;
+    d->parent[0] =DOM_NONE;
+    d->first_child[0] =DOM_NONE;
+    d->next_sibling[0] =DOM_NONE;
+    d->text[0].offset =d->text[0].length =0;
+    d->first_attr[0] =d->attr_count[0] =0;
+
+    builder_t b ={ d, 0, DOM_NONE, DOM_NONE, false };
+    haut_event_handler_t events =p->events;
+    void* userdata =p->userdata;
+
+    p->events =DOM_EVENT_HANDLER;
+    p->userdata =&b;
+    haut_setInput( p, buffer, len );
+    haut_parse( p );
+    p->events =events;
+    p->userdata =userdata;
+    return !b.failed;
+}
+
+uint32_t
+haut_domFindAttribute( const haut_dom_t* d, haut_node_t node, haut_attr_t attr ) {
+    for( uint32_t a =d->first_attr[node]; a < d->first_attr[node] + d->attr_count[node]; a++ )
+        if( d->attr_id[a] == attr )
+            return a;
+    return DOM_NONE;
+}
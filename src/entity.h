@@ -10,7 +10,8 @@
 
 #define ENTITY_SUCCESS_BIT 0x80000000
 
-#define ENTITY__N 2126
+#define ENTITY__N 2127
+#define ENTITY__MAX_UTF8 6
 #define ENTITY__N_INPUTS 63
 #define ENTITY__EOF 0
 #define ENTITY__FIRST_CHAR 59
@@ -0,0 +1,2130 @@
+// This file was automatically generated by gen_entities.c from `entities.json'
+// Please do not edit this file in any way
+// { first codepoint, length of the UTF-8 encoding, UTF-8 encoding of all codepoints }
+{ 0, 0, "" }, // none
+{ 0, 0, "" }, // unknown
+{ 0xc1, 2, "\xc3\x81" }, // &Aacute;
+{ 0xe1, 2, "\xc3\xa1" }, // &aacute;
+{ 0x102, 2, "\xc4\x82" }, // &Abreve;
+{ 0x103, 2, "\xc4\x83" }, // &abreve;
+{ 0x223e, 3, "\xe2\x88\xbe" }, // &ac;
+{ 0x223f, 3, "\xe2\x88\xbf" }, // &acd;
+{ 0x223e, 5, "\xe2\x88\xbe\xcc\xb3" }, // &acE;
+{ 0xc2, 2, "\xc3\x82" }, // &Acirc;
+{ 0xe2, 2, "\xc3\xa2" }, // &acirc;
+{ 0xb4, 2, "\xc2\xb4" }, // &acute;
+{ 0x410, 2, "\xd0\x90" }, // &Acy;
+{ 0x430, 2, "\xd0\xb0" }, // &acy;
+{ 0xc6, 2, "\xc3\x86" }, // &AElig;
+{ 0xe6, 2, "\xc3\xa6" }, // &aelig;
+{ 0x2061, 3, "\xe2\x81\xa1" }, // &af;
+{ 0x1d504, 4, "\xf0\x9d\x94\x84" }, // &Afr;
+{ 0x1d51e, 4, "\xf0\x9d\x94\x9e" }, // &afr;
+{ 0xc0, 2, "\xc3\x80" }, // &Agrave;
+{ 0xe0, 2, "\xc3\xa0" }, // &agrave;
+{ 0x2135, 3, "\xe2\x84\xb5" }, // &alefsym;
+{ 0x2135, 3, "\xe2\x84\xb5" }, // &aleph;
+{ 0x391, 2, "\xce\x91" }, // &Alpha;
+{ 0x3b1, 2, "\xce\xb1" }, // &alpha;
+{ 0x100, 2, "\xc4\x80" }, // &Amacr;
+{ 0x101, 2, "\xc4\x81" }, // &amacr;
+{ 0x2a3f, 3, "\xe2\xa8\xbf" }, // &amalg;
+{ 0x26, 1, "\x26" }, // &AMP;
+{ 0x26, 1, "\x26" }, // &amp;
+{ 0x2a53, 3, "\xe2\xa9\x93" }, // &And;
+{ 0x2227, 3, "\xe2\x88\xa7" }, // &and;
+{ 0x2a55, 3, "\xe2\xa9\x95" }, // &andand;
+{ 0x2a5c, 3, "\xe2\xa9\x9c" }, // &andd;
+{ 0x2a58, 3, "\xe2\xa9\x98" }, // &andslope;
+{ 0x2a5a, 3, "\xe2\xa9\x9a" }, // &andv;
+{ 0x2220, 3, "\xe2\x88\xa0" }, // &ang;
+{ 0x29a4, 3, "\xe2\xa6\xa4" }, // &ange;
+{ 0x2220, 3, "\xe2\x88\xa0" }, // &angle;
+{ 0x2221, 3, "\xe2\x88\xa1" }, // &angmsd;
+{ 0x29a8, 3, "\xe2\xa6\xa8" }, // &angmsdaa;
+{ 0x29a9, 3, "\xe2\xa6\xa9" }, // &angmsdab;
+{ 0x29aa, 3, "\xe2\xa6\xaa" }, // &angmsdac;
+{ 0x29ab, 3, "\xe2\xa6\xab" }, // &angmsdad;
+{ 0x29ac, 3, "\xe2\xa6\xac" }, // &angmsdae;
+{ 0x29ad, 3, "\xe2\xa6\xad" }, // &angmsdaf;
+{ 0x29ae, 3, "\xe2\xa6\xae" }, // &angmsdag;
+{ 0x29af, 3, "\xe2\xa6\xaf" }, // &angmsdah;
+{ 0x221f, 3, "\xe2\x88\x9f" }, // &angrt;
+{ 0x22be, 3, "\xe2\x8a\xbe" }, // &angrtvb;
+{ 0x299d, 3, "\xe2\xa6\x9d" }, // &angrtvbd;
+{ 0x2222, 3, "\xe2\x88\xa2" }, // &angsph;
+{ 0xc5, 2, "\xc3\x85" }, // &angst;
+{ 0x237c, 3, "\xe2\x8d\xbc" }, // &angzarr;
+{ 0x104, 2, "\xc4\x84" }, // &Aogon;
+{ 0x105, 2, "\xc4\x85" }, // &aogon;
+{ 0x1d538, 4, "\xf0\x9d\x94\xb8" }, // &Aopf;
+{ 0x1d552, 4, "\xf0\x9d\x95\x92" }, // &aopf;
+{ 0x2248, 3, "\xe2\x89\x88" }, // &ap;
+{ 0x2a6f, 3, "\xe2\xa9\xaf" }, // &apacir;
+{ 0x2a70, 3, "\xe2\xa9\xb0" }, // &apE;
+{ 0x224a, 3, "\xe2\x89\x8a" }, // &ape;
+{ 0x224b, 3, "\xe2\x89\x8b" }, // &apid;
+{ 0x27, 1, "\x27" }, // &apos;
+{ 0x2061, 3, "\xe2\x81\xa1" }, // &ApplyFunction;
+{ 0x2248, 3, "\xe2\x89\x88" }, // &approx;
+{ 0x224a, 3, "\xe2\x89\x8a" }, // &approxeq;
+{ 0xc5, 2, "\xc3\x85" }, // &Aring;
+{ 0xe5, 2, "\xc3\xa5" }, // &aring;
+{ 0x1d49c, 4, "\xf0\x9d\x92\x9c" }, // &Ascr;
+{ 0x1d4b6, 4, "\xf0\x9d\x92\xb6" }, // &ascr;
+{ 0x2254, 3, "\xe2\x89\x94" }, // &Assign;
+{ 0x2a, 1, "\x2a" }, // &ast;
+{ 0x2248, 3, "\xe2\x89\x88" }, // &asymp;
+{ 0x224d, 3, "\xe2\x89\x8d" }, // &asympeq;
+{ 0xc3, 2, "\xc3\x83" }, // &Atilde;
+{ 0xe3, 2, "\xc3\xa3" }, // &atilde;
+{ 0xc4, 2, "\xc3\x84" }, // &Auml;
+{ 0xe4, 2, "\xc3\xa4" }, // &auml;
+{ 0x2233, 3, "\xe2\x88\xb3" }, // &awconint;
+{ 0x2a11, 3, "\xe2\xa8\x91" }, // &awint;
+{ 0x224c, 3, "\xe2\x89\x8c" }, // &backcong;
+{ 0x3f6, 2, "\xcf\xb6" }, // &backepsilon;
+{ 0x2035, 3, "\xe2\x80\xb5" }, // &backprime;
+{ 0x223d, 3, "\xe2\x88\xbd" }, // &backsim;
+{ 0x22cd, 3, "\xe2\x8b\x8d" }, // &backsimeq;
+{ 0x2216, 3, "\xe2\x88\x96" }, // &Backslash;
+{ 0x2ae7, 3, "\xe2\xab\xa7" }, // &Barv;
+{ 0x22bd, 3, "\xe2\x8a\xbd" }, // &barvee;
+{ 0x2306, 3, "\xe2\x8c\x86" }, // &Barwed;
+{ 0x2305, 3, "\xe2\x8c\x85" }, // &barwed;
+{ 0x2305, 3, "\xe2\x8c\x85" }, // &barwedge;
+{ 0x23b5, 3, "\xe2\x8e\xb5" }, // &bbrk;
+{ 0x23b6, 3, "\xe2\x8e\xb6" }, // &bbrktbrk;
+{ 0x224c, 3, "\xe2\x89\x8c" }, // &bcong;
+{ 0x411, 2, "\xd0\x91" }, // &Bcy;
+{ 0x431, 2, "\xd0\xb1" }, // &bcy;
+{ 0x201e, 3, "\xe2\x80\x9e" }, // &bdquo;
+{ 0x2235, 3, "\xe2\x88\xb5" }, // &becaus;
+{ 0x2235, 3, "\xe2\x88\xb5" }, // &Because;
+{ 0x2235, 3, "\xe2\x88\xb5" }, // &because;
+{ 0x29b0, 3, "\xe2\xa6\xb0" }, // &bemptyv;
+{ 0x3f6, 2, "\xcf\xb6" }, // &bepsi;
+{ 0x212c, 3, "\xe2\x84\xac" }, // &bernou;
+{ 0x212c, 3, "\xe2\x84\xac" }, // &Bernoullis;
+{ 0x392, 2, "\xce\x92" }, // &Beta;
+{ 0x3b2, 2, "\xce\xb2" }, // &beta;
+{ 0x2136, 3, "\xe2\x84\xb6" }, // &beth;
+{ 0x226c, 3, "\xe2\x89\xac" }, // &between;
+{ 0x1d505, 4, "\xf0\x9d\x94\x85" }, // &Bfr;
+{ 0x1d51f, 4, "\xf0\x9d\x94\x9f" }, // &bfr;
+{ 0x22c2, 3, "\xe2\x8b\x82" }, // &bigcap;
+{ 0x25ef, 3, "\xe2\x97\xaf" }, // &bigcirc;
+{ 0x22c3, 3, "\xe2\x8b\x83" }, // &bigcup;
+{ 0x2a00, 3, "\xe2\xa8\x80" }, // &bigodot;
+{ 0x2a01, 3, "\xe2\xa8\x81" }, // &bigoplus;
+{ 0x2a02, 3, "\xe2\xa8\x82" }, // &bigotimes;
+{ 0x2a06, 3, "\xe2\xa8\x86" }, // &bigsqcup;
+{ 0x2605, 3, "\xe2\x98\x85" }, // &bigstar;
+{ 0x25bd, 3, "\xe2\x96\xbd" }, // &bigtriangledown;
+{ 0x25b3, 3, "\xe2\x96\xb3" }, // &bigtriangleup;
+{ 0x2a04, 3, "\xe2\xa8\x84" }, // &biguplus;
+{ 0x22c1, 3, "\xe2\x8b\x81" }, // &bigvee;
+{ 0x22c0, 3, "\xe2\x8b\x80" }, // &bigwedge;
+{ 0x290d, 3, "\xe2\xa4\x8d" }, // &bkarow;
+{ 0x29eb, 3, "\xe2\xa7\xab" }, // &blacklozenge;
+{ 0x25aa, 3, "\xe2\x96\xaa" }, // &blacksquare;
+{ 0x25b4, 3, "\xe2\x96\xb4" }, // &blacktriangle;
+{ 0x25be, 3, "\xe2\x96\xbe" }, // &blacktriangledown;
+{ 0x25c2, 3, "\xe2\x97\x82" }, // &blacktriangleleft;
+{ 0x25b8, 3, "\xe2\x96\xb8" }, // &blacktriangleright;
+{ 0x2423, 3, "\xe2\x90\xa3" }, // &blank;
+{ 0x2592, 3, "\xe2\x96\x92" }, // &blk12;
+{ 0x2591, 3, "\xe2\x96\x91" }, // &blk14;
+{ 0x2593, 3, "\xe2\x96\x93" }, // &blk34;
+{ 0x2588, 3, "\xe2\x96\x88" }, // &block;
+{ 0x3d, 4, "\x3d\xe2\x83\xa5" }, // &bne;
+{ 0x2261, 6, "\xe2\x89\xa1\xe2\x83\xa5" }, // &bnequiv;
+{ 0x2aed, 3, "\xe2\xab\xad" }, // &bNot;
+{ 0x2310, 3, "\xe2\x8c\x90" }, // &bnot;
+{ 0x1d539, 4, "\xf0\x9d\x94\xb9" }, // &Bopf;
+{ 0x1d553, 4, "\xf0\x9d\x95\x93" }, // &bopf;
+{ 0x22a5, 3, "\xe2\x8a\xa5" }, // &bot;
+{ 0x22a5, 3, "\xe2\x8a\xa5" }, // &bottom;
+{ 0x22c8, 3, "\xe2\x8b\x88" }, // &bowtie;
+{ 0x29c9, 3, "\xe2\xa7\x89" }, // &boxbox;
+{ 0x2557, 3, "\xe2\x95\x97" }, // &boxDL;
+{ 0x2556, 3, "\xe2\x95\x96" }, // &boxDl;
+{ 0x2555, 3, "\xe2\x95\x95" }, // &boxdL;
+{ 0x2510, 3, "\xe2\x94\x90" }, // &boxdl;
+{ 0x2554, 3, "\xe2\x95\x94" }, // &boxDR;
+{ 0x2553, 3, "\xe2\x95\x93" }, // &boxDr;
+{ 0x2552, 3, "\xe2\x95\x92" }, // &boxdR;
+{ 0x250c, 3, "\xe2\x94\x8c" }, // &boxdr;
+{ 0x2550, 3, "\xe2\x95\x90" }, // &boxH;
+{ 0x2500, 3, "\xe2\x94\x80" }, // &boxh;
+{ 0x2566, 3, "\xe2\x95\xa6" }, // &boxHD;
+{ 0x2564, 3, "\xe2\x95\xa4" }, // &boxHd;
+{ 0x2565, 3, "\xe2\x95\xa5" }, // &boxhD;
+{ 0x252c, 3, "\xe2\x94\xac" }, // &boxhd;
+{ 0x2569, 3, "\xe2\x95\xa9" }, // &boxHU;
+{ 0x2567, 3, "\xe2\x95\xa7" }, // &boxHu;
+{ 0x2568, 3, "\xe2\x95\xa8" }, // &boxhU;
+{ 0x2534, 3, "\xe2\x94\xb4" }, // &boxhu;
+{ 0x229f, 3, "\xe2\x8a\x9f" }, // &boxminus;
+{ 0x229e, 3, "\xe2\x8a\x9e" }, // &boxplus;
+{ 0x22a0, 3, "\xe2\x8a\xa0" }, // &boxtimes;
+{ 0x255d, 3, "\xe2\x95\x9d" }, // &boxUL;
+{ 0x255c, 3, "\xe2\x95\x9c" }, // &boxUl;
+{ 0x255b, 3, "\xe2\x95\x9b" }, // &boxuL;
+{ 0x2518, 3, "\xe2\x94\x98" }, // &boxul;
+{ 0x255a, 3, "\xe2\x95\x9a" }, // &boxUR;
+{ 0x2559, 3, "\xe2\x95\x99" }, // &boxUr;
+{ 0x2558, 3, "\xe2\x95\x98" }, // &boxuR;
+{ 0x2514, 3, "\xe2\x94\x94" }, // &boxur;
+{ 0x2551, 3, "\xe2\x95\x91" }, // &boxV;
+{ 0x2502, 3, "\xe2\x94\x82" }, // &boxv;
+{ 0x256c, 3, "\xe2\x95\xac" }, // &boxVH;
+{ 0x256b, 3, "\xe2\x95\xab" }, // &boxVh;
+{ 0x256a, 3, "\xe2\x95\xaa" }, // &boxvH;
+{ 0x253c, 3, "\xe2\x94\xbc" }, // &boxvh;
+{ 0x2563, 3, "\xe2\x95\xa3" }, // &boxVL;
+{ 0x2562, 3, "\xe2\x95\xa2" }, // &boxVl;
+{ 0x2561, 3, "\xe2\x95\xa1" }, // &boxvL;
+{ 0x2524, 3, "\xe2\x94\xa4" }, // &boxvl;
+{ 0x2560, 3, "\xe2\x95\xa0" }, // &boxVR;
+{ 0x255f, 3, "\xe2\x95\x9f" }, // &boxVr;
+{ 0x255e, 3, "\xe2\x95\x9e" }, // &boxvR;
+{ 0x251c, 3, "\xe2\x94\x9c" }, // &boxvr;
+{ 0x2035, 3, "\xe2\x80\xb5" }, // &bprime;
+{ 0x2d8, 2, "\xcb\x98" }, // &Breve;
+{ 0x2d8, 2, "\xcb\x98" }, // &breve;
+{ 0xa6, 2, "\xc2\xa6" }, // &brvbar;
+{ 0x212c, 3, "\xe2\x84\xac" }, // &Bscr;
+{ 0x1d4b7, 4, "\xf0\x9d\x92\xb7" }, // &bscr;
+{ 0x204f, 3, "\xe2\x81\x8f" }, // &bsemi;
+{ 0x223d, 3, "\xe2\x88\xbd" }, // &bsim;
+{ 0x22cd, 3, "\xe2\x8b\x8d" }, // &bsime;
+{ 0x5c, 1, "\x5c" }, // &bsol;
+{ 0x29c5, 3, "\xe2\xa7\x85" }, // &bsolb;
+{ 0x27c8, 3, "\xe2\x9f\x88" }, // &bsolhsub;
+{ 0x2022, 3, "\xe2\x80\xa2" }, // &bull;
+{ 0x2022, 3, "\xe2\x80\xa2" }, // &bullet;
+{ 0x224e, 3, "\xe2\x89\x8e" }, // &bump;
+{ 0x2aae, 3, "\xe2\xaa\xae" }, // &bumpE;
+{ 0x224f, 3, "\xe2\x89\x8f" }, // &bumpe;
+{ 0x224e, 3, "\xe2\x89\x8e" }, // &Bumpeq;
+{ 0x224f, 3, "\xe2\x89\x8f" }, // &bumpeq;
+{ 0x106, 2, "\xc4\x86" }, // &Cacute;
+{ 0x107, 2, "\xc4\x87" }, // &cacute;
+{ 0x22d2, 3, "\xe2\x8b\x92" }, // &Cap;
+{ 0x2229, 3, "\xe2\x88\xa9" }, // &cap;
+{ 0x2a44, 3, "\xe2\xa9\x84" }, // &capand;
+{ 0x2a49, 3, "\xe2\xa9\x89" }, // &capbrcup;
+{ 0x2a4b, 3, "\xe2\xa9\x8b" }, // &capcap;
+{ 0x2a47, 3, "\xe2\xa9\x87" }, // &capcup;
+{ 0x2a40, 3, "\xe2\xa9\x80" }, // &capdot;
+{ 0x2145, 3, "\xe2\x85\x85" }, // &CapitalDifferentialD;
+{ 0x2229, 6, "\xe2\x88\xa9\xef\xb8\x80" }, // &caps;
+{ 0x2041, 3, "\xe2\x81\x81" }, // &caret;
+{ 0x2c7, 2, "\xcb\x87" }, // &caron;
+{ 0x212d, 3, "\xe2\x84\xad" }, // &Cayleys;
+{ 0x2a4d, 3, "\xe2\xa9\x8d" }, // &ccaps;
+{ 0x10c, 2, "\xc4\x8c" }, // &Ccaron;
+{ 0x10d, 2, "\xc4\x8d" }, // &ccaron;
+{ 0xc7, 2, "\xc3\x87" }, // &Ccedil;
+{ 0xe7, 2, "\xc3\xa7" }, // &ccedil;
+{ 0x108, 2, "\xc4\x88" }, // &Ccirc;
+{ 0x109, 2, "\xc4\x89" }, // &ccirc;
+{ 0x2230, 3, "\xe2\x88\xb0" }, // &Cconint;
+{ 0x2a4c, 3, "\xe2\xa9\x8c" }, // &ccups;
+{ 0x2a50, 3, "\xe2\xa9\x90" }, // &ccupssm;
+{ 0x10a, 2, "\xc4\x8a" }, // &Cdot;
+{ 0x10b, 2, "\xc4\x8b" }, // &cdot;
+{ 0xb8, 2, "\xc2\xb8" }, // &cedil;
+{ 0xb8, 2, "\xc2\xb8" }, // &Cedilla;
+{ 0x29b2, 3, "\xe2\xa6\xb2" }, // &cemptyv;
+{ 0xa2, 2, "\xc2\xa2" }, // &cent;
+{ 0xb7, 2, "\xc2\xb7" }, // &CenterDot;
+{ 0xb7, 2, "\xc2\xb7" }, // &centerdot;
+{ 0x212d, 3, "\xe2\x84\xad" }, // &Cfr;
+{ 0x1d520, 4, "\xf0\x9d\x94\xa0" }, // &cfr;
+{ 0x427, 2, "\xd0\xa7" }, // &CHcy;
+{ 0x447, 2, "\xd1\x87" }, // &chcy;
+{ 0x2713, 3, "\xe2\x9c\x93" }, // &check;
+{ 0x2713, 3, "\xe2\x9c\x93" }, // &checkmark;
+{ 0x3a7, 2, "\xce\xa7" }, // &Chi;
+{ 0x3c7, 2, "\xcf\x87" }, // &chi;
+{ 0x25cb, 3, "\xe2\x97\x8b" }, // &cir;
+{ 0x2c6, 2, "\xcb\x86" }, // &circ;
+{ 0x2257, 3, "\xe2\x89\x97" }, // &circeq;
+{ 0x21ba, 3, "\xe2\x86\xba" }, // &circlearrowleft;
+{ 0x21bb, 3, "\xe2\x86\xbb" }, // &circlearrowright;
+{ 0x229b, 3, "\xe2\x8a\x9b" }, // &circledast;
+{ 0x229a, 3, "\xe2\x8a\x9a" }, // &circledcirc;
+{ 0x229d, 3, "\xe2\x8a\x9d" }, // &circleddash;
+{ 0x2299, 3, "\xe2\x8a\x99" }, // &CircleDot;
+{ 0xae, 2, "\xc2\xae" }, // &circledR;
+{ 0x24c8, 3, "\xe2\x93\x88" }, // &circledS;
+{ 0x2296, 3, "\xe2\x8a\x96" }, // &CircleMinus;
+{ 0x2295, 3, "\xe2\x8a\x95" }, // &CirclePlus;
+{ 0x2297, 3, "\xe2\x8a\x97" }, // &CircleTimes;
+{ 0x29c3, 3, "\xe2\xa7\x83" }, // &cirE;
+{ 0x2257, 3, "\xe2\x89\x97" }, // &cire;
+{ 0x2a10, 3, "\xe2\xa8\x90" }, // &cirfnint;
+{ 0x2aef, 3, "\xe2\xab\xaf" }, // &cirmid;
+{ 0x29c2, 3, "\xe2\xa7\x82" }, // &cirscir;
+{ 0x2232, 3, "\xe2\x88\xb2" }, // &ClockwiseContourIntegral;
+{ 0x201d, 3, "\xe2\x80\x9d" }, // &CloseCurlyDoubleQuote;
+{ 0x2019, 3, "\xe2\x80\x99" }, // &CloseCurlyQuote;
+{ 0x2663, 3, "\xe2\x99\xa3" }, // &clubs;
+{ 0x2663, 3, "\xe2\x99\xa3" }, // &clubsuit;
+{ 0x2237, 3, "\xe2\x88\xb7" }, // &Colon;
+{ 0x3a, 1, "\x3a" }, // &colon;
+{ 0x2a74, 3, "\xe2\xa9\xb4" }, // &Colone;
+{ 0x2254, 3, "\xe2\x89\x94" }, // &colone;
+{ 0x2254, 3, "\xe2\x89\x94" }, // &coloneq;
+{ 0x2c, 1, "\x2c" }, // &comma;
+{ 0x40, 1, "\x40" }, // &commat;
+{ 0x2201, 3, "\xe2\x88\x81" }, // &comp;
+{ 0x2218, 3, "\xe2\x88\x98" }, // &compfn;
+{ 0x2201, 3, "\xe2\x88\x81" }, // &complement;
+{ 0x2102, 3, "\xe2\x84\x82" }, // &complexes;
+{ 0x2245, 3, "\xe2\x89\x85" }, // &cong;
+{ 0x2a6d, 3, "\xe2\xa9\xad" }, // &congdot;
+{ 0x2261, 3, "\xe2\x89\xa1" }, // &Congruent;
+{ 0x222f, 3, "\xe2\x88\xaf" }, // &Conint;
+{ 0x222e, 3, "\xe2\x88\xae" }, // &conint;
+{ 0x222e, 3, "\xe2\x88\xae" }, // &ContourIntegral;
+{ 0x2102, 3, "\xe2\x84\x82" }, // &Copf;
+{ 0x1d554, 4, "\xf0\x9d\x95\x94" }, // &copf;
+{ 0x2210, 3, "\xe2\x88\x90" }, // &coprod;
+{ 0x2210, 3, "\xe2\x88\x90" }, // &Coproduct;
+{ 0xa9, 2, "\xc2\xa9" }, // &COPY;
+{ 0xa9, 2, "\xc2\xa9" }, // &copy;
+{ 0x2117, 3, "\xe2\x84\x97" }, // &copysr;
+{ 0x2233, 3, "\xe2\x88\xb3" }, // &CounterClockwiseContourIntegral;
+{ 0x21b5, 3, "\xe2\x86\xb5" }, // &crarr;
+{ 0x2a2f, 3, "\xe2\xa8\xaf" }, // &Cross;
+{ 0x2717, 3, "\xe2\x9c\x97" }, // &cross;
+{ 0x1d49e, 4, "\xf0\x9d\x92\x9e" }, // &Cscr;
+{ 0x1d4b8, 4, "\xf0\x9d\x92\xb8" }, // &cscr;
+{ 0x2acf, 3, "\xe2\xab\x8f" }, // &csub;
+{ 0x2ad1, 3, "\xe2\xab\x91" }, // &csube;
+{ 0x2ad0, 3, "\xe2\xab\x90" }, // &csup;
+{ 0x2ad2, 3, "\xe2\xab\x92" }, // &csupe;
+{ 0x22ef, 3, "\xe2\x8b\xaf" }, // &ctdot;
+{ 0x2938, 3, "\xe2\xa4\xb8" }, // &cudarrl;
+{ 0x2935, 3, "\xe2\xa4\xb5" }, // &cudarrr;
+{ 0x22de, 3, "\xe2\x8b\x9e" }, // &cuepr;
+{ 0x22df, 3, "\xe2\x8b\x9f" }, // &cuesc;
+{ 0x21b6, 3, "\xe2\x86\xb6" }, // &cularr;
+{ 0x293d, 3, "\xe2\xa4\xbd" }, // &cularrp;
+{ 0x22d3, 3, "\xe2\x8b\x93" }, // &Cup;
+{ 0x222a, 3, "\xe2\x88\xaa" }, // &cup;
+{ 0x2a48, 3, "\xe2\xa9\x88" }, // &cupbrcap;
+{ 0x224d, 3, "\xe2\x89\x8d" }, // &CupCap;
+{ 0x2a46, 3, "\xe2\xa9\x86" }, // &cupcap;
+{ 0x2a4a, 3, "\xe2\xa9\x8a" }, // &cupcup;
+{ 0x228d, 3, "\xe2\x8a\x8d" }, // &cupdot;
+{ 0x2a45, 3, "\xe2\xa9\x85" }, // &cupor;
+{ 0x222a, 6, "\xe2\x88\xaa\xef\xb8\x80" }, // &cups;
+{ 0x21b7, 3, "\xe2\x86\xb7" }, // &curarr;
+{ 0x293c, 3, "\xe2\xa4\xbc" }, // &curarrm;
+{ 0x22de, 3, "\xe2\x8b\x9e" }, // &curlyeqprec;
+{ 0x22df, 3, "\xe2\x8b\x9f" }, // &curlyeqsucc;
+{ 0x22ce, 3, "\xe2\x8b\x8e" }, // &curlyvee;
+{ 0x22cf, 3, "\xe2\x8b\x8f" }, // &curlywedge;
+{ 0xa4, 2, "\xc2\xa4" }, // &curren;
+{ 0x21b6, 3, "\xe2\x86\xb6" }, // &curvearrowleft;
+{ 0x21b7, 3, "\xe2\x86\xb7" }, // &curvearrowright;
+{ 0x22ce, 3, "\xe2\x8b\x8e" }, // &cuvee;
+{ 0x22cf, 3, "\xe2\x8b\x8f" }, // &cuwed;
+{ 0x2232, 3, "\xe2\x88\xb2" }, // &cwconint;
+{ 0x2231, 3, "\xe2\x88\xb1" }, // &cwint;
+{ 0x232d, 3, "\xe2\x8c\xad" }, // &cylcty;
+{ 0x2021, 3, "\xe2\x80\xa1" }, // &Dagger;
+{ 0x2020, 3, "\xe2\x80\xa0" }, // &dagger;
+{ 0x2138, 3, "\xe2\x84\xb8" }, // &daleth;
+{ 0x21a1, 3, "\xe2\x86\xa1" }, // &Darr;
+{ 0x21d3, 3, "\xe2\x87\x93" }, // &dArr;
+{ 0x2193, 3, "\xe2\x86\x93" }, // &darr;
+{ 0x2010, 3, "\xe2\x80\x90" }, // &dash;
+{ 0x2ae4, 3, "\xe2\xab\xa4" }, // &Dashv;
+{ 0x22a3, 3, "\xe2\x8a\xa3" }, // &dashv;
+{ 0x290f, 3, "\xe2\xa4\x8f" }, // &dbkarow;
+{ 0x2dd, 2, "\xcb\x9d" }, // &dblac;
+{ 0x10e, 2, "\xc4\x8e" }, // &Dcaron;
+{ 0x10f, 2, "\xc4\x8f" }, // &dcaron;
+{ 0x414, 2, "\xd0\x94" }, // &Dcy;
+{ 0x434, 2, "\xd0\xb4" }, // &dcy;
+{ 0x2145, 3, "\xe2\x85\x85" }, // &DD;
+{ 0x2146, 3, "\xe2\x85\x86" }, // &dd;
+{ 0x2021, 3, "\xe2\x80\xa1" }, // &ddagger;
+{ 0x21ca, 3, "\xe2\x87\x8a" }, // &ddarr;
+{ 0x2911, 3, "\xe2\xa4\x91" }, // &DDotrahd;
+{ 0x2a77, 3, "\xe2\xa9\xb7" }, // &ddotseq;
+{ 0xb0, 2, "\xc2\xb0" }, // &deg;
+{ 0x2207, 3, "\xe2\x88\x87" }, // &Del;
+{ 0x394, 2, "\xce\x94" }, // &Delta;
+{ 0x3b4, 2, "\xce\xb4" }, // &delta;
+{ 0x29b1, 3, "\xe2\xa6\xb1" }, // &demptyv;
+{ 0x297f, 3, "\xe2\xa5\xbf" }, // &dfisht;
+{ 0x1d507, 4, "\xf0\x9d\x94\x87" }, // &Dfr;
+{ 0x1d521, 4, "\xf0\x9d\x94\xa1" }, // &dfr;
+{ 0x2965, 3, "\xe2\xa5\xa5" }, // &dHar;
+{ 0x21c3, 3, "\xe2\x87\x83" }, // &dharl;
+{ 0x21c2, 3, "\xe2\x87\x82" }, // &dharr;
+{ 0xb4, 2, "\xc2\xb4" }, // &DiacriticalAcute;
+{ 0x2d9, 2, "\xcb\x99" }, // &DiacriticalDot;
+{ 0x2dd, 2, "\xcb\x9d" }, // &DiacriticalDoubleAcute;
+{ 0x60, 1, "\x60" }, // &DiacriticalGrave;
+{ 0x2dc, 2, "\xcb\x9c" }, // &DiacriticalTilde;
+{ 0x22c4, 3, "\xe2\x8b\x84" }, // &diam;
+{ 0x22c4, 3, "\xe2\x8b\x84" }, // &Diamond;
+{ 0x22c4, 3, "\xe2\x8b\x84" }, // &diamond;
+{ 0x2666, 3, "\xe2\x99\xa6" }, // &diamondsuit;
+{ 0x2666, 3, "\xe2\x99\xa6" }, // &diams;
+{ 0xa8, 2, "\xc2\xa8" }, // &die;
+{ 0x2146, 3, "\xe2\x85\x86" }, // &DifferentialD;
+{ 0x3dd, 2, "\xcf\x9d" }, // &digamma;
+{ 0x22f2, 3, "\xe2\x8b\xb2" }, // &disin;
+{ 0xf7, 2, "\xc3\xb7" }, // &div;
+{ 0xf7, 2, "\xc3\xb7" }, // &divide;
+{ 0x22c7, 3, "\xe2\x8b\x87" }, // &divideontimes;
+{ 0x22c7, 3, "\xe2\x8b\x87" }, // &divonx;
+{ 0x402, 2, "\xd0\x82" }, // &DJcy;
+{ 0x452, 2, "\xd1\x92" }, // &djcy;
+{ 0x231e, 3, "\xe2\x8c\x9e" }, // &dlcorn;
+{ 0x230d, 3, "\xe2\x8c\x8d" }, // &dlcrop;
+{ 0x24, 1, "\x24" }, // &dollar;
+{ 0x1d53b, 4, "\xf0\x9d\x94\xbb" }, // &Dopf;
+{ 0x1d555, 4, "\xf0\x9d\x95\x95" }, // &dopf;
+{ 0xa8, 2, "\xc2\xa8" }, // &Dot;
+{ 0x2d9, 2, "\xcb\x99" }, // &dot;
+{ 0x20dc, 3, "\xe2\x83\x9c" }, // &DotDot;
+{ 0x2250, 3, "\xe2\x89\x90" }, // &doteq;
+{ 0x2251, 3, "\xe2\x89\x91" }, // &doteqdot;
+{ 0x2250, 3, "\xe2\x89\x90" }, // &DotEqual;
+{ 0x2238, 3, "\xe2\x88\xb8" }, // &dotminus;
+{ 0x2214, 3, "\xe2\x88\x94" }, // &dotplus;
+{ 0x22a1, 3, "\xe2\x8a\xa1" }, // &dotsquare;
+{ 0x2306, 3, "\xe2\x8c\x86" }, // &doublebarwedge;
+{ 0x222f, 3, "\xe2\x88\xaf" }, // &DoubleContourIntegral;
+{ 0xa8, 2, "\xc2\xa8" }, // &DoubleDot;
+{ 0x21d3, 3, "\xe2\x87\x93" }, // &DoubleDownArrow;
+{ 0x21d0, 3, "\xe2\x87\x90" }, // &DoubleLeftArrow;
+{ 0x21d4, 3, "\xe2\x87\x94" }, // &DoubleLeftRightArrow;
+{ 0x2ae4, 3, "\xe2\xab\xa4" }, // &DoubleLeftTee;
+{ 0x27f8, 3, "\xe2\x9f\xb8" }, // &DoubleLongLeftArrow;
+{ 0x27fa, 3, "\xe2\x9f\xba" }, // &DoubleLongLeftRightArrow;
+{ 0x27f9, 3, "\xe2\x9f\xb9" }, // &DoubleLongRightArrow;
+{ 0x21d2, 3, "\xe2\x87\x92" }, // &DoubleRightArrow;
+{ 0x22a8, 3, "\xe2\x8a\xa8" }, // &DoubleRightTee;
+{ 0x21d1, 3, "\xe2\x87\x91" }, // &DoubleUpArrow;
+{ 0x21d5, 3, "\xe2\x87\x95" }, // &DoubleUpDownArrow;
+{ 0x2225, 3, "\xe2\x88\xa5" }, // &DoubleVerticalBar;
+{ 0x2193, 3, "\xe2\x86\x93" }, // &DownArrow;
+{ 0x21d3, 3, "\xe2\x87\x93" }, // &Downarrow;
+{ 0x2193, 3, "\xe2\x86\x93" }, // &downarrow;
+{ 0x2913, 3, "\xe2\xa4\x93" }, // &DownArrowBar;
+{ 0x21f5, 3, "\xe2\x87\xb5" }, // &DownArrowUpArrow;
+{ 0x311, 2, "\xcc\x91" }, // &DownBreve;
+{ 0x21ca, 3, "\xe2\x87\x8a" }, // &downdownarrows;
+{ 0x21c3, 3, "\xe2\x87\x83" }, // &downharpoonleft;
+{ 0x21c2, 3, "\xe2\x87\x82" }, // &downharpoonright;
+{ 0x2950, 3, "\xe2\xa5\x90" }, // &DownLeftRightVector;
+{ 0x295e, 3, "\xe2\xa5\x9e" }, // &DownLeftTeeVector;
+{ 0x21bd, 3, "\xe2\x86\xbd" }, // &DownLeftVector;
+{ 0x2956, 3, "\xe2\xa5\x96" }, // &DownLeftVectorBar;
+{ 0x295f, 3, "\xe2\xa5\x9f" }, // &DownRightTeeVector;
+{ 0x21c1, 3, "\xe2\x87\x81" }, // &DownRightVector;
+{ 0x2957, 3, "\xe2\xa5\x97" }, // &DownRightVectorBar;
+{ 0x22a4, 3, "\xe2\x8a\xa4" }, // &DownTee;
+{ 0x21a7, 3, "\xe2\x86\xa7" }, // &DownTeeArrow;
+{ 0x2910, 3, "\xe2\xa4\x90" }, // &drbkarow;
+{ 0x231f, 3, "\xe2\x8c\x9f" }, // &drcorn;
+{ 0x230c, 3, "\xe2\x8c\x8c" }, // &drcrop;
+{ 0x1d49f, 4, "\xf0\x9d\x92\x9f" }, // &Dscr;
+{ 0x1d4b9, 4, "\xf0\x9d\x92\xb9" }, // &dscr;
+{ 0x405, 2, "\xd0\x85" }, // &DScy;
+{ 0x455, 2, "\xd1\x95" }, // &dscy;
+{ 0x29f6, 3, "\xe2\xa7\xb6" }, // &dsol;
+{ 0x110, 2, "\xc4\x90" }, // &Dstrok;
+{ 0x111, 2, "\xc4\x91" }, // &dstrok;
+{ 0x22f1, 3, "\xe2\x8b\xb1" }, // &dtdot;
+{ 0x25bf, 3, "\xe2\x96\xbf" }, // &dtri;
+{ 0x25be, 3, "\xe2\x96\xbe" }, // &dtrif;
+{ 0x21f5, 3, "\xe2\x87\xb5" }, // &duarr;
+{ 0x296f, 3, "\xe2\xa5\xaf" }, // &duhar;
+{ 0x29a6, 3, "\xe2\xa6\xa6" }, // &dwangle;
+{ 0x40f, 2, "\xd0\x8f" }, // &DZcy;
+{ 0x45f, 2, "\xd1\x9f" }, // &dzcy;
+{ 0x27ff, 3, "\xe2\x9f\xbf" }, // &dzigrarr;
+{ 0xc9, 2, "\xc3\x89" }, // &Eacute;
+{ 0xe9, 2, "\xc3\xa9" }, // &eacute;
+{ 0x2a6e, 3, "\xe2\xa9\xae" }, // &easter;
+{ 0x11a, 2, "\xc4\x9a" }, // &Ecaron;
+{ 0x11b, 2, "\xc4\x9b" }, // &ecaron;
+{ 0x2256, 3, "\xe2\x89\x96" }, // &ecir;
+{ 0xca, 2, "\xc3\x8a" }, // &Ecirc;
+{ 0xea, 2, "\xc3\xaa" }, // &ecirc;
+{ 0x2255, 3, "\xe2\x89\x95" }, // &ecolon;
+{ 0x42d, 2, "\xd0\xad" }, // &Ecy;
+{ 0x44d, 2, "\xd1\x8d" }, // &ecy;
+{ 0x2a77, 3, "\xe2\xa9\xb7" }, // &eDDot;
+{ 0x116, 2, "\xc4\x96" }, // &Edot;
+{ 0x2251, 3, "\xe2\x89\x91" }, // &eDot;
+{ 0x117, 2, "\xc4\x97" }, // &edot;
+{ 0x2147, 3, "\xe2\x85\x87" }, // &ee;
+{ 0x2252, 3, "\xe2\x89\x92" }, // &efDot;
+{ 0x1d508, 4, "\xf0\x9d\x94\x88" }, // &Efr;
+{ 0x1d522, 4, "\xf0\x9d\x94\xa2" }, // &efr;
+{ 0x2a9a, 3, "\xe2\xaa\x9a" }, // &eg;
+{ 0xc8, 2, "\xc3\x88" }, // &Egrave;
+{ 0xe8, 2, "\xc3\xa8" }, // &egrave;
+{ 0x2a96, 3, "\xe2\xaa\x96" }, // &egs;
+{ 0x2a98, 3, "\xe2\xaa\x98" }, // &egsdot;
+{ 0x2a99, 3, "\xe2\xaa\x99" }, // &el;
+{ 0x2208, 3, "\xe2\x88\x88" }, // &Element;
+{ 0x23e7, 3, "\xe2\x8f\xa7" }, // &elinters;
+{ 0x2113, 3, "\xe2\x84\x93" }, // &ell;
+{ 0x2a95, 3, "\xe2\xaa\x95" }, // &els;
+{ 0x2a97, 3, "\xe2\xaa\x97" }, // &elsdot;
+{ 0x112, 2, "\xc4\x92" }, // &Emacr;
+{ 0x113, 2, "\xc4\x93" }, // &emacr;
+{ 0x2205, 3, "\xe2\x88\x85" }, // &empty;
+{ 0x2205, 3, "\xe2\x88\x85" }, // &emptyset;
+{ 0x25fb, 3, "\xe2\x97\xbb" }, // &EmptySmallSquare;
+{ 0x2205, 3, "\xe2\x88\x85" }, // &emptyv;
+{ 0x25ab, 3, "\xe2\x96\xab" }, // &EmptyVerySmallSquare;
+{ 0x2003, 3, "\xe2\x80\x83" }, // &emsp;
+{ 0x2004, 3, "\xe2\x80\x84" }, // &emsp13;
+{ 0x2005, 3, "\xe2\x80\x85" }, // &emsp14;
+{ 0x14a, 2, "\xc5\x8a" }, // &ENG;
+{ 0x14b, 2, "\xc5\x8b" }, // &eng;
+{ 0x2002, 3, "\xe2\x80\x82" }, // &ensp;
+{ 0x118, 2, "\xc4\x98" }, // &Eogon;
+{ 0x119, 2, "\xc4\x99" }, // &eogon;
+{ 0x1d53c, 4, "\xf0\x9d\x94\xbc" }, // &Eopf;
+{ 0x1d556, 4, "\xf0\x9d\x95\x96" }, // &eopf;
+{ 0x22d5, 3, "\xe2\x8b\x95" }, // &epar;
+{ 0x29e3, 3, "\xe2\xa7\xa3" }, // &eparsl;
+{ 0x2a71, 3, "\xe2\xa9\xb1" }, // &eplus;
+{ 0x3b5, 2, "\xce\xb5" }, // &epsi;
+{ 0x395, 2, "\xce\x95" }, // &Epsilon;
+{ 0x3b5, 2, "\xce\xb5" }, // &epsilon;
+{ 0x3f5, 2, "\xcf\xb5" }, // &epsiv;
+{ 0x2256, 3, "\xe2\x89\x96" }, // &eqcirc;
+{ 0x2255, 3, "\xe2\x89\x95" }, // &eqcolon;
+{ 0x2242, 3, "\xe2\x89\x82" }, // &eqsim;
+{ 0x2a96, 3, "\xe2\xaa\x96" }, // &eqslantgtr;
+{ 0x2a95, 3, "\xe2\xaa\x95" }, // &eqslantless;
+{ 0x2a75, 3, "\xe2\xa9\xb5" }, // &Equal;
+{ 0x3d, 1, "\x3d" }, // &equals;
+{ 0x2242, 3, "\xe2\x89\x82" }, // &EqualTilde;
+{ 0x225f, 3, "\xe2\x89\x9f" }, // &equest;
+{ 0x21cc, 3, "\xe2\x87\x8c" }, // &Equilibrium;
+{ 0x2261, 3, "\xe2\x89\xa1" }, // &equiv;
+{ 0x2a78, 3, "\xe2\xa9\xb8" }, // &equivDD;
+{ 0x29e5, 3, "\xe2\xa7\xa5" }, // &eqvparsl;
+{ 0x2971, 3, "\xe2\xa5\xb1" }, // &erarr;
+{ 0x2253, 3, "\xe2\x89\x93" }, // &erDot;
+{ 0x2130, 3, "\xe2\x84\xb0" }, // &Escr;
+{ 0x212f, 3, "\xe2\x84\xaf" }, // &escr;
+{ 0x2250, 3, "\xe2\x89\x90" }, // &esdot;
+{ 0x2a73, 3, "\xe2\xa9\xb3" }, // &Esim;
+{ 0x2242, 3, "\xe2\x89\x82" }, // &esim;
+{ 0x397, 2, "\xce\x97" }, // &Eta;
+{ 0x3b7, 2, "\xce\xb7" }, // &eta;
+{ 0xd0, 2, "\xc3\x90" }, // &ETH;
+{ 0xf0, 2, "\xc3\xb0" }, // &eth;
+{ 0xcb, 2, "\xc3\x8b" }, // &Euml;
+{ 0xeb, 2, "\xc3\xab" }, // &euml;
+{ 0x20ac, 3, "\xe2\x82\xac" }, // &euro;
+{ 0x21, 1, "\x21" }, // &excl;
+{ 0x2203, 3, "\xe2\x88\x83" }, // &exist;
+{ 0x2203, 3, "\xe2\x88\x83" }, // &Exists;
+{ 0x2130, 3, "\xe2\x84\xb0" }, // &expectation;
+{ 0x2147, 3, "\xe2\x85\x87" }, // &ExponentialE;
+{ 0x2147, 3, "\xe2\x85\x87" }, // &exponentiale;
+{ 0x2252, 3, "\xe2\x89\x92" }, // &fallingdotseq;
+{ 0x424, 2, "\xd0\xa4" }, // &Fcy;
+{ 0x444, 2, "\xd1\x84" }, // &fcy;
+{ 0x2640, 3, "\xe2\x99\x80" }, // &female;
+{ 0xfb03, 3, "\xef\xac\x83" }, // &ffilig;
+{ 0xfb00, 3, "\xef\xac\x80" }, // &fflig;
+{ 0xfb04, 3, "\xef\xac\x84" }, // &ffllig;
+{ 0x1d509, 4, "\xf0\x9d\x94\x89" }, // &Ffr;
+{ 0x1d523, 4, "\xf0\x9d\x94\xa3" }, // &ffr;
+{ 0xfb01, 3, "\xef\xac\x81" }, // &filig;
+{ 0x25fc, 3, "\xe2\x97\xbc" }, // &FilledSmallSquare;
+{ 0x25aa, 3, "\xe2\x96\xaa" }, // &FilledVerySmallSquare;
+{ 0x66, 2, "\x66\x6a" }, // &fjlig;
+{ 0x266d, 3, "\xe2\x99\xad" }, // &flat;
+{ 0xfb02, 3, "\xef\xac\x82" }, // &fllig;
+{ 0x25b1, 3, "\xe2\x96\xb1" }, // &fltns;
+{ 0x192, 2, "\xc6\x92" }, // &fnof;
+{ 0x1d53d, 4, "\xf0\x9d\x94\xbd" }, // &Fopf;
+{ 0x1d557, 4, "\xf0\x9d\x95\x97" }, // &fopf;
+{ 0x2200, 3, "\xe2\x88\x80" }, // &ForAll;
+{ 0x2200, 3, "\xe2\x88\x80" }, // &forall;
+{ 0x22d4, 3, "\xe2\x8b\x94" }, // &fork;
+{ 0x2ad9, 3, "\xe2\xab\x99" }, // &forkv;
+{ 0x2131, 3, "\xe2\x84\xb1" }, // &Fouriertrf;
+{ 0x2a0d, 3, "\xe2\xa8\x8d" }, // &fpartint;
+{ 0xbd, 2, "\xc2\xbd" }, // &frac12;
+{ 0x2153, 3, "\xe2\x85\x93" }, // &frac13;
+{ 0xbc, 2, "\xc2\xbc" }, // &frac14;
+{ 0x2155, 3, "\xe2\x85\x95" }, // &frac15;
+{ 0x2159, 3, "\xe2\x85\x99" }, // &frac16;
+{ 0x215b, 3, "\xe2\x85\x9b" }, // &frac18;
+{ 0x2154, 3, "\xe2\x85\x94" }, // &frac23;
+{ 0x2156, 3, "\xe2\x85\x96" }, // &frac25;
+{ 0xbe, 2, "\xc2\xbe" }, // &frac34;
+{ 0x2157, 3, "\xe2\x85\x97" }, // &frac35;
+{ 0x215c, 3, "\xe2\x85\x9c" }, // &frac38;
+{ 0x2158, 3, "\xe2\x85\x98" }, // &frac45;
+{ 0x215a, 3, "\xe2\x85\x9a" }, // &frac56;
+{ 0x215d, 3, "\xe2\x85\x9d" }, // &frac58;
+{ 0x215e, 3, "\xe2\x85\x9e" }, // &frac78;
+{ 0x2044, 3, "\xe2\x81\x84" }, // &frasl;
+{ 0x2322, 3, "\xe2\x8c\xa2" }, // &frown;
+{ 0x2131, 3, "\xe2\x84\xb1" }, // &Fscr;
+{ 0x1d4bb, 4, "\xf0\x9d\x92\xbb" }, // &fscr;
+{ 0x1f5, 2, "\xc7\xb5" }, // &gacute;
+{ 0x393, 2, "\xce\x93" }, // &Gamma;
+{ 0x3b3, 2, "\xce\xb3" }, // &gamma;
+{ 0x3dc, 2, "\xcf\x9c" }, // &Gammad;
+{ 0x3dd, 2, "\xcf\x9d" }, // &gammad;
+{ 0x2a86, 3, "\xe2\xaa\x86" }, // &gap;
+{ 0x11e, 2, "\xc4\x9e" }, // &Gbreve;
+{ 0x11f, 2, "\xc4\x9f" }, // &gbreve;
+{ 0x122, 2, "\xc4\xa2" }, // &Gcedil;
+{ 0x11c, 2, "\xc4\x9c" }, // &Gcirc;
+{ 0x11d, 2, "\xc4\x9d" }, // &gcirc;
+{ 0x413, 2, "\xd0\x93" }, // &Gcy;
+{ 0x433, 2, "\xd0\xb3" }, // &gcy;
+{ 0x120, 2, "\xc4\xa0" }, // &Gdot;
+{ 0x121, 2, "\xc4\xa1" }, // &gdot;
+{ 0x2267, 3, "\xe2\x89\xa7" }, // &gE;
+{ 0x2265, 3, "\xe2\x89\xa5" }, // &ge;
+{ 0x2a8c, 3, "\xe2\xaa\x8c" }, // &gEl;
+{ 0x22db, 3, "\xe2\x8b\x9b" }, // &gel;
+{ 0x2265, 3, "\xe2\x89\xa5" }, // &geq;
+{ 0x2267, 3, "\xe2\x89\xa7" }, // &geqq;
+{ 0x2a7e, 3, "\xe2\xa9\xbe" }, // &geqslant;
+{ 0x2a7e, 3, "\xe2\xa9\xbe" }, // &ges;
+{ 0x2aa9, 3, "\xe2\xaa\xa9" }, // &gescc;
+{ 0x2a80, 3, "\xe2\xaa\x80" }, // &gesdot;
+{ 0x2a82, 3, "\xe2\xaa\x82" }, // &gesdoto;
+{ 0x2a84, 3, "\xe2\xaa\x84" }, // &gesdotol;
+{ 0x22db, 6, "\xe2\x8b\x9b\xef\xb8\x80" }, // &gesl;
+{ 0x2a94, 3, "\xe2\xaa\x94" }, // &gesles;
+{ 0x1d50a, 4, "\xf0\x9d\x94\x8a" }, // &Gfr;
+{ 0x1d524, 4, "\xf0\x9d\x94\xa4" }, // &gfr;
+{ 0x22d9, 3, "\xe2\x8b\x99" }, // &Gg;
+{ 0x226b, 3, "\xe2\x89\xab" }, // &gg;
+{ 0x22d9, 3, "\xe2\x8b\x99" }, // &ggg;
+{ 0x2137, 3, "\xe2\x84\xb7" }, // &gimel;
+{ 0x403, 2, "\xd0\x83" }, // &GJcy;
+{ 0x453, 2, "\xd1\x93" }, // &gjcy;
+{ 0x2277, 3, "\xe2\x89\xb7" }, // &gl;
+{ 0x2aa5, 3, "\xe2\xaa\xa5" }, // &gla;
+{ 0x2a92, 3, "\xe2\xaa\x92" }, // &glE;
+{ 0x2aa4, 3, "\xe2\xaa\xa4" }, // &glj;
+{ 0x2a8a, 3, "\xe2\xaa\x8a" }, // &gnap;
+{ 0x2a8a, 3, "\xe2\xaa\x8a" }, // &gnapprox;
+{ 0x2269, 3, "\xe2\x89\xa9" }, // &gnE;
+{ 0x2a88, 3, "\xe2\xaa\x88" }, // &gne;
+{ 0x2a88, 3, "\xe2\xaa\x88" }, // &gneq;
+{ 0x2269, 3, "\xe2\x89\xa9" }, // &gneqq;
+{ 0x22e7, 3, "\xe2\x8b\xa7" }, // &gnsim;
+{ 0x1d53e, 4, "\xf0\x9d\x94\xbe" }, // &Gopf;
+{ 0x1d558, 4, "\xf0\x9d\x95\x98" }, // &gopf;
+{ 0x60, 1, "\x60" }, // &grave;
+{ 0x2265, 3, "\xe2\x89\xa5" }, // &GreaterEqual;
+{ 0x22db, 3, "\xe2\x8b\x9b" }, // &GreaterEqualLess;
+{ 0x2267, 3, "\xe2\x89\xa7" }, // &GreaterFullEqual;
+{ 0x2aa2, 3, "\xe2\xaa\xa2" }, // &GreaterGreater;
+{ 0x2277, 3, "\xe2\x89\xb7" }, // &GreaterLess;
+{ 0x2a7e, 3, "\xe2\xa9\xbe" }, // &GreaterSlantEqual;
+{ 0x2273, 3, "\xe2\x89\xb3" }, // &GreaterTilde;
+{ 0x1d4a2, 4, "\xf0\x9d\x92\xa2" }, // &Gscr;
+{ 0x210a, 3, "\xe2\x84\x8a" }, // &gscr;
+{ 0x2273, 3, "\xe2\x89\xb3" }, // &gsim;
+{ 0x2a8e, 3, "\xe2\xaa\x8e" }, // &gsime;
+{ 0x2a90, 3, "\xe2\xaa\x90" }, // &gsiml;
+{ 0x3e, 1, "\x3e" }, // &GT;
+{ 0x226b, 3, "\xe2\x89\xab" }, // &Gt;
+{ 0x3e, 1, "\x3e" }, // &gt;
+{ 0x2aa7, 3, "\xe2\xaa\xa7" }, // &gtcc;
+{ 0x2a7a, 3, "\xe2\xa9\xba" }, // &gtcir;
+{ 0x22d7, 3, "\xe2\x8b\x97" }, // &gtdot;
+{ 0x2995, 3, "\xe2\xa6\x95" }, // &gtlPar;
+{ 0x2a7c, 3, "\xe2\xa9\xbc" }, // &gtquest;
+{ 0x2a86, 3, "\xe2\xaa\x86" }, // &gtrapprox;
+{ 0x2978, 3, "\xe2\xa5\xb8" }, // &gtrarr;
+{ 0x22d7, 3, "\xe2\x8b\x97" }, // &gtrdot;
+{ 0x22db, 3, "\xe2\x8b\x9b" }, // &gtreqless;
+{ 0x2a8c, 3, "\xe2\xaa\x8c" }, // &gtreqqless;
+{ 0x2277, 3, "\xe2\x89\xb7" }, // &gtrless;
+{ 0x2273, 3, "\xe2\x89\xb3" }, // &gtrsim;
+{ 0x2269, 6, "\xe2\x89\xa9\xef\xb8\x80" }, // &gvertneqq;
+{ 0x2269, 6, "\xe2\x89\xa9\xef\xb8\x80" }, // &gvnE;
+{ 0x2c7, 2, "\xcb\x87" }, // &Hacek;
+{ 0x200a, 3, "\xe2\x80\x8a" }, // &hairsp;
+{ 0xbd, 2, "\xc2\xbd" }, // &half;
+{ 0x210b, 3, "\xe2\x84\x8b" }, // &hamilt;
+{ 0x42a, 2, "\xd0\xaa" }, // &HARDcy;
+{ 0x44a, 2, "\xd1\x8a" }, // &hardcy;
+{ 0x21d4, 3, "\xe2\x87\x94" }, // &hArr;
+{ 0x2194, 3, "\xe2\x86\x94" }, // &harr;
+{ 0x2948, 3, "\xe2\xa5\x88" }, // &harrcir;
+{ 0x21ad, 3, "\xe2\x86\xad" }, // &harrw;
+{ 0x5e, 1, "\x5e" }, // &Hat;
+{ 0x210f, 3, "\xe2\x84\x8f" }, // &hbar;
+{ 0x124, 2, "\xc4\xa4" }, // &Hcirc;
+{ 0x125, 2, "\xc4\xa5" }, // &hcirc;
+{ 0x2665, 3, "\xe2\x99\xa5" }, // &hearts;
+{ 0x2665, 3, "\xe2\x99\xa5" }, // &heartsuit;
+{ 0x2026, 3, "\xe2\x80\xa6" }, // &hellip;
+{ 0x22b9, 3, "\xe2\x8a\xb9" }, // &hercon;
+{ 0x210c, 3, "\xe2\x84\x8c" }, // &Hfr;
+{ 0x1d525, 4, "\xf0\x9d\x94\xa5" }, // &hfr;
+{ 0x210b, 3, "\xe2\x84\x8b" }, // &HilbertSpace;
+{ 0x2925, 3, "\xe2\xa4\xa5" }, // &hksearow;
+{ 0x2926, 3, "\xe2\xa4\xa6" }, // &hkswarow;
+{ 0x21ff, 3, "\xe2\x87\xbf" }, // &hoarr;
+{ 0x223b, 3, "\xe2\x88\xbb" }, // &homtht;
+{ 0x21a9, 3, "\xe2\x86\xa9" }, // &hookleftarrow;
+{ 0x21aa, 3, "\xe2\x86\xaa" }, // &hookrightarrow;
+{ 0x210d, 3, "\xe2\x84\x8d" }, // &Hopf;
+{ 0x1d559, 4, "\xf0\x9d\x95\x99" }, // &hopf;
+{ 0x2015, 3, "\xe2\x80\x95" }, // &horbar;
+{ 0x2500, 3, "\xe2\x94\x80" }, // &HorizontalLine;
+{ 0x210b, 3, "\xe2\x84\x8b" }, // &Hscr;
+{ 0x1d4bd, 4, "\xf0\x9d\x92\xbd" }, // &hscr;
+{ 0x210f, 3, "\xe2\x84\x8f" }, // &hslash;
+{ 0x126, 2, "\xc4\xa6" }, // &Hstrok;
+{ 0x127, 2, "\xc4\xa7" }, // &hstrok;
+{ 0x224e, 3, "\xe2\x89\x8e" }, // &HumpDownHump;
+{ 0x224f, 3, "\xe2\x89\x8f" }, // &HumpEqual;
+{ 0x2043, 3, "\xe2\x81\x83" }, // &hybull;
+{ 0x2010, 3, "\xe2\x80\x90" }, // &hyphen;
+{ 0xcd, 2, "\xc3\x8d" }, // &Iacute;
+{ 0xed, 2, "\xc3\xad" }, // &iacute;
+{ 0x2063, 3, "\xe2\x81\xa3" }, // &ic;
+{ 0xce, 2, "\xc3\x8e" }, // &Icirc;
+{ 0xee, 2, "\xc3\xae" }, // &icirc;
+{ 0x418, 2, "\xd0\x98" }, // &Icy;
+{ 0x438, 2, "\xd0\xb8" }, // &icy;
+{ 0x130, 2, "\xc4\xb0" }, // &Idot;
+{ 0x415, 2, "\xd0\x95" }, // &IEcy;
+{ 0x435, 2, "\xd0\xb5" }, // &iecy;
+{ 0xa1, 2, "\xc2\xa1" }, // &iexcl;
+{ 0x21d4, 3, "\xe2\x87\x94" }, // &iff;
+{ 0x2111, 3, "\xe2\x84\x91" }, // &Ifr;
+{ 0x1d526, 4, "\xf0\x9d\x94\xa6" }, // &ifr;
+{ 0xcc, 2, "\xc3\x8c" }, // &Igrave;
+{ 0xec, 2, "\xc3\xac" }, // &igrave;
+{ 0x2148, 3, "\xe2\x85\x88" }, // &ii;
+{ 0x2a0c, 3, "\xe2\xa8\x8c" }, // &iiiint;
+{ 0x222d, 3, "\xe2\x88\xad" }, // &iiint;
+{ 0x29dc, 3, "\xe2\xa7\x9c" }, // &iinfin;
+{ 0x2129, 3, "\xe2\x84\xa9" }, // &iiota;
+{ 0x132, 2, "\xc4\xb2" }, // &IJlig;
+{ 0x133, 2, "\xc4\xb3" }, // &ijlig;
+{ 0x2111, 3, "\xe2\x84\x91" }, // &Im;
+{ 0x12a, 2, "\xc4\xaa" }, // &Imacr;
+{ 0x12b, 2, "\xc4\xab" }, // &imacr;
+{ 0x2111, 3, "\xe2\x84\x91" }, // &image;
+{ 0x2148, 3, "\xe2\x85\x88" }, // &ImaginaryI;
+{ 0x2110, 3, "\xe2\x84\x90" }, // &imagline;
+{ 0x2111, 3, "\xe2\x84\x91" }, // &imagpart;
+{ 0x131, 2, "\xc4\xb1" }, // &imath;
+{ 0x22b7, 3, "\xe2\x8a\xb7" }, // &imof;
+{ 0x1b5, 2, "\xc6\xb5" }, // &imped;
+{ 0x21d2, 3, "\xe2\x87\x92" }, // &Implies;
+{ 0x2208, 3, "\xe2\x88\x88" }, // &in;
+{ 0x2105, 3, "\xe2\x84\x85" }, // &incare;
+{ 0x221e, 3, "\xe2\x88\x9e" }, // &infin;
+{ 0x29dd, 3, "\xe2\xa7\x9d" }, // &infintie;
+{ 0x131, 2, "\xc4\xb1" }, // &inodot;
+{ 0x222c, 3, "\xe2\x88\xac" }, // &Int;
+{ 0x222b, 3, "\xe2\x88\xab" }, // &int;
+{ 0x22ba, 3, "\xe2\x8a\xba" }, // &intcal;
+{ 0x2124, 3, "\xe2\x84\xa4" }, // &integers;
+{ 0x222b, 3, "\xe2\x88\xab" }, // &Integral;
+{ 0x22ba, 3, "\xe2\x8a\xba" }, // &intercal;
+{ 0x22c2, 3, "\xe2\x8b\x82" }, // &Intersection;
+{ 0x2a17, 3, "\xe2\xa8\x97" }, // &intlarhk;
+{ 0x2a3c, 3, "\xe2\xa8\xbc" }, // &intprod;
+{ 0x2063, 3, "\xe2\x81\xa3" }, // &InvisibleComma;
+{ 0x2062, 3, "\xe2\x81\xa2" }, // &InvisibleTimes;
+{ 0x401, 2, "\xd0\x81" }, // &IOcy;
+{ 0x451, 2, "\xd1\x91" }, // &iocy;
+{ 0x12e, 2, "\xc4\xae" }, // &Iogon;
+{ 0x12f, 2, "\xc4\xaf" }, // &iogon;
+{ 0x1d540, 4, "\xf0\x9d\x95\x80" }, // &Iopf;
+{ 0x1d55a, 4, "\xf0\x9d\x95\x9a" }, // &iopf;
+{ 0x399, 2, "\xce\x99" }, // &Iota;
+{ 0x3b9, 2, "\xce\xb9" }, // &iota;
+{ 0x2a3c, 3, "\xe2\xa8\xbc" }, // &iprod;
+{ 0xbf, 2, "\xc2\xbf" }, // &iquest;
+{ 0x2110, 3, "\xe2\x84\x90" }, // &Iscr;
+{ 0x1d4be, 4, "\xf0\x9d\x92\xbe" }, // &iscr;
+{ 0x2208, 3, "\xe2\x88\x88" }, // &isin;
+{ 0x22f5, 3, "\xe2\x8b\xb5" }, // &isindot;
+{ 0x22f9, 3, "\xe2\x8b\xb9" }, // &isinE;
+{ 0x22f4, 3, "\xe2\x8b\xb4" }, // &isins;
+{ 0x22f3, 3, "\xe2\x8b\xb3" }, // &isinsv;
+{ 0x2208, 3, "\xe2\x88\x88" }, // &isinv;
+{ 0x2062, 3, "\xe2\x81\xa2" }, // &it;
+{ 0x128, 2, "\xc4\xa8" }, // &Itilde;
+{ 0x129, 2, "\xc4\xa9" }, // &itilde;
+{ 0x406, 2, "\xd0\x86" }, // &Iukcy;
+{ 0x456, 2, "\xd1\x96" }, // &iukcy;
+{ 0xcf, 2, "\xc3\x8f" }, // &Iuml;
+{ 0xef, 2, "\xc3\xaf" }, // &iuml;
+{ 0x134, 2, "\xc4\xb4" }, // &Jcirc;
+{ 0x135, 2, "\xc4\xb5" }, // &jcirc;
+{ 0x419, 2, "\xd0\x99" }, // &Jcy;
+{ 0x439, 2, "\xd0\xb9" }, // &jcy;
+{ 0x1d50d, 4, "\xf0\x9d\x94\x8d" }, // &Jfr;
+{ 0x1d527, 4, "\xf0\x9d\x94\xa7" }, // &jfr;
+{ 0x237, 2, "\xc8\xb7" }, // &jmath;
+{ 0x1d541, 4, "\xf0\x9d\x95\x81" }, // &Jopf;
+{ 0x1d55b, 4, "\xf0\x9d\x95\x9b" }, // &jopf;
+{ 0x1d4a5, 4, "\xf0\x9d\x92\xa5" }, // &Jscr;
+{ 0x1d4bf, 4, "\xf0\x9d\x92\xbf" }, // &jscr;
+{ 0x408, 2, "\xd0\x88" }, // &Jsercy;
+{ 0x458, 2, "\xd1\x98" }, // &jsercy;
+{ 0x404, 2, "\xd0\x84" }, // &Jukcy;
+{ 0x454, 2, "\xd1\x94" }, // &jukcy;
+{ 0x39a, 2, "\xce\x9a" }, // &Kappa;
+{ 0x3ba, 2, "\xce\xba" }, // &kappa;
+{ 0x3f0, 2, "\xcf\xb0" }, // &kappav;
+{ 0x136, 2, "\xc4\xb6" }, // &Kcedil;
+{ 0x137, 2, "\xc4\xb7" }, // &kcedil;
+{ 0x41a, 2, "\xd0\x9a" }, // &Kcy;
+{ 0x43a, 2, "\xd0\xba" }, // &kcy;
+{ 0x1d50e, 4, "\xf0\x9d\x94\x8e" }, // &Kfr;
+{ 0x1d528, 4, "\xf0\x9d\x94\xa8" }, // &kfr;
+{ 0x138, 2, "\xc4\xb8" }, // &kgreen;
+{ 0x425, 2, "\xd0\xa5" }, // &KHcy;
+{ 0x445, 2, "\xd1\x85" }, // &khcy;
+{ 0x40c, 2, "\xd0\x8c" }, // &KJcy;
+{ 0x45c, 2, "\xd1\x9c" }, // &kjcy;
+{ 0x1d542, 4, "\xf0\x9d\x95\x82" }, // &Kopf;
+{ 0x1d55c, 4, "\xf0\x9d\x95\x9c" }, // &kopf;
+{ 0x1d4a6, 4, "\xf0\x9d\x92\xa6" }, // &Kscr;
+{ 0x1d4c0, 4, "\xf0\x9d\x93\x80" }, // &kscr;
+{ 0x21da, 3, "\xe2\x87\x9a" }, // &lAarr;
+{ 0x139, 2, "\xc4\xb9" }, // &Lacute;
+{ 0x13a, 2, "\xc4\xba" }, // &lacute;
+{ 0x29b4, 3, "\xe2\xa6\xb4" }, // &laemptyv;
+{ 0x2112, 3, "\xe2\x84\x92" }, // &lagran;
+{ 0x39b, 2, "\xce\x9b" }, // &Lambda;
+{ 0x3bb, 2, "\xce\xbb" }, // &lambda;
+{ 0x27ea, 3, "\xe2\x9f\xaa" }, // &Lang;
+{ 0x27e8, 3, "\xe2\x9f\xa8" }, // &lang;
+{ 0x2991, 3, "\xe2\xa6\x91" }, // &langd;
+{ 0x27e8, 3, "\xe2\x9f\xa8" }, // &langle;
+{ 0x2a85, 3, "\xe2\xaa\x85" }, // &lap;
+{ 0x2112, 3, "\xe2\x84\x92" }, // &Laplacetrf;
+{ 0xab, 2, "\xc2\xab" }, // &laquo;
+{ 0x219e, 3, "\xe2\x86\x9e" }, // &Larr;
+{ 0x21d0, 3, "\xe2\x87\x90" }, // &lArr;
+{ 0x2190, 3, "\xe2\x86\x90" }, // &larr;
+{ 0x21e4, 3, "\xe2\x87\xa4" }, // &larrb;
+{ 0x291f, 3, "\xe2\xa4\x9f" }, // &larrbfs;
+{ 0x291d, 3, "\xe2\xa4\x9d" }, // &larrfs;
+{ 0x21a9, 3, "\xe2\x86\xa9" }, // &larrhk;
+{ 0x21ab, 3, "\xe2\x86\xab" }, // &larrlp;
+{ 0x2939, 3, "\xe2\xa4\xb9" }, // &larrpl;
+{ 0x2973, 3, "\xe2\xa5\xb3" }, // &larrsim;
+{ 0x21a2, 3, "\xe2\x86\xa2" }, // &larrtl;
+{ 0x2aab, 3, "\xe2\xaa\xab" }, // &lat;
+{ 0x291b, 3, "\xe2\xa4\x9b" }, // &lAtail;
+{ 0x2919, 3, "\xe2\xa4\x99" }, // &latail;
+{ 0x2aad, 3, "\xe2\xaa\xad" }, // &late;
+{ 0x2aad, 6, "\xe2\xaa\xad\xef\xb8\x80" }, // &lates;
+{ 0x290e, 3, "\xe2\xa4\x8e" }, // &lBarr;
+{ 0x290c, 3, "\xe2\xa4\x8c" }, // &lbarr;
+{ 0x2772, 3, "\xe2\x9d\xb2" }, // &lbbrk;
+{ 0x7b, 1, "\x7b" }, // &lbrace;
+{ 0x5b, 1, "\x5b" }, // &lbrack;
+{ 0x298b, 3, "\xe2\xa6\x8b" }, // &lbrke;
+{ 0x298f, 3, "\xe2\xa6\x8f" }, // &lbrksld;
+{ 0x298d, 3, "\xe2\xa6\x8d" }, // &lbrkslu;
+{ 0x13d, 2, "\xc4\xbd" }, // &Lcaron;
+{ 0x13e, 2, "\xc4\xbe" }, // &lcaron;
+{ 0x13b, 2, "\xc4\xbb" }, // &Lcedil;
+{ 0x13c, 2, "\xc4\xbc" }, // &lcedil;
+{ 0x2308, 3, "\xe2\x8c\x88" }, // &lceil;
+{ 0x7b, 1, "\x7b" }, // &lcub;
+{ 0x41b, 2, "\xd0\x9b" }, // &Lcy;
+{ 0x43b, 2, "\xd0\xbb" }, // &lcy;
+{ 0x2936, 3, "\xe2\xa4\xb6" }, // &ldca;
+{ 0x201c, 3, "\xe2\x80\x9c" }, // &ldquo;
+{ 0x201e, 3, "\xe2\x80\x9e" }, // &ldquor;
+{ 0x2967, 3, "\xe2\xa5\xa7" }, // &ldrdhar;
+{ 0x294b, 3, "\xe2\xa5\x8b" }, // &ldrushar;
+{ 0x21b2, 3, "\xe2\x86\xb2" }, // &ldsh;
+{ 0x2266, 3, "\xe2\x89\xa6" }, // &lE;
+{ 0x2264, 3, "\xe2\x89\xa4" }, // &le;
+{ 0x27e8, 3, "\xe2\x9f\xa8" }, // &LeftAngleBracket;
+{ 0x2190, 3, "\xe2\x86\x90" }, // &LeftArrow;
+{ 0x21d0, 3, "\xe2\x87\x90" }, // &Leftarrow;
+{ 0x2190, 3, "\xe2\x86\x90" }, // &leftarrow;
+{ 0x21e4, 3, "\xe2\x87\xa4" }, // &LeftArrowBar;
+{ 0x21c6, 3, "\xe2\x87\x86" }, // &LeftArrowRightArrow;
+{ 0x21a2, 3, "\xe2\x86\xa2" }, // &leftarrowtail;
+{ 0x2308, 3, "\xe2\x8c\x88" }, // &LeftCeiling;
+{ 0x27e6, 3, "\xe2\x9f\xa6" }, // &LeftDoubleBracket;
+{ 0x2961, 3, "\xe2\xa5\xa1" }, // &LeftDownTeeVector;
+{ 0x21c3, 3, "\xe2\x87\x83" }, // &LeftDownVector;
+{ 0x2959, 3, "\xe2\xa5\x99" }, // &LeftDownVectorBar;
+{ 0x230a, 3, "\xe2\x8c\x8a" }, // &LeftFloor;
+{ 0x21bd, 3, "\xe2\x86\xbd" }, // &leftharpoondown;
+{ 0x21bc, 3, "\xe2\x86\xbc" }, // &leftharpoonup;
+{ 0x21c7, 3, "\xe2\x87\x87" }, // &leftleftarrows;
+{ 0x2194, 3, "\xe2\x86\x94" }, // &LeftRightArrow;
+{ 0x21d4, 3, "\xe2\x87\x94" }, // &Leftrightarrow;
+{ 0x2194, 3, "\xe2\x86\x94" }, // &leftrightarrow;
+{ 0x21c6, 3, "\xe2\x87\x86" }, // &leftrightarrows;
+{ 0x21cb, 3, "\xe2\x87\x8b" }, // &leftrightharpoons;
+{ 0x21ad, 3, "\xe2\x86\xad" }, // &leftrightsquigarrow;
+{ 0x294e, 3, "\xe2\xa5\x8e" }, // &LeftRightVector;
+{ 0x22a3, 3, "\xe2\x8a\xa3" }, // &LeftTee;
+{ 0x21a4, 3, "\xe2\x86\xa4" }, // &LeftTeeArrow;
+{ 0x295a, 3, "\xe2\xa5\x9a" }, // &LeftTeeVector;
+{ 0x22cb, 3, "\xe2\x8b\x8b" }, // &leftthreetimes;
+{ 0x22b2, 3, "\xe2\x8a\xb2" }, // &LeftTriangle;
+{ 0x29cf, 3, "\xe2\xa7\x8f" }, // &LeftTriangleBar;
+{ 0x22b4, 3, "\xe2\x8a\xb4" }, // &LeftTriangleEqual;
+{ 0x2951, 3, "\xe2\xa5\x91" }, // &LeftUpDownVector;
+{ 0x2960, 3, "\xe2\xa5\xa0" }, // &LeftUpTeeVector;
+{ 0x21bf, 3, "\xe2\x86\xbf" }, // &LeftUpVector;
+{ 0x2958, 3, "\xe2\xa5\x98" }, // &LeftUpVectorBar;
+{ 0x21bc, 3, "\xe2\x86\xbc" }, // &LeftVector;
+{ 0x2952, 3, "\xe2\xa5\x92" }, // &LeftVectorBar;
+{ 0x2a8b, 3, "\xe2\xaa\x8b" }, // &lEg;
+{ 0x22da, 3, "\xe2\x8b\x9a" }, // &leg;
+{ 0x2264, 3, "\xe2\x89\xa4" }, // &leq;
+{ 0x2266, 3, "\xe2\x89\xa6" }, // &leqq;
+{ 0x2a7d, 3, "\xe2\xa9\xbd" }, // &leqslant;
+{ 0x2a7d, 3, "\xe2\xa9\xbd" }, // &les;
+{ 0x2aa8, 3, "\xe2\xaa\xa8" }, // &lescc;
+{ 0x2a7f, 3, "\xe2\xa9\xbf" }, // &lesdot;
+{ 0x2a81, 3, "\xe2\xaa\x81" }, // &lesdoto;
+{ 0x2a83, 3, "\xe2\xaa\x83" }, // &lesdotor;
+{ 0x22da, 6, "\xe2\x8b\x9a\xef\xb8\x80" }, // &lesg;
+{ 0x2a93, 3, "\xe2\xaa\x93" }, // &lesges;
+{ 0x2a85, 3, "\xe2\xaa\x85" }, // &lessapprox;
+{ 0x22d6, 3, "\xe2\x8b\x96" }, // &lessdot;
+{ 0x22da, 3, "\xe2\x8b\x9a" }, // &lesseqgtr;
+{ 0x2a8b, 3, "\xe2\xaa\x8b" }, // &lesseqqgtr;
+{ 0x22da, 3, "\xe2\x8b\x9a" }, // &LessEqualGreater;
+{ 0x2266, 3, "\xe2\x89\xa6" }, // &LessFullEqual;
+{ 0x2276, 3, "\xe2\x89\xb6" }, // &LessGreater;
+{ 0x2276, 3, "\xe2\x89\xb6" }, // &lessgtr;
+{ 0x2aa1, 3, "\xe2\xaa\xa1" }, // &LessLess;
+{ 0x2272, 3, "\xe2\x89\xb2" }, // &lesssim;
+{ 0x2a7d, 3, "\xe2\xa9\xbd" }, // &LessSlantEqual;
+{ 0x2272, 3, "\xe2\x89\xb2" }, // &LessTilde;
+{ 0x297c, 3, "\xe2\xa5\xbc" }, // &lfisht;
+{ 0x230a, 3, "\xe2\x8c\x8a" }, // &lfloor;
+{ 0x1d50f, 4, "\xf0\x9d\x94\x8f" }, // &Lfr;
+{ 0x1d529, 4, "\xf0\x9d\x94\xa9" }, // &lfr;
+{ 0x2276, 3, "\xe2\x89\xb6" }, // &lg;
+{ 0x2a91, 3, "\xe2\xaa\x91" }, // &lgE;
+{ 0x2962, 3, "\xe2\xa5\xa2" }, // &lHar;
+{ 0x21bd, 3, "\xe2\x86\xbd" }, // &lhard;
+{ 0x21bc, 3, "\xe2\x86\xbc" }, // &lharu;
+{ 0x296a, 3, "\xe2\xa5\xaa" }, // &lharul;
+{ 0x2584, 3, "\xe2\x96\x84" }, // &lhblk;
+{ 0x409, 2, "\xd0\x89" }, // &LJcy;
+{ 0x459, 2, "\xd1\x99" }, // &ljcy;
+{ 0x22d8, 3, "\xe2\x8b\x98" }, // &Ll;
+{ 0x226a, 3, "\xe2\x89\xaa" }, // &ll;
+{ 0x21c7, 3, "\xe2\x87\x87" }, // &llarr;
+{ 0x231e, 3, "\xe2\x8c\x9e" }, // &llcorner;
+{ 0x21da, 3, "\xe2\x87\x9a" }, // &Lleftarrow;
+{ 0x296b, 3, "\xe2\xa5\xab" }, // &llhard;
+{ 0x25fa, 3, "\xe2\x97\xba" }, // &lltri;
+{ 0x13f, 2, "\xc4\xbf" }, // &Lmidot;
+{ 0x140, 2, "\xc5\x80" }, // &lmidot;
+{ 0x23b0, 3, "\xe2\x8e\xb0" }, // &lmoust;
+{ 0x23b0, 3, "\xe2\x8e\xb0" }, // &lmoustache;
+{ 0x2a89, 3, "\xe2\xaa\x89" }, // &lnap;
+{ 0x2a89, 3, "\xe2\xaa\x89" }, // &lnapprox;
+{ 0x2268, 3, "\xe2\x89\xa8" }, // &lnE;
+{ 0x2a87, 3, "\xe2\xaa\x87" }, // &lne;
+{ 0x2a87, 3, "\xe2\xaa\x87" }, // &lneq;
+{ 0x2268, 3, "\xe2\x89\xa8" }, // &lneqq;
+{ 0x22e6, 3, "\xe2\x8b\xa6" }, // &lnsim;
+{ 0x27ec, 3, "\xe2\x9f\xac" }, // &loang;
+{ 0x21fd, 3, "\xe2\x87\xbd" }, // &loarr;
+{ 0x27e6, 3, "\xe2\x9f\xa6" }, // &lobrk;
+{ 0x27f5, 3, "\xe2\x9f\xb5" }, // &LongLeftArrow;
+{ 0x27f8, 3, "\xe2\x9f\xb8" }, // &Longleftarrow;
+{ 0x27f5, 3, "\xe2\x9f\xb5" }, // &longleftarrow;
+{ 0x27f7, 3, "\xe2\x9f\xb7" }, // &LongLeftRightArrow;
+{ 0x27fa, 3, "\xe2\x9f\xba" }, // &Longleftrightarrow;
+{ 0x27f7, 3, "\xe2\x9f\xb7" }, // &longleftrightarrow;
+{ 0x27fc, 3, "\xe2\x9f\xbc" }, // &longmapsto;
+{ 0x27f6, 3, "\xe2\x9f\xb6" }, // &LongRightArrow;
+{ 0x27f9, 3, "\xe2\x9f\xb9" }, // &Longrightarrow;
+{ 0x27f6, 3, "\xe2\x9f\xb6" }, // &longrightarrow;
+{ 0x21ab, 3, "\xe2\x86\xab" }, // &looparrowleft;
+{ 0x21ac, 3, "\xe2\x86\xac" }, // &looparrowright;
+{ 0x2985, 3, "\xe2\xa6\x85" }, // &lopar;
+{ 0x1d543, 4, "\xf0\x9d\x95\x83" }, // &Lopf;
+{ 0x1d55d, 4, "\xf0\x9d\x95\x9d" }, // &lopf;
+{ 0x2a2d, 3, "\xe2\xa8\xad" }, // &loplus;
+{ 0x2a34, 3, "\xe2\xa8\xb4" }, // &lotimes;
+{ 0x2217, 3, "\xe2\x88\x97" }, // &lowast;
+{ 0x5f, 1, "\x5f" }, // &lowbar;
+{ 0x2199, 3, "\xe2\x86\x99" }, // &LowerLeftArrow;
+{ 0x2198, 3, "\xe2\x86\x98" }, // &LowerRightArrow;
+{ 0x25ca, 3, "\xe2\x97\x8a" }, // &loz;
+{ 0x25ca, 3, "\xe2\x97\x8a" }, // &lozenge;
+{ 0x29eb, 3, "\xe2\xa7\xab" }, // &lozf;
+{ 0x28, 1, "\x28" }, // &lpar;
+{ 0x2993, 3, "\xe2\xa6\x93" }, // &lparlt;
+{ 0x21c6, 3, "\xe2\x87\x86" }, // &lrarr;
+{ 0x231f, 3, "\xe2\x8c\x9f" }, // &lrcorner;
+{ 0x21cb, 3, "\xe2\x87\x8b" }, // &lrhar;
+{ 0x296d, 3, "\xe2\xa5\xad" }, // &lrhard;
+{ 0x200e, 3, "\xe2\x80\x8e" }, // &lrm;
+{ 0x22bf, 3, "\xe2\x8a\xbf" }, // &lrtri;
+{ 0x2039, 3, "\xe2\x80\xb9" }, // &lsaquo;
+{ 0x2112, 3, "\xe2\x84\x92" }, // &Lscr;
+{ 0x1d4c1, 4, "\xf0\x9d\x93\x81" }, // &lscr;
+{ 0x21b0, 3, "\xe2\x86\xb0" }, // &Lsh;
+{ 0x21b0, 3, "\xe2\x86\xb0" }, // &lsh;
+{ 0x2272, 3, "\xe2\x89\xb2" }, // &lsim;
+{ 0x2a8d, 3, "\xe2\xaa\x8d" }, // &lsime;
+{ 0x2a8f, 3, "\xe2\xaa\x8f" }, // &lsimg;
+{ 0x5b, 1, "\x5b" }, // &lsqb;
+{ 0x2018, 3, "\xe2\x80\x98" }, // &lsquo;
+{ 0x201a, 3, "\xe2\x80\x9a" }, // &lsquor;
+{ 0x141, 2, "\xc5\x81" }, // &Lstrok;
+{ 0x142, 2, "\xc5\x82" }, // &lstrok;
+{ 0x3c, 1, "\x3c" }, // &LT;
+{ 0x226a, 3, "\xe2\x89\xaa" }, // &Lt;
+{ 0x3c, 1, "\x3c" }, // &lt;
+{ 0x2aa6, 3, "\xe2\xaa\xa6" }, // &ltcc;
+{ 0x2a79, 3, "\xe2\xa9\xb9" }, // &ltcir;
+{ 0x22d6, 3, "\xe2\x8b\x96" }, // &ltdot;
+{ 0x22cb, 3, "\xe2\x8b\x8b" }, // &lthree;
+{ 0x22c9, 3, "\xe2\x8b\x89" }, // &ltimes;
+{ 0x2976, 3, "\xe2\xa5\xb6" }, // &ltlarr;
+{ 0x2a7b, 3, "\xe2\xa9\xbb" }, // &ltquest;
+{ 0x25c3, 3, "\xe2\x97\x83" }, // &ltri;
+{ 0x22b4, 3, "\xe2\x8a\xb4" }, // &ltrie;
+{ 0x25c2, 3, "\xe2\x97\x82" }, // &ltrif;
+{ 0x2996, 3, "\xe2\xa6\x96" }, // &ltrPar;
+{ 0x294a, 3, "\xe2\xa5\x8a" }, // &lurdshar;
+{ 0x2966, 3, "\xe2\xa5\xa6" }, // &luruhar;
+{ 0x2268, 6, "\xe2\x89\xa8\xef\xb8\x80" }, // &lvertneqq;
+{ 0x2268, 6, "\xe2\x89\xa8\xef\xb8\x80" }, // &lvnE;
+{ 0xaf, 2, "\xc2\xaf" }, // &macr;
+{ 0x2642, 3, "\xe2\x99\x82" }, // &male;
+{ 0x2720, 3, "\xe2\x9c\xa0" }, // &malt;
+{ 0x2720, 3, "\xe2\x9c\xa0" }, // &maltese;
+{ 0x2905, 3, "\xe2\xa4\x85" }, // &Map;
+{ 0x21a6, 3, "\xe2\x86\xa6" }, // &map;
+{ 0x21a6, 3, "\xe2\x86\xa6" }, // &mapsto;
+{ 0x21a7, 3, "\xe2\x86\xa7" }, // &mapstodown;
+{ 0x21a4, 3, "\xe2\x86\xa4" }, // &mapstoleft;
+{ 0x21a5, 3, "\xe2\x86\xa5" }, // &mapstoup;
+{ 0x25ae, 3, "\xe2\x96\xae" }, // &marker;
+{ 0x2a29, 3, "\xe2\xa8\xa9" }, // &mcomma;
+{ 0x41c, 2, "\xd0\x9c" }, // &Mcy;
+{ 0x43c, 2, "\xd0\xbc" }, // &mcy;
+{ 0x2014, 3, "\xe2\x80\x94" }, // &mdash;
+{ 0x223a, 3, "\xe2\x88\xba" }, // &mDDot;
+{ 0x2221, 3, "\xe2\x88\xa1" }, // &measuredangle;
+{ 0x205f, 3, "\xe2\x81\x9f" }, // &MediumSpace;
+{ 0x2133, 3, "\xe2\x84\xb3" }, // &Mellintrf;
+{ 0x1d510, 4, "\xf0\x9d\x94\x90" }, // &Mfr;
+{ 0x1d52a, 4, "\xf0\x9d\x94\xaa" }, // &mfr;
+{ 0x2127, 3, "\xe2\x84\xa7" }, // &mho;
+{ 0xb5, 2, "\xc2\xb5" }, // &micro;
+{ 0x2223, 3, "\xe2\x88\xa3" }, // &mid;
+{ 0x2a, 1, "\x2a" }, // &midast;
+{ 0x2af0, 3, "\xe2\xab\xb0" }, // &midcir;
+{ 0xb7, 2, "\xc2\xb7" }, // &middot;
+{ 0x2212, 3, "\xe2\x88\x92" }, // &minus;
+{ 0x229f, 3, "\xe2\x8a\x9f" }, // &minusb;
+{ 0x2238, 3, "\xe2\x88\xb8" }, // &minusd;
+{ 0x2a2a, 3, "\xe2\xa8\xaa" }, // &minusdu;
+{ 0x2213, 3, "\xe2\x88\x93" }, // &MinusPlus;
+{ 0x2adb, 3, "\xe2\xab\x9b" }, // &mlcp;
+{ 0x2026, 3, "\xe2\x80\xa6" }, // &mldr;
+{ 0x2213, 3, "\xe2\x88\x93" }, // &mnplus;
+{ 0x22a7, 3, "\xe2\x8a\xa7" }, // &models;
+{ 0x1d544, 4, "\xf0\x9d\x95\x84" }, // &Mopf;
+{ 0x1d55e, 4, "\xf0\x9d\x95\x9e" }, // &mopf;
+{ 0x2213, 3, "\xe2\x88\x93" }, // &mp;
+{ 0x2133, 3, "\xe2\x84\xb3" }, // &Mscr;
+{ 0x1d4c2, 4, "\xf0\x9d\x93\x82" }, // &mscr;
+{ 0x223e, 3, "\xe2\x88\xbe" }, // &mstpos;
+{ 0x39c, 2, "\xce\x9c" }, // &Mu;
+{ 0x3bc, 2, "\xce\xbc" }, // &mu;
+{ 0x22b8, 3, "\xe2\x8a\xb8" }, // &multimap;
+{ 0x22b8, 3, "\xe2\x8a\xb8" }, // &mumap;
+{ 0x2207, 3, "\xe2\x88\x87" }, // &nabla;
+{ 0x143, 2, "\xc5\x83" }, // &Nacute;
+{ 0x144, 2, "\xc5\x84" }, // &nacute;
+{ 0x2220, 6, "\xe2\x88\xa0\xe2\x83\x92" }, // &nang;
+{ 0x2249, 3, "\xe2\x89\x89" }, // &nap;
+{ 0x2a70, 5, "\xe2\xa9\xb0\xcc\xb8" }, // &napE;
+{ 0x224b, 5, "\xe2\x89\x8b\xcc\xb8" }, // &napid;
+{ 0x149, 2, "\xc5\x89" }, // &napos;
+{ 0x2249, 3, "\xe2\x89\x89" }, // &napprox;
+{ 0x266e, 3, "\xe2\x99\xae" }, // &natur;
+{ 0x266e, 3, "\xe2\x99\xae" }, // &natural;
+{ 0x2115, 3, "\xe2\x84\x95" }, // &naturals;
+{ 0xa0, 2, "\xc2\xa0" }, // &nbsp;
+{ 0x224e, 5, "\xe2\x89\x8e\xcc\xb8" }, // &nbump;
+{ 0x224f, 5, "\xe2\x89\x8f\xcc\xb8" }, // &nbumpe;
+{ 0x2a43, 3, "\xe2\xa9\x83" }, // &ncap;
+{ 0x147, 2, "\xc5\x87" }, // &Ncaron;
+{ 0x148, 2, "\xc5\x88" }, // &ncaron;
+{ 0x145, 2, "\xc5\x85" }, // &Ncedil;
+{ 0x146, 2, "\xc5\x86" }, // &ncedil;
+{ 0x2247, 3, "\xe2\x89\x87" }, // &ncong;
+{ 0x2a6d, 5, "\xe2\xa9\xad\xcc\xb8" }, // &ncongdot;
+{ 0x2a42, 3, "\xe2\xa9\x82" }, // &ncup;
+{ 0x41d, 2, "\xd0\x9d" }, // &Ncy;
+{ 0x43d, 2, "\xd0\xbd" }, // &ncy;
+{ 0x2013, 3, "\xe2\x80\x93" }, // &ndash;
+{ 0x2260, 3, "\xe2\x89\xa0" }, // &ne;
+{ 0x2924, 3, "\xe2\xa4\xa4" }, // &nearhk;
+{ 0x21d7, 3, "\xe2\x87\x97" }, // &neArr;
+{ 0x2197, 3, "\xe2\x86\x97" }, // &nearr;
+{ 0x2197, 3, "\xe2\x86\x97" }, // &nearrow;
+{ 0x2250, 5, "\xe2\x89\x90\xcc\xb8" }, // &nedot;
+{ 0x200b, 3, "\xe2\x80\x8b" }, // &NegativeMediumSpace;
+{ 0x200b, 3, "\xe2\x80\x8b" }, // &NegativeThickSpace;
+{ 0x200b, 3, "\xe2\x80\x8b" }, // &NegativeThinSpace;
+{ 0x200b, 3, "\xe2\x80\x8b" }, // &NegativeVeryThinSpace;
+{ 0x2262, 3, "\xe2\x89\xa2" }, // &nequiv;
+{ 0x2928, 3, "\xe2\xa4\xa8" }, // &nesear;
+{ 0x2242, 5, "\xe2\x89\x82\xcc\xb8" }, // &nesim;
+{ 0x226b, 3, "\xe2\x89\xab" }, // &NestedGreaterGreater;
+{ 0x226a, 3, "\xe2\x89\xaa" }, // &NestedLessLess;
+{ 0xa, 1, "\x0a" }, // &NewLine;
+{ 0x2204, 3, "\xe2\x88\x84" }, // &nexist;
+{ 0x2204, 3, "\xe2\x88\x84" }, // &nexists;
+{ 0x1d511, 4, "\xf0\x9d\x94\x91" }, // &Nfr;
+{ 0x1d52b, 4, "\xf0\x9d\x94\xab" }, // &nfr;
+{ 0x2267, 5, "\xe2\x89\xa7\xcc\xb8" }, // &ngE;
+{ 0x2271, 3, "\xe2\x89\xb1" }, // &nge;
+{ 0x2271, 3, "\xe2\x89\xb1" }, // &ngeq;
+{ 0x2267, 5, "\xe2\x89\xa7\xcc\xb8" }, // &ngeqq;
+{ 0x2a7e, 5, "\xe2\xa9\xbe\xcc\xb8" }, // &ngeqslant;
+{ 0x2a7e, 5, "\xe2\xa9\xbe\xcc\xb8" }, // &nges;
+{ 0x22d9, 5, "\xe2\x8b\x99\xcc\xb8" }, // &nGg;
+{ 0x2275, 3, "\xe2\x89\xb5" }, // &ngsim;
+{ 0x226b, 6, "\xe2\x89\xab\xe2\x83\x92" }, // &nGt;
+{ 0x226f, 3, "\xe2\x89\xaf" }, // &ngt;
+{ 0x226f, 3, "\xe2\x89\xaf" }, // &ngtr;
+{ 0x226b, 5, "\xe2\x89\xab\xcc\xb8" }, // &nGtv;
+{ 0x21ce, 3, "\xe2\x87\x8e" }, // &nhArr;
+{ 0x21ae, 3, "\xe2\x86\xae" }, // &nharr;
+{ 0x2af2, 3, "\xe2\xab\xb2" }, // &nhpar;
+{ 0x220b, 3, "\xe2\x88\x8b" }, // &ni;
+{ 0x22fc, 3, "\xe2\x8b\xbc" }, // &nis;
+{ 0x22fa, 3, "\xe2\x8b\xba" }, // &nisd;
+{ 0x220b, 3, "\xe2\x88\x8b" }, // &niv;
+{ 0x40a, 2, "\xd0\x8a" }, // &NJcy;
+{ 0x45a, 2, "\xd1\x9a" }, // &njcy;
+{ 0x21cd, 3, "\xe2\x87\x8d" }, // &nlArr;
+{ 0x219a, 3, "\xe2\x86\x9a" }, // &nlarr;
+{ 0x2025, 3, "\xe2\x80\xa5" }, // &nldr;
+{ 0x2266, 5, "\xe2\x89\xa6\xcc\xb8" }, // &nlE;
+{ 0x2270, 3, "\xe2\x89\xb0" }, // &nle;
+{ 0x21cd, 3, "\xe2\x87\x8d" }, // &nLeftarrow;
+{ 0x219a, 3, "\xe2\x86\x9a" }, // &nleftarrow;
+{ 0x21ce, 3, "\xe2\x87\x8e" }, // &nLeftrightarrow;
+{ 0x21ae, 3, "\xe2\x86\xae" }, // &nleftrightarrow;
+{ 0x2270, 3, "\xe2\x89\xb0" }, // &nleq;
+{ 0x2266, 5, "\xe2\x89\xa6\xcc\xb8" }, // &nleqq;
+{ 0x2a7d, 5, "\xe2\xa9\xbd\xcc\xb8" }, // &nleqslant;
+{ 0x2a7d, 5, "\xe2\xa9\xbd\xcc\xb8" }, // &nles;
+{ 0x226e, 3, "\xe2\x89\xae" }, // &nless;
+{ 0x22d8, 5, "\xe2\x8b\x98\xcc\xb8" }, // &nLl;
+{ 0x2274, 3, "\xe2\x89\xb4" }, // &nlsim;
+{ 0x226a, 6, "\xe2\x89\xaa\xe2\x83\x92" }, // &nLt;
+{ 0x226e, 3, "\xe2\x89\xae" }, // &nlt;
+{ 0x22ea, 3, "\xe2\x8b\xaa" }, // &nltri;
+{ 0x22ec, 3, "\xe2\x8b\xac" }, // &nltrie;
+{ 0x226a, 5, "\xe2\x89\xaa\xcc\xb8" }, // &nLtv;
+{ 0x2224, 3, "\xe2\x88\xa4" }, // &nmid;
+{ 0x2060, 3, "\xe2\x81\xa0" }, // &NoBreak;
+{ 0xa0, 2, "\xc2\xa0" }, // &NonBreakingSpace;
+{ 0x2115, 3, "\xe2\x84\x95" }, // &Nopf;
+{ 0x1d55f, 4, "\xf0\x9d\x95\x9f" }, // &nopf;
+{ 0x2aec, 3, "\xe2\xab\xac" }, // &Not;
+{ 0xac, 2, "\xc2\xac" }, // &not;
+{ 0x2262, 3, "\xe2\x89\xa2" }, // &NotCongruent;
+{ 0x226d, 3, "\xe2\x89\xad" }, // &NotCupCap;
+{ 0x2226, 3, "\xe2\x88\xa6" }, // &NotDoubleVerticalBar;
+{ 0x2209, 3, "\xe2\x88\x89" }, // &NotElement;
+{ 0x2260, 3, "\xe2\x89\xa0" }, // &NotEqual;
+{ 0x2242, 5, "\xe2\x89\x82\xcc\xb8" }, // &NotEqualTilde;
+{ 0x2204, 3, "\xe2\x88\x84" }, // &NotExists;
+{ 0x226f, 3, "\xe2\x89\xaf" }, // &NotGreater;
+{ 0x2271, 3, "\xe2\x89\xb1" }, // &NotGreaterEqual;
+{ 0x2267, 5, "\xe2\x89\xa7\xcc\xb8" }, // &NotGreaterFullEqual;
+{ 0x226b, 5, "\xe2\x89\xab\xcc\xb8" }, // &NotGreaterGreater;
+{ 0x2279, 3, "\xe2\x89\xb9" }, // &NotGreaterLess;
+{ 0x2a7e, 5, "\xe2\xa9\xbe\xcc\xb8" }, // &NotGreaterSlantEqual;
+{ 0x2275, 3, "\xe2\x89\xb5" }, // &NotGreaterTilde;
+{ 0x224e, 5, "\xe2\x89\x8e\xcc\xb8" }, // &NotHumpDownHump;
+{ 0x224f, 5, "\xe2\x89\x8f\xcc\xb8" }, // &NotHumpEqual;
+{ 0x2209, 3, "\xe2\x88\x89" }, // &notin;
+{ 0x22f5, 5, "\xe2\x8b\xb5\xcc\xb8" }, // &notindot;
+{ 0x22f9, 5, "\xe2\x8b\xb9\xcc\xb8" }, // &notinE;
+{ 0x2209, 3, "\xe2\x88\x89" }, // &notinva;
+{ 0x22f7, 3, "\xe2\x8b\xb7" }, // &notinvb;
+{ 0x22f6, 3, "\xe2\x8b\xb6" }, // &notinvc;
+{ 0x22ea, 3, "\xe2\x8b\xaa" }, // &NotLeftTriangle;
+{ 0x29cf, 5, "\xe2\xa7\x8f\xcc\xb8" }, // &NotLeftTriangleBar;
+{ 0x22ec, 3, "\xe2\x8b\xac" }, // &NotLeftTriangleEqual;
+{ 0x226e, 3, "\xe2\x89\xae" }, // &NotLess;
+{ 0x2270, 3, "\xe2\x89\xb0" }, // &NotLessEqual;
+{ 0x2278, 3, "\xe2\x89\xb8" }, // &NotLessGreater;
+{ 0x226a, 5, "\xe2\x89\xaa\xcc\xb8" }, // &NotLessLess;
+{ 0x2a7d, 5, "\xe2\xa9\xbd\xcc\xb8" }, // &NotLessSlantEqual;
+{ 0x2274, 3, "\xe2\x89\xb4" }, // &NotLessTilde;
+{ 0x2aa2, 5, "\xe2\xaa\xa2\xcc\xb8" }, // &NotNestedGreaterGreater;
+{ 0x2aa1, 5, "\xe2\xaa\xa1\xcc\xb8" }, // &NotNestedLessLess;
+{ 0x220c, 3, "\xe2\x88\x8c" }, // &notni;
+{ 0x220c, 3, "\xe2\x88\x8c" }, // &notniva;
+{ 0x22fe, 3, "\xe2\x8b\xbe" }, // &notnivb;
+{ 0x22fd, 3, "\xe2\x8b\xbd" }, // &notnivc;
+{ 0x2280, 3, "\xe2\x8a\x80" }, // &NotPrecedes;
+{ 0x2aaf, 5, "\xe2\xaa\xaf\xcc\xb8" }, // &NotPrecedesEqual;
+{ 0x22e0, 3, "\xe2\x8b\xa0" }, // &NotPrecedesSlantEqual;
+{ 0x220c, 3, "\xe2\x88\x8c" }, // &NotReverseElement;
+{ 0x22eb, 3, "\xe2\x8b\xab" }, // &NotRightTriangle;
+{ 0x29d0, 5, "\xe2\xa7\x90\xcc\xb8" }, // &NotRightTriangleBar;
+{ 0x22ed, 3, "\xe2\x8b\xad" }, // &NotRightTriangleEqual;
+{ 0x228f, 5, "\xe2\x8a\x8f\xcc\xb8" }, // &NotSquareSubset;
+{ 0x22e2, 3, "\xe2\x8b\xa2" }, // &NotSquareSubsetEqual;
+{ 0x2290, 5, "\xe2\x8a\x90\xcc\xb8" }, // &NotSquareSuperset;
+{ 0x22e3, 3, "\xe2\x8b\xa3" }, // &NotSquareSupersetEqual;
+{ 0x2282, 6, "\xe2\x8a\x82\xe2\x83\x92" }, // &NotSubset;
+{ 0x2288, 3, "\xe2\x8a\x88" }, // &NotSubsetEqual;
+{ 0x2281, 3, "\xe2\x8a\x81" }, // &NotSucceeds;
+{ 0x2ab0, 5, "\xe2\xaa\xb0\xcc\xb8" }, // &NotSucceedsEqual;
+{ 0x22e1, 3, "\xe2\x8b\xa1" }, // &NotSucceedsSlantEqual;
+{ 0x227f, 5, "\xe2\x89\xbf\xcc\xb8" }, // &NotSucceedsTilde;
+{ 0x2283, 6, "\xe2\x8a\x83\xe2\x83\x92" }, // &NotSuperset;
+{ 0x2289, 3, "\xe2\x8a\x89" }, // &NotSupersetEqual;
+{ 0x2241, 3, "\xe2\x89\x81" }, // &NotTilde;
+{ 0x2244, 3, "\xe2\x89\x84" }, // &NotTildeEqual;
+{ 0x2247, 3, "\xe2\x89\x87" }, // &NotTildeFullEqual;
+{ 0x2249, 3, "\xe2\x89\x89" }, // &NotTildeTilde;
+{ 0x2224, 3, "\xe2\x88\xa4" }, // &NotVerticalBar;
+{ 0x2226, 3, "\xe2\x88\xa6" }, // &npar;
+{ 0x2226, 3, "\xe2\x88\xa6" }, // &nparallel;
+{ 0x2afd, 6, "\xe2\xab\xbd\xe2\x83\xa5" }, // &nparsl;
+{ 0x2202, 5, "\xe2\x88\x82\xcc\xb8" }, // &npart;
+{ 0x2a14, 3, "\xe2\xa8\x94" }, // &npolint;
+{ 0x2280, 3, "\xe2\x8a\x80" }, // &npr;
+{ 0x22e0, 3, "\xe2\x8b\xa0" }, // &nprcue;
+{ 0x2aaf, 5, "\xe2\xaa\xaf\xcc\xb8" }, // &npre;
+{ 0x2280, 3, "\xe2\x8a\x80" }, // &nprec;
+{ 0x2aaf, 5, "\xe2\xaa\xaf\xcc\xb8" }, // &npreceq;
+{ 0x21cf, 3, "\xe2\x87\x8f" }, // &nrArr;
+{ 0x219b, 3, "\xe2\x86\x9b" }, // &nrarr;
+{ 0x2933, 5, "\xe2\xa4\xb3\xcc\xb8" }, // &nrarrc;
+{ 0x219d, 5, "\xe2\x86\x9d\xcc\xb8" }, // &nrarrw;
+{ 0x21cf, 3, "\xe2\x87\x8f" }, // &nRightarrow;
+{ 0x219b, 3, "\xe2\x86\x9b" }, // &nrightarrow;
+{ 0x22eb, 3, "\xe2\x8b\xab" }, // &nrtri;
+{ 0x22ed, 3, "\xe2\x8b\xad" }, // &nrtrie;
+{ 0x2281, 3, "\xe2\x8a\x81" }, // &nsc;
+{ 0x22e1, 3, "\xe2\x8b\xa1" }, // &nsccue;
+{ 0x2ab0, 5, "\xe2\xaa\xb0\xcc\xb8" }, // &nsce;
+{ 0x1d4a9, 4, "\xf0\x9d\x92\xa9" }, // &Nscr;
+{ 0x1d4c3, 4, "\xf0\x9d\x93\x83" }, // &nscr;
+{ 0x2224, 3, "\xe2\x88\xa4" }, // &nshortmid;
+{ 0x2226, 3, "\xe2\x88\xa6" }, // &nshortparallel;
+{ 0x2241, 3, "\xe2\x89\x81" }, // &nsim;
+{ 0x2244, 3, "\xe2\x89\x84" }, // &nsime;
+{ 0x2244, 3, "\xe2\x89\x84" }, // &nsimeq;
+{ 0x2224, 3, "\xe2\x88\xa4" }, // &nsmid;
+{ 0x2226, 3, "\xe2\x88\xa6" }, // &nspar;
+{ 0x22e2, 3, "\xe2\x8b\xa2" }, // &nsqsube;
+{ 0x22e3, 3, "\xe2\x8b\xa3" }, // &nsqsupe;
+{ 0x2284, 3, "\xe2\x8a\x84" }, // &nsub;
+{ 0x2ac5, 5, "\xe2\xab\x85\xcc\xb8" }, // &nsubE;
+{ 0x2288, 3, "\xe2\x8a\x88" }, // &nsube;
+{ 0x2282, 6, "\xe2\x8a\x82\xe2\x83\x92" }, // &nsubset;
+{ 0x2288, 3, "\xe2\x8a\x88" }, // &nsubseteq;
+{ 0x2ac5, 5, "\xe2\xab\x85\xcc\xb8" }, // &nsubseteqq;
+{ 0x2281, 3, "\xe2\x8a\x81" }, // &nsucc;
+{ 0x2ab0, 5, "\xe2\xaa\xb0\xcc\xb8" }, // &nsucceq;
+{ 0x2285, 3, "\xe2\x8a\x85" }, // &nsup;
+{ 0x2ac6, 5, "\xe2\xab\x86\xcc\xb8" }, // &nsupE;
+{ 0x2289, 3, "\xe2\x8a\x89" }, // &nsupe;
+{ 0x2283, 6, "\xe2\x8a\x83\xe2\x83\x92" }, // &nsupset;
+{ 0x2289, 3, "\xe2\x8a\x89" }, // &nsupseteq;
+{ 0x2ac6, 5, "\xe2\xab\x86\xcc\xb8" }, // &nsupseteqq;
+{ 0x2279, 3, "\xe2\x89\xb9" }, // &ntgl;
+{ 0xd1, 2, "\xc3\x91" }, // &Ntilde;
+{ 0xf1, 2, "\xc3\xb1" }, // &ntilde;
+{ 0x2278, 3, "\xe2\x89\xb8" }, // &ntlg;
+{ 0x22ea, 3, "\xe2\x8b\xaa" }, // &ntriangleleft;
+{ 0x22ec, 3, "\xe2\x8b\xac" }, // &ntrianglelefteq;
+{ 0x22eb, 3, "\xe2\x8b\xab" }, // &ntriangleright;
+{ 0x22ed, 3, "\xe2\x8b\xad" }, // &ntrianglerighteq;
+{ 0x39d, 2, "\xce\x9d" }, // &Nu;
+{ 0x3bd, 2, "\xce\xbd" }, // &nu;
+{ 0x23, 1, "\x23" }, // &num;
+{ 0x2116, 3, "\xe2\x84\x96" }, // &numero;
+{ 0x2007, 3, "\xe2\x80\x87" }, // &numsp;
+{ 0x224d, 6, "\xe2\x89\x8d\xe2\x83\x92" }, // &nvap;
+{ 0x22af, 3, "\xe2\x8a\xaf" }, // &nVDash;
+{ 0x22ae, 3, "\xe2\x8a\xae" }, // &nVdash;
+{ 0x22ad, 3, "\xe2\x8a\xad" }, // &nvDash;
+{ 0x22ac, 3, "\xe2\x8a\xac" }, // &nvdash;
+{ 0x2265, 6, "\xe2\x89\xa5\xe2\x83\x92" }, // &nvge;
+{ 0x3e, 4, "\x3e\xe2\x83\x92" }, // &nvgt;
+{ 0x2904, 3, "\xe2\xa4\x84" }, // &nvHarr;
+{ 0x29de, 3, "\xe2\xa7\x9e" }, // &nvinfin;
+{ 0x2902, 3, "\xe2\xa4\x82" }, // &nvlArr;
+{ 0x2264, 6, "\xe2\x89\xa4\xe2\x83\x92" }, // &nvle;
+{ 0x3c, 4, "\x3c\xe2\x83\x92" }, // &nvlt;
+{ 0x22b4, 6, "\xe2\x8a\xb4\xe2\x83\x92" }, // &nvltrie;
+{ 0x2903, 3, "\xe2\xa4\x83" }, // &nvrArr;
+{ 0x22b5, 6, "\xe2\x8a\xb5\xe2\x83\x92" }, // &nvrtrie;
+{ 0x223c, 6, "\xe2\x88\xbc\xe2\x83\x92" }, // &nvsim;
+{ 0x2923, 3, "\xe2\xa4\xa3" }, // &nwarhk;
+{ 0x21d6, 3, "\xe2\x87\x96" }, // &nwArr;
+{ 0x2196, 3, "\xe2\x86\x96" }, // &nwarr;
+{ 0x2196, 3, "\xe2\x86\x96" }, // &nwarrow;
+{ 0x2927, 3, "\xe2\xa4\xa7" }, // &nwnear;
+{ 0xd3, 2, "\xc3\x93" }, // &Oacute;
+{ 0xf3, 2, "\xc3\xb3" }, // &oacute;
+{ 0x229b, 3, "\xe2\x8a\x9b" }, // &oast;
+{ 0x229a, 3, "\xe2\x8a\x9a" }, // &ocir;
+{ 0xd4, 2, "\xc3\x94" }, // &Ocirc;
+{ 0xf4, 2, "\xc3\xb4" }, // &ocirc;
+{ 0x41e, 2, "\xd0\x9e" }, // &Ocy;
+{ 0x43e, 2, "\xd0\xbe" }, // &ocy;
+{ 0x229d, 3, "\xe2\x8a\x9d" }, // &odash;
+{ 0x150, 2, "\xc5\x90" }, // &Odblac;
+{ 0x151, 2, "\xc5\x91" }, // &odblac;
+{ 0x2a38, 3, "\xe2\xa8\xb8" }, // &odiv;
+{ 0x2299, 3, "\xe2\x8a\x99" }, // &odot;
+{ 0x29bc, 3, "\xe2\xa6\xbc" }, // &odsold;
+{ 0x152, 2, "\xc5\x92" }, // &OElig;
+{ 0x153, 2, "\xc5\x93" }, // &oelig;
+{ 0x29bf, 3, "\xe2\xa6\xbf" }, // &ofcir;
+{ 0x1d512, 4, "\xf0\x9d\x94\x92" }, // &Ofr;
+{ 0x1d52c, 4, "\xf0\x9d\x94\xac" }, // &ofr;
+{ 0x2db, 2, "\xcb\x9b" }, // &ogon;
+{ 0xd2, 2, "\xc3\x92" }, // &Ograve;
+{ 0xf2, 2, "\xc3\xb2" }, // &ograve;
+{ 0x29c1, 3, "\xe2\xa7\x81" }, // &ogt;
+{ 0x29b5, 3, "\xe2\xa6\xb5" }, // &ohbar;
+{ 0x3a9, 2, "\xce\xa9" }, // &ohm;
+{ 0x222e, 3, "\xe2\x88\xae" }, // &oint;
+{ 0x21ba, 3, "\xe2\x86\xba" }, // &olarr;
+{ 0x29be, 3, "\xe2\xa6\xbe" }, // &olcir;
+{ 0x29bb, 3, "\xe2\xa6\xbb" }, // &olcross;
+{ 0x203e, 3, "\xe2\x80\xbe" }, // &oline;
+{ 0x29c0, 3, "\xe2\xa7\x80" }, // &olt;
+{ 0x14c, 2, "\xc5\x8c" }, // &Omacr;
+{ 0x14d, 2, "\xc5\x8d" }, // &omacr;
+{ 0x3a9, 2, "\xce\xa9" }, // &Omega;
+{ 0x3c9, 2, "\xcf\x89" }, // &omega;
+{ 0x39f, 2, "\xce\x9f" }, // &Omicron;
+{ 0x3bf, 2, "\xce\xbf" }, // &omicron;
+{ 0x29b6, 3, "\xe2\xa6\xb6" }, // &omid;
+{ 0x2296, 3, "\xe2\x8a\x96" }, // &ominus;
+{ 0x1d546, 4, "\xf0\x9d\x95\x86" }, // &Oopf;
+{ 0x1d560, 4, "\xf0\x9d\x95\xa0" }, // &oopf;
+{ 0x29b7, 3, "\xe2\xa6\xb7" }, // &opar;
+{ 0x201c, 3, "\xe2\x80\x9c" }, // &OpenCurlyDoubleQuote;
+{ 0x2018, 3, "\xe2\x80\x98" }, // &OpenCurlyQuote;
+{ 0x29b9, 3, "\xe2\xa6\xb9" }, // &operp;
+{ 0x2295, 3, "\xe2\x8a\x95" }, // &oplus;
+{ 0x2a54, 3, "\xe2\xa9\x94" }, // &Or;
+{ 0x2228, 3, "\xe2\x88\xa8" }, // &or;
+{ 0x21bb, 3, "\xe2\x86\xbb" }, // &orarr;
+{ 0x2a5d, 3, "\xe2\xa9\x9d" }, // &ord;
+{ 0x2134, 3, "\xe2\x84\xb4" }, // &order;
+{ 0x2134, 3, "\xe2\x84\xb4" }, // &orderof;
+{ 0xaa, 2, "\xc2\xaa" }, // &ordf;
+{ 0xba, 2, "\xc2\xba" }, // &ordm;
+{ 0x22b6, 3, "\xe2\x8a\xb6" }, // &origof;
+{ 0x2a56, 3, "\xe2\xa9\x96" }, // &oror;
+{ 0x2a57, 3, "\xe2\xa9\x97" }, // &orslope;
+{ 0x2a5b, 3, "\xe2\xa9\x9b" }, // &orv;
+{ 0x24c8, 3, "\xe2\x93\x88" }, // &oS;
+{ 0x1d4aa, 4, "\xf0\x9d\x92\xaa" }, // &Oscr;
+{ 0x2134, 3, "\xe2\x84\xb4" }, // &oscr;
+{ 0xd8, 2, "\xc3\x98" }, // &Oslash;
+{ 0xf8, 2, "\xc3\xb8" }, // &oslash;
+{ 0x2298, 3, "\xe2\x8a\x98" }, // &osol;
+{ 0xd5, 2, "\xc3\x95" }, // &Otilde;
+{ 0xf5, 2, "\xc3\xb5" }, // &otilde;
+{ 0x2a37, 3, "\xe2\xa8\xb7" }, // &Otimes;
+{ 0x2297, 3, "\xe2\x8a\x97" }, // &otimes;
+{ 0x2a36, 3, "\xe2\xa8\xb6" }, // &otimesas;
+{ 0xd6, 2, "\xc3\x96" }, // &Ouml;
+{ 0xf6, 2, "\xc3\xb6" }, // &ouml;
+{ 0x233d, 3, "\xe2\x8c\xbd" }, // &ovbar;
+{ 0x203e, 3, "\xe2\x80\xbe" }, // &OverBar;
+{ 0x23de, 3, "\xe2\x8f\x9e" }, // &OverBrace;
+{ 0x23b4, 3, "\xe2\x8e\xb4" }, // &OverBracket;
+{ 0x23dc, 3, "\xe2\x8f\x9c" }, // &OverParenthesis;
+{ 0x2225, 3, "\xe2\x88\xa5" }, // &par;
+{ 0xb6, 2, "\xc2\xb6" }, // &para;
+{ 0x2225, 3, "\xe2\x88\xa5" }, // &parallel;
+{ 0x2af3, 3, "\xe2\xab\xb3" }, // &parsim;
+{ 0x2afd, 3, "\xe2\xab\xbd" }, // &parsl;
+{ 0x2202, 3, "\xe2\x88\x82" }, // &part;
+{ 0x2202, 3, "\xe2\x88\x82" }, // &PartialD;
+{ 0x41f, 2, "\xd0\x9f" }, // &Pcy;
+{ 0x43f, 2, "\xd0\xbf" }, // &pcy;
+{ 0x25, 1, "\x25" }, // &percnt;
+{ 0x2e, 1, "\x2e" }, // &period;
+{ 0x2030, 3, "\xe2\x80\xb0" }, // &permil;
+{ 0x22a5, 3, "\xe2\x8a\xa5" }, // &perp;
+{ 0x2031, 3, "\xe2\x80\xb1" }, // &pertenk;
+{ 0x1d513, 4, "\xf0\x9d\x94\x93" }, // &Pfr;
+{ 0x1d52d, 4, "\xf0\x9d\x94\xad" }, // &pfr;
+{ 0x3a6, 2, "\xce\xa6" }, // &Phi;
+{ 0x3c6, 2, "\xcf\x86" }, // &phi;
+{ 0x3d5, 2, "\xcf\x95" }, // &phiv;
+{ 0x2133, 3, "\xe2\x84\xb3" }, // &phmmat;
+{ 0x260e, 3, "\xe2\x98\x8e" }, // &phone;
+{ 0x3a0, 2, "\xce\xa0" }, // &Pi;
+{ 0x3c0, 2, "\xcf\x80" }, // &pi;
+{ 0x22d4, 3, "\xe2\x8b\x94" }, // &pitchfork;
+{ 0x3d6, 2, "\xcf\x96" }, // &piv;
+{ 0x210f, 3, "\xe2\x84\x8f" }, // &planck;
+{ 0x210e, 3, "\xe2\x84\x8e" }, // &planckh;
+{ 0x210f, 3, "\xe2\x84\x8f" }, // &plankv;
+{ 0x2b, 1, "\x2b" }, // &plus;
+{ 0x2a23, 3, "\xe2\xa8\xa3" }, // &plusacir;
+{ 0x229e, 3, "\xe2\x8a\x9e" }, // &plusb;
+{ 0x2a22, 3, "\xe2\xa8\xa2" }, // &pluscir;
+{ 0x2214, 3, "\xe2\x88\x94" }, // &plusdo;
+{ 0x2a25, 3, "\xe2\xa8\xa5" }, // &plusdu;
+{ 0x2a72, 3, "\xe2\xa9\xb2" }, // &pluse;
+{ 0xb1, 2, "\xc2\xb1" }, // &PlusMinus;
+{ 0xb1, 2, "\xc2\xb1" }, // &plusmn;
+{ 0x2a26, 3, "\xe2\xa8\xa6" }, // &plussim;
+{ 0x2a27, 3, "\xe2\xa8\xa7" }, // &plustwo;
+{ 0xb1, 2, "\xc2\xb1" }, // &pm;
+{ 0x210c, 3, "\xe2\x84\x8c" }, // &Poincareplane;
+{ 0x2a15, 3, "\xe2\xa8\x95" }, // &pointint;
+{ 0x2119, 3, "\xe2\x84\x99" }, // &Popf;
+{ 0x1d561, 4, "\xf0\x9d\x95\xa1" }, // &popf;
+{ 0xa3, 2, "\xc2\xa3" }, // &pound;
+{ 0x2abb, 3, "\xe2\xaa\xbb" }, // &Pr;
+{ 0x227a, 3, "\xe2\x89\xba" }, // &pr;
+{ 0x2ab7, 3, "\xe2\xaa\xb7" }, // &prap;
+{ 0x227c, 3, "\xe2\x89\xbc" }, // &prcue;
+{ 0x2ab3, 3, "\xe2\xaa\xb3" }, // &prE;
+{ 0x2aaf, 3, "\xe2\xaa\xaf" }, // &pre;
+{ 0x227a, 3, "\xe2\x89\xba" }, // &prec;
+{ 0x2ab7, 3, "\xe2\xaa\xb7" }, // &precapprox;
+{ 0x227c, 3, "\xe2\x89\xbc" }, // &preccurlyeq;
+{ 0x227a, 3, "\xe2\x89\xba" }, // &Precedes;
+{ 0x2aaf, 3, "\xe2\xaa\xaf" }, // &PrecedesEqual;
+{ 0x227c, 3, "\xe2\x89\xbc" }, // &PrecedesSlantEqual;
+{ 0x227e, 3, "\xe2\x89\xbe" }, // &PrecedesTilde;
+{ 0x2aaf, 3, "\xe2\xaa\xaf" }, // &preceq;
+{ 0x2ab9, 3, "\xe2\xaa\xb9" }, // &precnapprox;
+{ 0x2ab5, 3, "\xe2\xaa\xb5" }, // &precneqq;
+{ 0x22e8, 3, "\xe2\x8b\xa8" }, // &precnsim;
+{ 0x227e, 3, "\xe2\x89\xbe" }, // &precsim;
+{ 0x2033, 3, "\xe2\x80\xb3" }, // &Prime;
+{ 0x2032, 3, "\xe2\x80\xb2" }, // &prime;
+{ 0x2119, 3, "\xe2\x84\x99" }, // &primes;
+{ 0x2ab9, 3, "\xe2\xaa\xb9" }, // &prnap;
+{ 0x2ab5, 3, "\xe2\xaa\xb5" }, // &prnE;
+{ 0x22e8, 3, "\xe2\x8b\xa8" }, // &prnsim;
+{ 0x220f, 3, "\xe2\x88\x8f" }, // &prod;
+{ 0x220f, 3, "\xe2\x88\x8f" }, // &Product;
+{ 0x232e, 3, "\xe2\x8c\xae" }, // &profalar;
+{ 0x2312, 3, "\xe2\x8c\x92" }, // &profline;
+{ 0x2313, 3, "\xe2\x8c\x93" }, // &profsurf;
+{ 0x221d, 3, "\xe2\x88\x9d" }, // &prop;
+{ 0x2237, 3, "\xe2\x88\xb7" }, // &Proportion;
+{ 0x221d, 3, "\xe2\x88\x9d" }, // &Proportional;
+{ 0x221d, 3, "\xe2\x88\x9d" }, // &propto;
+{ 0x227e, 3, "\xe2\x89\xbe" }, // &prsim;
+{ 0x22b0, 3, "\xe2\x8a\xb0" }, // &prurel;
+{ 0x1d4ab, 4, "\xf0\x9d\x92\xab" }, // &Pscr;
+{ 0x1d4c5, 4, "\xf0\x9d\x93\x85" }, // &pscr;
+{ 0x3a8, 2, "\xce\xa8" }, // &Psi;
+{ 0x3c8, 2, "\xcf\x88" }, // &psi;
+{ 0x2008, 3, "\xe2\x80\x88" }, // &puncsp;
+{ 0x1d514, 4, "\xf0\x9d\x94\x94" }, // &Qfr;
+{ 0x1d52e, 4, "\xf0\x9d\x94\xae" }, // &qfr;
+{ 0x2a0c, 3, "\xe2\xa8\x8c" }, // &qint;
+{ 0x211a, 3, "\xe2\x84\x9a" }, // &Qopf;
+{ 0x1d562, 4, "\xf0\x9d\x95\xa2" }, // &qopf;
+{ 0x2057, 3, "\xe2\x81\x97" }, // &qprime;
+{ 0x1d4ac, 4, "\xf0\x9d\x92\xac" }, // &Qscr;
+{ 0x1d4c6, 4, "\xf0\x9d\x93\x86" }, // &qscr;
+{ 0x210d, 3, "\xe2\x84\x8d" }, // &quaternions;
+{ 0x2a16, 3, "\xe2\xa8\x96" }, // &quatint;
+{ 0x3f, 1, "\x3f" }, // &quest;
+{ 0x225f, 3, "\xe2\x89\x9f" }, // &questeq;
+{ 0x22, 1, "\x22" }, // &QUOT;
+{ 0x22, 1, "\x22" }, // &quot;
+{ 0x21db, 3, "\xe2\x87\x9b" }, // &rAarr;
+{ 0x223d, 5, "\xe2\x88\xbd\xcc\xb1" }, // &race;
+{ 0x154, 2, "\xc5\x94" }, // &Racute;
+{ 0x155, 2, "\xc5\x95" }, // &racute;
+{ 0x221a, 3, "\xe2\x88\x9a" }, // &radic;
+{ 0x29b3, 3, "\xe2\xa6\xb3" }, // &raemptyv;
+{ 0x27eb, 3, "\xe2\x9f\xab" }, // &Rang;
+{ 0x27e9, 3, "\xe2\x9f\xa9" }, // &rang;
+{ 0x2992, 3, "\xe2\xa6\x92" }, // &rangd;
+{ 0x29a5, 3, "\xe2\xa6\xa5" }, // &range;
+{ 0x27e9, 3, "\xe2\x9f\xa9" }, // &rangle;
+{ 0xbb, 2, "\xc2\xbb" }, // &raquo;
+{ 0x21a0, 3, "\xe2\x86\xa0" }, // &Rarr;
+{ 0x21d2, 3, "\xe2\x87\x92" }, // &rArr;
+{ 0x2192, 3, "\xe2\x86\x92" }, // &rarr;
+{ 0x2975, 3, "\xe2\xa5\xb5" }, // &rarrap;
+{ 0x21e5, 3, "\xe2\x87\xa5" }, // &rarrb;
+{ 0x2920, 3, "\xe2\xa4\xa0" }, // &rarrbfs;
+{ 0x2933, 3, "\xe2\xa4\xb3" }, // &rarrc;
+{ 0x291e, 3, "\xe2\xa4\x9e" }, // &rarrfs;
+{ 0x21aa, 3, "\xe2\x86\xaa" }, // &rarrhk;
+{ 0x21ac, 3, "\xe2\x86\xac" }, // &rarrlp;
+{ 0x2945, 3, "\xe2\xa5\x85" }, // &rarrpl;
+{ 0x2974, 3, "\xe2\xa5\xb4" }, // &rarrsim;
+{ 0x2916, 3, "\xe2\xa4\x96" }, // &Rarrtl;
+{ 0x21a3, 3, "\xe2\x86\xa3" }, // &rarrtl;
+{ 0x219d, 3, "\xe2\x86\x9d" }, // &rarrw;
+{ 0x291c, 3, "\xe2\xa4\x9c" }, // &rAtail;
+{ 0x291a, 3, "\xe2\xa4\x9a" }, // &ratail;
+{ 0x2236, 3, "\xe2\x88\xb6" }, // &ratio;
+{ 0x211a, 3, "\xe2\x84\x9a" }, // &rationals;
+{ 0x2910, 3, "\xe2\xa4\x90" }, // &RBarr;
+{ 0x290f, 3, "\xe2\xa4\x8f" }, // &rBarr;
+{ 0x290d, 3, "\xe2\xa4\x8d" }, // &rbarr;
+{ 0x2773, 3, "\xe2\x9d\xb3" }, // &rbbrk;
+{ 0x7d, 1, "\x7d" }, // &rbrace;
+{ 0x5d, 1, "\x5d" }, // &rbrack;
+{ 0x298c, 3, "\xe2\xa6\x8c" }, // &rbrke;
+{ 0x298e, 3, "\xe2\xa6\x8e" }, // &rbrksld;
+{ 0x2990, 3, "\xe2\xa6\x90" }, // &rbrkslu;
+{ 0x158, 2, "\xc5\x98" }, // &Rcaron;
+{ 0x159, 2, "\xc5\x99" }, // &rcaron;
+{ 0x156, 2, "\xc5\x96" }, // &Rcedil;
+{ 0x157, 2, "\xc5\x97" }, // &rcedil;
+{ 0x2309, 3, "\xe2\x8c\x89" }, // &rceil;
+{ 0x7d, 1, "\x7d" }, // &rcub;
+{ 0x420, 2, "\xd0\xa0" }, // &Rcy;
+{ 0x440, 2, "\xd1\x80" }, // &rcy;
+{ 0x2937, 3, "\xe2\xa4\xb7" }, // &rdca;
+{ 0x2969, 3, "\xe2\xa5\xa9" }, // &rdldhar;
+{ 0x201d, 3, "\xe2\x80\x9d" }, // &rdquo;
+{ 0x201d, 3, "\xe2\x80\x9d" }, // &rdquor;
+{ 0x21b3, 3, "\xe2\x86\xb3" }, // &rdsh;
+{ 0x211c, 3, "\xe2\x84\x9c" }, // &Re;
+{ 0x211c, 3, "\xe2\x84\x9c" }, // &real;
+{ 0x211b, 3, "\xe2\x84\x9b" }, // &realine;
+{ 0x211c, 3, "\xe2\x84\x9c" }, // &realpart;
+{ 0x211d, 3, "\xe2\x84\x9d" }, // &reals;
+{ 0x25ad, 3, "\xe2\x96\xad" }, // &rect;
+{ 0xae, 2, "\xc2\xae" }, // &REG;
+{ 0xae, 2, "\xc2\xae" }, // &reg;
+{ 0x220b, 3, "\xe2\x88\x8b" }, // &ReverseElement;
+{ 0x21cb, 3, "\xe2\x87\x8b" }, // &ReverseEquilibrium;
+{ 0x296f, 3, "\xe2\xa5\xaf" }, // &ReverseUpEquilibrium;
+{ 0x297d, 3, "\xe2\xa5\xbd" }, // &rfisht;
+{ 0x230b, 3, "\xe2\x8c\x8b" }, // &rfloor;
+{ 0x211c, 3, "\xe2\x84\x9c" }, // &Rfr;
+{ 0x1d52f, 4, "\xf0\x9d\x94\xaf" }, // &rfr;
+{ 0x2964, 3, "\xe2\xa5\xa4" }, // &rHar;
+{ 0x21c1, 3, "\xe2\x87\x81" }, // &rhard;
+{ 0x21c0, 3, "\xe2\x87\x80" }, // &rharu;
+{ 0x296c, 3, "\xe2\xa5\xac" }, // &rharul;
+{ 0x3a1, 2, "\xce\xa1" }, // &Rho;
+{ 0x3c1, 2, "\xcf\x81" }, // &rho;
+{ 0x3f1, 2, "\xcf\xb1" }, // &rhov;
+{ 0x27e9, 3, "\xe2\x9f\xa9" }, // &RightAngleBracket;
+{ 0x2192, 3, "\xe2\x86\x92" }, // &RightArrow;
+{ 0x21d2, 3, "\xe2\x87\x92" }, // &Rightarrow;
+{ 0x2192, 3, "\xe2\x86\x92" }, // &rightarrow;
+{ 0x21e5, 3, "\xe2\x87\xa5" }, // &RightArrowBar;
+{ 0x21c4, 3, "\xe2\x87\x84" }, // &RightArrowLeftArrow;
+{ 0x21a3, 3, "\xe2\x86\xa3" }, // &rightarrowtail;
+{ 0x2309, 3, "\xe2\x8c\x89" }, // &RightCeiling;
+{ 0x27e7, 3, "\xe2\x9f\xa7" }, // &RightDoubleBracket;
+{ 0x295d, 3, "\xe2\xa5\x9d" }, // &RightDownTeeVector;
+{ 0x21c2, 3, "\xe2\x87\x82" }, // &RightDownVector;
+{ 0x2955, 3, "\xe2\xa5\x95" }, // &RightDownVectorBar;
+{ 0x230b, 3, "\xe2\x8c\x8b" }, // &RightFloor;
+{ 0x21c1, 3, "\xe2\x87\x81" }, // &rightharpoondown;
+{ 0x21c0, 3, "\xe2\x87\x80" }, // &rightharpoonup;
+{ 0x21c4, 3, "\xe2\x87\x84" }, // &rightleftarrows;
+{ 0x21cc, 3, "\xe2\x87\x8c" }, // &rightleftharpoons;
+{ 0x21c9, 3, "\xe2\x87\x89" }, // &rightrightarrows;
+{ 0x219d, 3, "\xe2\x86\x9d" }, // &rightsquigarrow;
+{ 0x22a2, 3, "\xe2\x8a\xa2" }, // &RightTee;
+{ 0x21a6, 3, "\xe2\x86\xa6" }, // &RightTeeArrow;
+{ 0x295b, 3, "\xe2\xa5\x9b" }, // &RightTeeVector;
+{ 0x22cc, 3, "\xe2\x8b\x8c" }, // &rightthreetimes;
+{ 0x22b3, 3, "\xe2\x8a\xb3" }, // &RightTriangle;
+{ 0x29d0, 3, "\xe2\xa7\x90" }, // &RightTriangleBar;
+{ 0x22b5, 3, "\xe2\x8a\xb5" }, // &RightTriangleEqual;
+{ 0x294f, 3, "\xe2\xa5\x8f" }, // &RightUpDownVector;
+{ 0x295c, 3, "\xe2\xa5\x9c" }, // &RightUpTeeVector;
+{ 0x21be, 3, "\xe2\x86\xbe" }, // &RightUpVector;
+{ 0x2954, 3, "\xe2\xa5\x94" }, // &RightUpVectorBar;
+{ 0x21c0, 3, "\xe2\x87\x80" }, // &RightVector;
+{ 0x2953, 3, "\xe2\xa5\x93" }, // &RightVectorBar;
+{ 0x2da, 2, "\xcb\x9a" }, // &ring;
+{ 0x2253, 3, "\xe2\x89\x93" }, // &risingdotseq;
+{ 0x21c4, 3, "\xe2\x87\x84" }, // &rlarr;
+{ 0x21cc, 3, "\xe2\x87\x8c" }, // &rlhar;
+{ 0x200f, 3, "\xe2\x80\x8f" }, // &rlm;
+{ 0x23b1, 3, "\xe2\x8e\xb1" }, // &rmoust;
+{ 0x23b1, 3, "\xe2\x8e\xb1" }, // &rmoustache;
+{ 0x2aee, 3, "\xe2\xab\xae" }, // &rnmid;
+{ 0x27ed, 3, "\xe2\x9f\xad" }, // &roang;
+{ 0x21fe, 3, "\xe2\x87\xbe" }, // &roarr;
+{ 0x27e7, 3, "\xe2\x9f\xa7" }, // &robrk;
+{ 0x2986, 3, "\xe2\xa6\x86" }, // &ropar;
+{ 0x211d, 3, "\xe2\x84\x9d" }, // &Ropf;
+{ 0x1d563, 4, "\xf0\x9d\x95\xa3" }, // &ropf;
+{ 0x2a2e, 3, "\xe2\xa8\xae" }, // &roplus;
+{ 0x2a35, 3, "\xe2\xa8\xb5" }, // &rotimes;
+{ 0x2970, 3, "\xe2\xa5\xb0" }, // &RoundImplies;
+{ 0x29, 1, "\x29" }, // &rpar;
+{ 0x2994, 3, "\xe2\xa6\x94" }, // &rpargt;
+{ 0x2a12, 3, "\xe2\xa8\x92" }, // &rppolint;
+{ 0x21c9, 3, "\xe2\x87\x89" }, // &rrarr;
+{ 0x21db, 3, "\xe2\x87\x9b" }, // &Rrightarrow;
+{ 0x203a, 3, "\xe2\x80\xba" }, // &rsaquo;
+{ 0x211b, 3, "\xe2\x84\x9b" }, // &Rscr;
+{ 0x1d4c7, 4, "\xf0\x9d\x93\x87" }, // &rscr;
+{ 0x21b1, 3, "\xe2\x86\xb1" }, // &Rsh;
+{ 0x21b1, 3, "\xe2\x86\xb1" }, // &rsh;
+{ 0x5d, 1, "\x5d" }, // &rsqb;
+{ 0x2019, 3, "\xe2\x80\x99" }, // &rsquo;
+{ 0x2019, 3, "\xe2\x80\x99" }, // &rsquor;
+{ 0x22cc, 3, "\xe2\x8b\x8c" }, // &rthree;
+{ 0x22ca, 3, "\xe2\x8b\x8a" }, // &rtimes;
+{ 0x25b9, 3, "\xe2\x96\xb9" }, // &rtri;
+{ 0x22b5, 3, "\xe2\x8a\xb5" }, // &rtrie;
+{ 0x25b8, 3, "\xe2\x96\xb8" }, // &rtrif;
+{ 0x29ce, 3, "\xe2\xa7\x8e" }, // &rtriltri;
+{ 0x29f4, 3, "\xe2\xa7\xb4" }, // &RuleDelayed;
+{ 0x2968, 3, "\xe2\xa5\xa8" }, // &ruluhar;
+{ 0x211e, 3, "\xe2\x84\x9e" }, // &rx;
+{ 0x15a, 2, "\xc5\x9a" }, // &Sacute;
+{ 0x15b, 2, "\xc5\x9b" }, // &sacute;
+{ 0x201a, 3, "\xe2\x80\x9a" }, // &sbquo;
+{ 0x2abc, 3, "\xe2\xaa\xbc" }, // &Sc;
+{ 0x227b, 3, "\xe2\x89\xbb" }, // &sc;
+{ 0x2ab8, 3, "\xe2\xaa\xb8" }, // &scap;
+{ 0x160, 2, "\xc5\xa0" }, // &Scaron;
+{ 0x161, 2, "\xc5\xa1" }, // &scaron;
+{ 0x227d, 3, "\xe2\x89\xbd" }, // &sccue;
+{ 0x2ab4, 3, "\xe2\xaa\xb4" }, // &scE;
+{ 0x2ab0, 3, "\xe2\xaa\xb0" }, // &sce;
+{ 0x15e, 2, "\xc5\x9e" }, // &Scedil;
+{ 0x15f, 2, "\xc5\x9f" }, // &scedil;
+{ 0x15c, 2, "\xc5\x9c" }, // &Scirc;
+{ 0x15d, 2, "\xc5\x9d" }, // &scirc;
+{ 0x2aba, 3, "\xe2\xaa\xba" }, // &scnap;
+{ 0x2ab6, 3, "\xe2\xaa\xb6" }, // &scnE;
+{ 0x22e9, 3, "\xe2\x8b\xa9" }, // &scnsim;
+{ 0x2a13, 3, "\xe2\xa8\x93" }, // &scpolint;
+{ 0x227f, 3, "\xe2\x89\xbf" }, // &scsim;
+{ 0x421, 2, "\xd0\xa1" }, // &Scy;
+{ 0x441, 2, "\xd1\x81" }, // &scy;
+{ 0x22c5, 3, "\xe2\x8b\x85" }, // &sdot;
+{ 0x22a1, 3, "\xe2\x8a\xa1" }, // &sdotb;
+{ 0x2a66, 3, "\xe2\xa9\xa6" }, // &sdote;
+{ 0x2925, 3, "\xe2\xa4\xa5" }, // &searhk;
+{ 0x21d8, 3, "\xe2\x87\x98" }, // &seArr;
+{ 0x2198, 3, "\xe2\x86\x98" }, // &searr;
+{ 0x2198, 3, "\xe2\x86\x98" }, // &searrow;
+{ 0xa7, 2, "\xc2\xa7" }, // &sect;
+{ 0x3b, 1, "\x3b" }, // &semi;
+{ 0x2929, 3, "\xe2\xa4\xa9" }, // &seswar;
+{ 0x2216, 3, "\xe2\x88\x96" }, // &setminus;
+{ 0x2216, 3, "\xe2\x88\x96" }, // &setmn;
+{ 0x2736, 3, "\xe2\x9c\xb6" }, // &sext;
+{ 0x1d516, 4, "\xf0\x9d\x94\x96" }, // &Sfr;
+{ 0x1d530, 4, "\xf0\x9d\x94\xb0" }, // &sfr;
+{ 0x2322, 3, "\xe2\x8c\xa2" }, // &sfrown;
+{ 0x266f, 3, "\xe2\x99\xaf" }, // &sharp;
+{ 0x429, 2, "\xd0\xa9" }, // &SHCHcy;
+{ 0x449, 2, "\xd1\x89" }, // &shchcy;
+{ 0x428, 2, "\xd0\xa8" }, // &SHcy;
+{ 0x448, 2, "\xd1\x88" }, // &shcy;
+{ 0x2193, 3, "\xe2\x86\x93" }, // &ShortDownArrow;
+{ 0x2190, 3, "\xe2\x86\x90" }, // &ShortLeftArrow;
+{ 0x2223, 3, "\xe2\x88\xa3" }, // &shortmid;
+{ 0x2225, 3, "\xe2\x88\xa5" }, // &shortparallel;
+{ 0x2192, 3, "\xe2\x86\x92" }, // &ShortRightArrow;
+{ 0x2191, 3, "\xe2\x86\x91" }, // &ShortUpArrow;
+{ 0xad, 2, "\xc2\xad" }, // &shy;
+{ 0x3a3, 2, "\xce\xa3" }, // &Sigma;
+{ 0x3c3, 2, "\xcf\x83" }, // &sigma;
+{ 0x3c2, 2, "\xcf\x82" }, // &sigmaf;
+{ 0x3c2, 2, "\xcf\x82" }, // &sigmav;
+{ 0x223c, 3, "\xe2\x88\xbc" }, // &sim;
+{ 0x2a6a, 3, "\xe2\xa9\xaa" }, // &simdot;
+{ 0x2243, 3, "\xe2\x89\x83" }, // &sime;
+{ 0x2243, 3, "\xe2\x89\x83" }, // &simeq;
+{ 0x2a9e, 3, "\xe2\xaa\x9e" }, // &simg;
+{ 0x2aa0, 3, "\xe2\xaa\xa0" }, // &simgE;
+{ 0x2a9d, 3, "\xe2\xaa\x9d" }, // &siml;
+{ 0x2a9f, 3, "\xe2\xaa\x9f" }, // &simlE;
+{ 0x2246, 3, "\xe2\x89\x86" }, // &simne;
+{ 0x2a24, 3, "\xe2\xa8\xa4" }, // &simplus;
+{ 0x2972, 3, "\xe2\xa5\xb2" }, // &simrarr;
+{ 0x2190, 3, "\xe2\x86\x90" }, // &slarr;
+{ 0x2218, 3, "\xe2\x88\x98" }, // &SmallCircle;
+{ 0x2216, 3, "\xe2\x88\x96" }, // &smallsetminus;
+{ 0x2a33, 3, "\xe2\xa8\xb3" }, // &smashp;
+{ 0x29e4, 3, "\xe2\xa7\xa4" }, // &smeparsl;
+{ 0x2223, 3, "\xe2\x88\xa3" }, // &smid;
+{ 0x2323, 3, "\xe2\x8c\xa3" }, // &smile;
+{ 0x2aaa, 3, "\xe2\xaa\xaa" }, // &smt;
+{ 0x2aac, 3, "\xe2\xaa\xac" }, // &smte;
+{ 0x2aac, 6, "\xe2\xaa\xac\xef\xb8\x80" }, // &smtes;
+{ 0x42c, 2, "\xd0\xac" }, // &SOFTcy;
+{ 0x44c, 2, "\xd1\x8c" }, // &softcy;
+{ 0x2f, 1, "\x2f" }, // &sol;
+{ 0x29c4, 3, "\xe2\xa7\x84" }, // &solb;
+{ 0x233f, 3, "\xe2\x8c\xbf" }, // &solbar;
+{ 0x1d54a, 4, "\xf0\x9d\x95\x8a" }, // &Sopf;
+{ 0x1d564, 4, "\xf0\x9d\x95\xa4" }, // &sopf;
+{ 0x2660, 3, "\xe2\x99\xa0" }, // &spades;
+{ 0x2660, 3, "\xe2\x99\xa0" }, // &spadesuit;
+{ 0x2225, 3, "\xe2\x88\xa5" }, // &spar;
+{ 0x2293, 3, "\xe2\x8a\x93" }, // &sqcap;
+{ 0x2293, 6, "\xe2\x8a\x93\xef\xb8\x80" }, // &sqcaps;
+{ 0x2294, 3, "\xe2\x8a\x94" }, // &sqcup;
+{ 0x2294, 6, "\xe2\x8a\x94\xef\xb8\x80" }, // &sqcups;
+{ 0x221a, 3, "\xe2\x88\x9a" }, // &Sqrt;
+{ 0x228f, 3, "\xe2\x8a\x8f" }, // &sqsub;
+{ 0x2291, 3, "\xe2\x8a\x91" }, // &sqsube;
+{ 0x228f, 3, "\xe2\x8a\x8f" }, // &sqsubset;
+{ 0x2291, 3, "\xe2\x8a\x91" }, // &sqsubseteq;
+{ 0x2290, 3, "\xe2\x8a\x90" }, // &sqsup;
+{ 0x2292, 3, "\xe2\x8a\x92" }, // &sqsupe;
+{ 0x2290, 3, "\xe2\x8a\x90" }, // &sqsupset;
+{ 0x2292, 3, "\xe2\x8a\x92" }, // &sqsupseteq;
+{ 0x25a1, 3, "\xe2\x96\xa1" }, // &squ;
+{ 0x25a1, 3, "\xe2\x96\xa1" }, // &Square;
+{ 0x25a1, 3, "\xe2\x96\xa1" }, // &square;
+{ 0x2293, 3, "\xe2\x8a\x93" }, // &SquareIntersection;
+{ 0x228f, 3, "\xe2\x8a\x8f" }, // &SquareSubset;
+{ 0x2291, 3, "\xe2\x8a\x91" }, // &SquareSubsetEqual;
+{ 0x2290, 3, "\xe2\x8a\x90" }, // &SquareSuperset;
+{ 0x2292, 3, "\xe2\x8a\x92" }, // &SquareSupersetEqual;
+{ 0x2294, 3, "\xe2\x8a\x94" }, // &SquareUnion;
+{ 0x25aa, 3, "\xe2\x96\xaa" }, // &squarf;
+{ 0x25aa, 3, "\xe2\x96\xaa" }, // &squf;
+{ 0x2192, 3, "\xe2\x86\x92" }, // &srarr;
+{ 0x1d4ae, 4, "\xf0\x9d\x92\xae" }, // &Sscr;
+{ 0x1d4c8, 4, "\xf0\x9d\x93\x88" }, // &sscr;
+{ 0x2216, 3, "\xe2\x88\x96" }, // &ssetmn;
+{ 0x2323, 3, "\xe2\x8c\xa3" }, // &ssmile;
+{ 0x22c6, 3, "\xe2\x8b\x86" }, // &sstarf;
+{ 0x22c6, 3, "\xe2\x8b\x86" }, // &Star;
+{ 0x2606, 3, "\xe2\x98\x86" }, // &star;
+{ 0x2605, 3, "\xe2\x98\x85" }, // &starf;
+{ 0x3f5, 2, "\xcf\xb5" }, // &straightepsilon;
+{ 0x3d5, 2, "\xcf\x95" }, // &straightphi;
+{ 0xaf, 2, "\xc2\xaf" }, // &strns;
+{ 0x22d0, 3, "\xe2\x8b\x90" }, // &Sub;
+{ 0x2282, 3, "\xe2\x8a\x82" }, // &sub;
+{ 0x2abd, 3, "\xe2\xaa\xbd" }, // &subdot;
+{ 0x2ac5, 3, "\xe2\xab\x85" }, // &subE;
+{ 0x2286, 3, "\xe2\x8a\x86" }, // &sube;
+{ 0x2ac3, 3, "\xe2\xab\x83" }, // &subedot;
+{ 0x2ac1, 3, "\xe2\xab\x81" }, // &submult;
+{ 0x2acb, 3, "\xe2\xab\x8b" }, // &subnE;
+{ 0x228a, 3, "\xe2\x8a\x8a" }, // &subne;
+{ 0x2abf, 3, "\xe2\xaa\xbf" }, // &subplus;
+{ 0x2979, 3, "\xe2\xa5\xb9" }, // &subrarr;
+{ 0x22d0, 3, "\xe2\x8b\x90" }, // &Subset;
+{ 0x2282, 3, "\xe2\x8a\x82" }, // &subset;
+{ 0x2286, 3, "\xe2\x8a\x86" }, // &subseteq;
+{ 0x2ac5, 3, "\xe2\xab\x85" }, // &subseteqq;
+{ 0x2286, 3, "\xe2\x8a\x86" }, // &SubsetEqual;
+{ 0x228a, 3, "\xe2\x8a\x8a" }, // &subsetneq;
+{ 0x2acb, 3, "\xe2\xab\x8b" }, // &subsetneqq;
+{ 0x2ac7, 3, "\xe2\xab\x87" }, // &subsim;
+{ 0x2ad5, 3, "\xe2\xab\x95" }, // &subsub;
+{ 0x2ad3, 3, "\xe2\xab\x93" }, // &subsup;
+{ 0x227b, 3, "\xe2\x89\xbb" }, // &succ;
+{ 0x2ab8, 3, "\xe2\xaa\xb8" }, // &succapprox;
+{ 0x227d, 3, "\xe2\x89\xbd" }, // &succcurlyeq;
+{ 0x227b, 3, "\xe2\x89\xbb" }, // &Succeeds;
+{ 0x2ab0, 3, "\xe2\xaa\xb0" }, // &SucceedsEqual;
+{ 0x227d, 3, "\xe2\x89\xbd" }, // &SucceedsSlantEqual;
+{ 0x227f, 3, "\xe2\x89\xbf" }, // &SucceedsTilde;
+{ 0x2ab0, 3, "\xe2\xaa\xb0" }, // &succeq;
+{ 0x2aba, 3, "\xe2\xaa\xba" }, // &succnapprox;
+{ 0x2ab6, 3, "\xe2\xaa\xb6" }, // &succneqq;
+{ 0x22e9, 3, "\xe2\x8b\xa9" }, // &succnsim;
+{ 0x227f, 3, "\xe2\x89\xbf" }, // &succsim;
+{ 0x220b, 3, "\xe2\x88\x8b" }, // &SuchThat;
+{ 0x2211, 3, "\xe2\x88\x91" }, // &Sum;
+{ 0x2211, 3, "\xe2\x88\x91" }, // &sum;
+{ 0x266a, 3, "\xe2\x99\xaa" }, // &sung;
+{ 0x22d1, 3, "\xe2\x8b\x91" }, // &Sup;
+{ 0x2283, 3, "\xe2\x8a\x83" }, // &sup;
+{ 0xb9, 2, "\xc2\xb9" }, // &sup1;
+{ 0xb2, 2, "\xc2\xb2" }, // &sup2;
+{ 0xb3, 2, "\xc2\xb3" }, // &sup3;
+{ 0x2abe, 3, "\xe2\xaa\xbe" }, // &supdot;
+{ 0x2ad8, 3, "\xe2\xab\x98" }, // &supdsub;
+{ 0x2ac6, 3, "\xe2\xab\x86" }, // &supE;
+{ 0x2287, 3, "\xe2\x8a\x87" }, // &supe;
+{ 0x2ac4, 3, "\xe2\xab\x84" }, // &supedot;
+{ 0x2283, 3, "\xe2\x8a\x83" }, // &Superset;
+{ 0x2287, 3, "\xe2\x8a\x87" }, // &SupersetEqual;
+{ 0x27c9, 3, "\xe2\x9f\x89" }, // &suphsol;
+{ 0x2ad7, 3, "\xe2\xab\x97" }, // &suphsub;
+{ 0x297b, 3, "\xe2\xa5\xbb" }, // &suplarr;
+{ 0x2ac2, 3, "\xe2\xab\x82" }, // &supmult;
+{ 0x2acc, 3, "\xe2\xab\x8c" }, // &supnE;
+{ 0x228b, 3, "\xe2\x8a\x8b" }, // &supne;
+{ 0x2ac0, 3, "\xe2\xab\x80" }, // &supplus;
+{ 0x22d1, 3, "\xe2\x8b\x91" }, // &Supset;
+{ 0x2283, 3, "\xe2\x8a\x83" }, // &supset;
+{ 0x2287, 3, "\xe2\x8a\x87" }, // &supseteq;
+{ 0x2ac6, 3, "\xe2\xab\x86" }, // &supseteqq;
+{ 0x228b, 3, "\xe2\x8a\x8b" }, // &supsetneq;
+{ 0x2acc, 3, "\xe2\xab\x8c" }, // &supsetneqq;
+{ 0x2ac8, 3, "\xe2\xab\x88" }, // &supsim;
+{ 0x2ad4, 3, "\xe2\xab\x94" }, // &supsub;
+{ 0x2ad6, 3, "\xe2\xab\x96" }, // &supsup;
+{ 0x2926, 3, "\xe2\xa4\xa6" }, // &swarhk;
+{ 0x21d9, 3, "\xe2\x87\x99" }, // &swArr;
+{ 0x2199, 3, "\xe2\x86\x99" }, // &swarr;
+{ 0x2199, 3, "\xe2\x86\x99" }, // &swarrow;
+{ 0x292a, 3, "\xe2\xa4\xaa" }, // &swnwar;
+{ 0xdf, 2, "\xc3\x9f" }, // &szlig;
+{ 0x9, 1, "\x09" }, // &Tab;
+{ 0x2316, 3, "\xe2\x8c\x96" }, // &target;
+{ 0x3a4, 2, "\xce\xa4" }, // &Tau;
+{ 0x3c4, 2, "\xcf\x84" }, // &tau;
+{ 0x23b4, 3, "\xe2\x8e\xb4" }, // &tbrk;
+{ 0x164, 2, "\xc5\xa4" }, // &Tcaron;
+{ 0x165, 2, "\xc5\xa5" }, // &tcaron;
+{ 0x162, 2, "\xc5\xa2" }, // &Tcedil;
+{ 0x163, 2, "\xc5\xa3" }, // &tcedil;
+{ 0x422, 2, "\xd0\xa2" }, // &Tcy;
+{ 0x442, 2, "\xd1\x82" }, // &tcy;
+{ 0x20db, 3, "\xe2\x83\x9b" }, // &tdot;
+{ 0x2315, 3, "\xe2\x8c\x95" }, // &telrec;
+{ 0x1d517, 4, "\xf0\x9d\x94\x97" }, // &Tfr;
+{ 0x1d531, 4, "\xf0\x9d\x94\xb1" }, // &tfr;
+{ 0x2234, 3, "\xe2\x88\xb4" }, // &there4;
+{ 0x2234, 3, "\xe2\x88\xb4" }, // &Therefore;
+{ 0x2234, 3, "\xe2\x88\xb4" }, // &therefore;
+{ 0x398, 2, "\xce\x98" }, // &Theta;
+{ 0x3b8, 2, "\xce\xb8" }, // &theta;
+{ 0x3d1, 2, "\xcf\x91" }, // &thetasym;
+{ 0x3d1, 2, "\xcf\x91" }, // &thetav;
+{ 0x2248, 3, "\xe2\x89\x88" }, // &thickapprox;
+{ 0x223c, 3, "\xe2\x88\xbc" }, // &thicksim;
+{ 0x205f, 6, "\xe2\x81\x9f\xe2\x80\x8a" }, // &ThickSpace;
+{ 0x2009, 3, "\xe2\x80\x89" }, // &thinsp;
+{ 0x2009, 3, "\xe2\x80\x89" }, // &ThinSpace;
+{ 0x2248, 3, "\xe2\x89\x88" }, // &thkap;
+{ 0x223c, 3, "\xe2\x88\xbc" }, // &thksim;
+{ 0xde, 2, "\xc3\x9e" }, // &THORN;
+{ 0xfe, 2, "\xc3\xbe" }, // &thorn;
+{ 0x223c, 3, "\xe2\x88\xbc" }, // &Tilde;
+{ 0x2dc, 2, "\xcb\x9c" }, // &tilde;
+{ 0x2243, 3, "\xe2\x89\x83" }, // &TildeEqual;
+{ 0x2245, 3, "\xe2\x89\x85" }, // &TildeFullEqual;
+{ 0x2248, 3, "\xe2\x89\x88" }, // &TildeTilde;
+{ 0xd7, 2, "\xc3\x97" }, // &times;
+{ 0x22a0, 3, "\xe2\x8a\xa0" }, // &timesb;
+{ 0x2a31, 3, "\xe2\xa8\xb1" }, // &timesbar;
+{ 0x2a30, 3, "\xe2\xa8\xb0" }, // &timesd;
+{ 0x222d, 3, "\xe2\x88\xad" }, // &tint;
+{ 0x2928, 3, "\xe2\xa4\xa8" }, // &toea;
+{ 0x22a4, 3, "\xe2\x8a\xa4" }, // &top;
+{ 0x2336, 3, "\xe2\x8c\xb6" }, // &topbot;
+{ 0x2af1, 3, "\xe2\xab\xb1" }, // &topcir;
+{ 0x1d54b, 4, "\xf0\x9d\x95\x8b" }, // &Topf;
+{ 0x1d565, 4, "\xf0\x9d\x95\xa5" }, // &topf;
+{ 0x2ada, 3, "\xe2\xab\x9a" }, // &topfork;
+{ 0x2929, 3, "\xe2\xa4\xa9" }, // &tosa;
+{ 0x2034, 3, "\xe2\x80\xb4" }, // &tprime;
+{ 0x2122, 3, "\xe2\x84\xa2" }, // &TRADE;
+{ 0x2122, 3, "\xe2\x84\xa2" }, // &trade;
+{ 0x25b5, 3, "\xe2\x96\xb5" }, // &triangle;
+{ 0x25bf, 3, "\xe2\x96\xbf" }, // &triangledown;
+{ 0x25c3, 3, "\xe2\x97\x83" }, // &triangleleft;
+{ 0x22b4, 3, "\xe2\x8a\xb4" }, // &trianglelefteq;
+{ 0x225c, 3, "\xe2\x89\x9c" }, // &triangleq;
+{ 0x25b9, 3, "\xe2\x96\xb9" }, // &triangleright;
+{ 0x22b5, 3, "\xe2\x8a\xb5" }, // &trianglerighteq;
+{ 0x25ec, 3, "\xe2\x97\xac" }, // &tridot;
+{ 0x225c, 3, "\xe2\x89\x9c" }, // &trie;
+{ 0x2a3a, 3, "\xe2\xa8\xba" }, // &triminus;
+{ 0x20db, 3, "\xe2\x83\x9b" }, // &TripleDot;
+{ 0x2a39, 3, "\xe2\xa8\xb9" }, // &triplus;
+{ 0x29cd, 3, "\xe2\xa7\x8d" }, // &trisb;
+{ 0x2a3b, 3, "\xe2\xa8\xbb" }, // &tritime;
+{ 0x23e2, 3, "\xe2\x8f\xa2" }, // &trpezium;
+{ 0x1d4af, 4, "\xf0\x9d\x92\xaf" }, // &Tscr;
+{ 0x1d4c9, 4, "\xf0\x9d\x93\x89" }, // &tscr;
+{ 0x426, 2, "\xd0\xa6" }, // &TScy;
+{ 0x446, 2, "\xd1\x86" }, // &tscy;
+{ 0x40b, 2, "\xd0\x8b" }, // &TSHcy;
+{ 0x45b, 2, "\xd1\x9b" }, // &tshcy;
+{ 0x166, 2, "\xc5\xa6" }, // &Tstrok;
+{ 0x167, 2, "\xc5\xa7" }, // &tstrok;
+{ 0x226c, 3, "\xe2\x89\xac" }, // &twixt;
+{ 0x219e, 3, "\xe2\x86\x9e" }, // &twoheadleftarrow;
+{ 0x21a0, 3, "\xe2\x86\xa0" }, // &twoheadrightarrow;
+{ 0xda, 2, "\xc3\x9a" }, // &Uacute;
+{ 0xfa, 2, "\xc3\xba" }, // &uacute;
+{ 0x219f, 3, "\xe2\x86\x9f" }, // &Uarr;
+{ 0x21d1, 3, "\xe2\x87\x91" }, // &uArr;
+{ 0x2191, 3, "\xe2\x86\x91" }, // &uarr;
+{ 0x2949, 3, "\xe2\xa5\x89" }, // &Uarrocir;
+{ 0x40e, 2, "\xd0\x8e" }, // &Ubrcy;
+{ 0x45e, 2, "\xd1\x9e" }, // &ubrcy;
+{ 0x16c, 2, "\xc5\xac" }, // &Ubreve;
+{ 0x16d, 2, "\xc5\xad" }, // &ubreve;
+{ 0xdb, 2, "\xc3\x9b" }, // &Ucirc;
+{ 0xfb, 2, "\xc3\xbb" }, // &ucirc;
+{ 0x423, 2, "\xd0\xa3" }, // &Ucy;
+{ 0x443, 2, "\xd1\x83" }, // &ucy;
+{ 0x21c5, 3, "\xe2\x87\x85" }, // &udarr;
+{ 0x170, 2, "\xc5\xb0" }, // &Udblac;
+{ 0x171, 2, "\xc5\xb1" }, // &udblac;
+{ 0x296e, 3, "\xe2\xa5\xae" }, // &udhar;
+{ 0x297e, 3, "\xe2\xa5\xbe" }, // &ufisht;
+{ 0x1d518, 4, "\xf0\x9d\x94\x98" }, // &Ufr;
+{ 0x1d532, 4, "\xf0\x9d\x94\xb2" }, // &ufr;
+{ 0xd9, 2, "\xc3\x99" }, // &Ugrave;
+{ 0xf9, 2, "\xc3\xb9" }, // &ugrave;
+{ 0x2963, 3, "\xe2\xa5\xa3" }, // &uHar;
+{ 0x21bf, 3, "\xe2\x86\xbf" }, // &uharl;
+{ 0x21be, 3, "\xe2\x86\xbe" }, // &uharr;
+{ 0x2580, 3, "\xe2\x96\x80" }, // &uhblk;
+{ 0x231c, 3, "\xe2\x8c\x9c" }, // &ulcorn;
+{ 0x231c, 3, "\xe2\x8c\x9c" }, // &ulcorner;
+{ 0x230f, 3, "\xe2\x8c\x8f" }, // &ulcrop;
+{ 0x25f8, 3, "\xe2\x97\xb8" }, // &ultri;
+{ 0x16a, 2, "\xc5\xaa" }, // &Umacr;
+{ 0x16b, 2, "\xc5\xab" }, // &umacr;
+{ 0xa8, 2, "\xc2\xa8" }, // &uml;
+{ 0x5f, 1, "\x5f" }, // &UnderBar;
+{ 0x23df, 3, "\xe2\x8f\x9f" }, // &UnderBrace;
+{ 0x23b5, 3, "\xe2\x8e\xb5" }, // &UnderBracket;
+{ 0x23dd, 3, "\xe2\x8f\x9d" }, // &UnderParenthesis;
+{ 0x22c3, 3, "\xe2\x8b\x83" }, // &Union;
+{ 0x228e, 3, "\xe2\x8a\x8e" }, // &UnionPlus;
+{ 0x172, 2, "\xc5\xb2" }, // &Uogon;
+{ 0x173, 2, "\xc5\xb3" }, // &uogon;
+{ 0x1d54c, 4, "\xf0\x9d\x95\x8c" }, // &Uopf;
+{ 0x1d566, 4, "\xf0\x9d\x95\xa6" }, // &uopf;
+{ 0x2191, 3, "\xe2\x86\x91" }, // &UpArrow;
+{ 0x21d1, 3, "\xe2\x87\x91" }, // &Uparrow;
+{ 0x2191, 3, "\xe2\x86\x91" }, // &uparrow;
+{ 0x2912, 3, "\xe2\xa4\x92" }, // &UpArrowBar;
+{ 0x21c5, 3, "\xe2\x87\x85" }, // &UpArrowDownArrow;
+{ 0x2195, 3, "\xe2\x86\x95" }, // &UpDownArrow;
+{ 0x21d5, 3, "\xe2\x87\x95" }, // &Updownarrow;
+{ 0x2195, 3, "\xe2\x86\x95" }, // &updownarrow;
+{ 0x296e, 3, "\xe2\xa5\xae" }, // &UpEquilibrium;
+{ 0x21bf, 3, "\xe2\x86\xbf" }, // &upharpoonleft;
+{ 0x21be, 3, "\xe2\x86\xbe" }, // &upharpoonright;
+{ 0x228e, 3, "\xe2\x8a\x8e" }, // &uplus;
+{ 0x2196, 3, "\xe2\x86\x96" }, // &UpperLeftArrow;
+{ 0x2197, 3, "\xe2\x86\x97" }, // &UpperRightArrow;
+{ 0x3d2, 2, "\xcf\x92" }, // &Upsi;
+{ 0x3c5, 2, "\xcf\x85" }, // &upsi;
+{ 0x3d2, 2, "\xcf\x92" }, // &upsih;
+{ 0x3a5, 2, "\xce\xa5" }, // &Upsilon;
+{ 0x3c5, 2, "\xcf\x85" }, // &upsilon;
+{ 0x22a5, 3, "\xe2\x8a\xa5" }, // &UpTee;
+{ 0x21a5, 3, "\xe2\x86\xa5" }, // &UpTeeArrow;
+{ 0x21c8, 3, "\xe2\x87\x88" }, // &upuparrows;
+{ 0x231d, 3, "\xe2\x8c\x9d" }, // &urcorn;
+{ 0x231d, 3, "\xe2\x8c\x9d" }, // &urcorner;
+{ 0x230e, 3, "\xe2\x8c\x8e" }, // &urcrop;
+{ 0x16e, 2, "\xc5\xae" }, // &Uring;
+{ 0x16f, 2, "\xc5\xaf" }, // &uring;
+{ 0x25f9, 3, "\xe2\x97\xb9" }, // &urtri;
+{ 0x1d4b0, 4, "\xf0\x9d\x92\xb0" }, // &Uscr;
+{ 0x1d4ca, 4, "\xf0\x9d\x93\x8a" }, // &uscr;
+{ 0x22f0, 3, "\xe2\x8b\xb0" }, // &utdot;
+{ 0x168, 2, "\xc5\xa8" }, // &Utilde;
+{ 0x169, 2, "\xc5\xa9" }, // &utilde;
+{ 0x25b5, 3, "\xe2\x96\xb5" }, // &utri;
+{ 0x25b4, 3, "\xe2\x96\xb4" }, // &utrif;
+{ 0x21c8, 3, "\xe2\x87\x88" }, // &uuarr;
+{ 0xdc, 2, "\xc3\x9c" }, // &Uuml;
+{ 0xfc, 2, "\xc3\xbc" }, // &uuml;
+{ 0x29a7, 3, "\xe2\xa6\xa7" }, // &uwangle;
+{ 0x299c, 3, "\xe2\xa6\x9c" }, // &vangrt;
+{ 0x3f5, 2, "\xcf\xb5" }, // &varepsilon;
+{ 0x3f0, 2, "\xcf\xb0" }, // &varkappa;
+{ 0x2205, 3, "\xe2\x88\x85" }, // &varnothing;
+{ 0x3d5, 2, "\xcf\x95" }, // &varphi;
+{ 0x3d6, 2, "\xcf\x96" }, // &varpi;
+{ 0x221d, 3, "\xe2\x88\x9d" }, // &varpropto;
+{ 0x21d5, 3, "\xe2\x87\x95" }, // &vArr;
+{ 0x2195, 3, "\xe2\x86\x95" }, // &varr;
+{ 0x3f1, 2, "\xcf\xb1" }, // &varrho;
+{ 0x3c2, 2, "\xcf\x82" }, // &varsigma;
+{ 0x228a, 6, "\xe2\x8a\x8a\xef\xb8\x80" }, // &varsubsetneq;
+{ 0x2acb, 6, "\xe2\xab\x8b\xef\xb8\x80" }, // &varsubsetneqq;
+{ 0x228b, 6, "\xe2\x8a\x8b\xef\xb8\x80" }, // &varsupsetneq;
+{ 0x2acc, 6, "\xe2\xab\x8c\xef\xb8\x80" }, // &varsupsetneqq;
+{ 0x3d1, 2, "\xcf\x91" }, // &vartheta;
+{ 0x22b2, 3, "\xe2\x8a\xb2" }, // &vartriangleleft;
+{ 0x22b3, 3, "\xe2\x8a\xb3" }, // &vartriangleright;
+{ 0x2aeb, 3, "\xe2\xab\xab" }, // &Vbar;
+{ 0x2ae8, 3, "\xe2\xab\xa8" }, // &vBar;
+{ 0x2ae9, 3, "\xe2\xab\xa9" }, // &vBarv;
+{ 0x412, 2, "\xd0\x92" }, // &Vcy;
+{ 0x432, 2, "\xd0\xb2" }, // &vcy;
+{ 0x22ab, 3, "\xe2\x8a\xab" }, // &VDash;
+{ 0x22a9, 3, "\xe2\x8a\xa9" }, // &Vdash;
+{ 0x22a8, 3, "\xe2\x8a\xa8" }, // &vDash;
+{ 0x22a2, 3, "\xe2\x8a\xa2" }, // &vdash;
+{ 0x2ae6, 3, "\xe2\xab\xa6" }, // &Vdashl;
+{ 0x22c1, 3, "\xe2\x8b\x81" }, // &Vee;
+{ 0x2228, 3, "\xe2\x88\xa8" }, // &vee;
+{ 0x22bb, 3, "\xe2\x8a\xbb" }, // &veebar;
+{ 0x225a, 3, "\xe2\x89\x9a" }, // &veeeq;
+{ 0x22ee, 3, "\xe2\x8b\xae" }, // &vellip;
+{ 0x2016, 3, "\xe2\x80\x96" }, // &Verbar;
+{ 0x7c, 1, "\x7c" }, // &verbar;
+{ 0x2016, 3, "\xe2\x80\x96" }, // &Vert;
+{ 0x7c, 1, "\x7c" }, // &vert;
+{ 0x2223, 3, "\xe2\x88\xa3" }, // &VerticalBar;
+{ 0x7c, 1, "\x7c" }, // &VerticalLine;
+{ 0x2758, 3, "\xe2\x9d\x98" }, // &VerticalSeparator;
+{ 0x2240, 3, "\xe2\x89\x80" }, // &VerticalTilde;
+{ 0x200a, 3, "\xe2\x80\x8a" }, // &VeryThinSpace;
+{ 0x1d519, 4, "\xf0\x9d\x94\x99" }, // &Vfr;
+{ 0x1d533, 4, "\xf0\x9d\x94\xb3" }, // &vfr;
+{ 0x22b2, 3, "\xe2\x8a\xb2" }, // &vltri;
+{ 0x2282, 6, "\xe2\x8a\x82\xe2\x83\x92" }, // &vnsub;
+{ 0x2283, 6, "\xe2\x8a\x83\xe2\x83\x92" }, // &vnsup;
+{ 0x1d54d, 4, "\xf0\x9d\x95\x8d" }, // &Vopf;
+{ 0x1d567, 4, "\xf0\x9d\x95\xa7" }, // &vopf;
+{ 0x221d, 3, "\xe2\x88\x9d" }, // &vprop;
+{ 0x22b3, 3, "\xe2\x8a\xb3" }, // &vrtri;
+{ 0x1d4b1, 4, "\xf0\x9d\x92\xb1" }, // &Vscr;
+{ 0x1d4cb, 4, "\xf0\x9d\x93\x8b" }, // &vscr;
+{ 0x2acb, 6, "\xe2\xab\x8b\xef\xb8\x80" }, // &vsubnE;
+{ 0x228a, 6, "\xe2\x8a\x8a\xef\xb8\x80" }, // &vsubne;
+{ 0x2acc, 6, "\xe2\xab\x8c\xef\xb8\x80" }, // &vsupnE;
+{ 0x228b, 6, "\xe2\x8a\x8b\xef\xb8\x80" }, // &vsupne;
+{ 0x22aa, 3, "\xe2\x8a\xaa" }, // &Vvdash;
+{ 0x299a, 3, "\xe2\xa6\x9a" }, // &vzigzag;
+{ 0x174, 2, "\xc5\xb4" }, // &Wcirc;
+{ 0x175, 2, "\xc5\xb5" }, // &wcirc;
+{ 0x2a5f, 3, "\xe2\xa9\x9f" }, // &wedbar;
+{ 0x22c0, 3, "\xe2\x8b\x80" }, // &Wedge;
+{ 0x2227, 3, "\xe2\x88\xa7" }, // &wedge;
+{ 0x2259, 3, "\xe2\x89\x99" }, // &wedgeq;
+{ 0x2118, 3, "\xe2\x84\x98" }, // &weierp;
+{ 0x1d51a, 4, "\xf0\x9d\x94\x9a" }, // &Wfr;
+{ 0x1d534, 4, "\xf0\x9d\x94\xb4" }, // &wfr;
+{ 0x1d54e, 4, "\xf0\x9d\x95\x8e" }, // &Wopf;
+{ 0x1d568, 4, "\xf0\x9d\x95\xa8" }, // &wopf;
+{ 0x2118, 3, "\xe2\x84\x98" }, // &wp;
+{ 0x2240, 3, "\xe2\x89\x80" }, // &wr;
+{ 0x2240, 3, "\xe2\x89\x80" }, // &wreath;
+{ 0x1d4b2, 4, "\xf0\x9d\x92\xb2" }, // &Wscr;
+{ 0x1d4cc, 4, "\xf0\x9d\x93\x8c" }, // &wscr;
+{ 0x22c2, 3, "\xe2\x8b\x82" }, // &xcap;
+{ 0x25ef, 3, "\xe2\x97\xaf" }, // &xcirc;
+{ 0x22c3, 3, "\xe2\x8b\x83" }, // &xcup;
+{ 0x25bd, 3, "\xe2\x96\xbd" }, // &xdtri;
+{ 0x1d51b, 4, "\xf0\x9d\x94\x9b" }, // &Xfr;
+{ 0x1d535, 4, "\xf0\x9d\x94\xb5" }, // &xfr;
+{ 0x27fa, 3, "\xe2\x9f\xba" }, // &xhArr;
+{ 0x27f7, 3, "\xe2\x9f\xb7" }, // &xharr;
+{ 0x39e, 2, "\xce\x9e" }, // &Xi;
+{ 0x3be, 2, "\xce\xbe" }, // &xi;
+{ 0x27f8, 3, "\xe2\x9f\xb8" }, // &xlArr;
+{ 0x27f5, 3, "\xe2\x9f\xb5" }, // &xlarr;
+{ 0x27fc, 3, "\xe2\x9f\xbc" }, // &xmap;
+{ 0x22fb, 3, "\xe2\x8b\xbb" }, // &xnis;
+{ 0x2a00, 3, "\xe2\xa8\x80" }, // &xodot;
+{ 0x1d54f, 4, "\xf0\x9d\x95\x8f" }, // &Xopf;
+{ 0x1d569, 4, "\xf0\x9d\x95\xa9" }, // &xopf;
+{ 0x2a01, 3, "\xe2\xa8\x81" }, // &xoplus;
+{ 0x2a02, 3, "\xe2\xa8\x82" }, // &xotime;
+{ 0x27f9, 3, "\xe2\x9f\xb9" }, // &xrArr;
+{ 0x27f6, 3, "\xe2\x9f\xb6" }, // &xrarr;
+{ 0x1d4b3, 4, "\xf0\x9d\x92\xb3" }, // &Xscr;
+{ 0x1d4cd, 4, "\xf0\x9d\x93\x8d" }, // &xscr;
+{ 0x2a06, 3, "\xe2\xa8\x86" }, // &xsqcup;
+{ 0x2a04, 3, "\xe2\xa8\x84" }, // &xuplus;
+{ 0x25b3, 3, "\xe2\x96\xb3" }, // &xutri;
+{ 0x22c1, 3, "\xe2\x8b\x81" }, // &xvee;
+{ 0x22c0, 3, "\xe2\x8b\x80" }, // &xwedge;
+{ 0xdd, 2, "\xc3\x9d" }, // &Yacute;
+{ 0xfd, 2, "\xc3\xbd" }, // &yacute;
+{ 0x42f, 2, "\xd0\xaf" }, // &YAcy;
+{ 0x44f, 2, "\xd1\x8f" }, // &yacy;
+{ 0x176, 2, "\xc5\xb6" }, // &Ycirc;
+{ 0x177, 2, "\xc5\xb7" }, // &ycirc;
+{ 0x42b, 2, "\xd0\xab" }, // &Ycy;
+{ 0x44b, 2, "\xd1\x8b" }, // &ycy;
+{ 0xa5, 2, "\xc2\xa5" }, // &yen;
+{ 0x1d51c, 4, "\xf0\x9d\x94\x9c" }, // &Yfr;
+{ 0x1d536, 4, "\xf0\x9d\x94\xb6" }, // &yfr;
+{ 0x407, 2, "\xd0\x87" }, // &YIcy;
+{ 0x457, 2, "\xd1\x97" }, // &yicy;
+{ 0x1d550, 4, "\xf0\x9d\x95\x90" }, // &Yopf;
+{ 0x1d56a, 4, "\xf0\x9d\x95\xaa" }, // &yopf;
+{ 0x1d4b4, 4, "\xf0\x9d\x92\xb4" }, // &Yscr;
+{ 0x1d4ce, 4, "\xf0\x9d\x93\x8e" }, // &yscr;
+{ 0x42e, 2, "\xd0\xae" }, // &YUcy;
+{ 0x44e, 2, "\xd1\x8e" }, // &yucy;
+{ 0x178, 2, "\xc5\xb8" }, // &Yuml;
+{ 0xff, 2, "\xc3\xbf" }, // &yuml;
+{ 0x179, 2, "\xc5\xb9" }, // &Zacute;
+{ 0x17a, 2, "\xc5\xba" }, // &zacute;
+{ 0x17d, 2, "\xc5\xbd" }, // &Zcaron;
+{ 0x17e, 2, "\xc5\xbe" }, // &zcaron;
+{ 0x417, 2, "\xd0\x97" }, // &Zcy;
+{ 0x437, 2, "\xd0\xb7" }, // &zcy;
+{ 0x17b, 2, "\xc5\xbb" }, // &Zdot;
+{ 0x17c, 2, "\xc5\xbc" }, // &zdot;
+{ 0x2128, 3, "\xe2\x84\xa8" }, // &zeetrf;
+{ 0x200b, 3, "\xe2\x80\x8b" }, // &ZeroWidthSpace;
+{ 0x396, 2, "\xce\x96" }, // &Zeta;
+{ 0x3b6, 2, "\xce\xb6" }, // &zeta;
+{ 0x2128, 3, "\xe2\x84\xa8" }, // &Zfr;
+{ 0x1d537, 4, "\xf0\x9d\x94\xb7" }, // &zfr;
+{ 0x416, 2, "\xd0\x96" }, // &ZHcy;
+{ 0x436, 2, "\xd0\xb6" }, // &zhcy;
+{ 0x21dd, 3, "\xe2\x87\x9d" }, // &zigrarr;
+{ 0x2124, 3, "\xe2\x84\xa4" }, // &Zopf;
+{ 0x1d56b, 4, "\xf0\x9d\x95\xab" }, // &zopf;
+{ 0x1d4b5, 4, "\xf0\x9d\x92\xb5" }, // &Zscr;
+{ 0x1d4cf, 4, "\xf0\x9d\x93\x8f" }, // &zscr;
+{ 0x200d, 3, "\xe2\x80\x8d" }, // &zwj;
+{ 0x200c, 3, "\xe2\x80\x8c" }, // &zwnj;
@@ -46,9 +46,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x37,0x39,0x8000223e,0x1,
-0x3d,0x80002061,0x41,0x1,0x1,0x1,
-0x1,0x42,0x45,0x48,0x4a,0x80002248,
+0x1,0x1,0x37,0x39,0x80000006,0x1,
+0x3d,0x80000010,0x41,0x1,0x1,0x1,
+0x1,0x42,0x45,0x48,0x4a,0x8000003a,
 0x1,0x4e,0x50,0x52,0x54,0x1,
 0x55,0x1,0x1},
 // Transitions for state 4
@@ -101,7 +101,7 @@
 0x89,0x1,0x8a},
 // Transitions for state 8
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002145,0x1,0x1,
+0x1,0x1,0x1,0x8000015f,0x1,0x1,
 0x1,0x1,0x1,0x9b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0xa3,0x1,0x1,0x1,0x1,0x1,
@@ -118,7 +118,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8c,0x8e,0x90,0x80002146,
+0x1,0x1,0x8c,0x8e,0x90,0x80000160,
 0x93,0x95,0x1,0x98,0x9a,0x9c,
 0x1,0x9d,0x1,0x1,0x9e,0x1,
 0x1,0xa0,0xa2,0xa4,0xa5,0x1,
@@ -143,8 +143,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xaa,0x1,0xac,0xaf,
-0x80002147,0xb0,0x80002a9a,0x1,0x1,0x1,
-0x1,0x80002a99,0xb7,0xb9,0xbb,0xbc,
+0x800001d5,0xb0,0x800001d9,0x1,0x1,0x1,
+0x1,0x800001de,0xb7,0xb9,0xbb,0xbc,
 0xbe,0xc0,0xc2,0xc4,0xc7,0x1,
 0x1,0xc8,0x1},
 // Transitions for state 12
@@ -173,27 +173,27 @@
 0x1,0x1,0x1},
 // Transitions for state 14
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002267,0x1,
+0x1,0x1,0x1,0x1,0x80000258,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xdb,0xde,0xe0,0xe2,
-0x80002265,0xe6,0x8000226b,0x1,0xe8,0xea,
-0x1,0x80002277,0x1,0xec,0xee,0x1,
-0x1,0xef,0xf2,0x8000003e,0x1,0xf4,
+0x80000259,0xe6,0x80000269,0x1,0xe8,0xea,
+0x1,0x8000026e,0x1,0xec,0xee,0x1,
+0x1,0xef,0xf2,0x8000028a,0x1,0xf4,
 0x1,0x1,0x1},
 // Transitions for state 15
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0xe9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000003e,0x1,0x1,0x1,0x1,
+0x1,0x80000288,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xdc,0xdd,0xdf,0xe1,
-0x1,0xe5,0x800022d9,0x1,0x1,0x1,
+0x1,0xe5,0x80000268,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0xed,0x1,
-0x1,0xf0,0xf1,0x8000226b,0x1,0x1,
+0x1,0xf0,0xf1,0x80000289,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 16
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -228,7 +228,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x107,0x1,0x109,0x10b,
 0x1,0x10f,0x110,0x1,0x1,0x1,
-0x1,0x1,0x80002111,0x118,0x11b,0x1,
+0x1,0x1,0x800002d8,0x118,0x11b,0x1,
 0x1,0x1,0x11e,0x120,0x122,0x1,
 0x1,0x1,0x1},
 // Transitions for state 19
@@ -238,10 +238,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x108,0x1,0x80002063,0x1,
-0x10d,0x10e,0x111,0x1,0x80002148,0x114,
-0x1,0x1,0x116,0x80002208,0x11a,0x11c,
-0x11d,0x1,0x11f,0x80002062,0x123,0x1,
+0x1,0x1,0x108,0x1,0x800002c3,0x1,
+0x10d,0x10e,0x111,0x1,0x800002d1,0x114,
+0x1,0x1,0x116,0x800002e3,0x11a,0x11c,
+0x11d,0x1,0x11f,0x80000305,0x123,0x1,
 0x1,0x1,0x1},
 // Transitions for state 20
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -293,27 +293,27 @@
 0x1,0x1,0x1},
 // Transitions for state 24
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x13e,0x141,0x1,0x1,0x80002266,0x1,
+0x13e,0x141,0x1,0x1,0x80000361,0x1,
 0x1,0x14c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x140,0x142,0x144,0x145,
-0x80002264,0x149,0x80002276,0x14d,0x1,0x14f,
-0x1,0x8000226a,0x153,0x154,0x155,0x157,
-0x1,0x158,0x159,0x8000003c,0x15c,0x15d,
+0x80000362,0x149,0x800003a3,0x14d,0x1,0x14f,
+0x1,0x800003ad,0x153,0x154,0x155,0x157,
+0x1,0x158,0x159,0x800003f0,0x15c,0x15d,
 0x1,0x1,0x1},
 // Transitions for state 25
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x14e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000003c,0x1,0x1,0x1,0x1,
+0x1,0x800003ee,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x13f,0x1,0x143,0x1,
 0x146,0x14a,0x1,0x1,0x1,0x1,
-0x1,0x800022d8,0x152,0x1,0x156,0x1,
-0x1,0x1,0x15a,0x8000226a,0x1,0x1,
+0x1,0x800003ac,0x152,0x1,0x156,0x1,
+0x1,0x1,0x15a,0x800003ef,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 26
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -324,8 +324,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x15e,0x1,0x160,0x162,
 0x164,0x167,0x1,0x168,0x169,0x1,
-0x1,0x16b,0x1,0x16c,0x16d,0x80002213,
-0x1,0x1,0x170,0x1,0x800003bc,0x1,
+0x1,0x16b,0x1,0x16c,0x16d,0x80000426,
+0x1,0x1,0x170,0x1,0x8000042b,0x1,
 0x1,0x1,0x1},
 // Transitions for state 27
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -337,7 +337,7 @@
 0x1,0x1,0x15f,0x1,0x161,0x1,
 0x165,0x166,0x1,0x1,0x16a,0x1,
 0x1,0x1,0x1,0x1,0x16e,0x1,
-0x1,0x1,0x16f,0x1,0x8000039c,0x1,
+0x1,0x1,0x16f,0x1,0x8000042a,0x1,
 0x1,0x1,0x1},
 // Transitions for state 28
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -347,9 +347,9 @@
 0x1,0x1,0x1,0x190,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x172,0x174,0x175,0x177,
-0x80002260,0x17b,0x17c,0x17e,0x8000220b,0x181,
+0x80000448,0x17b,0x17c,0x17e,0x8000046b,0x181,
 0x1,0x182,0x184,0x1,0x186,0x187,
-0x1,0x188,0x18a,0x18c,0x800003bd,0x18f,
+0x1,0x188,0x18a,0x18c,0x80000501,0x18f,
 0x191,0x1,0x1},
 // Transitions for state 29
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -361,7 +361,7 @@
 0x1,0x1,0x173,0x1,0x176,0x1,
 0x179,0x17a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x185,0x1,
-0x1,0x1,0x18b,0x18d,0x8000039d,0x1,
+0x1,0x1,0x18b,0x18d,0x80000500,0x1,
 0x1,0x1,0x1},
 // Transitions for state 30
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -373,19 +373,19 @@
 0x1,0x1,0x192,0x1,0x195,0x197,
 0x1,0x19b,0x19d,0x1,0x1,0x1,
 0x1,0x1,0x1a1,0x1,0x1a3,0x1a6,
-0x1,0x80002a54,0x1a8,0x1aa,0x1ac,0x1af,
+0x1,0x80000548,0x1a8,0x1aa,0x1ac,0x1af,
 0x1,0x1,0x1},
 // Transitions for state 31
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800024c8,0x1,0x1,0x1,0x1,0x1,
+0x80000554,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x193,0x1,0x194,0x196,
 0x199,0x19a,0x19c,0x19e,0x19f,0x1,
 0x1,0x1a0,0x1a2,0x1,0x1a4,0x1a5,
-0x1,0x80002228,0x1a9,0x1ab,0x1ad,0x1ae,
+0x1,0x80000549,0x1a9,0x1ab,0x1ad,0x1ae,
 0x1,0x1,0x1},
 // Transitions for state 32
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -395,9 +395,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1b0,0x1,0x1b3,0x1,
-0x1b4,0x1b6,0x1,0x1b8,0x800003c0,0x1,
-0x1,0x1ba,0x800000b1,0x1,0x1bd,0x1,
-0x1,0x8000227a,0x1c1,0x1,0x1c2,0x1,
+0x1b4,0x1b6,0x1,0x1b8,0x8000057c,0x1,
+0x1,0x1ba,0x8000058d,0x1,0x1bd,0x1,
+0x1,0x80000594,0x1c1,0x1,0x1c2,0x1,
 0x1,0x1,0x1},
 // Transitions for state 33
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -407,9 +407,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1b1,0x1,0x1b2,0x1,
-0x1,0x1b5,0x1,0x1b7,0x800003a0,0x1,
+0x1,0x1b5,0x1,0x1b7,0x8000057b,0x1,
 0x1,0x1bb,0x1,0x1,0x1bc,0x1,
-0x1,0x80002abb,0x1c0,0x1,0x1,0x1,
+0x1,0x80000593,0x1c0,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 34
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -446,7 +446,7 @@
 0x1d6,0x1d9,0x1,0x1dc,0x1df,0x1,
 0x1,0x1e0,0x1e1,0x1e2,0x1e3,0x1e5,
 0x1,0x1e6,0x1e8,0x1ea,0x1ec,0x1,
-0x1,0x8000211e,0x1},
+0x1,0x8000065a,0x1},
 // Transitions for state 37
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1d0,0x1,0x1,0x1d7,0x1,
@@ -455,7 +455,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1cf,0x1,0x1d3,0x1,
-0x8000211c,0x1da,0x1,0x1dd,0x1de,0x1,
+0x800005fe,0x1da,0x1,0x1dd,0x1de,0x1,
 0x1,0x1,0x1,0x1,0x1e4,0x1,
 0x1,0x1e7,0x1e9,0x1,0x1eb,0x1,
 0x1,0x1,0x1},
@@ -466,7 +466,7 @@
 0x1,0x1,0x1fe,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1ed,0x1,0x80002abc,0x1,
+0x1,0x1,0x1ed,0x1,0x8000065e,0x1,
 0x1,0x1f4,0x1,0x1f8,0x1f9,0x1,
 0x1,0x1,0x1fc,0x1,0x200,0x1,
 0x203,0x1,0x205,0x207,0x209,0x1,
@@ -478,7 +478,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1ee,0x1ef,0x8000227b,0x1f2,
+0x1,0x1,0x1ee,0x1ef,0x8000065f,0x1f2,
 0x1f3,0x1f5,0x1,0x1f6,0x1fa,0x1,
 0x1,0x1fb,0x1fd,0x1,0x1ff,0x201,
 0x202,0x204,0x206,0x208,0x20a,0x1,
@@ -576,8 +576,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x25e,0x1,
 0x25f,0x262,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x264,0x80002118,
-0x1,0x80002240,0x267,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x264,0x80000802,
+0x1,0x80000803,0x267,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 48
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -587,7 +587,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x268,0x269,
-0x1,0x26b,0x1,0x26c,0x800003be,0x1,
+0x1,0x26b,0x1,0x26c,0x80000810,0x1,
 0x1,0x26d,0x26e,0x26f,0x270,0x1,
 0x1,0x272,0x274,0x1,0x275,0x276,
 0x277,0x1,0x1},
@@ -599,7 +599,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x26a,0x1,0x1,0x8000039e,0x1,
+0x1,0x26a,0x1,0x1,0x8000080f,0x1,
 0x1,0x1,0x1,0x1,0x271,0x1,
 0x1,0x1,0x273,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -701,16 +701,16 @@
 0x1,0x1,0x1},
 // Transitions for state 58
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000223e,0x1,
+0x1,0x1,0x1,0x1,0x80000008,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000223f,
+0x1,0x1,0x1,0x1,0x1,0x80000007,
 0x1,0x1,0x1,0x1,0x2a0,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x2a1,0x1,
-0x1,0x1,0x80000430},
+0x1,0x1,0x8000000d},
 // Transitions for state 59
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -722,7 +722,7 @@
 0x1,0x1,0x1,0x1,0x29f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000410},
+0x1,0x1,0x8000000c},
 // Transitions for state 60
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -757,7 +757,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d504,0x1,0x1,0x1,0x1,
+0x1,0x80000011,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 63
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -769,7 +769,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d51e,0x1,0x1,0x1,0x1,
+0x1,0x80000012,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 64
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -840,14 +840,14 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x2aa,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80000026,
+0x1,0x1,0x1,0x1,0x1,0x8000001d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 70
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000026,0x1,0x1,
+0x1,0x1,0x1,0x8000001c,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -862,7 +862,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a53,
+0x1,0x1,0x1,0x1,0x1,0x8000001e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -874,8 +874,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002227,
-0x1,0x1,0x80002220,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x8000001f,
+0x1,0x1,0x80000024,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -905,13 +905,13 @@
 0x1,0x1,0x1},
 // Transitions for state 75
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a70,0x1,
+0x1,0x1,0x1,0x1,0x8000003c,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x2b1,0x1,0x1,0x1,
-0x8000224a,0x1,0x1,0x1,0x2b2,0x1,
+0x8000003d,0x1,0x1,0x1,0x2b2,0x1,
 0x1,0x1,0x1,0x1,0x2b3,0x2b5,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -973,7 +973,7 @@
 0x1,0x1,0x1,0x1,0x2b9,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000002a,0x1,0x1,
+0x1,0x1,0x1,0x80000048,0x1,0x1,
 0x1,0x1,0x2bb},
 // Transitions for state 81
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1082,7 +1082,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x2c7,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000431},
+0x1,0x1,0x80000060},
 // Transitions for state 90
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1094,7 +1094,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000411},
+0x1,0x1,0x8000005f},
 // Transitions for state 91
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1141,7 +1141,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d505,0x1,0x1,0x1,0x1,
+0x1,0x8000006d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 95
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1153,7 +1153,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d51f,0x1,0x1,0x1,0x1,
+0x1,0x8000006e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 96
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1199,7 +1199,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000003d,0x1,0x1,0x1,0x1,0x1,
+0x80000088,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x2d8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -1237,7 +1237,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x2da,
-0x1,0x1,0x1,0x800022a5,0x1,0x1,
+0x1,0x1,0x1,0x8000008e,0x1,0x1,
 0x2dc,0x2dd,0x1},
 // Transitions for state 103
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1332,7 +1332,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x2ea,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022d2,
+0x1,0x1,0x1,0x1,0x1,0x800000d2,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x2ef},
 // Transitions for state 111
@@ -1344,7 +1344,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x2eb,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002229,
+0x1,0x1,0x1,0x1,0x1,0x800000d3,
 0x1,0x2ee,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 112
@@ -1429,7 +1429,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000212d,0x1,0x1,0x1,0x1,
+0x1,0x800000f0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 119
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1441,7 +1441,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d520,0x1,0x1,0x1,0x1,
+0x1,0x800000f1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 120
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1463,7 +1463,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x300,0x1,
-0x301,0x1,0x1,0x1,0x800003c7,0x1,
+0x301,0x1,0x1,0x1,0x800000f7,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -1475,7 +1475,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003a7,0x1,
+0x1,0x1,0x1,0x1,0x800000f6,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -1489,7 +1489,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800025cb,0x1,0x1,0x1,0x1,
+0x1,0x800000f8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 124
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1632,7 +1632,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x316,
 0x317,0x1,0x1,0x1,0x1,0x1,
-0x1,0x318,0x1,0x1,0x1,0x8000222a,
+0x1,0x318,0x1,0x1,0x1,0x8000013a,
 0x1,0x31b,0x1,0x1,0x1,0x31c,
 0x31d,0x1,0x1},
 // Transitions for state 136
@@ -1644,7 +1644,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022d3,
+0x1,0x1,0x1,0x1,0x1,0x80000139,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 137
@@ -1730,7 +1730,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000414},
+0x1,0x1,0x8000015d},
 // Transitions for state 144
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1742,7 +1742,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000434},
+0x1,0x1,0x8000015e},
 // Transitions for state 145
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1775,7 +1775,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000b0,0x1,0x1,0x1,
+0x1,0x1,0x80000165,0x1,0x1,0x1,
 0x1,0x331,0x332,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -1788,7 +1788,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002207,0x1,0x1,0x1,0x1,
+0x1,0x80000166,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 149
@@ -1801,7 +1801,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x333,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d521,0x1,0x1,0x1,0x1,
+0x1,0x8000016c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 150
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1813,7 +1813,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d507,0x1,0x1,0x1,0x1,
+0x1,0x8000016b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 151
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1859,9 +1859,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x337,0x1,0x1,0x1,
-0x800000a8,0x1,0x339,0x1,0x1,0x1,
+0x8000017a,0x1,0x339,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x33a,0x1,0x1,0x800000f7,
+0x1,0x1,0x33a,0x1,0x1,0x8000017e,
 0x1,0x1,0x1},
 // Transitions for state 155
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1909,7 +1909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x33f,0x1,0x1,0x1,0x341,
-0x1,0x1,0x1,0x800002d9,0x344,0x1,
+0x1,0x1,0x1,0x8000018a,0x344,0x1,
 0x347,0x1,0x1},
 // Transitions for state 159
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -1921,7 +1921,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x340,
-0x1,0x1,0x1,0x800000a8,0x345,0x1,
+0x1,0x1,0x1,0x80000189,0x345,0x1,
 0x346,0x1,0x1},
 // Transitions for state 160
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2066,7 +2066,7 @@
 0x1,0x1,0x1,0x1,0x35e,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000042d},
+0x1,0x1,0x800001cf},
 // Transitions for state 172
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2078,7 +2078,7 @@
 0x1,0x1,0x1,0x1,0x35d,0x1,
 0x1,0x1,0x1,0x1,0x35f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000044d},
+0x1,0x1,0x800001d0},
 // Transitions for state 173
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x360,0x1,0x1,
@@ -2125,7 +2125,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d522,0x1,0x1,0x1,0x1,
+0x1,0x800001d8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 177
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2137,7 +2137,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d508,0x1,0x1,0x1,0x1,
+0x1,0x800001d7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 178
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2161,7 +2161,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x366,0x80002a96,0x1,0x1,0x1,
+0x1,0x366,0x800001dc,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 180
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2184,8 +2184,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x369,0x1,
-0x1,0x80002113,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a95,0x1,0x1,0x1,
+0x1,0x800001e1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x800001e2,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 182
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2214,7 +2214,7 @@
 // Transitions for state 184
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000014a,0x1,0x1,0x1,0x1,0x1,
+0x800001ee,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2231,7 +2231,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000014b,0x1,0x1,0x1,
+0x1,0x1,0x800001ef,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x370,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -2350,7 +2350,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000397,0x1,0x1,0x1,
+0x1,0x1,0x80000210,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2362,15 +2362,15 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b7,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000f0,0x1,0x1,
+0x1,0x1,0x80000211,0x1,0x1,0x1,
+0x1,0x1,0x1,0x80000213,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 197
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000d0,0x1,0x1,0x1,0x1,
+0x1,0x80000212,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2450,7 +2450,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000424},
+0x1,0x1,0x8000021e},
 // Transitions for state 204
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2462,7 +2462,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000444},
+0x1,0x1,0x8000021f},
 // Transitions for state 205
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2485,7 +2485,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x38f,0x1,
 0x1,0x390,0x1,0x1,0x1,0x1,
-0x1,0x8001d523,0x1,0x1,0x1,0x1,
+0x1,0x80000225,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 207
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2497,7 +2497,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d509,0x1,0x1,0x1,0x1,
+0x1,0x80000224,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 208
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2640,7 +2640,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x3a2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x3a4,0x1,0x1,0x80002a86,
+0x1,0x1,0x3a4,0x1,0x1,0x8000024e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 220
@@ -2690,7 +2690,7 @@
 0x3a7,0x1,0x1,0x1,0x3a8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000413},
+0x1,0x1,0x80000254},
 // Transitions for state 224
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2702,7 +2702,7 @@
 0x1,0x1,0x1,0x1,0x3a9,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000433},
+0x1,0x1,0x80000255},
 // Transitions for state 225
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2736,7 +2736,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a8c,0x1,0x1,0x1,0x1,
+0x1,0x8000025a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 228
@@ -2748,8 +2748,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022db,0x1,0x1,0x1,0x1,
-0x80002265,0x1,0x80002a7e,0x1,0x1,0x1,
+0x1,0x8000025b,0x1,0x1,0x1,0x1,
+0x8000025c,0x1,0x8000025f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 229
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2761,7 +2761,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d50a,0x1,0x1,0x1,0x1,
+0x1,0x80000266,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 230
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2773,7 +2773,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d524,0x1,0x1,0x1,0x1,
+0x1,0x80000267,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 231
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -2783,7 +2783,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022d9,0x1,0x1,0x1,
+0x1,0x1,0x8000026a,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -2825,25 +2825,25 @@
 0x1,0x1,0x1},
 // Transitions for state 235
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a92,0x1,
+0x1,0x1,0x1,0x1,0x80000270,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002aa5,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002aa4,
+0x1,0x1,0x8000026f,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x80000271,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 236
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002269,0x1,
+0x1,0x1,0x1,0x1,0x80000274,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x3b1,0x1,0x1,0x1,
-0x80002a88,0x1,0x1,0x1,0x1,0x1,
+0x80000275,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x3b3,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -2953,7 +2953,7 @@
 0x1,0x1,0x1,0x1,0x3c2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000005e,0x1,0x1,
+0x1,0x1,0x1,0x800002a3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 246
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3049,7 +3049,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000210c,0x1,0x1,0x1,0x1,
+0x1,0x800002ab,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 254
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3061,7 +3061,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d525,0x1,0x1,0x1,0x1,
+0x1,0x800002ac,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 255
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3194,7 +3194,7 @@
 0x1,0x1,0x1,0x1,0x3e2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000418},
+0x1,0x1,0x800002c6},
 // Transitions for state 266
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3206,7 +3206,7 @@
 0x1,0x1,0x1,0x1,0x3e3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000438},
+0x1,0x1,0x800002c7},
 // Transitions for state 267
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3251,9 +3251,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d4,0x1,0x1,0x1,0x1,
+0x1,0x800002cc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d526,0x1,0x1,0x1,0x1,
+0x1,0x800002ce,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 271
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3265,7 +3265,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002111,0x1,0x1,0x1,0x1,
+0x1,0x800002cd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 272
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3361,7 +3361,7 @@
 0x1,0x1,0x1,0x1,0x3f4,0x1,
 0x1,0x3f5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x3f6,0x1,
-0x1,0x1,0x1,0x8000222b,0x1,0x1,
+0x1,0x1,0x1,0x800002e9,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 280
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3373,7 +3373,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000222c,0x1,0x3f9,
+0x1,0x1,0x1,0x800002e8,0x1,0x3f9,
 0x1,0x1,0x1},
 // Transitions for state 281
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3518,7 +3518,7 @@
 0x1,0x1,0x1,0x1,0x40d,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000419},
+0x1,0x1,0x8000030e},
 // Transitions for state 293
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3530,7 +3530,7 @@
 0x1,0x1,0x1,0x1,0x40e,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000439},
+0x1,0x1,0x8000030f},
 // Transitions for state 294
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3541,7 +3541,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d50d,0x1,0x1,0x1,0x1,
+0x1,0x80000310,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 295
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3553,7 +3553,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d527,0x1,0x1,0x1,0x1,
+0x1,0x80000311,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 296
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3674,7 +3674,7 @@
 0x41a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000041a},
+0x1,0x1,0x80000320},
 // Transitions for state 306
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3686,7 +3686,7 @@
 0x41b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000043a},
+0x1,0x1,0x80000321},
 // Transitions for state 307
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3697,7 +3697,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d50e,0x1,0x1,0x1,0x1,
+0x1,0x80000322,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 308
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3709,7 +3709,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d528,0x1,0x1,0x1,0x1,
+0x1,0x80000323,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 309
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3852,8 +3852,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x427,0x1,
 0x428,0x1,0x429,0x1,0x1,0x1,
-0x1,0x1,0x42b,0x42d,0x1,0x80002a85,
-0x42f,0x432,0x1,0x80002aab,0x1,0x1,
+0x1,0x1,0x42b,0x42d,0x1,0x80000338,
+0x42f,0x432,0x1,0x80000346,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 321
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3890,7 +3890,7 @@
 0x43b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000041b},
+0x1,0x1,0x80000359},
 // Transitions for state 324
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3902,7 +3902,7 @@
 0x43c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x43d,0x1,
-0x1,0x1,0x8000043b},
+0x1,0x1,0x8000035a},
 // Transitions for state 325
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3935,9 +3935,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x443,0x800022da,0x1,0x1,0x1,
+0x1,0x443,0x80000388,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002264,0x1,0x80002a7d,0x1,0x1,0x1,
+0x80000389,0x1,0x8000038c,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 328
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3947,7 +3947,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a8b,0x1,0x1,0x1,
+0x1,0x1,0x80000387,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -3961,7 +3961,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x447,0x1,
 0x1,0x448,0x1,0x1,0x1,0x1,
-0x1,0x8001d529,0x1,0x1,0x1,0x1,
+0x1,0x800003a2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 330
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -3973,11 +3973,11 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d50f,0x1,0x1,0x1,0x1,
+0x1,0x800003a1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 331
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a91,0x1,
+0x1,0x1,0x1,0x1,0x800003a4,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4085,13 +4085,13 @@
 0x1,0x1,0x1},
 // Transitions for state 340
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002268,0x1,
+0x1,0x1,0x1,0x1,0x800003b9,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x456,0x1,0x1,0x1,
-0x80002a87,0x1,0x1,0x1,0x1,0x1,
+0x800003ba,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x458,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -4140,7 +4140,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x465,0x1,0x466,0x1,
 0x1,0x1,0x1,0x467,0x1,0x1,
-0x1,0x1,0x8000200e,0x1,0x1,0x1,
+0x1,0x1,0x800003df,0x1,0x1,0x1,
 0x1,0x1,0x1,0x468,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 345
@@ -4151,7 +4151,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x469,0x1,0x46b,0x1,
-0x1,0x1,0x1,0x800021b0,0x46c,0x1,
+0x1,0x1,0x1,0x800003e5,0x46c,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x46d,0x1,0x1,0x46f,0x1,0x1,
 0x1,0x1,0x1},
@@ -4163,7 +4163,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x46a,0x1,
-0x1,0x1,0x1,0x800021b0,0x1,0x1,
+0x1,0x1,0x1,0x800003e4,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x46e,0x1,0x1,
 0x1,0x1,0x1},
@@ -4212,7 +4212,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x47a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x47b,0x1,0x1,0x1,0x800021a6,
+0x1,0x47b,0x1,0x1,0x1,0x80000405,
 0x1,0x47d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 351
@@ -4224,7 +4224,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002905,
+0x1,0x1,0x1,0x1,0x1,0x80000404,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 352
@@ -4238,7 +4238,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x47e,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000043c},
+0x1,0x1,0x8000040d},
 // Transitions for state 353
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4250,7 +4250,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000041c},
+0x1,0x1,0x8000040c},
 // Transitions for state 354
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4309,7 +4309,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d510,0x1,0x1,0x1,0x1,
+0x1,0x80000413,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 359
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4321,7 +4321,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d52a,0x1,0x1,0x1,0x1,
+0x1,0x80000414,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 360
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4332,7 +4332,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002127,0x1,
+0x1,0x1,0x1,0x1,0x80000415,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 361
@@ -4342,7 +4342,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x484,0x80002223,
+0x1,0x1,0x1,0x1,0x484,0x80000417,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x486,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4452,7 +4452,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x493,0x495,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x496,0x1,0x80002249,
+0x1,0x1,0x1,0x496,0x1,0x80000432,
 0x1,0x1,0x1,0x498,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 371
@@ -4490,7 +4490,7 @@
 0x49e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x49f,0x1,
 0x1,0x1,0x1,0x1,0x4a0,0x1,
-0x1,0x1,0x8000043d},
+0x1,0x1,0x80000446},
 // Transitions for state 374
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4502,7 +4502,7 @@
 0x49d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000041d},
+0x1,0x1,0x80000445},
 // Transitions for state 375
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4549,7 +4549,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d511,0x1,0x1,0x1,0x1,
+0x1,0x8000045a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 379
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4561,19 +4561,19 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d52b,0x1,0x1,0x1,0x1,
+0x1,0x8000045b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 380
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002267,0x1,
+0x1,0x1,0x1,0x1,0x8000045c,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002271,0x1,0x1,0x1,0x1,0x1,
+0x8000045d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x4ac,0x8000226f,0x1,0x1,
+0x1,0x1,0x4ac,0x80000465,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 381
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4583,9 +4583,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022d9,0x1,0x1,0x1,
+0x1,0x1,0x80000462,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000226b,0x1,0x1,
+0x1,0x1,0x1,0x80000464,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 382
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4609,7 +4609,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022fc,0x1,0x1,0x8000220b,
+0x1,0x1,0x8000046c,0x1,0x1,0x8000046e,
 0x1,0x1,0x1},
 // Transitions for state 384
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4637,15 +4637,15 @@
 0x1,0x1,0x1},
 // Transitions for state 386
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x4b5,0x1,0x1,0x1,0x80002266,0x1,
+0x4b5,0x1,0x1,0x1,0x80000474,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x4b6,0x1,0x1,0x4b7,
-0x80002270,0x1,0x1,0x1,0x1,0x1,
+0x80000475,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x4ba,0x8000226e,0x1,0x1,
+0x1,0x1,0x4ba,0x80000482,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 387
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4656,8 +4656,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x4b8,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022d8,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000226a,0x1,0x1,
+0x1,0x8000047f,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x80000481,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 388
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4681,7 +4681,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x4bf,0x1,0x4c0,
-0x1,0x1,0x1,0x80002aec,0x1,0x1,
+0x1,0x1,0x1,0x8000048b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 390
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4693,7 +4693,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x4c1,
-0x1,0x1,0x1,0x800000ac,0x1,0x1,
+0x1,0x1,0x1,0x8000048c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 391
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4705,7 +4705,7 @@
 0x1,0x1,0x4c4,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x4c5,0x1,
-0x1,0x80002280,0x1,0x1,0x1,0x1,
+0x1,0x800004cf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 392
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4738,7 +4738,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002281,0x1,
+0x1,0x1,0x1,0x1,0x800004dc,0x1,
 0x1,0x1,0x1,0x4ce,0x4cf,0x1,
 0x1,0x1,0x4d0,0x1,0x1,0x4d1,
 0x4d2,0x1,0x1,0x1,0x4d3,0x1,
@@ -4788,7 +4788,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000023,0x1,0x1,0x1,
+0x1,0x1,0x80000502,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 399
@@ -4862,7 +4862,7 @@
 0x1,0x1,0x1,0x1,0x4eb,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000043e},
+0x1,0x1,0x80000521},
 // Transitions for state 405
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4874,7 +4874,7 @@
 0x1,0x1,0x1,0x1,0x4ec,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000041e},
+0x1,0x1,0x80000520},
 // Transitions for state 406
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4933,7 +4933,7 @@
 0x1,0x1,0x1,0x1,0x4f5,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d52c,0x1,0x1,0x1,0x1,
+0x1,0x8000052c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 411
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4945,7 +4945,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d512,0x1,0x1,0x1,0x1,
+0x1,0x8000052b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 412
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4957,7 +4957,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x4f6,0x1,
-0x1,0x4f8,0x1,0x800029c1,0x1,0x1,
+0x1,0x4f8,0x1,0x80000530,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 413
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -4980,7 +4980,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x4f9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003a9,0x1,0x1,0x1,
+0x1,0x1,0x80000532,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 415
@@ -5005,7 +5005,7 @@
 0x1,0x1,0x4fb,0x1,0x4fc,0x1,
 0x1,0x1,0x1,0x1,0x4fd,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800029c0,0x1,0x1,
+0x1,0x1,0x1,0x80000538,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 417
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5086,10 +5086,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x50a,0x1,0x1,0x80002a5d,
+0x1,0x1,0x50a,0x1,0x1,0x8000054b,
 0x1,0x1,0x1,0x1,0x50c,0x1,
 0x1,0x1,0x1,0x1,0x50d,0x1,
-0x1,0x1,0x50e,0x1,0x1,0x80002a5b,
+0x1,0x1,0x50e,0x1,0x1,0x80000553,
 0x1,0x1,0x1},
 // Transitions for state 424
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5197,7 +5197,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002225,0x1,0x1,0x1,0x1,
+0x1,0x80000566,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 433
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5222,7 +5222,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000041f},
+0x1,0x1,0x8000056d},
 // Transitions for state 435
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5234,7 +5234,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000043f},
+0x1,0x1,0x8000056e},
 // Transitions for state 436
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5257,7 +5257,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d513,0x1,0x1,0x1,0x1,
+0x1,0x80000574,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 438
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5269,7 +5269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d52d,0x1,0x1,0x1,0x1,
+0x1,0x80000575,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 439
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5279,7 +5279,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003a6,0x1,
+0x1,0x1,0x1,0x1,0x80000576,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -5291,7 +5291,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003c6,0x1,
+0x1,0x1,0x1,0x1,0x80000577,0x1,
 0x1,0x1,0x51e,0x1,0x51f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -5305,7 +5305,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x520,0x1,0x800003d6,
+0x1,0x1,0x1,0x520,0x1,0x8000057e,
 0x1,0x1,0x1},
 // Transitions for state 442
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5357,13 +5357,13 @@
 0x1,0x1,0x1},
 // Transitions for state 446
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ab3,0x1,
+0x1,0x1,0x1,0x1,0x80000597,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x529,0x1,0x52a,0x1,
-0x80002aaf,0x1,0x1,0x1,0x52e,0x1,
+0x80000598,0x1,0x1,0x1,0x52e,0x1,
 0x1,0x1,0x1,0x52f,0x530,0x1,
 0x1,0x1,0x532,0x1,0x533,0x1,
 0x1,0x1,0x1},
@@ -5387,7 +5387,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x534,0x1,
-0x1,0x1,0x1,0x1,0x800003a8,0x1,
+0x1,0x1,0x1,0x1,0x800005b8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -5399,7 +5399,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x535,0x1,
-0x1,0x1,0x1,0x1,0x800003c8,0x1,
+0x1,0x1,0x1,0x1,0x800005b9,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -5425,7 +5425,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d514,0x1,0x1,0x1,0x1,
+0x1,0x800005bb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 452
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5437,7 +5437,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d52e,0x1,0x1,0x1,0x1,
+0x1,0x800005bc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 453
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5618,7 +5618,7 @@
 0x555,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000420},
+0x1,0x1,0x800005f7},
 // Transitions for state 468
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5630,7 +5630,7 @@
 0x556,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x557,0x1,
-0x1,0x1,0x80000440},
+0x1,0x1,0x800005f8},
 // Transitions for state 469
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5651,14 +5651,14 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x55c,0x1,0x55d,0x1,
-0x1,0x1,0x800000ae,0x1,0x1,0x1,
+0x1,0x1,0x80000605,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 471
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000ae,0x1,0x1,0x1,0x1,0x1,
+0x80000604,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5689,7 +5689,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x55f,0x1,
 0x1,0x560,0x1,0x1,0x1,0x1,
-0x1,0x8001d52f,0x1,0x1,0x1,0x1,
+0x1,0x8000060c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 474
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5701,7 +5701,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000211c,0x1,0x1,0x1,0x1,
+0x1,0x8000060b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 475
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5724,7 +5724,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x562,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003c1,0x1,
+0x1,0x1,0x1,0x1,0x80000612,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 477
@@ -5736,7 +5736,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003a1,0x1,
+0x1,0x1,0x1,0x1,0x80000611,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 478
@@ -5772,7 +5772,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x568,0x1,0x1,0x1,
 0x1,0x1,0x1,0x569,0x1,0x1,
-0x1,0x1,0x8000200f,0x1,0x1,0x1,
+0x1,0x1,0x80000638,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 481
@@ -5867,7 +5867,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x576,0x1,0x578,0x1,
-0x1,0x1,0x1,0x800021b1,0x1,0x1,
+0x1,0x1,0x1,0x8000064e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x579,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -5879,7 +5879,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x577,0x1,
-0x1,0x1,0x1,0x800021b1,0x1,0x1,
+0x1,0x1,0x1,0x8000064d,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -5957,16 +5957,16 @@
 0x1,0x1,0x1},
 // Transitions for state 496
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ab4,0x1,
+0x1,0x1,0x1,0x1,0x80000664,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x582,0x1,0x584,0x1,
-0x80002ab0,0x1,0x1,0x1,0x588,0x1,
+0x80000665,0x1,0x1,0x1,0x588,0x1,
 0x1,0x1,0x1,0x589,0x1,0x58a,
 0x1,0x1,0x58b,0x1,0x1,0x1,
-0x1,0x1,0x80000441},
+0x1,0x1,0x80000670},
 // Transitions for state 497
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -5978,7 +5978,7 @@
 0x585,0x1,0x1,0x1,0x587,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000421},
+0x1,0x1,0x8000066f},
 // Transitions for state 498
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6013,7 +6013,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d516,0x1,0x1,0x1,0x1,
+0x1,0x8000067e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 501
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6025,7 +6025,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d530,0x1,0x1,0x1,0x1,
+0x1,0x8000067f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 502
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6038,7 +6038,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x59a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000ad},
+0x1,0x1,0x8000068c},
 // Transitions for state 503
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x596,0x1,0x1,0x1,
@@ -6084,7 +6084,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x59c,0x1,0x1,0x1,
-0x1,0x1,0x8000223c,0x1,0x1,0x1,
+0x1,0x1,0x80000691,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 507
@@ -6121,7 +6121,7 @@
 0x1,0x1,0x5a0,0x1,0x1,0x1,
 0x5a1,0x1,0x1,0x1,0x5a2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002aaa,0x1,0x1,
+0x1,0x1,0x1,0x800006a3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 510
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6144,7 +6144,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x5a5,0x1,0x1,0x1,0x1,
-0x1,0x8000002f,0x1,0x1,0x1,0x5a8,
+0x1,0x800006a8,0x1,0x1,0x1,0x5a8,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 512
@@ -6181,7 +6181,7 @@
 0x1,0x1,0x1,0x1,0x5aa,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x5ac,0x1,0x800025a1,0x1,
+0x1,0x1,0x5ac,0x1,0x800006bd,0x1,
 0x1,0x1,0x1},
 // Transitions for state 515
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6262,9 +6262,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d0,0x5bb,0x1,
+0x1,0x1,0x1,0x800006d4,0x5bb,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002211,0x1,0x1,0x800022d1,
+0x1,0x1,0x800006f6,0x1,0x1,0x800006f9,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 522
@@ -6274,9 +6274,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002282,0x5ba,0x1,
+0x1,0x1,0x1,0x800006d5,0x5ba,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002211,0x5bc,0x1,0x80002283,
+0x1,0x1,0x800006f7,0x5bc,0x1,0x800006fa,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 523
@@ -6310,10 +6310,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000009,0x1,0x1,
+0x1,0x1,0x1,0x8000071b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003a4,0x1,
+0x1,0x1,0x1,0x1,0x8000071d,0x1,
 0x1,0x1,0x1},
 // Transitions for state 526
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6325,7 +6325,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x5c3,0x1,0x1,0x800003c4,0x1,
+0x1,0x5c3,0x1,0x1,0x8000071e,0x1,
 0x1,0x1,0x1},
 // Transitions for state 527
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6350,7 +6350,7 @@
 0x5c7,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000422},
+0x1,0x1,0x80000724},
 // Transitions for state 529
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6362,7 +6362,7 @@
 0x5c8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000442},
+0x1,0x1,0x80000725},
 // Transitions for state 530
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6397,7 +6397,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d517,0x1,0x1,0x1,0x1,
+0x1,0x80000728,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 533
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6409,7 +6409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d531,0x1,0x1,0x1,0x1,
+0x1,0x80000729,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 534
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6480,7 +6480,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x5d6,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022a4,
+0x1,0x1,0x1,0x1,0x1,0x80000745,
 0x1,0x1,0x5d9,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 540
@@ -6662,7 +6662,7 @@
 0x1,0x1,0x1,0x1,0x5f0,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000423},
+0x1,0x1,0x80000775},
 // Transitions for state 555
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6674,7 +6674,7 @@
 0x1,0x1,0x1,0x1,0x5f1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000443},
+0x1,0x1,0x80000776},
 // Transitions for state 556
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6709,7 +6709,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x5f6,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d532,0x1,0x1,0x1,0x1,
+0x1,0x8000077d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 559
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6721,7 +6721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d518,0x1,0x1,0x1,0x1,
+0x1,0x8000077c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 560
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -6804,7 +6804,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x5ff,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000a8,0x1,0x1,0x1,0x1,
+0x1,0x8000078a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 567
@@ -7034,7 +7034,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000412},
+0x1,0x1,0x800007d1},
 // Transitions for state 586
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7046,7 +7046,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000432},
+0x1,0x1,0x800007d2},
 // Transitions for state 587
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7103,7 +7103,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c1,0x1,0x1,0x1,0x1,0x1,
+0x800007d8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x62d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -7115,7 +7115,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002228,0x1,0x1,0x1,0x1,0x1,
+0x800007d9,0x1,0x1,0x1,0x1,0x1,
 0x1,0x62c,0x1,0x1,0x1,0x1,
 0x1,0x62e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -7129,7 +7129,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d519,0x1,0x1,0x1,0x1,
+0x1,0x800007e6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 594
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7141,7 +7141,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d533,0x1,0x1,0x1,0x1,
+0x1,0x800007e7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 595
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7321,7 +7321,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d51a,0x1,0x1,0x1,0x1,
+0x1,0x800007fe,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 610
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7333,7 +7333,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d534,0x1,0x1,0x1,0x1,
+0x1,0x800007ff,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 611
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7429,7 +7429,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d51b,0x1,0x1,0x1,0x1,
+0x1,0x8000080b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 619
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7441,7 +7441,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d535,0x1,0x1,0x1,0x1,
+0x1,0x8000080c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 620
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7634,7 +7634,7 @@
 0x1,0x1,0x1,0x1,0x65e,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000042b},
+0x1,0x1,0x80000829},
 // Transitions for state 636
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7646,7 +7646,7 @@
 0x1,0x1,0x1,0x1,0x65f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000044b},
+0x1,0x1,0x8000082a},
 // Transitions for state 637
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7656,7 +7656,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000a5,0x1,0x1,
+0x1,0x1,0x1,0x8000082b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 638
@@ -7669,7 +7669,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d51c,0x1,0x1,0x1,0x1,
+0x1,0x8000082c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 639
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7681,7 +7681,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d536,0x1,0x1,0x1,0x1,
+0x1,0x8000082d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 640
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7826,7 +7826,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000417},
+0x1,0x1,0x8000083c},
 // Transitions for state 652
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7838,7 +7838,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000437},
+0x1,0x1,0x8000083d},
 // Transitions for state 653
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7897,7 +7897,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002128,0x1,0x1,0x1,0x1,
+0x1,0x80000844,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 658
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -7909,7 +7909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d537,0x1,0x1,0x1,0x1,
+0x1,0x80000845,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 659
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8003,7 +8003,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000200d,
+0x1,0x1,0x1,0x1,0x1,0x8000084d,
 0x1,0x1,0x1,0x67b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -8206,10 +8206,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x68e,0x1,0x1,0x80002a5c,
+0x1,0x1,0x68e,0x1,0x1,0x80000021,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x68f,0x1,0x1,0x80002a5a,
+0x1,0x1,0x68f,0x1,0x1,0x80000023,
 0x1,0x1,0x1},
 // Transitions for state 684
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8219,7 +8219,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800029a4,0x1,0x1,0x1,0x1,0x1,
+0x80000025,0x1,0x1,0x1,0x1,0x1,
 0x1,0x690,0x691,0x1,0x1,0x1,
 0x1,0x692,0x693,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -8255,7 +8255,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d538,0x1,0x1,0x1,0x1,
+0x1,0x80000038,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -8267,7 +8267,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d552,0x1,0x1,0x1,0x1,
+0x1,0x80000039,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -8290,7 +8290,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224b,
+0x1,0x1,0x1,0x1,0x1,0x8000003e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8305,7 +8305,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000027,0x1,0x1,0x1,
+0x1,0x1,0x8000003f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 692
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8365,7 +8365,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d49c,0x1,0x1,0x1,0x1,
+0x1,0x80000045,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 697
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8377,7 +8377,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b6,0x1,0x1,0x1,0x1,
+0x1,0x80000046,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 698
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8436,7 +8436,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000c4,0x1,0x1,0x1,0x1,
+0x1,0x8000004d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 703
@@ -8448,7 +8448,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000e4,0x1,0x1,0x1,0x1,
+0x1,0x8000004e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 704
@@ -8509,7 +8509,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ae7,
+0x1,0x1,0x1,0x1,0x1,0x80000057,
 0x6a5,0x1,0x1},
 // Transitions for state 709
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8532,7 +8532,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023b5,0x1,0x1,0x1,0x1,0x1,
+0x8000005c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 711
@@ -8638,7 +8638,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000392,0x1,0x1,0x1,
+0x1,0x1,0x80000069,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8650,8 +8650,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b2,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002136,0x1,0x1,
+0x1,0x1,0x8000006a,0x1,0x1,0x1,
+0x1,0x1,0x1,0x8000006b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x6b0,0x1,0x1},
@@ -8737,7 +8737,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002aed,0x1,0x1,
+0x1,0x1,0x1,0x8000008a,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 728
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8749,7 +8749,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002310,0x1,0x1,
+0x1,0x1,0x1,0x8000008b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 729
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8759,7 +8759,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d539,0x1,0x1,0x1,0x1,
+0x1,0x8000008c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -8771,7 +8771,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d553,0x1,0x1,0x1,0x1,
+0x1,0x8000008d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -8802,14 +8802,14 @@
 // Transitions for state 733
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x6c2,0x1,0x1,
-0x1,0x80002550,0x1,0x1,0x1,0x1,
+0x1,0x8000009a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x6c9,0x80002551,0x1,0x1,
+0x1,0x1,0x6c9,0x800000af,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x6c1,0x1,0x6c3,
-0x1,0x1,0x1,0x80002500,0x1,0x1,
+0x1,0x1,0x1,0x8000009b,0x1,0x1,
 0x1,0x1,0x6c6,0x1,0x1,0x6c7,
-0x1,0x1,0x1,0x6c8,0x6ca,0x80002502,
+0x1,0x1,0x1,0x6c8,0x6ca,0x800000b0,
 0x1,0x1,0x1},
 // Transitions for state 734
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8869,7 +8869,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000212c,0x1,0x1,0x1,0x1,
+0x1,0x800000c1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 739
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8881,7 +8881,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b7,0x1,0x1,0x1,0x1,
+0x1,0x800000c2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 740
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -8904,7 +8904,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000223d,0x1,0x1,0x1,
+0x1,0x1,0x800000c4,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 742
@@ -8916,7 +8916,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000005c,0x1,0x1,0x1,0x1,
+0x1,0x800000c6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 743
@@ -8928,7 +8928,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002022,0x1,0x1,0x1,0x1,
+0x1,0x800000c9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 744
@@ -8940,7 +8940,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224e,
+0x1,0x1,0x1,0x1,0x1,0x800000cb,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 745
@@ -8989,7 +8989,7 @@
 0x1,0x1,0x6d9,0x6da,0x6db,0x6dc,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002229,0x1,0x1,0x1,
+0x1,0x1,0x800000da,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 749
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9133,7 +9133,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000010a,0x1,0x1,
+0x1,0x1,0x1,0x800000e8,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 761
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9145,7 +9145,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000010b,0x1,0x1,
+0x1,0x1,0x1,0x800000e9,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 762
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9193,7 +9193,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000a2,0x1,0x1,
+0x1,0x1,0x1,0x800000ed,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 766
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9218,7 +9218,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000427},
+0x1,0x1,0x800000f2},
 // Transitions for state 768
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9230,7 +9230,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000447},
+0x1,0x1,0x800000f3},
 // Transitions for state 769
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9245,13 +9245,13 @@
 0x1,0x1,0x1},
 // Transitions for state 770
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800029c3,0x1,
+0x1,0x1,0x1,0x1,0x80000106,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800002c6,0x1,
-0x80002257,0x6f2,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x800000f9,0x1,
+0x80000107,0x6f2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x6f3,0x1,0x1,0x1,
 0x1,0x1,0x6f4,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -9324,7 +9324,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x6fa,0x1,0x1,0x80002201,
+0x1,0x1,0x6fa,0x1,0x1,0x80000117,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 777
@@ -9335,7 +9335,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002245,0x1,0x6ff,0x1,
+0x1,0x1,0x8000011b,0x1,0x6ff,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -9359,7 +9359,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002102,0x1,0x1,0x1,0x1,
+0x1,0x80000121,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x702,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -9371,17 +9371,17 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d554,0x1,0x1,0x1,0x1,
+0x1,0x80000122,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x701,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000a9},
+0x1,0x1,0x80000126},
 // Transitions for state 781
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000a9,0x1,0x1,0x1,0x1,0x1,
+0x80000125,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9445,7 +9445,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d49e,0x1,0x1,0x1,0x1,
+0x1,0x8000012c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 787
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9457,7 +9457,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b8,0x1,0x1,0x1,0x1,
+0x1,0x8000012d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 788
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9466,9 +9466,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002acf,0x1,0x1,
+0x1,0x1,0x1,0x8000012e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ad0,
+0x1,0x1,0x1,0x1,0x1,0x80000130,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 789
@@ -9529,7 +9529,7 @@
 0x1,0x1,0x1,0x70f,0x711,0x712,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x713,0x1,
-0x1,0x1,0x8000222a,0x1,0x1,0x1,
+0x1,0x1,0x80000141,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 794
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9661,7 +9661,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021a1,0x1,0x1,0x1,0x1,
+0x1,0x80000153,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 805
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9673,7 +9673,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d3,0x1,0x1,0x1,0x1,
+0x1,0x80000154,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 806
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9685,7 +9685,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002193,0x1,0x1,0x1,0x1,
+0x1,0x80000155,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 807
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9695,7 +9695,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002010,0x1,0x1,
+0x1,0x1,0x1,0x80000156,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -9853,7 +9853,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002965,0x1,0x1,0x1,0x1,
+0x1,0x8000016d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 821
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9888,7 +9888,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022c4,0x1,0x1,0x1,
+0x1,0x1,0x80000175,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 824
@@ -9950,7 +9950,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000402},
+0x1,0x1,0x80000182},
 // Transitions for state 829
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9962,7 +9962,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000452},
+0x1,0x1,0x80000183},
 // Transitions for state 830
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -9995,7 +9995,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d53b,0x1,0x1,0x1,0x1,
+0x1,0x80000187,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -10007,7 +10007,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d555,0x1,0x1,0x1,0x1,
+0x1,0x80000188,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -10117,7 +10117,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d49f,0x1,0x1,0x1,0x1,
+0x1,0x800001b6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 843
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10129,8 +10129,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b9,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000455},
+0x1,0x800001b7,0x1,0x1,0x1,0x1,
+0x1,0x1,0x800001b9},
 // Transitions for state 844
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10142,7 +10142,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000405},
+0x1,0x1,0x800001b8},
 // Transitions for state 845
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10152,7 +10152,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029f6,0x1,0x1,0x1,0x1,
+0x1,0x800001ba,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 846
@@ -10199,7 +10199,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025bf,0x1,
+0x1,0x1,0x1,0x1,0x800001be,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -10250,7 +10250,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000040f},
+0x1,0x1,0x800001c3},
 // Transitions for state 854
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10262,7 +10262,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000045f},
+0x1,0x1,0x800001c4},
 // Transitions for state 855
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10345,7 +10345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002256,0x1,0x1,0x1,0x1,
+0x1,0x800001cb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 862
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10393,7 +10393,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000116,0x1,0x1,
+0x1,0x1,0x1,0x800001d2,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 866
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10405,7 +10405,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002251,0x1,0x1,
+0x1,0x1,0x1,0x800001d3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 867
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10417,7 +10417,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000117,0x1,0x1,
+0x1,0x1,0x1,0x800001d4,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 868
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10560,7 +10560,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002003,
+0x1,0x1,0x1,0x1,0x1,0x800001eb,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 880
@@ -10572,7 +10572,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002002,
+0x1,0x1,0x1,0x1,0x1,0x800001f0,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 881
@@ -10607,7 +10607,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d53c,0x1,0x1,0x1,0x1,
+0x1,0x800001f3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -10619,7 +10619,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d556,0x1,0x1,0x1,0x1,
+0x1,0x800001f4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -10633,7 +10633,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022d5,0x1,0x1,0x1,0x1,
+0x1,0x800001f5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 886
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10655,7 +10655,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003b5,0x1,
+0x1,0x1,0x1,0x1,0x800001f8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -10765,7 +10765,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002130,0x1,0x1,0x1,0x1,
+0x1,0x8000020b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 897
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10777,7 +10777,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000212f,0x1,0x1,0x1,0x1,
+0x1,0x8000020c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 898
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -10800,7 +10800,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a73,0x1,0x1,0x1,
+0x1,0x1,0x8000020e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 900
@@ -10812,7 +10812,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002242,0x1,0x1,0x1,
+0x1,0x1,0x8000020f,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 901
@@ -10824,7 +10824,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000cb,0x1,0x1,0x1,0x1,
+0x1,0x80000214,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 902
@@ -10836,7 +10836,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000eb,0x1,0x1,0x1,0x1,
+0x1,0x80000215,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 903
@@ -10848,7 +10848,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800020ac,0x1,
+0x1,0x1,0x1,0x1,0x80000216,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 904
@@ -10860,7 +10860,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000021,0x1,0x1,0x1,0x1,
+0x1,0x80000217,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 905
@@ -11005,7 +11005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000266d,0x1,0x1,
+0x1,0x1,0x1,0x8000022a,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 917
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11039,7 +11039,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000192,0x1,0x1,0x1,0x1,
+0x1,0x8000022d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11051,7 +11051,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d53d,0x1,0x1,0x1,0x1,
+0x1,0x8000022e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11063,7 +11063,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d557,0x1,0x1,0x1,0x1,
+0x1,0x8000022f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11088,7 +11088,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x787,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022d4,0x1,0x1,0x1,0x1,0x1,
+0x80000232,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 924
@@ -11149,7 +11149,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002131,0x1,0x1,0x1,0x1,
+0x1,0x80000247,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 929
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11161,7 +11161,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4bb,0x1,0x1,0x1,0x1,
+0x1,0x80000248,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 930
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11269,7 +11269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000120,0x1,0x1,
+0x1,0x1,0x1,0x80000256,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 939
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11281,7 +11281,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000121,0x1,0x1,
+0x1,0x1,0x1,0x80000257,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 940
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11293,7 +11293,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002267,0x1,0x796,0x1,0x1,0x1,
+0x8000025d,0x1,0x796,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 941
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11304,7 +11304,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x797,0x798,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022db,0x1,0x1,0x1,0x1,
+0x1,0x80000264,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 942
@@ -11330,7 +11330,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000403},
+0x1,0x1,0x8000026c},
 // Transitions for state 944
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11342,7 +11342,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000453},
+0x1,0x1,0x8000026d},
 // Transitions for state 945
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11352,7 +11352,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a8a,
+0x1,0x1,0x1,0x1,0x1,0x80000272,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 946
@@ -11365,7 +11365,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a88,0x1,0x1,0x1,0x1,0x1,
+0x80000276,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 947
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11387,7 +11387,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d53e,0x1,0x1,0x1,0x1,
+0x1,0x80000279,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11399,7 +11399,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d558,0x1,0x1,0x1,0x1,
+0x1,0x8000027a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11437,7 +11437,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4a2,0x1,0x1,0x1,0x1,
+0x1,0x80000283,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 953
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11449,7 +11449,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000210a,0x1,0x1,0x1,0x1,
+0x1,0x80000284,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 954
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11460,7 +11460,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002273,0x1,0x1,0x1,
+0x1,0x1,0x80000285,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 955
@@ -11470,7 +11470,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002aa7,0x1,
+0x1,0x1,0x1,0x1,0x8000028b,0x1,
 0x1,0x1,0x1,0x1,0x7a1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11537,7 +11537,7 @@
 0x1,0x1,0x1},
 // Transitions for state 961
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002269,0x1,
+0x1,0x1,0x1,0x1,0x80000298,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11579,7 +11579,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000bd,0x1,0x1,0x1,0x1,
+0x1,0x8000029b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11617,7 +11617,7 @@
 0x1,0x1,0x1,0x1,0x1,0x7af,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002194,0x1,0x1,0x1,0x1,
+0x1,0x800002a0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 968
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11629,7 +11629,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d4,0x1,0x1,0x1,0x1,
+0x1,0x8000029f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 969
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11641,7 +11641,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000210f,0x1,0x1,0x1,0x1,
+0x1,0x800002a4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 970
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11771,7 +11771,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000210d,0x1,0x1,0x1,0x1,
+0x1,0x800002b4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11783,7 +11783,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d559,0x1,0x1,0x1,0x1,
+0x1,0x800002b5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -11821,7 +11821,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000210b,0x1,0x1,0x1,0x1,
+0x1,0x800002b8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 985
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11833,7 +11833,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4bd,0x1,0x1,0x1,0x1,
+0x1,0x800002b9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 986
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11965,7 +11965,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000130,0x1,0x1,
+0x1,0x1,0x1,0x800002c8,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 997
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11978,7 +11978,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000415},
+0x1,0x1,0x800002c9},
 // Transitions for state 998
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -11990,7 +11990,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000435},
+0x1,0x1,0x800002ca},
 // Transitions for state 999
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12119,7 +12119,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022b7,0x1,0x1,0x1,0x1,
+0x1,0x800002e0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12230,7 +12230,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000401},
+0x1,0x1,0x800002f3},
 // Transitions for state 1019
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12242,7 +12242,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000451},
+0x1,0x1,0x800002f4},
 // Transitions for state 1020
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12275,7 +12275,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d540,0x1,0x1,0x1,0x1,
+0x1,0x800002f7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12287,7 +12287,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d55a,0x1,0x1,0x1,0x1,
+0x1,0x800002f8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12298,7 +12298,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000399,0x1,0x1,0x1,
+0x1,0x1,0x800002f9,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12310,7 +12310,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b9,0x1,0x1,0x1,
+0x1,0x1,0x800002fa,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12349,7 +12349,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002110,0x1,0x1,0x1,0x1,
+0x1,0x800002fd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1029
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12361,7 +12361,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4be,0x1,0x1,0x1,0x1,
+0x1,0x800002fe,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1030
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12372,7 +12372,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002208,0x1,0x1,
+0x1,0x1,0x1,0x800002ff,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1031
@@ -12432,7 +12432,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000cf,0x1,0x1,0x1,0x1,
+0x1,0x8000030a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1036
@@ -12444,7 +12444,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000ef,0x1,0x1,0x1,0x1,
+0x1,0x8000030b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1037
@@ -12491,7 +12491,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d541,0x1,0x1,0x1,0x1,
+0x1,0x80000313,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12503,7 +12503,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d55b,0x1,0x1,0x1,0x1,
+0x1,0x80000314,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12517,7 +12517,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4a5,0x1,0x1,0x1,0x1,
+0x1,0x80000315,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1043
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12529,7 +12529,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4bf,0x1,0x1,0x1,0x1,
+0x1,0x80000316,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1044
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12650,7 +12650,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000425},
+0x1,0x1,0x80000325},
 // Transitions for state 1054
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12662,7 +12662,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000445},
+0x1,0x1,0x80000326},
 // Transitions for state 1055
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12674,7 +12674,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000040c},
+0x1,0x1,0x80000327},
 // Transitions for state 1056
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12686,7 +12686,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000045c},
+0x1,0x1,0x80000328},
 // Transitions for state 1057
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12695,7 +12695,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d542,0x1,0x1,0x1,0x1,
+0x1,0x80000329,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12707,7 +12707,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d55c,0x1,0x1,0x1,0x1,
+0x1,0x8000032a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12721,7 +12721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4a6,0x1,0x1,0x1,0x1,
+0x1,0x8000032b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1060
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12733,7 +12733,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c0,0x1,0x1,0x1,0x1,
+0x1,0x8000032c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1061
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12827,7 +12827,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800027ea,0x1,0x1,0x1,
+0x1,0x1,0x80000334,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12839,7 +12839,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800027e8,0x1,0x1,0x1,
+0x1,0x1,0x80000335,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -12877,7 +12877,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000219e,0x1,0x1,0x1,0x1,
+0x1,0x8000033b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1073
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12889,7 +12889,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d0,0x1,0x1,0x1,0x1,
+0x1,0x8000033c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1074
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12901,7 +12901,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002190,0x1,0x1,0x1,0x1,
+0x1,0x8000033d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1075
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -12923,7 +12923,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x802,0x1,0x1,0x1,
-0x80002aad,0x1,0x1,0x1,0x1,0x1,
+0x80000349,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13030,7 +13030,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000007b,0x1,0x1,
+0x1,0x1,0x1,0x80000358,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13042,7 +13042,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002936,0x1,0x1,0x1,
+0x1,0x1,0x8000035b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13079,7 +13079,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021b2,0x1,0x1,
+0x1,0x1,0x1,0x80000360,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13117,7 +13117,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002266,0x1,0x813,0x1,0x1,0x1,
+0x8000038a,0x1,0x813,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1093
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13127,7 +13127,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x814,0x815,
-0x1,0x1,0x800022da,0x1,0x1,0x1,
+0x1,0x1,0x80000391,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x817,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13177,7 +13177,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002962,0x1,0x1,0x1,0x1,
+0x1,0x800003a5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1098
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13214,7 +13214,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000409},
+0x1,0x1,0x800003aa},
 // Transitions for state 1101
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13226,7 +13226,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000459},
+0x1,0x1,0x800003ab},
 // Transitions for state 1102
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13332,7 +13332,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a89,
+0x1,0x1,0x1,0x1,0x1,0x800003b7,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1111
@@ -13345,7 +13345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a87,0x1,0x1,0x1,0x1,0x1,
+0x800003bb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1112
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13427,7 +13427,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x82e,0x1,0x1,0x1,
-0x1,0x8001d55d,0x1,0x1,0x1,0x1,
+0x1,0x800003cf,0x1,0x1,0x1,0x1,
 0x1,0x82f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13439,7 +13439,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d543,0x1,0x1,0x1,0x1,
+0x1,0x800003ce,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13487,7 +13487,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x834,0x800029eb,0x1,0x1,0x1,0x1,
+0x834,0x800003d8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13501,7 +13501,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000028,0x1,0x1,0x1,0x1,
+0x1,0x800003d9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1125
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13573,7 +13573,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002112,0x1,0x1,0x1,0x1,
+0x1,0x800003e2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1131
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13585,7 +13585,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c1,0x1,0x1,0x1,0x1,
+0x1,0x800003e3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1132
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13596,7 +13596,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002272,0x1,0x1,0x1,
+0x1,0x1,0x800003e6,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1133
@@ -13606,7 +13606,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000005b,0x1,0x1,
+0x1,0x1,0x1,0x800003e9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x83c,0x1,
@@ -13642,7 +13642,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002aa6,0x1,
+0x1,0x1,0x1,0x1,0x800003f1,0x1,
 0x1,0x1,0x1,0x1,0x83f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13715,7 +13715,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025c3,0x1,
+0x1,0x1,0x1,0x1,0x800003f8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13745,7 +13745,7 @@
 0x1,0x1,0x1},
 // Transitions for state 1145
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002268,0x1,
+0x1,0x1,0x1,0x1,0x800003ff,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13765,7 +13765,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000af,0x1,0x1,0x1,0x1,
+0x1,0x80000400,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1147
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13775,9 +13775,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002642,0x1,0x1,0x1,0x1,0x1,
+0x80000401,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002720,0x1,0x1,
+0x1,0x1,0x1,0x80000402,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1148
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13932,7 +13932,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002adb,
+0x1,0x1,0x1,0x1,0x1,0x80000420,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1161
@@ -13945,7 +13945,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002026,0x1,0x1,0x1,0x1,
+0x1,0x80000421,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1162
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -13979,7 +13979,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d544,0x1,0x1,0x1,0x1,
+0x1,0x80000424,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -13991,7 +13991,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d55e,0x1,0x1,0x1,0x1,
+0x1,0x80000425,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -14005,7 +14005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002133,0x1,0x1,0x1,0x1,
+0x1,0x80000427,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1167
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14017,7 +14017,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c2,0x1,0x1,0x1,0x1,
+0x1,0x80000428,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1168
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14099,13 +14099,13 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002220,0x1,0x1,0x1,
+0x1,0x1,0x80000431,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1175
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a70,0x1,
+0x1,0x1,0x1,0x1,0x80000433,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14136,7 +14136,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800000a0,
+0x1,0x1,0x1,0x1,0x1,0x8000043a,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1178
@@ -14160,7 +14160,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a43,
+0x1,0x1,0x1,0x1,0x1,0x8000043d,
 0x1,0x867,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1180
@@ -14220,7 +14220,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a42,
+0x1,0x1,0x1,0x1,0x1,0x80000444,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1185
@@ -14353,7 +14353,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002271,0x1,0x80002a7e,0x1,0x1,0x1,
+0x8000045e,0x1,0x80000461,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1196
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14377,7 +14377,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000226f,0x1,0x1,0x1,0x1,
+0x1,0x80000466,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1198
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14389,7 +14389,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000226b,
+0x1,0x1,0x1,0x1,0x1,0x80000467,
 0x1,0x1,0x1},
 // Transitions for state 1199
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14434,7 +14434,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022fa,
+0x1,0x1,0x1,0x1,0x1,0x8000046d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14450,7 +14450,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000040a},
+0x1,0x1,0x8000046f},
 // Transitions for state 1204
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14462,7 +14462,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000045a},
+0x1,0x1,0x80000470},
 // Transitions for state 1205
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14497,7 +14497,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002025,0x1,0x1,0x1,0x1,
+0x1,0x80000473,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1208
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14521,7 +14521,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x87e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002270,0x1,0x80002a7d,0x1,0x1,0x1,
+0x8000047a,0x1,0x8000047d,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1210
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14557,7 +14557,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000226a,
+0x1,0x1,0x1,0x1,0x1,0x80000485,
 0x1,0x1,0x1},
 // Transitions for state 1213
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14566,7 +14566,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002224,
+0x1,0x1,0x1,0x1,0x1,0x80000486,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14603,7 +14603,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002115,0x1,0x1,0x1,0x1,
+0x1,0x80000489,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -14615,7 +14615,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d55f,0x1,0x1,0x1,0x1,
+0x1,0x8000048a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -14653,7 +14653,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002226,0x1,0x1,0x1,0x1,
+0x1,0x800004ca,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1221
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14675,7 +14675,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x895,0x1,
-0x80002aaf,0x1,0x1,0x1,0x1,0x1,
+0x800004d1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -14747,9 +14747,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x89c,0x1,
-0x80002ab0,0x1,0x1,0x1,0x1,0x1,
+0x800004de,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c3,0x1,0x1,0x1,0x1,
+0x1,0x800004e0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1229
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14761,7 +14761,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4a9,0x1,0x1,0x1,0x1,
+0x1,0x800004df,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1230
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -14784,7 +14784,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002241,0x1,0x1,0x1,
+0x1,0x1,0x800004e3,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1232
@@ -14830,9 +14830,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002284,0x8a3,0x1,
+0x1,0x1,0x1,0x800004ea,0x8a3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002285,
+0x1,0x1,0x1,0x1,0x1,0x800004f2,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1236
@@ -14844,7 +14844,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002279,0x1,0x1,0x1,0x1,
+0x1,0x800004f8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1237
@@ -14879,7 +14879,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002278,0x1,0x1,0x1,
+0x1,0x1,0x800004fb,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -14916,7 +14916,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224d,
+0x1,0x1,0x1,0x1,0x1,0x80000505,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1243
@@ -14975,9 +14975,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002265,0x1,0x1,0x1,0x1,0x1,
+0x8000050a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000003e,0x1,0x1,
+0x1,0x1,0x1,0x8000050b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1248
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15011,9 +15011,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002264,0x1,0x1,0x1,0x1,0x1,
+0x8000050f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000003c,0x1,0x1,
+0x1,0x1,0x1,0x80000510,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1251
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15109,7 +15109,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000229b,0x1,0x1,
+0x1,0x1,0x1,0x8000051c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1259
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15121,7 +15121,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000229a,0x1,0x1,0x1,0x1,
+0x1,0x8000051d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1260
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15181,7 +15181,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a38,
+0x1,0x1,0x1,0x1,0x1,0x80000525,
 0x1,0x1,0x1},
 // Transitions for state 1265
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15193,7 +15193,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002299,0x1,0x1,
+0x1,0x1,0x1,0x80000526,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1266
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15252,7 +15252,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800002db,0x1,0x1,
+0x1,0x1,0x1,0x8000052d,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1271
@@ -15301,7 +15301,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000222e,0x1,0x1,
+0x1,0x1,0x1,0x80000533,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1275
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15406,7 +15406,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8cf,0x800029b6,
+0x1,0x1,0x1,0x1,0x8cf,0x8000053f,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x8d0,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15419,7 +15419,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d546,0x1,0x1,0x1,0x1,
+0x1,0x80000541,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -15431,7 +15431,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d560,0x1,0x1,0x1,0x1,
+0x1,0x80000542,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -15445,7 +15445,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029b7,0x1,0x1,0x1,0x1,
+0x1,0x80000543,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1287
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15503,8 +15503,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8d5,0x800000aa,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000ba,0x1,0x1,0x1,
+0x8d5,0x8000054e,0x1,0x1,0x1,0x1,
+0x1,0x1,0x8000054f,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1292
@@ -15529,7 +15529,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a56,0x1,0x1,0x1,0x1,
+0x1,0x80000551,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1294
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15553,7 +15553,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4aa,0x1,0x1,0x1,0x1,
+0x1,0x80000555,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1296
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15565,7 +15565,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002134,0x1,0x1,0x1,0x1,
+0x1,0x80000556,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1297
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15600,7 +15600,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002298,0x1,0x1,0x1,0x1,
+0x1,0x80000559,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1300
@@ -15636,7 +15636,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000d6,0x1,0x1,0x1,0x1,
+0x1,0x8000055f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1303
@@ -15648,7 +15648,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000f6,0x1,0x1,0x1,0x1,
+0x1,0x80000560,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1304
@@ -15682,10 +15682,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000b6,0x1,0x1,0x1,
+0x1,0x1,0x80000567,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8e1,0x80002202,0x1,0x1,
+0x1,0x1,0x8e1,0x8000056b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1307
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15708,7 +15708,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x8e3,0x1,
 0x1,0x1,0x1,0x1,0x8e4,0x1,
-0x1,0x1,0x8e5,0x1,0x1,0x800022a5,
+0x1,0x1,0x8e5,0x1,0x1,0x80000572,
 0x1,0x1,0x1,0x8e6,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1309
@@ -15721,7 +15721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003d5,
+0x1,0x1,0x1,0x1,0x1,0x80000578,
 0x1,0x1,0x1},
 // Transitions for state 1310
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15781,7 +15781,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000002b,0x1,0x1,0x1,
+0x1,0x1,0x80000582,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1315
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15827,7 +15827,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002119,0x1,0x1,0x1,0x1,
+0x1,0x80000590,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -15839,7 +15839,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d561,0x1,0x1,0x1,0x1,
+0x1,0x80000591,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -15864,7 +15864,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ab7,
+0x1,0x1,0x1,0x1,0x1,0x80000595,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1322
@@ -15886,7 +15886,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000227a,0x1,
+0x1,0x1,0x1,0x1,0x80000599,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15929,7 +15929,7 @@
 0x1,0x1,0x1},
 // Transitions for state 1327
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ab5,0x1,
+0x1,0x1,0x1,0x1,0x800005a9,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -15946,9 +15946,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000220f,
+0x1,0x1,0x1,0x1,0x1,0x800005ab,
 0x1,0x8f8,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000221d,
+0x1,0x1,0x1,0x1,0x1,0x800005b0,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1329
@@ -15997,7 +15997,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4ab,0x1,0x1,0x1,0x1,
+0x1,0x800005b6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1333
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16009,7 +16009,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c5,0x1,0x1,0x1,0x1,
+0x1,0x800005b7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1334
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16033,7 +16033,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a0c,0x1,0x1,
+0x1,0x1,0x1,0x800005bd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1336
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16043,7 +16043,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000211a,0x1,0x1,0x1,0x1,
+0x1,0x800005be,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16055,7 +16055,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d562,0x1,0x1,0x1,0x1,
+0x1,0x800005bf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16081,7 +16081,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4ac,0x1,0x1,0x1,0x1,
+0x1,0x800005c1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1340
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16093,7 +16093,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c6,0x1,0x1,0x1,0x1,
+0x1,0x800005c2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1341
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16124,7 +16124,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000022,0x1,0x1,0x1,0x1,
+0x1,0x800005c7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16141,7 +16141,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000022,0x1,0x1,
+0x1,0x1,0x1,0x800005c8,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1345
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16163,7 +16163,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000223d,0x1,0x1,0x1,0x1,0x1,
+0x800005ca,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x903,0x1,
 0x1,0x1,0x1},
@@ -16211,7 +16211,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800027eb,0x1,0x1,0x1,
+0x1,0x1,0x800005cf,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16223,7 +16223,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800027e9,0x1,0x1,0x1,
+0x1,0x1,0x800005d0,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16249,7 +16249,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021a0,0x1,0x1,0x1,0x1,
+0x1,0x800005d5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1354
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16261,7 +16261,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d2,0x1,0x1,0x1,0x1,
+0x1,0x800005d6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1355
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16273,7 +16273,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002192,0x1,0x1,0x1,0x1,
+0x1,0x800005d7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1356
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16414,7 +16414,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000007d,0x1,0x1,
+0x1,0x1,0x1,0x800005f6,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16426,7 +16426,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002937,0x1,0x1,0x1,
+0x1,0x1,0x800005f9,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16463,7 +16463,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021b3,0x1,0x1,
+0x1,0x1,0x1,0x800005fd,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16476,7 +16476,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000211c,0x1,0x1,0x1,0x1,
+0x1,0x800005ff,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1373
@@ -16489,7 +16489,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025ad,0x1,0x1,
+0x1,0x1,0x1,0x80000603,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1374
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16537,7 +16537,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002964,0x1,0x1,0x1,0x1,
+0x1,0x8000060d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1378
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16561,7 +16561,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003f1,
+0x1,0x1,0x1,0x1,0x1,0x80000613,
 0x1,0x1,0x1},
 // Transitions for state 1380
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16595,7 +16595,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800002da,0x1,0x1,0x1,
+0x1,0x1,0x80000634,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16691,7 +16691,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x929,0x1,0x1,0x1,
-0x1,0x8001d563,0x1,0x1,0x1,0x1,
+0x1,0x80000641,0x1,0x1,0x1,0x1,
 0x1,0x92a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16703,7 +16703,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000211d,0x1,0x1,0x1,0x1,
+0x1,0x80000640,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16741,7 +16741,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000029,0x1,0x1,0x1,0x1,
+0x1,0x80000645,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1395
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16801,7 +16801,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000211b,0x1,0x1,0x1,0x1,
+0x1,0x8000064b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1400
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16813,7 +16813,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c7,0x1,0x1,0x1,0x1,
+0x1,0x8000064c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1401
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -16822,7 +16822,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000005d,0x1,0x1,
+0x1,0x1,0x1,0x8000064f,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x932,0x1,
@@ -16859,7 +16859,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025b9,0x1,
+0x1,0x1,0x1,0x1,0x80000654,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -16932,7 +16932,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ab8,
+0x1,0x1,0x1,0x1,0x1,0x80000660,
 0x1,0x93c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1411
@@ -17009,7 +17009,7 @@
 0x1,0x1,0x1},
 // Transitions for state 1417
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ab6,0x1,
+0x1,0x1,0x1,0x1,0x8000066b,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17053,7 +17053,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022c5,0x1,0x1,
+0x1,0x1,0x1,0x80000671,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1421
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17089,7 +17089,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000a7,0x1,0x1,
+0x1,0x1,0x1,0x80000678,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1424
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17099,7 +17099,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000003b,0x1,
+0x1,0x1,0x1,0x1,0x80000679,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17137,7 +17137,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002736,0x1,0x1,
+0x1,0x1,0x1,0x8000067d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1428
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17186,7 +17186,7 @@
 0x1,0x1,0x1,0x94e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000448},
+0x1,0x1,0x80000685},
 // Transitions for state 1432
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17198,7 +17198,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000428},
+0x1,0x1,0x80000684},
 // Transitions for state 1433
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17255,8 +17255,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x953,
-0x80002243,0x1,0x80002a9e,0x1,0x1,0x1,
-0x1,0x80002a9d,0x1,0x957,0x1,0x958,
+0x80000693,0x1,0x80000695,0x1,0x1,0x1,
+0x1,0x80000697,0x1,0x957,0x1,0x958,
 0x1,0x959,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1438
@@ -17314,7 +17314,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002223,
+0x1,0x1,0x1,0x1,0x1,0x800006a1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x95f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17327,7 +17327,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002aac,0x1,0x1,0x1,0x1,0x1,
+0x800006a4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17362,7 +17362,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800029c4,0x1,0x1,
+0x1,0x1,0x1,0x800006a9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17375,7 +17375,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d54a,0x1,0x1,0x1,0x1,
+0x1,0x800006ab,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17387,7 +17387,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d564,0x1,0x1,0x1,0x1,
+0x1,0x800006ac,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17401,7 +17401,7 @@
 0x1,0x1,0x1,0x1,0x1,0x964,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002225,0x1,0x1,0x1,0x1,
+0x1,0x800006af,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1450
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17425,7 +17425,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000221a,0x1,0x1,
+0x1,0x1,0x1,0x800006b4,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1452
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17459,7 +17459,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x969,0x1,0x1,0x1,
-0x1,0x800025aa,0x1,0x1,0x1,0x1,
+0x1,0x800006c7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17485,7 +17485,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4ae,0x1,0x1,0x1,0x1,
+0x1,0x800006c9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1457
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17497,7 +17497,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c8,0x1,0x1,0x1,0x1,
+0x1,0x800006ca,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1458
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17545,7 +17545,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022c6,0x1,0x1,0x1,0x1,
+0x1,0x800006ce,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1462
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17557,7 +17557,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002606,0x1,0x1,0x1,0x1,
+0x1,0x800006cf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1463
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17573,13 +17573,13 @@
 0x1,0x1,0x1},
 // Transitions for state 1464
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ac5,0x1,
+0x1,0x1,0x1,0x1,0x800006d7,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x971,
-0x80002286,0x1,0x1,0x1,0x1,0x1,
+0x800006d8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x973,0x974,0x1,0x975,
 0x1,0x976,0x978,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17602,7 +17602,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000227b,0x1,
+0x1,0x1,0x1,0x1,0x800006e9,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17627,19 +17627,19 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000266a,0x1,0x1,0x1,
+0x1,0x1,0x800006f8,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1469
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ac6,0x1,
+0x1,0x1,0x1,0x1,0x80000700,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x97c,
-0x80002287,0x1,0x1,0x97f,0x1,0x1,
+0x80000701,0x1,0x1,0x97f,0x1,0x1,
 0x1,0x980,0x981,0x982,0x1,0x983,
 0x1,0x1,0x985,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17724,7 +17724,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023b4,0x1,0x1,0x1,0x1,0x1,
+0x8000071f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1477
@@ -17785,7 +17785,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800020db,0x1,0x1,
+0x1,0x1,0x1,0x80000726,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1482
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17929,7 +17929,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000222d,0x1,0x1,
+0x1,0x1,0x1,0x80000743,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1494
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17938,7 +17938,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002928,0x1,0x1,0x1,
+0x1,0x1,0x80000744,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -17951,7 +17951,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x99f,0x9a0,0x1,
-0x1,0x8001d565,0x1,0x1,0x1,0x1,
+0x1,0x80000749,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17963,7 +17963,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d54b,0x1,0x1,0x1,0x1,
+0x1,0x80000748,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -17974,7 +17974,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002929,0x1,0x1,0x1,
+0x1,0x1,0x8000074b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18023,7 +18023,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x9a5,0x1,0x1,0x9a6,
-0x8000225c,0x1,0x1,0x1,0x1,0x1,
+0x80000757,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x9a7,0x1,0x1,0x9a9,
 0x1,0x1,0x9aa,0x9ab,0x1,0x1,
 0x1,0x1,0x1},
@@ -18061,7 +18061,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4af,0x1,0x1,0x1,0x1,
+0x1,0x8000075e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1505
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18073,8 +18073,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4c9,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000446},
+0x1,0x8000075f,0x1,0x1,0x1,0x1,
+0x1,0x1,0x80000761},
 // Transitions for state 1506
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18086,7 +18086,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000426},
+0x1,0x1,0x80000760},
 // Transitions for state 1507
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18193,7 +18193,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000219f,0x1,0x1,0x1,0x1,
+0x1,0x8000076b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1516
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18205,7 +18205,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d1,0x1,0x1,0x1,0x1,
+0x1,0x8000076c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1517
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18217,7 +18217,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002191,0x1,0x1,0x1,0x1,
+0x1,0x8000076d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1518
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18361,7 +18361,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002963,0x1,0x1,0x1,0x1,
+0x1,0x80000780,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1530
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18491,7 +18491,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d54c,0x1,0x1,0x1,0x1,
+0x1,0x80000793,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -18503,7 +18503,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d566,0x1,0x1,0x1,0x1,
+0x1,0x80000794,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -18635,7 +18635,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003d2,0x1,
+0x1,0x1,0x1,0x1,0x800007a3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -18647,7 +18647,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003c5,0x1,
+0x1,0x1,0x1,0x1,0x800007a4,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -18733,7 +18733,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b0,0x1,0x1,0x1,0x1,
+0x1,0x800007b1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1561
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18745,7 +18745,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4ca,0x1,0x1,0x1,0x1,
+0x1,0x800007b2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1562
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18791,7 +18791,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025b5,0x1,
+0x1,0x1,0x1,0x1,0x800007b6,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -18816,7 +18816,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000dc,0x1,0x1,0x1,0x1,
+0x1,0x800007b9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1568
@@ -18828,7 +18828,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000fc,0x1,0x1,0x1,0x1,
+0x1,0x800007ba,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1569
@@ -18865,7 +18865,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x9e8,0x1,0x1,0x1,0x1,0x1,
 0x9e9,0x1,0x1,0x9ea,0x1,0x9eb,
-0x1,0x80002195,0x9ed,0x9ee,0x1,0x1,
+0x1,0x800007c4,0x9ed,0x9ee,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1572
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18877,7 +18877,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d5,0x1,0x1,0x1,0x1,
+0x1,0x800007c3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1573
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18889,7 +18889,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002aeb,0x1,0x1,0x1,0x1,
+0x1,0x800007ce,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1574
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18901,7 +18901,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ae8,0x1,0x1,0x1,0x1,
+0x1,0x800007cf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1575
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18985,7 +18985,7 @@
 0x1,0x1,0x1,0x9f7,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002016,0x1,0x1,
+0x1,0x1,0x1,0x800007df,0x1,0x1,
 0x1,0x1,0x9fa},
 // Transitions for state 1582
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -18997,7 +18997,7 @@
 0x1,0x1,0x1,0x9f8,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000007c,0x1,0x1,
+0x1,0x1,0x1,0x800007e0,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1583
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19031,7 +19031,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d54d,0x1,0x1,0x1,0x1,
+0x1,0x800007eb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19043,7 +19043,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d567,0x1,0x1,0x1,0x1,
+0x1,0x800007ec,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19081,7 +19081,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b1,0x1,0x1,0x1,0x1,
+0x1,0x800007ef,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1590
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19093,7 +19093,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4cb,0x1,0x1,0x1,0x1,
+0x1,0x800007f0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1591
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19199,7 +19199,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d54e,0x1,0x1,0x1,0x1,
+0x1,0x80000800,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19211,7 +19211,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d568,0x1,0x1,0x1,0x1,
+0x1,0x80000801,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19237,7 +19237,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b2,0x1,0x1,0x1,0x1,
+0x1,0x80000805,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1603
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19249,7 +19249,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4cc,0x1,0x1,0x1,0x1,
+0x1,0x80000806,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1604
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19260,7 +19260,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022c2,
+0x1,0x1,0x1,0x1,0x1,0x80000807,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1605
@@ -19284,7 +19284,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022c3,
+0x1,0x1,0x1,0x1,0x1,0x80000809,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1607
@@ -19356,7 +19356,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800027fc,
+0x1,0x1,0x1,0x1,0x1,0x80000813,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1613
@@ -19369,7 +19369,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022fb,0x1,0x1,0x1,
+0x1,0x1,0x80000814,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1614
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19391,7 +19391,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d54f,0x1,0x1,0x1,0x1,
+0x1,0x80000816,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19403,7 +19403,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d569,0x1,0x1,0x1,0x1,
+0x1,0x80000817,0x1,0x1,0x1,0x1,
 0x1,0xa11,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19453,7 +19453,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b3,0x1,0x1,0x1,0x1,
+0x1,0x8000081c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1621
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19465,7 +19465,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4cd,0x1,0x1,0x1,0x1,
+0x1,0x8000081d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1622
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19511,7 +19511,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c1,0x1,0x1,0x1,0x1,0x1,
+0x80000821,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19550,7 +19550,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0xa1a,0x1,
-0x1,0x1,0x8000044f},
+0x1,0x1,0x80000826},
 // Transitions for state 1629
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19562,7 +19562,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000042f},
+0x1,0x1,0x80000825},
 // Transitions for state 1630
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19598,7 +19598,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000407},
+0x1,0x1,0x8000082e},
 // Transitions for state 1633
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19610,7 +19610,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000457},
+0x1,0x1,0x8000082f},
 // Transitions for state 1634
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19619,7 +19619,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d550,0x1,0x1,0x1,0x1,
+0x1,0x80000830,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19631,7 +19631,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d56a,0x1,0x1,0x1,0x1,
+0x1,0x80000831,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19645,7 +19645,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b4,0x1,0x1,0x1,0x1,
+0x1,0x80000832,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1637
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19657,7 +19657,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4ce,0x1,0x1,0x1,0x1,
+0x1,0x80000833,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1638
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19670,7 +19670,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000042e},
+0x1,0x1,0x80000834},
 // Transitions for state 1639
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19682,7 +19682,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000044e},
+0x1,0x1,0x80000835},
 // Transitions for state 1640
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19692,7 +19692,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000178,0x1,0x1,0x1,0x1,
+0x1,0x80000836,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1641
@@ -19704,7 +19704,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000ff,0x1,0x1,0x1,0x1,
+0x1,0x80000837,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1642
@@ -19765,7 +19765,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000017b,0x1,0x1,
+0x1,0x1,0x1,0x8000083e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1647
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19777,7 +19777,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000017c,0x1,0x1,
+0x1,0x1,0x1,0x8000083f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1648
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19810,7 +19810,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000396,0x1,0x1,0x1,
+0x1,0x1,0x80000842,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19822,7 +19822,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b6,0x1,0x1,0x1,
+0x1,0x1,0x80000843,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19838,7 +19838,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000416},
+0x1,0x1,0x80000846},
 // Transitions for state 1653
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19850,7 +19850,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000436},
+0x1,0x1,0x80000847},
 // Transitions for state 1654
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19871,7 +19871,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002124,0x1,0x1,0x1,0x1,
+0x1,0x80000849,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19883,7 +19883,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d56b,0x1,0x1,0x1,0x1,
+0x1,0x8000084a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19897,7 +19897,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4b5,0x1,0x1,0x1,0x1,
+0x1,0x8000084b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1658
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19909,7 +19909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8001d4cf,0x1,0x1,0x1,0x1,
+0x1,0x8000084c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1659
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19919,7 +19919,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000200c,
+0x1,0x1,0x1,0x1,0x1,0x8000084e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -19978,7 +19978,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000c2,0x1,
+0x1,0x1,0x1,0x1,0x80000009,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -19990,7 +19990,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000e2,0x1,
+0x1,0x1,0x1,0x1,0x8000000a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20003,7 +20003,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000b4,0x1,0x1,0x1,0x1,0x1,
+0x8000000b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20015,7 +20015,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000c6,0x1,0x1,0x1,
+0x1,0x1,0x8000000e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20027,7 +20027,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000e6,0x1,0x1,0x1,
+0x1,0x1,0x8000000f,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20075,7 +20075,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002135,0x1,0x1,
+0x1,0x1,0x1,0x80000016,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20086,7 +20086,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000391,0x1,0x1,0x1,
+0x1,0x1,0x80000017,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20098,7 +20098,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b1,0x1,0x1,0x1,
+0x1,0x1,0x80000018,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20113,7 +20113,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000100,0x1,0x1,0x1,0x1,
+0x1,0x80000019,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1676
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20125,7 +20125,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000101,0x1,0x1,0x1,0x1,
+0x1,0x8000001a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1677
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20135,7 +20135,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a3f,0x1,0x1,0x1,
+0x1,0x1,0x8000001b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20171,7 +20171,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002220,0x1,0x1,0x1,0x1,0x1,
+0x80000026,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20197,7 +20197,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000221f,0x1,0x1,
+0x1,0x1,0x1,0x80000030,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1683
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20209,7 +20209,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0xa2f,
-0x1,0x1,0x1,0x800000c5,0x1,0x1,
+0x1,0x1,0x1,0x80000034,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1684
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20232,7 +20232,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000104,0x1,0x1,
+0x1,0x1,0x1,0x80000036,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1686
@@ -20244,7 +20244,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000105,0x1,0x1,
+0x1,0x1,0x1,0x80000037,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1687
@@ -20291,7 +20291,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000c5,0x1,0x1,0x1,
+0x1,0x1,0x80000043,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20303,7 +20303,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000e5,0x1,0x1,0x1,
+0x1,0x1,0x80000044,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20328,7 +20328,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002248,
+0x1,0x1,0x1,0x1,0x1,0x80000049,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1694
@@ -20377,7 +20377,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a11,0x1,0x1,
+0x1,0x1,0x1,0x80000050,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1698
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20459,7 +20459,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000224c,0x1,0x1,0x1,
+0x1,0x1,0x8000005e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20472,7 +20472,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000201e,0x1,
+0x1,0x1,0x1,0x1,0x80000061,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1706
@@ -20519,7 +20519,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003f6,0x1,
+0x1,0x1,0x1,0x1,0x80000066,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20676,7 +20676,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002423,0x1,0x1,0x1,0x1,0x1,
+0x80000083,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1723
@@ -20712,7 +20712,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002588,0x1,0x1,0x1,0x1,0x1,
+0x80000087,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1726
@@ -20766,50 +20766,50 @@
 // Transitions for state 1730
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002557,
-0x1,0x1,0x1,0x1,0x1,0x80002554,
+0x1,0x1,0x1,0x1,0x1,0x80000092,
+0x1,0x1,0x1,0x1,0x1,0x80000096,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002556,0x1,0x1,0x1,0x1,
-0x1,0x80002553,0x1,0x1,0x1,0x1,
+0x1,0x80000093,0x1,0x1,0x1,0x1,
+0x1,0x80000097,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1731
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002555,
-0x1,0x1,0x1,0x1,0x1,0x80002552,
+0x1,0x1,0x1,0x1,0x1,0x80000094,
+0x1,0x1,0x1,0x1,0x1,0x80000098,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002510,0x1,0x1,0x1,0x1,
-0x1,0x8000250c,0x1,0x1,0x1,0x1,
+0x1,0x80000095,0x1,0x1,0x1,0x1,
+0x1,0x80000099,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1732
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002566,0x1,0x1,
+0x1,0x1,0x1,0x8000009c,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002569,0x1,0x1,0x1,
+0x1,0x1,0x800000a0,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002564,
+0x1,0x1,0x1,0x1,0x1,0x8000009d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002567,0x1,
+0x1,0x1,0x1,0x1,0x800000a1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1733
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002565,0x1,0x1,
+0x1,0x1,0x1,0x8000009e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002568,0x1,0x1,0x1,
+0x1,0x1,0x800000a2,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000252c,
+0x1,0x1,0x1,0x1,0x1,0x8000009f,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002534,0x1,
+0x1,0x1,0x1,0x1,0x800000a3,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1734
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20850,50 +20850,50 @@
 // Transitions for state 1737
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000255d,
-0x1,0x1,0x1,0x1,0x1,0x8000255a,
+0x1,0x1,0x1,0x1,0x1,0x800000a7,
+0x1,0x1,0x1,0x1,0x1,0x800000ab,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000255c,0x1,0x1,0x1,0x1,
-0x1,0x80002559,0x1,0x1,0x1,0x1,
+0x1,0x800000a8,0x1,0x1,0x1,0x1,
+0x1,0x800000ac,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1738
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000255b,
-0x1,0x1,0x1,0x1,0x1,0x80002558,
+0x1,0x1,0x1,0x1,0x1,0x800000a9,
+0x1,0x1,0x1,0x1,0x1,0x800000ad,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002518,0x1,0x1,0x1,0x1,
-0x1,0x80002514,0x1,0x1,0x1,0x1,
+0x1,0x800000aa,0x1,0x1,0x1,0x1,
+0x1,0x800000ae,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1739
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000256c,0x1,0x1,0x1,0x80002563,
-0x1,0x1,0x1,0x1,0x1,0x80002560,
+0x1,0x800000b1,0x1,0x1,0x1,0x800000b5,
+0x1,0x1,0x1,0x1,0x1,0x800000b9,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000256b,0x1,0x1,
-0x1,0x80002562,0x1,0x1,0x1,0x1,
-0x1,0x8000255f,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x800000b2,0x1,0x1,
+0x1,0x800000b6,0x1,0x1,0x1,0x1,
+0x1,0x800000ba,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1740
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000256a,0x1,0x1,0x1,0x80002561,
-0x1,0x1,0x1,0x1,0x1,0x8000255e,
+0x1,0x800000b3,0x1,0x1,0x1,0x800000b7,
+0x1,0x1,0x1,0x1,0x1,0x800000bb,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000253c,0x1,0x1,
-0x1,0x80002524,0x1,0x1,0x1,0x1,
-0x1,0x8000251c,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x800000b4,0x1,0x1,
+0x1,0x800000b8,0x1,0x1,0x1,0x1,
+0x1,0x800000bc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1741
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20915,7 +20915,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800002d8,0x1,0x1,0x1,0x1,0x1,
+0x800000be,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20927,7 +20927,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800002d8,0x1,0x1,0x1,0x1,0x1,
+0x800000bf,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20951,7 +20951,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000204f,0x1,
+0x1,0x1,0x1,0x1,0x800000c3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20963,7 +20963,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022cd,0x1,0x1,0x1,0x1,0x1,
+0x800000c5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -20974,7 +20974,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800029c5,0x1,0x1,
+0x1,0x1,0x1,0x800000c7,0x1,0x1,
 0x1,0x1,0x1,0xa5f,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -20993,13 +20993,13 @@
 0x1,0x1,0x1},
 // Transitions for state 1749
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002aae,0x1,
+0x1,0x1,0x1,0x1,0x800000cc,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000224f,0x1,0x1,0x1,0x1,0x1,
+0x800000cd,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -21109,7 +21109,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002041,0x1,0x1,
+0x1,0x1,0x1,0x800000db,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1759
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21120,7 +21120,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800002c7,0x1,0x1,
+0x1,0x1,0x1,0x800000dc,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1760
@@ -21145,7 +21145,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a4d,0x1,0x1,0x1,
+0x1,0x1,0x800000de,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1762
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21202,7 +21202,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000108,0x1,
+0x1,0x1,0x1,0x1,0x800000e3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21214,7 +21214,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000109,0x1,
+0x1,0x1,0x1,0x1,0x800000e4,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21241,7 +21241,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a4c,0x1,0x1,0x1,
+0x1,0x1,0x800000e6,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1770
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21252,7 +21252,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000b8,0x1,0x1,0x1,0x1,
+0x1,0x800000ea,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1771
@@ -21312,7 +21312,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002713,0x1,0x1,0x1,0x1,0x1,
+0x800000f4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1776
@@ -21409,7 +21409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002663,0x1,0x1,0x1,
+0x1,0x1,0x8000010e,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1784
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21420,7 +21420,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002237,0x1,0x1,
+0x1,0x1,0x1,0x80000110,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1785
@@ -21432,7 +21432,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000003a,0x1,0x1,
+0x1,0x1,0x1,0x80000111,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1786
@@ -21442,7 +21442,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000002c,0x1,0x1,0x1,
+0x1,0x1,0x80000115,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21577,7 +21577,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021b5,0x1,0x1,0x1,0x1,
+0x1,0x80000129,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1798
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21589,7 +21589,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a2f,0x1,0x1,0x1,
+0x1,0x1,0x8000012a,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1799
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21601,7 +21601,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002717,0x1,0x1,0x1,
+0x1,0x1,0x8000012b,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1800
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21611,7 +21611,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ad1,0x1,0x1,0x1,0x1,0x1,
+0x8000012f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -21623,7 +21623,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ad2,0x1,0x1,0x1,0x1,0x1,
+0x80000131,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -21637,7 +21637,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022ef,0x1,0x1,
+0x1,0x1,0x1,0x80000132,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1803
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21661,7 +21661,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022de,0x1,0x1,0x1,0x1,
+0x1,0x80000135,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1805
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21670,7 +21670,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022df,0x1,
+0x1,0x1,0x1,0x1,0x80000136,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21745,7 +21745,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a45,0x1,0x1,0x1,0x1,
+0x1,0x80000140,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1812
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21803,7 +21803,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ce,0x1,0x1,0x1,0x1,0x1,
+0x8000014b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -21814,7 +21814,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022cf,
+0x1,0x1,0x1,0x1,0x1,0x8000014c,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21841,7 +21841,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002231,0x1,0x1,
+0x1,0x1,0x1,0x8000014e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1820
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21901,7 +21901,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ae4,
+0x1,0x1,0x1,0x1,0x1,0x80000157,
 0x1,0x1,0x1},
 // Transitions for state 1825
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21913,7 +21913,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022a3,
+0x1,0x1,0x1,0x1,0x1,0x80000158,
 0x1,0x1,0x1},
 // Transitions for state 1826
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21934,7 +21934,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800002dd,0x1,
+0x1,0x1,0x1,0x1,0x8000015a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -21985,7 +21985,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021ca,0x1,0x1,0x1,0x1,
+0x1,0x80000162,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1832
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22018,7 +22018,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000394,0x1,0x1,0x1,
+0x1,0x1,0x80000167,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22030,7 +22030,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b4,0x1,0x1,0x1,
+0x1,0x1,0x80000168,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22068,8 +22068,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c3,0x1,0x1,0x1,0x1,
-0x1,0x800021c2,0x1,0x1,0x1,0x1,
+0x1,0x8000016e,0x1,0x1,0x1,0x1,
+0x1,0x8000016f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1839
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22105,7 +22105,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0xaa8,0x1,
-0x1,0x1,0x80002666,0x1,0x1,0x1,
+0x1,0x1,0x80000179,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1842
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22140,7 +22140,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022f2,0x1,0x1,
+0x1,0x1,0x1,0x8000017d,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1845
@@ -22225,7 +22225,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002250,0x1,0x1,0x1,0x1,0x1,
+0x8000018c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1852
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22393,7 +22393,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022f1,0x1,0x1,
+0x1,0x1,0x1,0x800001bd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1866
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22403,7 +22403,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800025be,0x1,0x1,0x1,0x1,
+0x1,0x800001bf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -22417,7 +22417,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021f5,0x1,0x1,0x1,0x1,
+0x1,0x800001c0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1868
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22429,7 +22429,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000296f,0x1,0x1,0x1,0x1,
+0x1,0x800001c1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1869
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22522,7 +22522,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000ca,0x1,
+0x1,0x1,0x1,0x1,0x800001cc,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22534,7 +22534,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000ea,0x1,
+0x1,0x1,0x1,0x1,0x800001cd,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22561,7 +22561,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a77,0x1,0x1,
+0x1,0x1,0x1,0x800001d1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1880
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22573,7 +22573,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002252,0x1,0x1,
+0x1,0x1,0x1,0x800001d6,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1881
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22657,7 +22657,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000112,0x1,0x1,0x1,0x1,
+0x1,0x800001e4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1888
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22669,7 +22669,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000113,0x1,0x1,0x1,0x1,
+0x1,0x800001e5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1889
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22682,7 +22682,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002205},
+0x1,0x1,0x800001e6},
 // Transitions for state 1890
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22716,7 +22716,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000118,0x1,0x1,
+0x1,0x1,0x1,0x800001f1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1893
@@ -22728,7 +22728,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000119,0x1,0x1,
+0x1,0x1,0x1,0x800001f2,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1894
@@ -22753,7 +22753,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a71,0x1,0x1,0x1,
+0x1,0x1,0x800001f7,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1896
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22777,7 +22777,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0xad9,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003f5,
+0x1,0x1,0x1,0x1,0x1,0x800001fb,
 0x1,0x1,0x1},
 // Transitions for state 1898
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22812,7 +22812,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002242,0x1,0x1,0x1,
+0x1,0x1,0x800001fe,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1901
@@ -22836,7 +22836,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a75,0x1,0x1,0x1,0x1,
+0x1,0x80000201,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1903
@@ -22885,7 +22885,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002261,
+0x1,0x1,0x1,0x1,0x1,0x80000206,
 0x1,0x1,0x1},
 // Transitions for state 1907
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22909,7 +22909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002971,0x1,0x1,0x1,0x1,
+0x1,0x80000209,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1909
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22921,7 +22921,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002253,0x1,0x1,
+0x1,0x1,0x1,0x8000020a,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1910
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22933,7 +22933,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002250,0x1,0x1,
+0x1,0x1,0x1,0x8000020d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1911
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -22945,7 +22945,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002203,0x1,0x1,
+0x1,0x1,0x1,0x80000218,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1912
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23039,7 +23039,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000fb00,0x1,0x1,0x1,
+0x1,0x1,0x80000222,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -23063,7 +23063,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000fb01,0x1,0x1,0x1,
+0x1,0x1,0x80000226,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -23087,7 +23087,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000066,0x1,0x1,0x1,
+0x1,0x1,0x80000229,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -23099,7 +23099,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000fb02,0x1,0x1,0x1,
+0x1,0x1,0x8000022b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -23113,7 +23113,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800025b1,0x1,0x1,0x1,
+0x1,0x1,0x8000022c,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1926
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23149,7 +23149,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ad9,
+0x1,0x1,0x1,0x1,0x1,0x80000233,
 0x1,0x1,0x1},
 // Transitions for state 1929
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23196,7 +23196,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002044,0x1,0x1,0x1,0x1,
+0x1,0x80000245,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1933
@@ -23208,7 +23208,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002322,0x1,0x1,
+0x1,0x1,0x1,0x80000246,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1934
@@ -23230,7 +23230,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000393,0x1,0x1,0x1,
+0x1,0x1,0x8000024a,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23242,7 +23242,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b3,0x1,0x1,0x1,
+0x1,0x1,0x8000024b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23290,7 +23290,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000011c,0x1,
+0x1,0x1,0x1,0x1,0x80000252,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23302,7 +23302,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000011d,0x1,
+0x1,0x1,0x1,0x1,0x80000253,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23326,7 +23326,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002aa9,0x1,
+0x1,0x1,0x1,0x1,0x80000260,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23364,7 +23364,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002137,0x1,0x1,0x1,0x1,
+0x1,0x8000026b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1947
@@ -23389,7 +23389,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002269,0x1,0x1,0x1,0x1,0x1,
+0x80000277,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1949
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23400,7 +23400,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022e7,0x1,0x1,0x1,
+0x1,0x1,0x80000278,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1950
@@ -23411,7 +23411,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000060,0x1,0x1,0x1,0x1,0x1,
+0x8000027b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -23435,8 +23435,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a8e,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a90,0x1,0x1,0x1,0x1,
+0x80000286,0x1,0x1,0x1,0x1,0x1,
+0x1,0x80000287,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1953
@@ -23449,7 +23449,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a7a,0x1,0x1,0x1,0x1,
+0x1,0x8000028c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1954
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23461,7 +23461,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d7,0x1,0x1,
+0x1,0x1,0x1,0x8000028d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1955
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23568,7 +23568,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800002c7,0x1,0x1,0x1,0x1,0x1,
+0x80000299,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1964
@@ -23630,7 +23630,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021ad,0x1,0x1},
+0x800002a2,0x1,0x1},
 // Transitions for state 1969
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23638,7 +23638,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000124,0x1,
+0x1,0x1,0x1,0x1,0x800002a5,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23650,7 +23650,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000125,0x1,
+0x1,0x1,0x1,0x1,0x800002a6,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23737,7 +23737,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021ff,0x1,0x1,0x1,0x1,
+0x1,0x800002b0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1978
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23890,7 +23890,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000ce,0x1,
+0x1,0x1,0x1,0x1,0x800002c4,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23902,7 +23902,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000ee,0x1,
+0x1,0x1,0x1,0x1,0x800002c5,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23916,7 +23916,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000a1,0x1,0x1,0x1,0x1,
+0x1,0x800002cb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1993
@@ -23965,7 +23965,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000222d,0x1,0x1,
+0x1,0x1,0x1,0x800002d3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 1997
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23986,7 +23986,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002129,0x1,0x1,0x1,
+0x1,0x1,0x800002d5,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -23999,7 +23999,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000132,0x1,0x1,0x1,
+0x1,0x1,0x800002d6,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -24011,7 +24011,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000133,0x1,0x1,0x1,
+0x1,0x1,0x800002d7,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -24025,7 +24025,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000012a,0x1,0x1,0x1,0x1,
+0x1,0x800002d9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2002
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24037,7 +24037,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000012b,0x1,0x1,0x1,0x1,
+0x1,0x800002da,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2003
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24047,7 +24047,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002111,0x1,0x1,0x1,0x1,0x1,
+0x800002db,0x1,0x1,0x1,0x1,0x1,
 0x1,0xb28,0x1,0x1,0x1,0xb29,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -24071,7 +24071,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000131,0x1,0x1,
+0x1,0x1,0x1,0x800002df,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -24082,7 +24082,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800001b5,
+0x1,0x1,0x1,0x1,0x1,0x800002e1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24120,7 +24120,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000221e,0x1,0x1,
+0x1,0x1,0x1,0x800002e5,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2010
@@ -24216,7 +24216,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000012e,0x1,0x1,
+0x1,0x1,0x1,0x800002f5,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2018
@@ -24228,7 +24228,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000012f,0x1,0x1,
+0x1,0x1,0x1,0x800002f6,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2019
@@ -24238,7 +24238,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a3c,
+0x1,0x1,0x1,0x1,0x1,0x800002fb,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24257,7 +24257,7 @@
 0x1,0x1,0x1},
 // Transitions for state 2021
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022f9,0x1,
+0x1,0x1,0x1,0x1,0x80000301,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24265,7 +24265,7 @@
 0x1,0x1,0x1,0x1,0x1,0xb37,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022f4,0x1,0x1,0x80002208,
+0x1,0x1,0x80000302,0x1,0x1,0x80000304,
 0x1,0x1,0x1},
 // Transitions for state 2022
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24302,7 +24302,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000406},
+0x1,0x1,0x80000308},
 // Transitions for state 2025
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24314,7 +24314,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000456},
+0x1,0x1,0x80000309},
 // Transitions for state 2026
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24322,7 +24322,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000134,0x1,
+0x1,0x1,0x1,0x1,0x8000030c,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24334,7 +24334,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000135,0x1,
+0x1,0x1,0x1,0x1,0x8000030d,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24347,7 +24347,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000237,0x1,0x1,
+0x1,0x1,0x1,0x80000312,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -24386,7 +24386,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000404},
+0x1,0x1,0x80000319},
 // Transitions for state 2032
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24398,7 +24398,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000454},
+0x1,0x1,0x8000031a},
 // Transitions for state 2033
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24406,7 +24406,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000039a,0x1,0x1,0x1,
+0x1,0x1,0x8000031b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24418,7 +24418,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003ba,0x1,0x1,0x1,
+0x1,0x1,0x8000031c,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24469,7 +24469,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021da,0x1,0x1,0x1,0x1,
+0x1,0x8000032d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2039
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24550,7 +24550,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002991,
+0x1,0x1,0x1,0x1,0x1,0x80000336,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0xb47,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24576,7 +24576,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000ab,0x1,
+0x1,0x1,0x1,0x1,0x8000033a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2048
@@ -24586,7 +24586,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021e4,0x1,0x1,
+0x1,0x1,0x1,0x8000033e,0x1,0x1,
 0x1,0xb4a,0x1,0xb4b,0x1,0x1,
 0x1,0xb4c,0x1,0x1,0x1,0xb4d,
 0x1,0x1,0xb4e,0xb4f,0x1,0x1,
@@ -24625,7 +24625,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002aad,0x1,0x1,0x1,
+0x1,0x1,0x8000034a,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2052
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24637,7 +24637,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000290e,0x1,0x1,0x1,0x1,
+0x1,0x8000034b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2053
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24649,7 +24649,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000290c,0x1,0x1,0x1,0x1,
+0x1,0x8000034c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2054
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24660,7 +24660,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002772,0x1,0x1,0x1,0x1,0x1,
+0x8000034d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2055
@@ -24683,7 +24683,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000298b,0x1,0x1,0x1,0x1,0x1,
+0x80000350,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xb53,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -24744,7 +24744,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002308,0x1,0x1,0x1,0x1,
+0x1,0x80000357,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2062
@@ -24756,7 +24756,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000201c,0x1,
+0x1,0x1,0x1,0x1,0x8000035c,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2063
@@ -24826,7 +24826,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002aa8,0x1,
+0x1,0x1,0x1,0x1,0x8000038d,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24910,10 +24910,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021bd,
+0x1,0x1,0x1,0x1,0x1,0x800003a6,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800021bc,0x1,
+0x1,0x1,0x1,0x1,0x800003a7,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2076
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24924,7 +24924,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002584,0x1,0x1,0x1,0x1,0x1,
+0x800003a9,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2077
@@ -24937,7 +24937,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c7,0x1,0x1,0x1,0x1,
+0x1,0x800003ae,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2078
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -24983,7 +24983,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025fa,0x1,
+0x1,0x1,0x1,0x1,0x800003b2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25045,7 +25045,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002268,0x1,0x1,0x1,0x1,0x1,
+0x800003bc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2087
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25056,7 +25056,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022e6,0x1,0x1,0x1,
+0x1,0x1,0x800003bd,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2088
@@ -25067,7 +25067,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800027ec,0x1,0x1,0x1,
+0x1,0x1,0x800003be,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25081,7 +25081,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021fd,0x1,0x1,0x1,0x1,
+0x1,0x800003bf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2090
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25092,7 +25092,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027e6,0x1,0x1,0x1,0x1,0x1,
+0x800003c0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2091
@@ -25141,7 +25141,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002985,0x1,0x1,0x1,0x1,
+0x1,0x800003cd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2095
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25237,7 +25237,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c6,0x1,0x1,0x1,0x1,
+0x1,0x800003db,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2103
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25261,7 +25261,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021cb,0x1,0x1,0x1,0x1,
+0x1,0x800003dd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2105
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25271,7 +25271,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022bf,0x1,
+0x1,0x1,0x1,0x1,0x800003e0,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25295,7 +25295,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a8d,0x1,0x80002a8f,0x1,0x1,0x1,
+0x800003e7,0x1,0x800003e8,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25308,7 +25308,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002018,0x1,
+0x1,0x1,0x1,0x1,0x800003ea,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2109
@@ -25345,7 +25345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a79,0x1,0x1,0x1,0x1,
+0x1,0x800003f2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2112
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25357,7 +25357,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d6,0x1,0x1,
+0x1,0x1,0x1,0x800003f3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2113
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25415,7 +25415,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b4,0x800025c2,0x1,0x1,0x1,0x1,
+0x800003f9,0x800003fa,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25523,7 +25523,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002014,0x1,0x1,
+0x1,0x1,0x1,0x8000040e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25537,7 +25537,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000223a,0x1,0x1,
+0x1,0x1,0x1,0x8000040f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2128
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25584,7 +25584,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000b5,0x1,
+0x1,0x1,0x1,0x1,0x80000416,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2132
@@ -25633,7 +25633,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002212,0x1,0x1,0x1,
+0x1,0x1,0x8000041b,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2136
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25704,7 +25704,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022b8,
+0x1,0x1,0x1,0x1,0x1,0x8000042d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2142
@@ -25714,7 +25714,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002207,0x1,0x1,0x1,
+0x1,0x1,0x8000042e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25750,7 +25750,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224b,
+0x1,0x1,0x1,0x1,0x1,0x80000434,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25765,7 +25765,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000149,0x1,0x1,0x1,
+0x1,0x1,0x80000435,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2147
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25789,7 +25789,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000266e,0x1,0x1,0x1,0x1,
+0x1,0x80000437,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2149
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25800,7 +25800,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224e,
+0x1,0x1,0x1,0x1,0x1,0x8000043b,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2150
@@ -25859,7 +25859,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002247,0x1,0x1,0x1,
+0x1,0x1,0x80000442,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25871,7 +25871,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002013,0x1,0x1,
+0x1,0x1,0x1,0x80000447,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -25885,7 +25885,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0xbb9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002197,0x1,0x1,0x1,0x1,
+0x1,0x8000044b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2157
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25897,7 +25897,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d7,0x1,0x1,0x1,0x1,
+0x1,0x8000044a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2158
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25909,7 +25909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002250,0x1,0x1,
+0x1,0x1,0x1,0x8000044d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2159
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -25956,7 +25956,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002242,0x1,0x1,0x1,
+0x1,0x1,0x80000454,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2163
@@ -26005,7 +26005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002267,0x1,0xbc1,0x1,0x1,0x1,
+0x8000045f,0x1,0xbc1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2167
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26016,7 +26016,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002275,0x1,0x1,0x1,
+0x1,0x1,0x80000463,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2168
@@ -26029,7 +26029,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021ce,0x1,0x1,0x1,0x1,
+0x1,0x80000468,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2169
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26041,7 +26041,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021ae,0x1,0x1,0x1,0x1,
+0x1,0x80000469,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2170
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26053,7 +26053,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002af2,0x1,0x1,0x1,0x1,
+0x1,0x8000046a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2171
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26065,7 +26065,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021cd,0x1,0x1,0x1,0x1,
+0x1,0x80000471,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2172
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26077,7 +26077,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000219a,0x1,0x1,0x1,0x1,
+0x1,0x80000472,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2173
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26113,7 +26113,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002266,0x1,0xbc4,0x1,0x1,0x1,
+0x8000047b,0x1,0xbc4,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2176
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26125,7 +26125,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000226e,0x1,0x1,0x1,
+0x1,0x1,0x8000047e,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2177
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26136,7 +26136,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002274,0x1,0x1,0x1,
+0x1,0x1,0x80000480,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2178
@@ -26147,7 +26147,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022ea,0x1,
+0x1,0x1,0x1,0x1,0x80000483,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26244,7 +26244,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002209,0x1,0x1,
+0x1,0x1,0x1,0x8000049d,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2187
@@ -26279,7 +26279,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000220c,0x1,
+0x1,0x1,0x1,0x1,0x800004ae,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26353,7 +26353,7 @@
 0x1,0x1,0xbdb,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0xbdc,0x80002202,0x1,0x1,
+0x1,0x1,0xbdc,0x800004cd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2196
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26386,7 +26386,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002280,0x1,
+0x1,0x1,0x1,0x1,0x800004d2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26401,7 +26401,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021cf,0x1,0x1,0x1,0x1,
+0x1,0x800004d4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2200
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26413,7 +26413,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000219b,0x1,0x1,0x1,0x1,
+0x1,0x800004d5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2201
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26447,7 +26447,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022eb,0x1,
+0x1,0x1,0x1,0x1,0x800004da,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26483,7 +26483,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002244,0x1,0x1,0x1,0x1,0x1,
+0x800004e4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26494,7 +26494,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002224,
+0x1,0x1,0x1,0x1,0x1,0x800004e6,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26509,7 +26509,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002226,0x1,0x1,0x1,0x1,
+0x1,0x800004e7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2209
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26525,13 +26525,13 @@
 0x1,0x1,0x1},
 // Transitions for state 2210
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ac5,0x1,
+0x1,0x1,0x1,0x1,0x800004eb,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002288,0x1,0x1,0x1,0x1,0x1,
+0x800004ec,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xbe8,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26542,20 +26542,20 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002281,0x1,
+0x1,0x1,0x1,0x1,0x800004f0,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2212
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002ac6,0x1,
+0x1,0x1,0x1,0x1,0x800004f3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002289,0x1,0x1,0x1,0x1,0x1,
+0x800004f4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xbea,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26616,7 +26616,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002007,
+0x1,0x1,0x1,0x1,0x1,0x80000504,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2218
@@ -26748,7 +26748,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000223c,0x1,0x1,0x1,
+0x1,0x1,0x80000514,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2229
@@ -26761,7 +26761,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0xbf9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002196,0x1,0x1,0x1,0x1,
+0x1,0x80000517,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2230
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26773,7 +26773,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d6,0x1,0x1,0x1,0x1,
+0x1,0x80000516,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2231
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26818,7 +26818,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000d4,0x1,
+0x1,0x1,0x1,0x1,0x8000051e,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26830,7 +26830,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000f4,0x1,
+0x1,0x1,0x1,0x1,0x8000051f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26843,7 +26843,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000229d,0x1,0x1,
+0x1,0x1,0x1,0x80000522,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26891,7 +26891,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000152,0x1,0x1,0x1,
+0x1,0x1,0x80000528,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26903,7 +26903,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000153,0x1,0x1,0x1,
+0x1,0x1,0x80000529,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -26917,7 +26917,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029bf,0x1,0x1,0x1,0x1,
+0x1,0x8000052a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2243
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26953,7 +26953,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029b5,0x1,0x1,0x1,0x1,
+0x1,0x80000531,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2246
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26965,7 +26965,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021ba,0x1,0x1,0x1,0x1,
+0x1,0x80000534,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2247
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26977,7 +26977,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029be,0x1,0x1,0x1,0x1,
+0x1,0x80000535,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2248
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -26999,7 +26999,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000203e,0x1,0x1,0x1,0x1,0x1,
+0x80000537,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27013,7 +27013,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000014c,0x1,0x1,0x1,0x1,
+0x1,0x80000539,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2251
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27025,7 +27025,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000014d,0x1,0x1,0x1,0x1,
+0x1,0x8000053a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2252
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27034,7 +27034,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003a9,0x1,0x1,0x1,
+0x1,0x1,0x8000053b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27046,7 +27046,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003c9,0x1,0x1,0x1,
+0x1,0x1,0x8000053c,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27108,7 +27108,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029b9,
+0x1,0x1,0x1,0x1,0x1,0x80000546,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2259
@@ -27121,7 +27121,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002295,0x1,0x1,0x1,
+0x1,0x1,0x80000547,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2260
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27133,7 +27133,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021bb,0x1,0x1,0x1,0x1,
+0x1,0x8000054a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2261
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27145,7 +27145,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002134,0x1,0x1,0x1,0x1,
+0x1,0x8000054c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2262
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27253,7 +27253,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000233d,0x1,0x1,0x1,0x1,
+0x1,0x80000561,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2271
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27288,7 +27288,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0xc14,0x1,
-0x1,0x80002afd,0x1,0x1,0x1,0x1,
+0x1,0x8000056a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2274
@@ -27371,7 +27371,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000260e,0x1,0x1,0x1,0x1,0x1,
+0x8000057a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27406,8 +27406,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0xc1e,0x8000229e,0xc1f,0xc20,
-0x80002a72,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0xc1e,0x80000584,0xc1f,0xc20,
+0x80000588,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xc22,0x1,0x1,0x1,
 0x1,0x1,0xc23,0xc24,0x1,0x1,
 0x1,0x1,0x1},
@@ -27454,7 +27454,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800000a3,
+0x1,0x1,0x1,0x1,0x1,0x80000592,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27467,7 +27467,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227c,0x1,0x1,0x1,0x1,0x1,
+0x80000596,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27503,7 +27503,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002033,0x1,0x1,0x1,0x1,0x1,
+0x800005a5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27515,7 +27515,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002032,0x1,0x1,0x1,0x1,0x1,
+0x800005a6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27528,7 +27528,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ab9,
+0x1,0x1,0x1,0x1,0x1,0x800005a8,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2294
@@ -27600,7 +27600,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000227e,0x1,0x1,0x1,
+0x1,0x1,0x800005b4,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2300
@@ -27661,7 +27661,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000003f,0x1,0x1,
+0x1,0x1,0x1,0x800005c5,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2305
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27673,7 +27673,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021db,0x1,0x1,0x1,0x1,
+0x1,0x800005c9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2306
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27706,7 +27706,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000221a,0x1,
+0x1,0x1,0x1,0x1,0x800005cd,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27730,8 +27730,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002992,
-0x800029a5,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x800005d1,
+0x800005d2,0x1,0x1,0x1,0x1,0x1,
 0x1,0xc3e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27744,7 +27744,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000bb,0x1,
+0x1,0x1,0x1,0x1,0x800005d4,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2312
@@ -27754,11 +27754,11 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0xc3f,0x800021e5,0x80002933,0x1,
+0x1,0x1,0xc3f,0x800005d9,0x800005db,0x1,
 0x1,0xc41,0x1,0xc42,0x1,0x1,
 0x1,0xc43,0x1,0x1,0x1,0xc44,
 0x1,0x1,0xc45,0xc47,0x1,0x1,
-0x8000219d,0x1,0x1},
+0x800005e3,0x1,0x1},
 // Transitions for state 2313
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27804,7 +27804,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002236,0x1,
+0x1,0x1,0x1,0x1,0x800005e6,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2317
@@ -27817,7 +27817,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002910,0x1,0x1,0x1,0x1,
+0x1,0x800005e8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2318
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27829,7 +27829,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000290f,0x1,0x1,0x1,0x1,
+0x1,0x800005e9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2319
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27841,7 +27841,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000290d,0x1,0x1,0x1,0x1,
+0x1,0x800005ea,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2320
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -27852,7 +27852,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002773,0x1,0x1,0x1,0x1,0x1,
+0x800005eb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2321
@@ -27875,7 +27875,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000298c,0x1,0x1,0x1,0x1,0x1,
+0x800005ee,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xc4c,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -27936,7 +27936,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002309,0x1,0x1,0x1,0x1,
+0x1,0x800005f5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2328
@@ -27960,7 +27960,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000201d,0x1,
+0x1,0x1,0x1,0x1,0x800005fb,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2330
@@ -27973,7 +27973,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0xc53,0x1,
 0x1,0x1,0x1,0x1,0x1,0xc54,
-0x1,0x1,0x8000211d,0x1,0x1,0x1,
+0x1,0x1,0x80000602,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2331
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28018,10 +28018,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021c1,
+0x1,0x1,0x1,0x1,0x1,0x8000060e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800021c0,0x1,
+0x1,0x1,0x1,0x1,0x8000060f,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2335
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28069,7 +28069,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c4,0x1,0x1,0x1,0x1,
+0x1,0x80000636,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2339
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28081,7 +28081,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021cc,0x1,0x1,0x1,0x1,
+0x1,0x80000637,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2340
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28102,7 +28102,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002aee,
+0x1,0x1,0x1,0x1,0x1,0x8000063b,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28115,7 +28115,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800027ed,0x1,0x1,0x1,
+0x1,0x1,0x8000063c,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -28129,7 +28129,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021fe,0x1,0x1,0x1,0x1,
+0x1,0x8000063d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2344
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28140,7 +28140,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027e7,0x1,0x1,0x1,0x1,0x1,
+0x8000063e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2345
@@ -28153,7 +28153,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002986,0x1,0x1,0x1,0x1,
+0x1,0x8000063f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2346
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28225,7 +28225,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c9,0x1,0x1,0x1,0x1,
+0x1,0x80000648,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2352
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28260,7 +28260,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002019,0x1,
+0x1,0x1,0x1,0x1,0x80000650,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2355
@@ -28295,7 +28295,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b5,0x800025b8,0x1,0x1,0x1,0x1,
+0x80000655,0x80000656,0x1,0x1,0x1,0x1,
 0x1,0xc67,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -28356,7 +28356,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000201a,0x1,
+0x1,0x1,0x1,0x1,0x8000065d,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2363
@@ -28391,7 +28391,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227d,0x1,0x1,0x1,0x1,0x1,
+0x80000663,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -28426,7 +28426,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000015c,0x1,
+0x1,0x1,0x1,0x1,0x80000668,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28438,7 +28438,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000015d,0x1,
+0x1,0x1,0x1,0x1,0x80000669,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28452,7 +28452,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002aba,
+0x1,0x1,0x1,0x1,0x1,0x8000066a,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2371
@@ -28488,7 +28488,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000227f,0x1,0x1,0x1,
+0x1,0x1,0x8000066e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2374
@@ -28498,8 +28498,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022a1,0x1,0x1,
-0x80002a66,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x80000672,0x1,0x1,
+0x80000673,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -28513,7 +28513,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0xc72,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002198,0x1,0x1,0x1,0x1,
+0x1,0x80000676,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2376
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28525,7 +28525,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d8,0x1,0x1,0x1,0x1,
+0x1,0x80000675,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2377
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28548,7 +28548,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0xc75,0x1,
-0x1,0x1,0x1,0x80002216,0x1,0x1,
+0x1,0x1,0x1,0x8000067c,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2379
@@ -28572,7 +28572,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000266f,
+0x1,0x1,0x1,0x1,0x1,0x80000681,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2381
@@ -28630,7 +28630,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003a3,0x1,0x1,0x1,
+0x1,0x1,0x8000068d,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28642,7 +28642,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003c3,0x1,0x1,0x1,
+0x1,0x1,0x8000068e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28669,11 +28669,11 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002243,0x1,0x1,0x1,0x1,0x1,
+0x80000694,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2389
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002aa0,0x1,
+0x1,0x1,0x1,0x1,0x80000696,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28685,7 +28685,7 @@
 0x1,0x1,0x1},
 // Transitions for state 2390
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a9f,0x1,
+0x1,0x1,0x1,0x1,0x80000698,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28703,7 +28703,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002246,0x1,0x1,0x1,0x1,0x1,
+0x80000699,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -28741,7 +28741,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002190,0x1,0x1,0x1,0x1,
+0x1,0x8000069c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2395
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28799,7 +28799,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002323,0x1,0x1,0x1,0x1,0x1,
+0x800006a2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -28813,7 +28813,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002aac,0x1,0x1,0x1,
+0x1,0x1,0x800006a5,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2401
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28872,7 +28872,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002293,
+0x1,0x1,0x1,0x1,0x1,0x800006b0,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2406
@@ -28884,7 +28884,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002294,
+0x1,0x1,0x1,0x1,0x1,0x800006b2,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2407
@@ -28894,9 +28894,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000228f,0x1,0x1,
+0x1,0x1,0x1,0x800006b5,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002290,
+0x1,0x1,0x1,0x1,0x1,0x800006b9,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2408
@@ -28933,7 +28933,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002192,0x1,0x1,0x1,0x1,
+0x1,0x800006c8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2411
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -28979,7 +28979,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002605,0x1,0x1,0x1,0x1,
+0x1,0x800006d0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29005,7 +29005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000af,0x1,0x1,0x1,
+0x1,0x1,0x800006d3,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2417
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29045,13 +29045,13 @@
 0x1,0x1,0x1},
 // Transitions for state 2420
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002acb,0x1,
+0x1,0x1,0x1,0x1,0x800006db,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228a,0x1,0x1,0x1,0x1,0x1,
+0x800006dc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29213,13 +29213,13 @@
 0x1,0x1,0x1},
 // Transitions for state 2434
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002acc,0x1,
+0x1,0x1,0x1,0x1,0x80000709,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228b,0x1,0x1,0x1,0x1,0x1,
+0x8000070a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29269,7 +29269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0xcad,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002199,0x1,0x1,0x1,0x1,
+0x1,0x80000717,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2439
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29281,7 +29281,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021d9,0x1,0x1,0x1,0x1,
+0x1,0x80000716,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2440
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29303,7 +29303,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000df,0x1,0x1,0x1,
+0x1,0x1,0x8000071a,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29410,7 +29410,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000398,0x1,0x1,0x1,
+0x1,0x1,0x8000072d,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29422,7 +29422,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003b8,0x1,0x1,0x1,
+0x1,0x1,0x8000072e,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29484,7 +29484,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002248,
+0x1,0x1,0x1,0x1,0x1,0x80000736,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2457
@@ -29503,7 +29503,7 @@
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000de,0x1,0x1,0x1,0x1,
+0x1,0x80000738,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29520,7 +29520,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000fe,0x1,0x1,
+0x1,0x1,0x1,0x80000739,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2460
@@ -29531,7 +29531,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000223c,0x1,0x1,0x1,0x1,0x1,
+0x8000073a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29543,7 +29543,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800002dc,0x1,0x1,0x1,0x1,0x1,
+0x8000073b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29557,7 +29557,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000d7,0x1,0x1,0x1,
+0x1,0x1,0x8000073f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2463
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29609,7 +29609,7 @@
 0x1,0x1,0x1},
 // Transitions for state 2467
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002122,0x1,
+0x1,0x1,0x1,0x1,0x8000074d,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29627,7 +29627,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002122,0x1,0x1,0x1,0x1,0x1,
+0x8000074e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -29698,7 +29698,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800029cd,0x1,0x1,
+0x1,0x1,0x1,0x8000075b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29738,7 +29738,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000040b},
+0x1,0x1,0x80000762},
 // Transitions for state 2478
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29750,7 +29750,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000045b},
+0x1,0x1,0x80000763},
 // Transitions for state 2479
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29785,7 +29785,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000226c,0x1,0x1,
+0x1,0x1,0x1,0x80000766,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2482
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29846,7 +29846,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000040e},
+0x1,0x1,0x8000076f},
 // Transitions for state 2487
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29858,7 +29858,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000045e},
+0x1,0x1,0x80000770},
 // Transitions for state 2488
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29890,7 +29890,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000db,0x1,
+0x1,0x1,0x1,0x1,0x80000773,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29902,7 +29902,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800000fb,0x1,
+0x1,0x1,0x1,0x1,0x80000774,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29917,7 +29917,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c5,0x1,0x1,0x1,0x1,
+0x1,0x80000777,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2493
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -29953,7 +29953,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000296e,0x1,0x1,0x1,0x1,
+0x1,0x8000077a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2496
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30000,8 +30000,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021bf,0x1,0x1,0x1,0x1,
-0x1,0x800021be,0x1,0x1,0x1,0x1,
+0x1,0x80000781,0x1,0x1,0x1,0x1,
+0x1,0x80000782,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2500
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30012,7 +30012,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002580,0x1,0x1,0x1,0x1,0x1,
+0x80000783,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2501
@@ -30047,7 +30047,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025f8,0x1,
+0x1,0x1,0x1,0x1,0x80000787,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30061,7 +30061,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000016a,0x1,0x1,0x1,0x1,
+0x1,0x80000788,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2505
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30073,7 +30073,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000016b,0x1,0x1,0x1,0x1,
+0x1,0x80000789,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2506
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30096,7 +30096,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022c3,0x1,0x1,
+0x1,0x1,0x1,0x8000078f,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2508
@@ -30108,7 +30108,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000172,0x1,0x1,
+0x1,0x1,0x1,0x80000791,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2509
@@ -30120,7 +30120,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000173,0x1,0x1,
+0x1,0x1,0x1,0x80000792,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2510
@@ -30229,7 +30229,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000228e,0x1,0x1,0x1,
+0x1,0x1,0x800007a0,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2519
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30251,7 +30251,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003d2,0x1,0x1,
+0x1,0x1,0x1,0x800007a5,0x1,0x1,
 0x1,0xce6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30275,7 +30275,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022a5,0x1,0x1,0x1,0x1,0x1,
+0x800007a8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30323,7 +30323,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000016e,0x1,0x1,0x1,
+0x1,0x1,0x800007ae,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30335,7 +30335,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000016f,0x1,0x1,0x1,
+0x1,0x1,0x800007af,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30347,7 +30347,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025f9,0x1,
+0x1,0x1,0x1,0x1,0x800007b0,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30361,7 +30361,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022f0,0x1,0x1,
+0x1,0x1,0x1,0x800007b3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2530
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30395,7 +30395,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800025b4,0x1,0x1,0x1,0x1,
+0x1,0x800007b7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30409,7 +30409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c8,0x1,0x1,0x1,0x1,
+0x1,0x800007b8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2534
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30479,7 +30479,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0xcf2,0x800003d6,0x1,
+0x1,0x1,0x1,0xcf2,0x800007c1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0xcf3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30529,7 +30529,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ae9,
+0x1,0x1,0x1,0x1,0x1,0x800007d0,
 0x1,0x1,0x1},
 // Transitions for state 2544
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30539,7 +30539,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022ab,0x1,0x1,
+0x1,0x1,0x1,0x800007d3,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30551,7 +30551,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022a9,0x1,0x1,
+0x1,0x1,0x1,0x800007d4,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30563,7 +30563,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022a8,0x1,0x1,
+0x1,0x1,0x1,0x800007d5,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30575,7 +30575,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022a2,0x1,0x1,
+0x1,0x1,0x1,0x800007d6,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30601,7 +30601,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000225a,0x1,0x1,0x1,0x1,0x1,
+0x800007db,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2550
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30671,7 +30671,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022b2,0x1,
+0x1,0x1,0x1,0x1,0x800007e8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30682,9 +30682,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002282,0x1,0x1,
+0x1,0x1,0x1,0x800007e9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002283,
+0x1,0x1,0x1,0x1,0x1,0x800007ea,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2557
@@ -30696,7 +30696,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000221d,
+0x1,0x1,0x1,0x1,0x1,0x800007ed,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2558
@@ -30707,7 +30707,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022b3,0x1,
+0x1,0x1,0x1,0x1,0x800007ee,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30766,7 +30766,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000174,0x1,
+0x1,0x1,0x1,0x1,0x800007f7,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30778,7 +30778,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000175,0x1,
+0x1,0x1,0x1,0x1,0x800007f8,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30803,7 +30803,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c0,0x1,0x1,0x1,0x1,0x1,
+0x800007fa,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30815,7 +30815,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002227,0x1,0x1,0x1,0x1,0x1,
+0x800007fb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30850,7 +30850,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025ef,0x1,
+0x1,0x1,0x1,0x1,0x80000808,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30863,7 +30863,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025bd,0x1,
+0x1,0x1,0x1,0x1,0x8000080a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -30877,7 +30877,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027fa,0x1,0x1,0x1,0x1,
+0x1,0x8000080d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2573
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30889,7 +30889,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027f7,0x1,0x1,0x1,0x1,
+0x1,0x8000080e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2574
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30901,7 +30901,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027f8,0x1,0x1,0x1,0x1,
+0x1,0x80000811,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2575
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30913,7 +30913,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027f5,0x1,0x1,0x1,0x1,
+0x1,0x80000812,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2576
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30925,7 +30925,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a00,0x1,0x1,
+0x1,0x1,0x1,0x80000815,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2577
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30961,7 +30961,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027f9,0x1,0x1,0x1,0x1,
+0x1,0x8000081a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2580
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -30973,7 +30973,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027f6,0x1,0x1,0x1,0x1,
+0x1,0x8000081b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2581
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31007,7 +31007,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025b3,0x1,
+0x1,0x1,0x1,0x1,0x80000820,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31054,7 +31054,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000176,0x1,
+0x1,0x1,0x1,0x1,0x80000827,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31066,7 +31066,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000177,0x1,
+0x1,0x1,0x1,0x1,0x80000828,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31163,7 +31163,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000c1,0x1,0x1,0x1,0x1,0x1,
+0x80000002,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31175,7 +31175,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000e1,0x1,0x1,0x1,0x1,0x1,
+0x80000003,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31187,7 +31187,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000102,0x1,0x1,0x1,0x1,0x1,
+0x80000004,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31199,7 +31199,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000103,0x1,0x1,0x1,0x1,0x1,
+0x80000005,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31211,7 +31211,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000c0,0x1,0x1,0x1,0x1,0x1,
+0x80000013,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31223,7 +31223,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000e0,0x1,0x1,0x1,0x1,0x1,
+0x80000014,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31246,7 +31246,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a55,
+0x1,0x1,0x1,0x1,0x1,0x80000020,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31270,7 +31270,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002221,
+0x1,0x1,0x1,0x1,0x1,0x80000027,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31295,7 +31295,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002222,0x1,0x1,
+0x1,0x1,0x1,0x80000033,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31321,7 +31321,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a6f,0x1,0x1,0x1,0x1,
+0x1,0x8000003b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2610
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31346,7 +31346,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002248,0x1},
+0x1,0x80000041,0x1},
 // Transitions for state 2612
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31356,7 +31356,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002254,0x1,0x1,
+0x1,0x1,0x1,0x80000047,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2613
@@ -31379,7 +31379,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000c3,0x1,0x1,0x1,0x1,0x1,
+0x8000004b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31391,7 +31391,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000e3,0x1,0x1,0x1,0x1,0x1,
+0x8000004c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31475,7 +31475,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022bd,0x1,0x1,0x1,0x1,0x1,
+0x80000058,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31486,7 +31486,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002306,
+0x1,0x1,0x1,0x1,0x1,0x80000059,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31498,7 +31498,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002305,
+0x1,0x1,0x1,0x1,0x1,0x8000005a,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31525,7 +31525,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002235,0x1,0x1,0x1,
+0x1,0x1,0x80000062,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2627
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31561,7 +31561,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000212c,0x1,
+0x1,0x1,0x1,0x1,0x80000067,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2630
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31596,7 +31596,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022c2,
+0x1,0x1,0x1,0x1,0x1,0x8000006f,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2633
@@ -31620,7 +31620,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022c3,
+0x1,0x1,0x1,0x1,0x1,0x80000071,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2635
@@ -31715,7 +31715,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c1,0x1,0x1,0x1,0x1,0x1,
+0x8000007a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31742,7 +31742,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000290d,0x1,0x1},
+0x8000007c,0x1,0x1},
 // Transitions for state 2645
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31776,7 +31776,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022a5,0x1,0x1,0x1,
+0x1,0x1,0x8000008f,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2648
@@ -31787,7 +31787,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c8,0x1,0x1,0x1,0x1,0x1,
+0x80000090,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31802,7 +31802,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029c9,0x1},
+0x1,0x80000091,0x1},
 // Transitions for state 2650
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31847,7 +31847,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002035,0x1,0x1,0x1,0x1,0x1,
+0x800000bd,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31861,7 +31861,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000a6,0x1,0x1,0x1,0x1,
+0x1,0x800000c0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2655
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31885,7 +31885,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002022,0x1,0x1,
+0x1,0x1,0x1,0x800000ca,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2657
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31897,7 +31897,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000224e,0x1,0x1,0x1,0x1,0x1,
+0x800000ce,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2658
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31909,7 +31909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000224f,0x1,0x1,0x1,0x1,0x1,
+0x800000cf,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2659
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31919,7 +31919,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000106,0x1,0x1,0x1,0x1,0x1,
+0x800000d0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31931,7 +31931,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000107,0x1,0x1,0x1,0x1,0x1,
+0x800000d1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -31942,7 +31942,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a44,
+0x1,0x1,0x1,0x1,0x1,0x800000d4,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -31968,7 +31968,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a4b,
+0x1,0x1,0x1,0x1,0x1,0x800000d6,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2664
@@ -31980,7 +31980,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a47,
+0x1,0x1,0x1,0x1,0x1,0x800000d7,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2665
@@ -31993,7 +31993,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a40,0x1,0x1,
+0x1,0x1,0x1,0x800000d8,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2666
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32028,7 +32028,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000010c,0x1,0x1,
+0x1,0x1,0x1,0x800000df,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2669
@@ -32040,7 +32040,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000010d,0x1,0x1,
+0x1,0x1,0x1,0x800000e0,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2670
@@ -32052,7 +32052,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000c7,0x1,0x1,0x1,0x1,
+0x1,0x800000e1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2671
@@ -32064,7 +32064,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800000e7,0x1,0x1,0x1,0x1,
+0x1,0x800000e2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2672
@@ -32161,7 +32161,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002257,0x1,0x1,0x1,0x1,0x1,
+0x800000fa,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2680
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32206,7 +32206,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002aef,
+0x1,0x1,0x1,0x1,0x1,0x80000109,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32267,7 +32267,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a74,0x1,0x1,0x1,0x1,0x1,
+0x80000112,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -32279,7 +32279,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002254,0x1,0x1,0x1,0x1,0x1,
+0x80000113,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -32293,7 +32293,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000040,0x1,0x1,
+0x1,0x1,0x1,0x80000116,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2691
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32304,7 +32304,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002218,0x1,0x1,
+0x1,0x1,0x1,0x80000118,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2692
@@ -32353,7 +32353,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000222f,0x1,0x1,
+0x1,0x1,0x1,0x8000011e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2696
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32365,7 +32365,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000222e,0x1,0x1,
+0x1,0x1,0x1,0x8000011f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2697
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32386,7 +32386,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002210,
+0x1,0x1,0x1,0x1,0x1,0x80000123,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32413,7 +32413,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002117,0x1,0x1,0x1,0x1,
+0x1,0x80000127,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2701
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32449,7 +32449,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021b6,0x1,0x1,0x1,0x1,
+0x1,0x80000137,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2704
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32472,7 +32472,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224d,
+0x1,0x1,0x1,0x1,0x1,0x8000013c,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2706
@@ -32484,7 +32484,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a46,
+0x1,0x1,0x1,0x1,0x1,0x8000013d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2707
@@ -32496,7 +32496,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a4a,
+0x1,0x1,0x1,0x1,0x1,0x8000013e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2708
@@ -32509,7 +32509,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000228d,0x1,0x1,
+0x1,0x1,0x1,0x8000013f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2709
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32521,7 +32521,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021b7,0x1,0x1,0x1,0x1,
+0x1,0x80000142,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2710
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32544,7 +32544,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000a4,0x1,0x1,
+0x1,0x1,0x1,0x80000148,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2712
@@ -32582,7 +32582,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000232d},
+0x1,0x1,0x8000014f},
 // Transitions for state 2715
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32593,7 +32593,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002021,0x1,0x1,0x1,0x1,
+0x1,0x80000150,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2716
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32605,7 +32605,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002020,0x1,0x1,0x1,0x1,
+0x1,0x80000151,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2717
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32615,7 +32615,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002138,0x1,0x1,
+0x1,0x1,0x1,0x80000152,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -32640,7 +32640,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000010e,0x1,0x1,
+0x1,0x1,0x1,0x8000015b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2720
@@ -32652,7 +32652,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000010f,0x1,0x1,
+0x1,0x1,0x1,0x8000015c,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2721
@@ -32713,7 +32713,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000297f,0x1,0x1,
+0x1,0x1,0x1,0x8000016a,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2726
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32783,7 +32783,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000f7,0x1,0x1,0x1,0x1,0x1,
+0x8000017f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -32798,7 +32798,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022c7,0x1},
+0x1,0x80000181,0x1},
 // Transitions for state 2733
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32808,7 +32808,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000231e,0x1,0x1,
+0x1,0x1,0x1,0x80000184,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2734
@@ -32820,7 +32820,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000230d,
+0x1,0x1,0x1,0x1,0x1,0x80000185,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2735
@@ -32833,7 +32833,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000024,0x1,0x1,0x1,0x1,
+0x1,0x80000186,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2736
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -32845,7 +32845,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800020dc,0x1,0x1,
+0x1,0x1,0x1,0x8000018b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2737
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33060,7 +33060,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000231f,0x1,0x1,
+0x1,0x1,0x1,0x800001b4,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2755
@@ -33072,7 +33072,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000230c,
+0x1,0x1,0x1,0x1,0x1,0x800001b5,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2756
@@ -33084,7 +33084,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000110,0x1,0x1,0x1,0x1,0x1,
+0x800001bb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2757
@@ -33096,7 +33096,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000111,0x1,0x1,0x1,0x1,0x1,
+0x800001bc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2758
@@ -33131,7 +33131,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000c9,0x1,0x1,0x1,0x1,0x1,
+0x800001c6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33143,7 +33143,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000e9,0x1,0x1,0x1,0x1,0x1,
+0x800001c7,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33157,7 +33157,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a6e,0x1,0x1,0x1,0x1,
+0x1,0x800001c8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2763
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33168,7 +33168,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000011a,0x1,0x1,
+0x1,0x1,0x1,0x800001c9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2764
@@ -33180,7 +33180,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000011b,0x1,0x1,
+0x1,0x1,0x1,0x800001ca,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2765
@@ -33192,7 +33192,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002255,0x1,0x1,
+0x1,0x1,0x1,0x800001ce,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2766
@@ -33203,7 +33203,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000c8,0x1,0x1,0x1,0x1,0x1,
+0x800001da,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33215,7 +33215,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000e8,0x1,0x1,0x1,0x1,0x1,
+0x800001db,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33229,7 +33229,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a98,0x1,0x1,
+0x1,0x1,0x1,0x800001dd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2769
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33265,7 +33265,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a97,0x1,0x1,
+0x1,0x1,0x1,0x800001e3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2772
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33277,7 +33277,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0xd7d,0x1,0x1,0x80002205,
+0x1,0x1,0xd7d,0x1,0x1,0x800001e9,
 0x1,0x1,0x1},
 // Transitions for state 2773
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33312,7 +33312,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029e3,0x1,0x1,0x1,0x1,
+0x1,0x800001f6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2776
@@ -33346,7 +33346,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002256,0x1,
+0x1,0x1,0x1,0x1,0x800001fc,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33385,7 +33385,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000003d,0x1,0x1,0x1,
+0x1,0x1,0x80000202,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2782
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33409,7 +33409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000225f,0x1,0x1,
+0x1,0x1,0x1,0x80000204,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2784
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33457,7 +33457,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002203,0x1,0x1,0x1,
+0x1,0x1,0x80000219,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2788
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33515,7 +33515,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002640,0x1,0x1,0x1,0x1,0x1,
+0x80000220,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33527,7 +33527,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000fb03,0x1,0x1,0x1,
+0x1,0x1,0x80000221,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33539,7 +33539,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000fb04,0x1,0x1,0x1,
+0x1,0x1,0x80000223,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33564,7 +33564,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002200,0x1,0x1,0x1,0x1,
+0x1,0x80000230,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2797
@@ -33576,7 +33576,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002200,0x1,0x1,0x1,0x1,
+0x1,0x80000231,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2798
@@ -33683,7 +33683,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800001f5,0x1,0x1,0x1,0x1,0x1,
+0x80000249,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33694,7 +33694,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003dc,
+0x1,0x1,0x1,0x1,0x1,0x8000024c,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33706,7 +33706,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003dd,
+0x1,0x1,0x1,0x1,0x1,0x8000024d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33719,7 +33719,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000011e,0x1,0x1,0x1,0x1,0x1,
+0x8000024f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33731,7 +33731,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000011f,0x1,0x1,0x1,0x1,0x1,
+0x80000250,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -33744,7 +33744,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000122,0x1,0x1,0x1,0x1,
+0x1,0x80000251,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2812
@@ -33769,7 +33769,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a80,0x1,0x1,
+0x1,0x1,0x1,0x80000261,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2814
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33781,7 +33781,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a94,0x1,0x1,0x1,
+0x1,0x1,0x80000265,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2815
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33817,7 +33817,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002995,0x1,0x1,0x1,0x1,
+0x1,0x8000028e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2818
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33853,7 +33853,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002978,0x1,0x1,0x1,0x1,
+0x1,0x80000291,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2821
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33865,7 +33865,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d7,0x1,0x1,
+0x1,0x1,0x1,0x80000292,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2822
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33900,7 +33900,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002273,0x1,0x1,0x1,
+0x1,0x1,0x80000296,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2825
@@ -33924,7 +33924,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000200a,
+0x1,0x1,0x1,0x1,0x1,0x8000029a,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2827
@@ -33937,7 +33937,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000210b,0x1,0x1,
+0x1,0x1,0x1,0x8000029c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2828
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33950,7 +33950,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000042a},
+0x1,0x1,0x8000029d},
 // Transitions for state 2829
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33962,7 +33962,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000044a},
+0x1,0x1,0x8000029e},
 // Transitions for state 2830
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33985,7 +33985,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002665,0x1,0x1,0x1,
+0x1,0x1,0x800002a7,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2832
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -33996,7 +33996,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002026,
+0x1,0x1,0x1,0x1,0x1,0x800002a9,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2833
@@ -34008,7 +34008,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022b9,0x1,0x1,
+0x1,0x1,0x1,0x800002aa,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2834
@@ -34057,7 +34057,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000223b,0x1,0x1,
+0x1,0x1,0x1,0x800002b1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2838
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34093,7 +34093,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002015,0x1,0x1,0x1,0x1,
+0x1,0x800002b6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2841
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34115,7 +34115,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000210f,0x1,0x1,
+0x1,0x1,0x1,0x800002ba,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34128,7 +34128,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000126,0x1,0x1,0x1,0x1,0x1,
+0x800002bb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2844
@@ -34140,7 +34140,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000127,0x1,0x1,0x1,0x1,0x1,
+0x800002bc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2845
@@ -34176,7 +34176,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002043,0x1,0x1,0x1,0x1,
+0x1,0x800002bf,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2848
@@ -34188,7 +34188,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002010,0x1,0x1,
+0x1,0x1,0x1,0x800002c0,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2849
@@ -34199,7 +34199,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000cd,0x1,0x1,0x1,0x1,0x1,
+0x800002c1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34211,7 +34211,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000ed,0x1,0x1,0x1,0x1,0x1,
+0x800002c2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34223,7 +34223,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000cc,0x1,0x1,0x1,0x1,0x1,
+0x800002cf,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34235,7 +34235,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000ec,0x1,0x1,0x1,0x1,0x1,
+0x800002d0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34249,7 +34249,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a0c,0x1,0x1,
+0x1,0x1,0x1,0x800002d2,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2854
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34260,7 +34260,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800029dc,0x1,0x1,
+0x1,0x1,0x1,0x800002d4,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2855
@@ -34319,7 +34319,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002105,0x1,0x1,0x1,0x1,0x1,
+0x800002e4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34345,7 +34345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000131,0x1,0x1,
+0x1,0x1,0x1,0x800002e7,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2862
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34356,7 +34356,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022ba,0x1,0x1,0x1,0x1,
+0x1,0x800002ea,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2863
@@ -34453,7 +34453,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000bf,0x1,0x1,
+0x1,0x1,0x1,0x800002fc,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2871
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34477,7 +34477,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022f3,
+0x1,0x1,0x1,0x1,0x1,0x80000303,
 0x1,0x1,0x1},
 // Transitions for state 2873
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34487,7 +34487,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000128,0x1,0x1,0x1,0x1,0x1,
+0x80000306,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34499,7 +34499,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000129,0x1,0x1,0x1,0x1,0x1,
+0x80000307,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34514,7 +34514,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000408},
+0x1,0x1,0x80000317},
 // Transitions for state 2876
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34526,7 +34526,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000458},
+0x1,0x1,0x80000318},
 // Transitions for state 2877
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34537,7 +34537,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003f0,
+0x1,0x1,0x1,0x1,0x1,0x8000031d,
 0x1,0x1,0x1},
 // Transitions for state 2878
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34548,7 +34548,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000136,0x1,0x1,0x1,0x1,
+0x1,0x8000031e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2879
@@ -34560,7 +34560,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000137,0x1,0x1,0x1,0x1,
+0x1,0x8000031f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2880
@@ -34572,7 +34572,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000138,0x1,0x1,
+0x1,0x1,0x1,0x80000324,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2881
@@ -34583,7 +34583,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000139,0x1,0x1,0x1,0x1,0x1,
+0x8000032e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34595,7 +34595,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000013a,0x1,0x1,0x1,0x1,0x1,
+0x8000032f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34620,7 +34620,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002112,0x1,0x1,
+0x1,0x1,0x1,0x80000331,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2885
@@ -34630,7 +34630,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000039b,0x1,0x1,0x1,
+0x1,0x1,0x80000332,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34642,7 +34642,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003bb,0x1,0x1,0x1,
+0x1,0x1,0x80000333,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34655,7 +34655,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027e8,0x1,0x1,0x1,0x1,0x1,
+0x80000337,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -34693,7 +34693,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000291d,0x1,0x1,0x1,
+0x1,0x1,0x80000340,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2891
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -34704,7 +34704,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a9,0x1,0x1,0x1,0x1,0x1,
+0x80000341,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2892
@@ -34716,7 +34716,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021ab,
+0x1,0x1,0x1,0x1,0x1,0x80000342,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2893
@@ -34728,7 +34728,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002939,0x1,0x1,0x1,0x1,
+0x1,0x80000343,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2894
@@ -34752,7 +34752,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021a2,0x1,0x1,0x1,0x1,
+0x1,0x80000345,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2896
@@ -34764,7 +34764,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000291b,0x1,0x1,0x1,0x1,
+0x1,0x80000347,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2897
@@ -34776,7 +34776,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002919,0x1,0x1,0x1,0x1,
+0x1,0x80000348,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2898
@@ -34787,8 +34787,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000007b,0x1,0x1,0x1,0x1,0x1,
-0x8000005b,0x1,0x1,0x1,0x1,0x1,
+0x8000034e,0x1,0x1,0x1,0x1,0x1,
+0x8000034f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2899
@@ -34812,7 +34812,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000013d,0x1,0x1,
+0x1,0x1,0x1,0x80000353,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2901
@@ -34824,7 +34824,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000013e,0x1,0x1,
+0x1,0x1,0x1,0x80000354,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2902
@@ -34836,7 +34836,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000013b,0x1,0x1,0x1,0x1,
+0x1,0x80000355,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2903
@@ -34848,7 +34848,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000013c,0x1,0x1,0x1,0x1,
+0x1,0x80000356,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2904
@@ -34861,7 +34861,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000201e,0x1,0x1,0x1,0x1,
+0x1,0x8000035d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2905
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35089,7 +35089,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7f,0x1,0x1,
+0x1,0x1,0x1,0x8000038e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2924
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35101,7 +35101,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a93,0x1,0x1,0x1,
+0x1,0x1,0x80000392,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2925
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35245,7 +35245,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000297c,0x1,0x1,
+0x1,0x1,0x1,0x8000039f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2937
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35257,7 +35257,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000230a,0x1,0x1,0x1,0x1,
+0x1,0x800003a0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2938
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35268,7 +35268,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000296a,0x1,0x1,0x1,0x1,
+0x1,0x800003a8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2939
@@ -35302,7 +35302,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000296b,
+0x1,0x1,0x1,0x1,0x1,0x800003b1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35317,7 +35317,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000013f,0x1,0x1,
+0x1,0x1,0x1,0x800003b3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2943
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35329,7 +35329,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000140,0x1,0x1,
+0x1,0x1,0x1,0x800003b4,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2944
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35341,7 +35341,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800023b0,0x1,0x1,
+0x1,0x1,0x1,0x800003b5,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2945
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35461,7 +35461,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a2d,0x1,0x1,0x1,
+0x1,0x1,0x800003d0,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2955
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35485,7 +35485,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002217,0x1,0x1,
+0x1,0x1,0x1,0x800003d2,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2957
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35497,7 +35497,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000005f,0x1,0x1,0x1,0x1,
+0x1,0x800003d3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2958
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35533,7 +35533,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002993,0x1,0x1,
+0x1,0x1,0x1,0x800003da,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2961
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35554,7 +35554,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000296d,
+0x1,0x1,0x1,0x1,0x1,0x800003de,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35568,7 +35568,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002039,0x1,
+0x1,0x1,0x1,0x1,0x800003e1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2964
@@ -35581,7 +35581,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000201a,0x1,0x1,0x1,0x1,
+0x1,0x800003eb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2965
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35592,7 +35592,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000141,0x1,0x1,0x1,0x1,0x1,
+0x800003ec,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2966
@@ -35604,7 +35604,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000142,0x1,0x1,0x1,0x1,0x1,
+0x800003ed,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2967
@@ -35615,7 +35615,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022cb,0x1,0x1,0x1,0x1,0x1,
+0x800003f4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -35629,7 +35629,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022c9,0x1,0x1,0x1,
+0x1,0x1,0x800003f5,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2969
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35641,7 +35641,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002976,0x1,0x1,0x1,0x1,
+0x1,0x800003f6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2970
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35665,7 +35665,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002996,0x1,0x1,0x1,0x1,
+0x1,0x800003fb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2972
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35724,7 +35724,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800021a6,0x1,
+0x1,0x1,0x1,0x1,0x80000406,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2977
@@ -35737,7 +35737,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800025ae,0x1,0x1,0x1,0x1,
+0x1,0x8000040a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2978
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35746,7 +35746,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a29,0x1,0x1,0x1,
+0x1,0x1,0x8000040b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35797,7 +35797,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000002a,0x1,0x1,
+0x1,0x1,0x1,0x80000418,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2983
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35809,7 +35809,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002af0,0x1,0x1,0x1,0x1,
+0x1,0x80000419,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2984
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35821,7 +35821,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000b7,0x1,0x1,
+0x1,0x1,0x1,0x8000041a,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2985
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35830,7 +35830,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000229f,0x1,0x80002238,
+0x1,0x1,0x1,0x8000041c,0x1,0x8000041d,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35857,7 +35857,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002213,0x1,0x1,0x1,
+0x1,0x1,0x80000422,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2988
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35869,7 +35869,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022a7,0x1,0x1,0x1,
+0x1,0x1,0x80000423,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2989
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35881,7 +35881,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000223e,0x1,0x1,0x1,
+0x1,0x1,0x80000429,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2990
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -35903,7 +35903,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000143,0x1,0x1,0x1,0x1,0x1,
+0x8000042f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -35915,7 +35915,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000144,0x1,0x1,0x1,0x1,0x1,
+0x80000430,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -35951,7 +35951,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000224f,0x1,0x1,0x1,0x1,0x1,
+0x8000043c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -35964,7 +35964,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000147,0x1,0x1,
+0x1,0x1,0x1,0x8000043e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2997
@@ -35976,7 +35976,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000148,0x1,0x1,
+0x1,0x1,0x1,0x8000043f,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2998
@@ -35988,7 +35988,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000145,0x1,0x1,0x1,0x1,
+0x1,0x80000440,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 2999
@@ -36000,7 +36000,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000146,0x1,0x1,0x1,0x1,
+0x1,0x80000441,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3000
@@ -36024,7 +36024,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002924,0x1,0x1,0x1,0x1,0x1,
+0x80000449,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3002
@@ -36061,7 +36061,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002262,
+0x1,0x1,0x1,0x1,0x1,0x80000452,
 0x1,0x1,0x1},
 // Transitions for state 3005
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36073,7 +36073,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002928,0x1,0x1,0x1,0x1,
+0x1,0x80000453,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3006
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36109,7 +36109,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002204,0x1,0x1,
+0x1,0x1,0x1,0x80000458,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3009
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36167,7 +36167,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ec,0x1,0x1,0x1,0x1,0x1,
+0x80000484,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36293,7 +36293,7 @@
 0x1,0x1,0x1},
 // Transitions for state 3024
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022f9,0x1,
+0x1,0x1,0x1,0x1,0x8000049f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36444,7 +36444,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002afd,0x1,0x1,0x1,0x1,
+0x1,0x800004cc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3037
@@ -36467,7 +36467,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022e0,0x1,0x1,0x1,0x1,0x1,
+0x800004d0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36490,11 +36490,11 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002933,0x1,
+0x1,0x1,0x1,0x1,0x800004d6,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000219d,0x1,0x1},
+0x800004d7,0x1,0x1},
 // Transitions for state 3041
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36527,7 +36527,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ed,0x1,0x1,0x1,0x1,0x1,
+0x800004db,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36539,7 +36539,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022e1,0x1,0x1,0x1,0x1,0x1,
+0x800004dd,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36565,7 +36565,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002244,0x1,0x1,0x1,0x1,0x1,
+0x800004e5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3047
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36623,7 +36623,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000d1,0x1,0x1,0x1,0x1,0x1,
+0x800004f9,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36635,7 +36635,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000f1,0x1,0x1,0x1,0x1,0x1,
+0x800004fa,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36660,7 +36660,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002116,0x1,
+0x1,0x1,0x1,0x1,0x80000503,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3055
@@ -36671,7 +36671,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022af,0x1,0x1,
+0x1,0x1,0x1,0x80000506,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36683,7 +36683,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022ae,0x1,0x1,
+0x1,0x1,0x1,0x80000507,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36695,7 +36695,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022ad,0x1,0x1,
+0x1,0x1,0x1,0x80000508,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36707,7 +36707,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022ac,0x1,0x1,
+0x1,0x1,0x1,0x80000509,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36721,7 +36721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002904,0x1,0x1,0x1,0x1,
+0x1,0x8000050c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3060
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36745,7 +36745,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002902,0x1,0x1,0x1,0x1,
+0x1,0x8000050e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3062
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36769,7 +36769,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002903,0x1,0x1,0x1,0x1,
+0x1,0x80000512,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3064
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36792,7 +36792,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002923,0x1,0x1,0x1,0x1,0x1,
+0x80000515,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3066
@@ -36817,7 +36817,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002927,0x1,0x1,0x1,0x1,
+0x1,0x80000519,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3068
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36827,7 +36827,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000d3,0x1,0x1,0x1,0x1,0x1,
+0x8000051a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36839,7 +36839,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000f3,0x1,0x1,0x1,0x1,0x1,
+0x8000051b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36850,7 +36850,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000150,0x1,
+0x1,0x1,0x1,0x1,0x80000523,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36862,7 +36862,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000151,0x1,
+0x1,0x1,0x1,0x1,0x80000524,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36874,7 +36874,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029bc,
+0x1,0x1,0x1,0x1,0x1,0x80000527,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36887,7 +36887,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000d2,0x1,0x1,0x1,0x1,0x1,
+0x8000052e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36899,7 +36899,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000f2,0x1,0x1,0x1,0x1,0x1,
+0x8000052f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -36949,7 +36949,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002296,0x1,0x1,0x1,
+0x1,0x1,0x80000540,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3079
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -36983,7 +36983,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022b6,0x1,0x1,0x1,0x1,
+0x1,0x80000550,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37007,7 +37007,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000d8,0x1,0x1,
+0x1,0x1,0x1,0x80000557,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37019,7 +37019,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000f8,0x1,0x1,
+0x1,0x1,0x1,0x80000558,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37031,7 +37031,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000d5,0x1,0x1,0x1,0x1,0x1,
+0x8000055a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37043,7 +37043,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000f5,0x1,0x1,0x1,0x1,0x1,
+0x8000055b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37057,7 +37057,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a37,0x1,0x1,0x1,
+0x1,0x1,0x8000055c,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3088
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37069,7 +37069,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002297,0x1,0x1,0x1,
+0x1,0x1,0x8000055d,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3089
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37116,7 +37116,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002af3,0x1,0x1,0x1,
+0x1,0x1,0x80000569,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3093
@@ -37141,7 +37141,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000025,0x1,0x1,
+0x1,0x1,0x1,0x8000056f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3095
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37150,7 +37150,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000002e,
+0x1,0x1,0x1,0x1,0x1,0x80000570,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37164,7 +37164,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002030,0x1,0x1,0x1,0x1,
+0x1,0x80000571,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3097
@@ -37189,7 +37189,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002133,0x1,0x1,
+0x1,0x1,0x1,0x80000579,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3099
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37212,7 +37212,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000210f,0x1,0x1,0x1,0x1,0x1,
+0x8000057f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3101
@@ -37225,7 +37225,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000210f,
+0x1,0x1,0x1,0x1,0x1,0x80000581,
 0x1,0x1,0x1},
 // Transitions for state 3102
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37260,8 +37260,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002214,0x1,
-0x1,0x1,0x1,0x1,0x80002a25,0x1,
+0x1,0x1,0x1,0x1,0x80000586,0x1,
+0x1,0x1,0x1,0x1,0x80000587,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3105
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37284,7 +37284,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000b1,0x1,0x1,
+0x1,0x1,0x1,0x8000058a,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3107
@@ -37381,7 +37381,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002aaf,0x1,0x1,0x1,0x1,0x1,
+0x800005a0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3115
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37417,7 +37417,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002119,0x1,0x1,0x1,
+0x1,0x1,0x800005a7,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3118
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37428,7 +37428,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022e8,0x1,0x1,0x1,
+0x1,0x1,0x800005aa,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3119
@@ -37500,7 +37500,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000221d,0x1,
+0x1,0x1,0x1,0x1,0x800005b3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3125
@@ -37512,7 +37512,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022b0,0x1,0x1,0x1,0x1,
+0x1,0x800005b5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3126
@@ -37524,7 +37524,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002008,
+0x1,0x1,0x1,0x1,0x1,0x800005ba,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3127
@@ -37535,7 +37535,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002057,0x1,0x1,0x1,0x1,0x1,
+0x800005c0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37583,7 +37583,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000154,0x1,0x1,0x1,0x1,0x1,
+0x800005cb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37595,7 +37595,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000155,0x1,0x1,0x1,0x1,0x1,
+0x800005cc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37619,7 +37619,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027e9,0x1,0x1,0x1,0x1,0x1,
+0x800005d3,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -37632,7 +37632,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002975,
+0x1,0x1,0x1,0x1,0x1,0x800005d8,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3136
@@ -37657,7 +37657,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000291e,0x1,0x1,0x1,
+0x1,0x1,0x800005dc,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3138
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37668,7 +37668,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021aa,0x1,0x1,0x1,0x1,0x1,
+0x800005dd,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3139
@@ -37680,7 +37680,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021ac,
+0x1,0x1,0x1,0x1,0x1,0x800005de,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3140
@@ -37692,7 +37692,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002945,0x1,0x1,0x1,0x1,
+0x1,0x800005df,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3141
@@ -37716,7 +37716,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002916,0x1,0x1,0x1,0x1,
+0x1,0x800005e1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3143
@@ -37728,7 +37728,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021a3,0x1,0x1,0x1,0x1,
+0x1,0x800005e2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3144
@@ -37740,7 +37740,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000291c,0x1,0x1,0x1,0x1,
+0x1,0x800005e4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3145
@@ -37752,7 +37752,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000291a,0x1,0x1,0x1,0x1,
+0x1,0x800005e5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3146
@@ -37775,8 +37775,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000007d,0x1,0x1,0x1,0x1,0x1,
-0x8000005d,0x1,0x1,0x1,0x1,0x1,
+0x800005ec,0x1,0x1,0x1,0x1,0x1,
+0x800005ed,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3148
@@ -37800,7 +37800,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000158,0x1,0x1,
+0x1,0x1,0x1,0x800005f1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3150
@@ -37812,7 +37812,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000159,0x1,0x1,
+0x1,0x1,0x1,0x800005f2,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3151
@@ -37824,7 +37824,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000156,0x1,0x1,0x1,0x1,
+0x1,0x800005f3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3152
@@ -37836,7 +37836,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000157,0x1,0x1,0x1,0x1,
+0x1,0x800005f4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3153
@@ -37861,7 +37861,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000201d,0x1,0x1,0x1,0x1,
+0x1,0x800005fc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3155
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37909,7 +37909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000297d,0x1,0x1,
+0x1,0x1,0x1,0x80000609,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3159
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37921,7 +37921,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000230b,0x1,0x1,0x1,0x1,
+0x1,0x8000060a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3160
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37932,7 +37932,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000296c,0x1,0x1,0x1,0x1,
+0x1,0x80000610,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3161
@@ -37981,7 +37981,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800023b1,0x1,0x1,
+0x1,0x1,0x1,0x80000639,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3165
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -37993,7 +37993,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a2e,0x1,0x1,0x1,
+0x1,0x1,0x80000642,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3166
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38029,7 +38029,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002994,0x1,0x1,
+0x1,0x1,0x1,0x80000646,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3169
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38064,7 +38064,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000203a,0x1,
+0x1,0x1,0x1,0x1,0x8000064a,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3172
@@ -38077,7 +38077,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002019,0x1,0x1,0x1,0x1,
+0x1,0x80000651,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3173
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38087,7 +38087,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022cc,0x1,0x1,0x1,0x1,0x1,
+0x80000652,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38101,7 +38101,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022ca,0x1,0x1,0x1,
+0x1,0x1,0x80000653,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3175
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38147,7 +38147,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000015a,0x1,0x1,0x1,0x1,0x1,
+0x8000065b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38159,7 +38159,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000015b,0x1,0x1,0x1,0x1,0x1,
+0x8000065c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38172,7 +38172,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000160,0x1,0x1,
+0x1,0x1,0x1,0x80000661,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3181
@@ -38184,7 +38184,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000161,0x1,0x1,
+0x1,0x1,0x1,0x80000662,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3182
@@ -38196,7 +38196,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000015e,0x1,0x1,0x1,0x1,
+0x1,0x80000666,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3183
@@ -38208,7 +38208,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000015f,0x1,0x1,0x1,0x1,
+0x1,0x80000667,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3184
@@ -38220,7 +38220,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022e9,0x1,0x1,0x1,
+0x1,0x1,0x8000066c,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3185
@@ -38244,7 +38244,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002925,0x1,0x1,0x1,0x1,0x1,
+0x80000674,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3187
@@ -38269,7 +38269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002929,0x1,0x1,0x1,0x1,
+0x1,0x8000067a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3189
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38292,7 +38292,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002322,0x1,0x1,
+0x1,0x1,0x1,0x80000680,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3191
@@ -38306,7 +38306,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000429},
+0x1,0x1,0x80000682},
 // Transitions for state 3192
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38318,7 +38318,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80000449},
+0x1,0x1,0x80000683},
 // Transitions for state 3193
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0xe71,0x1,0x1,
@@ -38351,9 +38351,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800003c2,0x1,0x1,0x1,0x1,
+0x1,0x8000068f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800003c2,
+0x1,0x1,0x1,0x1,0x1,0x80000690,
 0x1,0x1,0x1},
 // Transitions for state 3196
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38365,7 +38365,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a6a,0x1,0x1,
+0x1,0x1,0x1,0x80000692,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3197
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38424,7 +38424,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a33,
+0x1,0x1,0x1,0x1,0x1,0x8000069f,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3202
@@ -38450,7 +38450,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000042c},
+0x1,0x1,0x800006a6},
 // Transitions for state 3204
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38462,7 +38462,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000044c},
+0x1,0x1,0x800006a7},
 // Transitions for state 3205
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38473,7 +38473,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000233f,0x1,0x1,0x1,0x1,
+0x1,0x800006aa,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3206
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38485,7 +38485,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002660,0x1,0x1,0x1,
+0x1,0x1,0x800006ad,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3207
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38497,7 +38497,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002293,0x1,0x1,0x1,
+0x1,0x1,0x800006b1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3208
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38509,7 +38509,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002294,0x1,0x1,0x1,
+0x1,0x1,0x800006b3,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3209
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38519,7 +38519,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002291,0x1,0x1,0x1,0x1,0x1,
+0x800006b6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xe7d,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38531,7 +38531,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002292,0x1,0x1,0x1,0x1,0x1,
+0x800006ba,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0xe7e,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38543,7 +38543,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025a1,0x1,0x1,0x1,0x1,0x1,
+0x800006be,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38555,7 +38555,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025a1,0x800025aa,0x1,0x1,0x1,0x1,
+0x800006bf,0x800006c6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38568,7 +38568,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002216,0x1,0x1,
+0x1,0x1,0x1,0x800006cb,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3214
@@ -38579,7 +38579,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002323,0x1,0x1,0x1,0x1,0x1,
+0x800006cc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38591,7 +38591,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022c6,0x1,0x1,0x1,0x1,
+0x1,0x800006cd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -38617,7 +38617,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002abd,0x1,0x1,
+0x1,0x1,0x1,0x800006d6,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3218
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38677,7 +38677,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d0,0x1,0x1,
+0x1,0x1,0x1,0x800006df,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3223
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38689,7 +38689,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002282,0x1,0x1,
+0x1,0x1,0x1,0x800006e0,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3224
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38700,7 +38700,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002ac7,0x1,0x1,0x1,
+0x1,0x1,0x800006e6,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3225
@@ -38710,9 +38710,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ad5,0x1,0x1,
+0x1,0x1,0x1,0x800006e7,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ad3,
+0x1,0x1,0x1,0x1,0x1,0x800006e8,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3226
@@ -38761,7 +38761,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ab0,0x1,0x1,0x1,0x1,0x1,
+0x800006f0,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3230
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38809,7 +38809,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002abe,0x1,0x1,
+0x1,0x1,0x1,0x800006fe,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3234
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38905,7 +38905,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d1,0x1,0x1,
+0x1,0x1,0x1,0x8000070c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3242
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38917,7 +38917,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002283,0x1,0x1,
+0x1,0x1,0x1,0x8000070d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3243
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38928,7 +38928,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002ac8,0x1,0x1,0x1,
+0x1,0x1,0x80000712,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3244
@@ -38938,9 +38938,9 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ad4,0x1,0x1,
+0x1,0x1,0x1,0x80000713,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002ad6,
+0x1,0x1,0x1,0x1,0x1,0x80000714,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3245
@@ -38952,7 +38952,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002926,0x1,0x1,0x1,0x1,0x1,
+0x80000715,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3246
@@ -38977,7 +38977,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000292a,0x1,0x1,0x1,0x1,
+0x1,0x80000719,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3248
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -38989,7 +38989,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002316,0x1,0x1,
+0x1,0x1,0x1,0x8000071c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3249
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39000,7 +39000,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000164,0x1,0x1,
+0x1,0x1,0x1,0x80000720,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3250
@@ -39012,7 +39012,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000165,0x1,0x1,
+0x1,0x1,0x1,0x80000721,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3251
@@ -39024,7 +39024,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000162,0x1,0x1,0x1,0x1,
+0x1,0x80000722,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3252
@@ -39036,7 +39036,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80000163,0x1,0x1,0x1,0x1,
+0x1,0x80000723,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3253
@@ -39046,7 +39046,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002315,0x1,
+0x1,0x1,0x1,0x1,0x80000727,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39085,7 +39085,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0xe9b,0x1,0x1,0x800003d1,
+0x1,0x1,0xe9b,0x1,0x1,0x80000730,
 0x1,0x1,0x1},
 // Transitions for state 3257
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39120,7 +39120,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002009,
+0x1,0x1,0x1,0x1,0x1,0x80000734,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3260
@@ -39144,7 +39144,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000223c,0x1,0x1,0x1,
+0x1,0x1,0x80000737,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3262
@@ -39166,7 +39166,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022a0,0x1,0x80002a30,
+0x1,0x1,0x1,0x80000740,0x1,0x80000742,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39181,7 +39181,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002336,0x1,0x1,
+0x1,0x1,0x1,0x80000746,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3265
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39193,7 +39193,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002af1,0x1,0x1,0x1,0x1,
+0x1,0x80000747,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3266
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39215,7 +39215,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002034,0x1,0x1,0x1,0x1,0x1,
+0x8000074c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39241,7 +39241,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025ec,0x1,0x1,
+0x1,0x1,0x1,0x80000756,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3270
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39312,7 +39312,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000166,0x1,0x1,0x1,0x1,0x1,
+0x80000764,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3276
@@ -39324,7 +39324,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000167,0x1,0x1,0x1,0x1,0x1,
+0x80000765,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3277
@@ -39347,7 +39347,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000da,0x1,0x1,0x1,0x1,0x1,
+0x80000769,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39359,7 +39359,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000fa,0x1,0x1,0x1,0x1,0x1,
+0x8000076a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39383,7 +39383,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000016c,0x1,0x1,0x1,0x1,0x1,
+0x80000771,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39395,7 +39395,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000016d,0x1,0x1,0x1,0x1,0x1,
+0x80000772,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39406,7 +39406,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000170,0x1,
+0x1,0x1,0x1,0x1,0x80000778,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39418,7 +39418,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80000171,0x1,
+0x1,0x1,0x1,0x1,0x80000779,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39433,7 +39433,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000297e,0x1,0x1,
+0x1,0x1,0x1,0x8000077b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3286
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39443,7 +39443,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000d9,0x1,0x1,0x1,0x1,0x1,
+0x8000077e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39455,7 +39455,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000f9,0x1,0x1,0x1,0x1,0x1,
+0x8000077f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39468,7 +39468,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000231c,0x1,0x1,
+0x1,0x1,0x1,0x80000784,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3289
@@ -39480,7 +39480,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000230f,
+0x1,0x1,0x1,0x1,0x1,0x80000786,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3290
@@ -39672,7 +39672,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000231d,0x1,0x1,
+0x1,0x1,0x1,0x800007ab,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3306
@@ -39684,7 +39684,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000230e,
+0x1,0x1,0x1,0x1,0x1,0x800007ad,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3307
@@ -39695,7 +39695,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000168,0x1,0x1,0x1,0x1,0x1,
+0x800007b4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39707,7 +39707,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000169,0x1,0x1,0x1,0x1,0x1,
+0x800007b5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39733,7 +39733,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000299c,0x1,0x1,
+0x1,0x1,0x1,0x800007bc,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3311
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39779,7 +39779,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003d5,0x1,
+0x1,0x1,0x1,0x1,0x800007c0,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39804,7 +39804,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003f1,0x1,
+0x1,0x1,0x1,0x1,0x800007c5,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3317
@@ -39864,7 +39864,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ae6,0x1,0x1,0x1,0x1,
+0x1,0x800007d7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3322
@@ -39877,7 +39877,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022bb,0x1,0x1,0x1,0x1,
+0x1,0x800007da,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3323
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39888,7 +39888,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022ee,
+0x1,0x1,0x1,0x1,0x1,0x800007dc,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3324
@@ -39901,7 +39901,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002016,0x1,0x1,0x1,0x1,
+0x1,0x800007dd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3325
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39913,7 +39913,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000007c,0x1,0x1,0x1,0x1,
+0x1,0x800007de,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3326
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -39941,25 +39941,25 @@
 0x1,0x1,0x1},
 // Transitions for state 3328
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002acb,0x1,
+0x1,0x1,0x1,0x1,0x800007f1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228a,0x1,0x1,0x1,0x1,0x1,
+0x800007f2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3329
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002acc,0x1,
+0x1,0x1,0x1,0x1,0x800007f3,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228b,0x1,0x1,0x1,0x1,0x1,
+0x800007f4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39971,7 +39971,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022aa,0x1,0x1,
+0x1,0x1,0x1,0x800007f5,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -39997,7 +39997,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a5f,0x1,0x1,0x1,0x1,
+0x1,0x800007f9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3333
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40009,7 +40009,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002259,0x1,0x1,0x1,0x1,0x1,
+0x800007fc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3334
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40020,7 +40020,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002118,
+0x1,0x1,0x1,0x1,0x1,0x800007fd,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3335
@@ -40031,7 +40031,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002240,0x1,0x1,
+0x1,0x1,0x1,0x80000804,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40045,7 +40045,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a01,0x1,0x1,0x1,
+0x1,0x1,0x80000818,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3337
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40055,7 +40055,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a02,0x1,0x1,0x1,0x1,0x1,
+0x80000819,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40068,7 +40068,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a06,
+0x1,0x1,0x1,0x1,0x1,0x8000081e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3339
@@ -40081,7 +40081,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a04,0x1,0x1,0x1,
+0x1,0x1,0x8000081f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3340
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40091,7 +40091,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c0,0x1,0x1,0x1,0x1,0x1,
+0x80000822,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40103,7 +40103,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000dd,0x1,0x1,0x1,0x1,0x1,
+0x80000823,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40115,7 +40115,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000fd,0x1,0x1,0x1,0x1,0x1,
+0x80000824,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40127,7 +40127,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000179,0x1,0x1,0x1,0x1,0x1,
+0x80000838,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40139,7 +40139,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000017a,0x1,0x1,0x1,0x1,0x1,
+0x80000839,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40152,7 +40152,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000017d,0x1,0x1,
+0x1,0x1,0x1,0x8000083a,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3346
@@ -40164,7 +40164,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000017e,0x1,0x1,
+0x1,0x1,0x1,0x8000083b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3347
@@ -40175,7 +40175,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002128,0x1,0x1,0x1,0x1,
+0x1,0x80000840,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40212,7 +40212,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002135,0x1,0x1,0x1,
+0x1,0x1,0x80000015,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3351
@@ -40246,7 +40246,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022be,0x1,0x1,
+0x1,0x1,0x1,0x80000031,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40261,7 +40261,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000237c,0x1,0x1,0x1,0x1,
+0x1,0x80000035,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3355
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40297,7 +40297,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000224d,0x1,0x1,0x1,0x1,0x1,
+0x8000004a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3358
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40356,7 +40356,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000223d,0x1,0x1,0x1,
+0x1,0x1,0x80000054,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3363
@@ -40403,7 +40403,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002235,0x1,0x1,0x1,0x1,0x1,
+0x80000063,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40415,7 +40415,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002235,0x1,0x1,0x1,0x1,0x1,
+0x80000064,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -40429,7 +40429,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029b0,
+0x1,0x1,0x1,0x1,0x1,0x80000065,
 0x1,0x1,0x1},
 // Transitions for state 3369
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40452,7 +40452,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000226c,0x1,0x1,
+0x1,0x1,0x1,0x8000006c,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3371
@@ -40462,7 +40462,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800025ef,0x1,
+0x1,0x1,0x1,0x1,0x80000070,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40477,7 +40477,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a00,0x1,0x1,
+0x1,0x1,0x1,0x80000072,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3373
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40525,7 +40525,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002605,0x1,0x1,0x1,0x1,
+0x1,0x80000076,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3377
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40609,7 +40609,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002261,
+0x1,0x1,0x1,0x1,0x1,0x80000089,
 0x1,0x1,0x1},
 // Transitions for state 3384
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40633,7 +40633,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000229e,0x1,0x1,0x1,
+0x1,0x1,0x800000a5,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3386
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40693,7 +40693,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000212d,0x1,0x1,0x1,
+0x1,0x1,0x800000dd,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3391
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40705,7 +40705,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002230,0x1,0x1,
+0x1,0x1,0x1,0x800000e5,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3392
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40716,7 +40716,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a50,0x1,0x1,0x1,
+0x1,0x1,0x800000e7,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3393
@@ -40726,7 +40726,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000b8,0x1,0x1,0x1,
+0x1,0x1,0x800000eb,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40741,7 +40741,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029b2,
+0x1,0x1,0x1,0x1,0x1,0x800000ec,
 0x1,0x1,0x1},
 // Transitions for state 3395
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40825,7 +40825,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029c2,0x1,0x1,0x1,0x1,
+0x1,0x8000010a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3402
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40873,7 +40873,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002254,0x1,0x1,0x1,0x1,0x1,
+0x80000114,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3406
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40897,7 +40897,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a6d,0x1,0x1,
+0x1,0x1,0x1,0x8000011c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3408
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40956,8 +40956,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002938,0x1,0x1,0x1,0x1,
-0x1,0x80002935,0x1,0x1,0x1,0x1,
+0x1,0x80000133,0x1,0x1,0x1,0x1,
+0x1,0x80000134,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3413
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -40968,7 +40968,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000293d,
+0x1,0x1,0x1,0x1,0x1,0x80000138,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3414
@@ -40992,7 +40992,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000293c,0x1,0x1,0x1,
+0x1,0x1,0x80000143,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3416
@@ -41066,7 +41066,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000290f,0x1,0x1},
+0x80000159,0x1,0x1},
 // Transitions for state 3422
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41077,7 +41077,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002021,0x1,0x1,0x1,0x1,
+0x1,0x80000161,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3423
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41101,7 +41101,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a77,0x1,0x1,0x1,0x1,0x1,
+0x80000164,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3425
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41113,7 +41113,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029b1,
+0x1,0x1,0x1,0x1,0x1,0x80000169,
 0x1,0x1,0x1},
 // Transitions for state 3426
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41134,7 +41134,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022c4,
+0x1,0x1,0x1,0x1,0x1,0x80000176,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41146,7 +41146,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022c4,
+0x1,0x1,0x1,0x1,0x1,0x80000177,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41170,7 +41170,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003dd,0x1,0x1,0x1,
+0x1,0x1,0x8000017c,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41233,7 +41233,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002214,0x1,0x1,0x1,
+0x1,0x1,0x80000190,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3436
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41375,7 +41375,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022a4,0x1,0x1,0x1,0x1,0x1,
+0x800001b1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -41399,7 +41399,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800029a6,0x1,0x1,0x1,0x1,0x1,
+0x800001c2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -41425,7 +41425,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002208,0x1,0x1,
+0x1,0x1,0x1,0x800001df,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3452
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41484,7 +41484,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80000395,0x1,0x1,
+0x1,0x1,0x1,0x800001f9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3457
@@ -41496,7 +41496,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003b5,0x1,0x1,
+0x1,0x1,0x1,0x800001fa,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3458
@@ -41508,7 +41508,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002255,0x1,0x1,
+0x1,0x1,0x1,0x800001fd,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3459
@@ -41549,7 +41549,7 @@
 0x1,0x1,0x1},
 // Transitions for state 3462
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a78,0x1,0x1,
+0x1,0x1,0x1,0x80000207,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41676,7 +41676,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a82,0x1,
+0x1,0x1,0x1,0x1,0x80000262,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3473
@@ -41713,7 +41713,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7c,0x1,0x1,
+0x1,0x1,0x1,0x8000028f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3476
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41761,7 +41761,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002277,0x1,0x1,0x1,
+0x1,0x1,0x80000295,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3480
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41785,7 +41785,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002948,0x1,0x1,0x1,0x1,
+0x1,0x800002a1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3482
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -41941,7 +41941,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021d2,0x1,0x1,0x1,
+0x1,0x1,0x800002e2,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3495
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42022,7 +42022,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a3c,
+0x1,0x1,0x1,0x1,0x1,0x800002f0,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42049,7 +42049,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022f5,0x1,0x1,
+0x1,0x1,0x1,0x80000300,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3504
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42085,7 +42085,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000291f,0x1,0x1,0x1,
+0x1,0x1,0x8000033f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3507
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42096,7 +42096,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002973,0x1,0x1,0x1,
+0x1,0x1,0x80000344,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3508
@@ -42106,10 +42106,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000298f,
+0x1,0x1,0x1,0x1,0x1,0x80000351,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000298d,0x1,
+0x1,0x1,0x1,0x1,0x80000352,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3509
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42121,7 +42121,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002967,0x1,0x1,0x1,0x1,
+0x1,0x8000035e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3510
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42287,7 +42287,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022a3,0x1,0x1,0x1,0x1,0x1,
+0x8000037a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -42360,7 +42360,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a81,0x1,
+0x1,0x1,0x1,0x1,0x8000038f,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3530
@@ -42385,7 +42385,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022d6,0x1,0x1,
+0x1,0x1,0x1,0x80000394,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3532
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42445,7 +42445,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002276,0x1,0x1,0x1,0x1,
+0x1,0x8000039a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3537
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42468,7 +42468,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002272,0x1,0x1,0x1,
+0x1,0x1,0x8000039c,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3539
@@ -42649,7 +42649,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a34,0x1,0x1,0x1,
+0x1,0x1,0x800003d1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3554
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42683,7 +42683,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025ca,0x1,0x1,0x1,0x1,0x1,
+0x800003d7,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -42709,7 +42709,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7b,0x1,0x1,
+0x1,0x1,0x1,0x800003f7,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3559
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42733,7 +42733,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002966,0x1,0x1,0x1,0x1,
+0x1,0x800003fd,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3561
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42755,7 +42755,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002720,0x1,0x1,0x1,0x1,0x1,
+0x80000403,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -42817,7 +42817,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a2a,0x1,
+0x1,0x1,0x1,0x1,0x8000041e,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3568
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42854,7 +42854,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002249,0x1},
+0x1,0x80000436,0x1},
 // Transitions for state 3571
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42864,7 +42864,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000266e,0x1,0x1,0x1,0x1,
+0x1,0x80000438,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3572
@@ -42890,7 +42890,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002197,0x1,0x1},
+0x8000044c,0x1,0x1},
 // Transitions for state 3574
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -42923,7 +42923,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000000a,0x1,0x1,0x1,0x1,0x1,
+0x80000457,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -42937,7 +42937,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002204,0x1,0x1,0x1,
+0x1,0x1,0x80000459,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3578
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43020,7 +43020,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002060,0x1,0x1,0x1,0x1,0x1,
+0x80000487,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3585
@@ -43150,7 +43150,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002209,0x800022f7,0x800022f6,0x1,
+0x1,0x1,0x800004a0,0x800004a1,0x800004a2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43177,7 +43177,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000226e,0x1,0x1,0x1,
+0x1,0x1,0x800004a6,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3598
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43198,7 +43198,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000220c,0x800022fe,0x800022fd,0x1,
+0x1,0x1,0x800004af,0x800004b0,0x800004b1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43333,7 +43333,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a14,0x1,0x1,
+0x1,0x1,0x1,0x800004ce,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3611
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43345,7 +43345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002aaf,0x1,0x1,0x1,0x1,0x1,
+0x800004d3,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3612
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43391,7 +43391,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022e2,0x1,0x1,0x1,0x1,0x1,
+0x800004e8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43403,7 +43403,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022e3,0x1,0x1,0x1,0x1,0x1,
+0x800004e9,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43417,7 +43417,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002282,0x1,0x1,
+0x1,0x1,0x1,0x800004ed,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3618
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43429,7 +43429,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ab0,0x1,0x1,0x1,0x1,0x1,
+0x800004f1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3619
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43441,7 +43441,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002283,0x1,0x1,
+0x1,0x1,0x1,0x800004f5,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3620
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43464,7 +43464,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800029de,0x1,0x1,
+0x1,0x1,0x1,0x8000050d,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3622
@@ -43475,7 +43475,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b4,0x1,0x1,0x1,0x1,0x1,
+0x80000511,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43487,7 +43487,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b5,0x1,0x1,0x1,0x1,0x1,
+0x80000513,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43502,7 +43502,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002196,0x1,0x1},
+0x80000518,0x1,0x1},
 // Transitions for state 3625
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43513,7 +43513,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800029bb,0x1,0x1,0x1,
+0x1,0x1,0x80000536,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3626
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43524,7 +43524,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000039f,0x1,0x1,
+0x1,0x1,0x1,0x8000053d,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3627
@@ -43536,7 +43536,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003bf,0x1,0x1,
+0x1,0x1,0x1,0x8000053e,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3628
@@ -43559,7 +43559,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002134,0x1,0x1,0x1,0x1,
+0x1,0x8000054d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43571,7 +43571,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a57,0x1,0x1,0x1,0x1,0x1,
+0x80000552,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43597,7 +43597,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000203e,0x1,0x1,0x1,0x1,
+0x1,0x80000562,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3633
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43656,7 +43656,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002031,0x1,0x1,0x1,0x1,0x1,
+0x80000573,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3638
@@ -43679,7 +43679,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000210e,0x1,0x1,
+0x1,0x1,0x1,0x80000580,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -43705,7 +43705,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a22,0x1,0x1,0x1,0x1,
+0x1,0x80000585,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3642
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43728,7 +43728,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a26,0x1,0x1,0x1,
+0x1,0x1,0x8000058b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3644
@@ -43740,7 +43740,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002a27,0x1,
+0x1,0x1,0x1,0x1,0x8000058c,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3645
@@ -43848,7 +43848,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000227e,0x1,0x1,0x1,
+0x1,0x1,0x800005a4,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3654
@@ -43861,7 +43861,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000220f,0x1,0x1,
+0x1,0x1,0x1,0x800005ac,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3655
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43933,7 +43933,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a16,0x1,0x1,
+0x1,0x1,0x1,0x800005c4,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3661
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43945,7 +43945,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000225f,0x1,0x1,0x1,0x1,0x1,
+0x800005c6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3662
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43969,7 +43969,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002920,0x1,0x1,0x1,
+0x1,0x1,0x800005da,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3664
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -43980,7 +43980,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002974,0x1,0x1,0x1,
+0x1,0x1,0x800005e0,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3665
@@ -44002,10 +44002,10 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000298e,
+0x1,0x1,0x1,0x1,0x1,0x800005ef,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002990,0x1,
+0x1,0x1,0x1,0x1,0x800005f0,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3667
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44017,7 +44017,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002969,0x1,0x1,0x1,0x1,
+0x1,0x800005fa,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3668
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44027,7 +44027,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000211b,0x1,0x1,0x1,0x1,0x1,
+0x80000600,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -44257,7 +44257,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a35,0x1,0x1,0x1,
+0x1,0x1,0x80000643,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3688
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44329,7 +44329,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002968,0x1,0x1,0x1,0x1,
+0x1,0x80000659,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3694
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44354,7 +44354,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002198,0x1,0x1},
+0x80000677,0x1,0x1},
 // Transitions for state 3696
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44449,7 +44449,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a24,0x1,0x1,0x1,
+0x1,0x1,0x8000069a,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3704
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44461,7 +44461,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002972,0x1,0x1,0x1,0x1,
+0x1,0x8000069b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3705
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44569,7 +44569,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ac3,0x1,0x1,
+0x1,0x1,0x1,0x800006d9,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3714
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44581,7 +44581,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ac1,0x1,0x1,
+0x1,0x1,0x1,0x800006da,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3715
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44593,7 +44593,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002abf,0x1,0x1,0x1,
+0x1,0x1,0x800006dd,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3716
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44605,7 +44605,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002979,0x1,0x1,0x1,0x1,
+0x1,0x800006de,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3717
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44712,7 +44712,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000227f,0x1,0x1,0x1,
+0x1,0x1,0x800006f4,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3726
@@ -44734,7 +44734,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ad8,0x1,0x1,
+0x1,0x1,0x1,0x800006ff,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44749,7 +44749,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ac4,0x1,0x1,
+0x1,0x1,0x1,0x80000702,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3729
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44772,7 +44772,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027c9,0x1,0x1,0x1,0x1,
+0x1,0x80000705,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3731
@@ -44782,7 +44782,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ad7,0x1,0x1,
+0x1,0x1,0x1,0x80000706,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44797,7 +44797,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000297b,0x1,0x1,0x1,0x1,
+0x1,0x80000707,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3733
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44809,7 +44809,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002ac2,0x1,0x1,
+0x1,0x1,0x1,0x80000708,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3734
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44821,7 +44821,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002ac0,0x1,0x1,0x1,
+0x1,0x1,0x8000070b,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3735
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44846,7 +44846,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002199,0x1,0x1},
+0x80000718,0x1,0x1},
 // Transitions for state 3737
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -44988,7 +44988,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ada,0x1,0x1,0x1,0x1,0x1,
+0x8000074a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3749
@@ -45037,7 +45037,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a39,0x1,0x1,0x1,
+0x1,0x1,0x8000075a,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3753
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45047,7 +45047,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a3b,0x1,0x1,0x1,0x1,0x1,
+0x8000075c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45146,7 +45146,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002191,0x1,0x1},
+0x80000795,0x1,0x1},
 // Transitions for state 3762
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45158,7 +45158,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d1,0x1,0x1},
+0x80000796,0x1,0x1},
 // Transitions for state 3763
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45170,7 +45170,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002191,0x1,0x1},
+0x80000797,0x1,0x1},
 // Transitions for state 3764
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1015,0x1,0x1,0x1,0x1,0x1,
@@ -45264,7 +45264,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003a5,0x1,0x1,
+0x1,0x1,0x1,0x800007a6,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3772
@@ -45276,7 +45276,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003c5,0x1,0x1,
+0x1,0x1,0x1,0x800007a7,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3773
@@ -45323,7 +45323,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800029a7,0x1,0x1,0x1,0x1,0x1,
+0x800007bb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45467,7 +45467,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000299a,0x1,0x1,0x1,
+0x1,0x1,0x800007f6,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45493,7 +45493,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021dd,0x1,0x1,0x1,0x1,
+0x1,0x80000848,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3791
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45503,7 +45503,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a58,0x1,0x1,0x1,0x1,0x1,
+0x80000022,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45514,8 +45514,8 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800029a8,0x800029a9,0x800029aa,0x800029ab,
-0x800029ac,0x800029ad,0x800029ae,0x800029af,0x1,0x1,
+0x1,0x1,0x80000028,0x80000029,0x8000002a,0x8000002b,
+0x8000002c,0x8000002d,0x8000002e,0x8000002f,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45526,7 +45526,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000299d,
+0x1,0x1,0x1,0x1,0x1,0x80000032,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45553,7 +45553,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000224a,0x1,0x1,0x1,0x1,0x1,
+0x80000042,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3796
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45565,7 +45565,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002233,0x1,0x1,
+0x1,0x1,0x1,0x8000004f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3797
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45575,7 +45575,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000224c,0x1,0x1,0x1,
+0x1,0x1,0x80000051,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45635,7 +45635,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002305,0x1,0x1,0x1,0x1,0x1,
+0x8000005b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45648,7 +45648,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023b6,0x1,0x1,0x1,0x1,0x1,
+0x8000005d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3804
@@ -45673,7 +45673,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a01,0x1,0x1,0x1,
+0x1,0x1,0x80000073,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3806
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45696,7 +45696,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a06,
+0x1,0x1,0x1,0x1,0x1,0x80000075,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3808
@@ -45721,7 +45721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a04,0x1,0x1,0x1,
+0x1,0x1,0x80000079,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3810
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45731,7 +45731,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022c0,0x1,0x1,0x1,0x1,0x1,
+0x8000007b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -45781,7 +45781,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000229f,0x1,0x1,0x1,
+0x1,0x1,0x800000a4,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3815
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45793,7 +45793,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022a0,0x1,0x1,0x1,
+0x1,0x1,0x800000a6,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3816
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45802,7 +45802,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800027c8,0x1,0x1,
+0x1,0x1,0x1,0x800000c8,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45816,7 +45816,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a49,
+0x1,0x1,0x1,0x1,0x1,0x800000d5,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3818
@@ -45883,8 +45883,8 @@
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800000ae,
-0x800024c8,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x80000101,
+0x80000102,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x103b,0x1,0x103c,0x103d,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45949,7 +45949,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a10,0x1,0x1,
+0x1,0x1,0x1,0x80000108,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3829
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -45985,7 +45985,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002663,0x1,0x1,
+0x1,0x1,0x1,0x8000010f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3832
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46068,7 +46068,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002a48,
+0x1,0x1,0x1,0x1,0x1,0x8000013b,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3839
@@ -46091,7 +46091,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ce,0x1,0x1,0x1,0x1,0x1,
+0x80000146,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -46129,7 +46129,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002232,0x1,0x1,
+0x1,0x1,0x1,0x8000014d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3844
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46138,7 +46138,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002911,
+0x1,0x1,0x1,0x1,0x1,0x80000163,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46201,7 +46201,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002251,0x1,0x1,
+0x1,0x1,0x1,0x8000018d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3850
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46212,7 +46212,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002250,0x1,0x1,0x1,0x1,
+0x1,0x8000018e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3851
@@ -46225,7 +46225,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002238,0x1,0x1,0x1,
+0x1,0x1,0x8000018f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3852
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46442,7 +46442,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002910,0x1,0x1},
+0x800001b3,0x1,0x1},
 // Transitions for state 3870
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46453,7 +46453,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800027ff,0x1,0x1,0x1,0x1,
+0x1,0x800001c5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3871
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46465,7 +46465,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800023e7,0x1,0x1,0x1,
+0x1,0x1,0x800001e0,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3872
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46477,7 +46477,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002205,0x1,0x1,
+0x1,0x1,0x1,0x800001e7,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3873
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46548,7 +46548,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029e5,0x1,0x1,0x1,0x1,
+0x1,0x80000208,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3879
@@ -46645,7 +46645,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a0d,0x1,0x1,
+0x1,0x1,0x1,0x80000235,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3887
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46657,7 +46657,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7e,0x1,0x1,
+0x1,0x1,0x1,0x8000025e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3888
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46668,7 +46668,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a84,0x1,0x1,0x1,0x1,
+0x1,0x80000263,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3889
@@ -46682,7 +46682,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a8a,0x1},
+0x1,0x80000273,0x1},
 // Transitions for state 3890
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1071,0x1072,
@@ -46778,7 +46778,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002925,0x1,0x1},
+0x800002ae,0x1,0x1},
 // Transitions for state 3898
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46790,7 +46790,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002926,0x1,0x1},
+0x800002af,0x1,0x1},
 // Transitions for state 3899
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46871,7 +46871,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002110,0x1,0x1,0x1,0x1,0x1,
+0x800002dd,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -46885,7 +46885,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002111,0x1,0x1,
+0x1,0x1,0x1,0x800002de,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3907
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46895,7 +46895,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800029dd,0x1,0x1,0x1,0x1,0x1,
+0x800002e6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -46909,7 +46909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002124,0x1,0x1,0x1,
+0x1,0x1,0x800002eb,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3909
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -46920,7 +46920,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000222b,0x1,0x1,0x1,0x1,
+0x1,0x800002ec,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3910
@@ -46932,7 +46932,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022ba,0x1,0x1,0x1,0x1,
+0x1,0x800002ed,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3911
@@ -46956,7 +46956,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002a17,0x1,0x1,0x1,0x1,0x1,
+0x800002ef,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3913
@@ -46981,7 +46981,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029b4,
+0x1,0x1,0x1,0x1,0x1,0x80000330,
 0x1,0x1,0x1},
 // Transitions for state 3915
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47005,7 +47005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000294b,0x1,0x1,0x1,0x1,
+0x1,0x8000035f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3917
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47257,7 +47257,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7d,0x1,0x1,
+0x1,0x1,0x1,0x8000038b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3938
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47269,7 +47269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a83,0x1,0x1,0x1,0x1,
+0x1,0x80000390,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3939
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47353,7 +47353,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002aa1,0x1,0x1,0x1,
+0x1,0x1,0x8000039b,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3946
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47389,7 +47389,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000231e,0x1,0x1,0x1,0x1,
+0x1,0x800003af,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3949
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47426,7 +47426,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a89,0x1},
+0x1,0x800003b8,0x1},
 // Transitions for state 3952
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47557,7 +47557,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000231f,0x1,0x1,0x1,0x1,
+0x1,0x800003dc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3963
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47569,7 +47569,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000294a,0x1,0x1,0x1,0x1,
+0x1,0x800003fc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3964
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47616,7 +47616,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021a5,
+0x1,0x1,0x1,0x1,0x1,0x80000409,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3968
@@ -47676,7 +47676,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800022b8,
+0x1,0x1,0x1,0x1,0x1,0x8000042c,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3973
@@ -47689,7 +47689,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002115,0x1,0x1,0x1,
+0x1,0x1,0x80000439,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3974
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47701,7 +47701,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a6d,0x1,0x1,
+0x1,0x1,0x1,0x80000443,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3975
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -47880,7 +47880,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002260,0x1,0x1,0x1,0x1,
+0x1,0x80000491,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3990
@@ -47929,7 +47929,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022f5,0x1,0x1,
+0x1,0x1,0x1,0x8000049e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 3994
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48059,7 +48059,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002241,0x1,0x1,0x1,0x1,0x1,
+0x800004c5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -48193,7 +48193,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a36,0x1,0x1,0x1,
+0x1,0x1,0x8000055e,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4016
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48228,12 +48228,12 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002225,0x1,0x1,0x1,0x1,
+0x1,0x80000568,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4019
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002202,0x1,0x1,
+0x1,0x1,0x1,0x8000056c,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48265,7 +48265,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a23,0x1,0x1,0x1,0x1,
+0x1,0x80000583,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4022
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48301,7 +48301,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a15,0x1,0x1,
+0x1,0x1,0x1,0x8000058f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4025
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48337,7 +48337,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000227a,0x1,0x1,0x1,
+0x1,0x1,0x8000059c,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4028
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48361,7 +48361,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ab5,0x1,0x1,0x1,0x1,0x1,
+0x800005a2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4030
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48372,7 +48372,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022e8,0x1,0x1,0x1,
+0x1,0x1,0x800005a3,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4031
@@ -48385,7 +48385,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000232e,0x1,0x1,0x1,0x1,
+0x1,0x800005ad,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4032
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48395,7 +48395,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002312,0x1,0x1,0x1,0x1,0x1,
+0x800005ae,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -48407,7 +48407,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002313,0x1,0x1,0x1,0x1,
+0x1,0x800005af,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -48445,7 +48445,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029b3,
+0x1,0x1,0x1,0x1,0x1,0x800005ce,
 0x1,0x1,0x1},
 // Transitions for state 4037
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48469,7 +48469,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000211c,0x1,0x1,
+0x1,0x1,0x1,0x80000601,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4039
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48623,7 +48623,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022a2,0x1,0x1,0x1,0x1,0x1,
+0x80000627,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -48721,7 +48721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a12,0x1,0x1,
+0x1,0x1,0x1,0x80000647,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4060
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48743,7 +48743,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800029ce,0x1,
+0x1,0x1,0x1,0x1,0x80000657,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -48769,7 +48769,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a13,0x1,0x1,
+0x1,0x1,0x1,0x8000066d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4064
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48781,7 +48781,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002216,0x1,0x1,0x1,
+0x1,0x1,0x8000067b,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4065
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48814,7 +48814,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002223,
+0x1,0x1,0x1,0x1,0x1,0x80000688,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48888,7 +48888,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029e4,0x1,0x1,0x1,0x1,
+0x1,0x800006a0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4074
@@ -48913,7 +48913,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000228f,0x1,0x1,
+0x1,0x1,0x1,0x800006b7,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4076
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48925,7 +48925,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002290,0x1,0x1,
+0x1,0x1,0x1,0x800006bb,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4077
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -48985,7 +48985,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002286,0x1,0x1,0x1,0x1,0x1,
+0x800006e1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4082
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49045,7 +49045,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000227b,0x1,0x1,0x1,
+0x1,0x1,0x800006ec,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4087
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49069,7 +49069,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ab6,0x1,0x1,0x1,0x1,0x1,
+0x800006f2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4089
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49080,7 +49080,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022e9,0x1,0x1,0x1,
+0x1,0x1,0x800006f3,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4090
@@ -49093,7 +49093,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000220b,0x1,0x1,
+0x1,0x1,0x1,0x800006f5,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4091
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49105,7 +49105,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002283,0x1,0x1,
+0x1,0x1,0x1,0x80000703,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4092
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49117,7 +49117,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002287,0x1,0x1,0x1,0x1,0x1,
+0x8000070e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4093
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49164,7 +49164,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003d1,0x1,0x1,0x1,
+0x1,0x1,0x8000072f,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4097
@@ -49188,7 +49188,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000223c,0x1,0x1,0x1,
+0x1,0x1,0x80000732,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4099
@@ -49261,7 +49261,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a31,0x1,0x1,0x1,0x1,
+0x1,0x80000741,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4105
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49271,7 +49271,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025b5,0x1,0x1,0x1,0x1,0x1,
+0x8000074f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -49285,7 +49285,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a3a,0x1,0x1,0x1,
+0x1,0x1,0x80000758,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4107
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49308,7 +49308,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800023e2,0x1,0x1,0x1,
+0x1,0x1,0x8000075d,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4109
@@ -49333,7 +49333,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002949,0x1,0x1,0x1,0x1,
+0x1,0x8000076e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4111
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49345,7 +49345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000231c,0x1,0x1,0x1,0x1,
+0x1,0x80000785,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4112
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49357,7 +49357,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000005f,0x1,0x1,0x1,0x1,
+0x1,0x8000078b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4113
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49525,7 +49525,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000231d,0x1,0x1,0x1,0x1,
+0x1,0x800007ac,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4127
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49546,7 +49546,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003f0,0x1,0x1,0x1,
+0x1,0x1,0x800007be,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49582,7 +49582,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003c2,0x1,0x1,0x1,
+0x1,0x1,0x800007c6,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49618,7 +49618,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800003d1,0x1,0x1,0x1,
+0x1,0x1,0x800007cb,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49703,7 +49703,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002035,0x1,0x1,0x1,0x1,0x1,
+0x80000053,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -49717,7 +49717,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022cd,0x1,0x1,0x1,0x1,0x1,
+0x80000055,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4143
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49727,7 +49727,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002216,0x1,0x1,
+0x1,0x1,0x1,0x80000056,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -49753,7 +49753,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a02,0x1,0x1,0x1,
+0x1,0x1,0x80000074,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4146
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49825,7 +49825,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000b7,0x1,0x1,
+0x1,0x1,0x1,0x800000ee,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4152
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49837,7 +49837,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000b7,0x1,0x1,
+0x1,0x1,0x1,0x800000ef,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4153
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49848,7 +49848,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002713,0x1,0x1,0x1,0x1,0x1,
+0x800000f5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4154
@@ -49909,7 +49909,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002299,0x1,0x1,
+0x1,0x1,0x1,0x80000100,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4159
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -49993,7 +49993,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002102,0x1,0x1,0x1,
+0x1,0x1,0x8000011a,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4166
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50005,7 +50005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002261,0x1,0x1,
+0x1,0x1,0x1,0x8000011d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4167
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50029,7 +50029,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002210,0x1,0x1,
+0x1,0x1,0x1,0x80000124,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4169
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50147,7 +50147,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022a1,0x1,0x1,0x1,0x1,0x1,
+0x80000191,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -50185,7 +50185,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800000a8,0x1,0x1,
+0x1,0x1,0x1,0x80000194,0x1,0x1,
 0x1161,0x1,0x1},
 // Transitions for state 4182
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50258,7 +50258,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002193,0x1,0x1},
+0x800001a1,0x1,0x1},
 // Transitions for state 4188
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50270,7 +50270,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d3,0x1,0x1},
+0x800001a2,0x1,0x1},
 // Transitions for state 4189
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50282,7 +50282,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002193,0x1,0x1},
+0x800001a3,0x1,0x1},
 // Transitions for state 4190
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50291,7 +50291,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000311,0x1,0x1,0x1,0x1,0x1,
+0x800001a6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -50594,7 +50594,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a86,0x1},
+0x1,0x80000290,0x1},
 // Transitions for state 4216
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50605,7 +50605,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022db,0x1,0x1,0x1,
+0x1,0x1,0x80000293,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4217
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50629,7 +50629,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002269,0x1,0x1,0x1,0x1,0x1,
+0x80000297,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4219
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50641,7 +50641,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002665,0x1,0x1,
+0x1,0x1,0x1,0x800002a8,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4220
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50712,7 +50712,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000224f,0x1,0x1,0x1,0x1,
+0x1,0x800002be,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4226
@@ -50786,7 +50786,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002190,0x1,0x1},
+0x80000364,0x1,0x1},
 // Transitions for state 4232
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50798,7 +50798,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d0,0x1,0x1},
+0x80000365,0x1,0x1},
 // Transitions for state 4233
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50810,7 +50810,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002190,0x1,0x1},
+0x80000366,0x1,0x1},
 // Transitions for state 4234
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -50857,7 +50857,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000230a,0x1,0x1,0x1,0x1,
+0x1,0x8000036f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4238
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51037,7 +51037,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022da,0x1,0x1,0x1,0x1,
+0x1,0x80000395,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4253
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51107,7 +51107,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002272,0x1,0x1,0x1,0x1,0x1,
+0x8000039e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -51265,7 +51265,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002268,0x1,0x1,0x1,0x1,0x1,
+0x800003fe,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4272
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51323,7 +51323,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002133,0x1,0x1,0x1,0x1,
+0x1,0x80000412,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -51337,7 +51337,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002213,0x1,0x1,0x1,
+0x1,0x1,0x8000041f,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4278
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51385,7 +51385,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7e,0x1,0x1,
+0x1,0x1,0x1,0x80000460,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4282
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51445,7 +51445,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002a7d,0x1,0x1,
+0x1,0x1,0x1,0x8000047c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4287
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51480,7 +51480,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000226d,
+0x1,0x1,0x1,0x1,0x1,0x8000048e,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4290
@@ -51529,7 +51529,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002204,0x1,0x1,0x1,
+0x1,0x1,0x80000493,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4294
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51709,7 +51709,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002282,0x1,0x1,
+0x1,0x1,0x1,0x800004bd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4309
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51768,7 +51768,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002226,0x1,0x1,0x1,0x1,
+0x1,0x800004cb,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4314
@@ -51802,7 +51802,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x80002224,
+0x1,0x1,0x1,0x1,0x1,0x800004e1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51829,7 +51829,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002288,0x1,0x1,0x1,0x1,0x1,
+0x800004ee,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4319
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51841,7 +51841,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002289,0x1,0x1,0x1,0x1,0x1,
+0x800004f6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4320
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -51875,7 +51875,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023de,0x1,0x1,0x1,0x1,0x1,
+0x80000563,0x1,0x1,0x1,0x1,0x1,
 0x11e4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -51900,7 +51900,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022d4,0x1,0x1,0x1,0x1,0x1,
+0x8000057d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4325
@@ -51913,7 +51913,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800000b1,0x1,0x1,0x1,
+0x1,0x1,0x80000589,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4326
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52009,7 +52009,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000211a,0x1,0x1,0x1,
+0x1,0x1,0x800005e7,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4334
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52417,7 +52417,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002660,0x1,0x1,
+0x1,0x1,0x1,0x800006ae,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4368
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52501,7 +52501,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ac5,0x1,0x1,0x1,0x1,0x1,
+0x800006e2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4375
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52525,7 +52525,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228a,0x1,0x1,0x1,0x1,0x1,
+0x800006e4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4377
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52597,7 +52597,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ac6,0x1,0x1,0x1,0x1,0x1,
+0x8000070f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4383
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52609,7 +52609,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228b,0x1,0x1,0x1,0x1,0x1,
+0x80000710,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4384
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52619,7 +52619,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002234,0x1,0x1,0x1,0x1,0x1,
+0x8000072b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -52631,7 +52631,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002234,0x1,0x1,0x1,0x1,0x1,
+0x8000072c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -52667,7 +52667,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002009,0x1,0x1,0x1,0x1,0x1,
+0x80000735,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -52717,7 +52717,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1229,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x122a,0x1,0x1,0x1,0x1,
-0x8000225c,0x122b,0x1,0x1,0x1,0x1,
+0x80000753,0x122b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4393
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52729,7 +52729,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800020db,0x1,0x1,
+0x1,0x1,0x1,0x80000759,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4394
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52789,7 +52789,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000228e,0x1,0x1,0x1,
+0x1,0x1,0x80000790,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4399
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -52956,7 +52956,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000221d,0x1,
+0x1,0x1,0x1,0x1,0x800007c2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4413
@@ -53065,7 +53065,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000212c,0x1,0x1,0x1,
+0x1,0x1,0x80000068,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4422
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53149,7 +53149,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000229b,0x1,0x1,
+0x1,0x1,0x1,0x800000fd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4429
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53197,7 +53197,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002295,0x1,0x1,0x1,
+0x1,0x1,0x80000104,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4433
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53245,7 +53245,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002201,0x1,0x1,
+0x1,0x1,0x1,0x80000119,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4437
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53303,7 +53303,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022cf,0x1,0x1,0x1,0x1,0x1,
+0x80000147,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -53605,7 +53605,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a96,0x1,0x1,0x1,0x1,
+0x1,0x800001ff,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4467
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53627,7 +53627,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002242,0x1,0x1,0x1,0x1,0x1,
+0x80000203,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -53723,7 +53723,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002131,0x1,0x1,0x1,0x1,
+0x1,0x80000234,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -53809,7 +53809,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a8c,0x1,0x1,0x1,
+0x1,0x1,0x80000294,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4484
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53874,7 +53874,7 @@
 // Transitions for state 4489
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002148,0x1,0x1,0x1,
+0x1,0x1,0x800002dc,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -53915,7 +53915,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002112,0x1,0x1,0x1,0x1,
+0x1,0x80000339,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -54157,7 +54157,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021bc,0x1,0x1,0x1,0x1,
+0x1,0x80000385,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4513
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54170,7 +54170,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a85,0x1},
+0x1,0x80000393,0x1},
 // Transitions for state 4514
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54181,7 +54181,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a8b,0x1,0x1,0x1,0x1,
+0x1,0x80000396,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4515
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54242,7 +54242,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021da,0x1,0x1},
+0x800003b0,0x1,0x1},
 // Transitions for state 4520
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54251,7 +54251,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023b0,0x1,0x1,0x1,0x1,0x1,
+0x800003b6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -54336,7 +54336,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800027fc,0x1,
+0x1,0x1,0x1,0x1,0x800003c7,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4528
@@ -54420,7 +54420,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021a7,0x1,0x1,
+0x1,0x1,0x1,0x80000407,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4535
@@ -54433,7 +54433,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021a4,0x1,0x1,
+0x1,0x1,0x1,0x80000408,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4536
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54530,7 +54530,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021cd,0x1,0x1},
+0x80000476,0x1,0x1},
 // Transitions for state 4544
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54542,7 +54542,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000219a,0x1,0x1},
+0x80000477,0x1,0x1},
 // Transitions for state 4545
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54613,7 +54613,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002209,0x1,0x1,
+0x1,0x1,0x1,0x80000490,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4551
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54637,7 +54637,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000226f,0x1,0x1,0x1,0x1,
+0x1,0x80000494,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4553
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54925,7 +54925,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ac5,0x1,0x1,0x1,0x1,0x1,
+0x800004ef,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4577
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -54937,7 +54937,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ac6,0x1,0x1,0x1,0x1,0x1,
+0x800004f7,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4578
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55010,7 +55010,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ab7,0x1},
+0x1,0x8000059a,0x1},
 // Transitions for state 4584
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55080,7 +55080,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002237,0x1,0x1,
+0x1,0x1,0x1,0x800005b1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4590
@@ -55154,7 +55154,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002192,0x1,0x1},
+0x80000615,0x1,0x1},
 // Transitions for state 4596
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55166,7 +55166,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d2,0x1,0x1},
+0x80000616,0x1,0x1},
 // Transitions for state 4597
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55178,7 +55178,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002192,0x1,0x1},
+0x80000617,0x1,0x1},
 // Transitions for state 4598
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55225,7 +55225,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000230b,0x1,0x1,0x1,0x1,
+0x1,0x80000620,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4602
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55391,7 +55391,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023b1,0x1,0x1,0x1,0x1,0x1,
+0x8000063a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -55525,7 +55525,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002291,0x1,0x1,0x1,0x1,0x1,
+0x800006b8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4627
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55537,7 +55537,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002292,0x1,0x1,0x1,0x1,0x1,
+0x800006bc,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4628
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55633,7 +55633,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002acb,0x1,0x1,0x1,0x1,0x1,
+0x800006e5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4636
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55646,7 +55646,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ab8,0x1},
+0x1,0x800006ea,0x1},
 // Transitions for state 4637
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55729,7 +55729,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002acc,0x1,0x1,0x1,0x1,0x1,
+0x80000711,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4644
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55751,7 +55751,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000205f,0x1,0x1,0x1,0x1,0x1,
+0x80000733,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -55764,7 +55764,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002243,0x1,0x1,0x1,0x1,
+0x1,0x8000073c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4647
@@ -55787,7 +55787,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002248,0x1,0x1,0x1,0x1,0x1,
+0x8000073e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -55859,7 +55859,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800023df,0x1,0x1,0x1,0x1,0x1,
+0x8000078c,0x1,0x1,0x1,0x1,0x1,
 0x131b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -55885,7 +55885,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002912,0x1,0x1,0x1,0x1,
+0x1,0x80000798,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4657
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -55994,7 +55994,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a5,0x1,0x1},
+0x800007a9,0x1,0x1},
 // Transitions for state 4666
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56005,7 +56005,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021c8,0x1,0x1,0x1,
+0x1,0x1,0x800007aa,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4667
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56016,7 +56016,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003f5,0x1,0x1,
+0x1,0x1,0x1,0x800007bd,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4668
@@ -56027,7 +56027,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002205,0x1,0x1,0x1,
+0x1,0x1,0x800007bf,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -56160,7 +56160,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003f6,0x1,0x1,
+0x1,0x1,0x1,0x80000052,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4680
@@ -56195,7 +56195,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025aa,0x1,0x1,0x1,0x1,0x1,
+0x8000007e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -56242,7 +56242,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x8000229a,0x1,
+0x1,0x1,0x1,0x1,0x800000fe,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56255,7 +56255,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000229d,0x1,0x1,
+0x1,0x1,0x1,0x800000ff,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -56269,7 +56269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002296,0x1,0x1,0x1,
+0x1,0x1,0x80000103,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4689
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56281,7 +56281,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002297,0x1,0x1,0x1,
+0x1,0x1,0x80000105,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4690
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56338,7 +56338,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022de,0x1,
+0x1,0x1,0x1,0x1,0x80000144,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56350,7 +56350,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800022df,0x1,
+0x1,0x1,0x1,0x1,0x80000145,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56389,7 +56389,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002666,0x1,0x1,
+0x1,0x1,0x1,0x80000178,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4699
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56677,7 +56677,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002a95,0x1,0x1,0x1,
+0x1,0x1,0x80000200,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4723
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56688,7 +56688,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021cc,0x1,0x1,0x1,
+0x1,0x1,0x80000205,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4724
@@ -56700,7 +56700,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002130,0x1,0x1,
+0x1,0x1,0x1,0x8000021a,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4725
@@ -56809,7 +56809,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002277,0x1,0x1,0x1,
+0x1,0x1,0x80000280,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4734
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -56987,7 +56987,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002308,0x1,0x1,0x1,
+0x1,0x1,0x8000036a,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -57253,7 +57253,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002276,0x1,0x1,0x1,0x1,
+0x1,0x80000399,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4771
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57443,7 +57443,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000205f,0x1,0x1,0x1,0x1,0x1,
+0x80000411,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -57661,7 +57661,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000226a,0x1,0x1,0x1,
+0x1,0x1,0x800004a9,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4805
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57721,7 +57721,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002280,0x1,0x1,0x1,
+0x1,0x1,0x800004b2,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4810
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57781,7 +57781,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002281,0x1,0x1,0x1,
+0x1,0x1,0x800004bf,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4815
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57793,7 +57793,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002283,0x1,0x1,
+0x1,0x1,0x1,0x800004c3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4816
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57854,7 +57854,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021cf,0x1,0x1},
+0x800004d8,0x1,0x1},
 // Transitions for state 4821
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57866,7 +57866,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000219b,0x1,0x1},
+0x800004d9,0x1,0x1},
 // Transitions for state 4822
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57937,7 +57937,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800023b4,0x1,0x1,
+0x1,0x1,0x1,0x80000564,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4828
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -57973,7 +57973,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227c,0x1,0x1,0x1,0x1,0x1,
+0x8000059b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4831
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58022,7 +58022,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ab9,0x1},
+0x1,0x800005a1,0x1},
 // Transitions for state 4835
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58045,7 +58045,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000210d,0x1,0x1,0x1,
+0x1,0x1,0x800005c3,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4837
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58321,7 +58321,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c0,0x1,0x1,0x1,0x1,
+0x1,0x80000632,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4860
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58358,7 +58358,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021db,0x1,0x1},
+0x80000649,0x1,0x1},
 // Transitions for state 4863
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58366,7 +58366,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800029f4,
+0x1,0x1,0x1,0x1,0x1,0x80000658,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58439,7 +58439,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002218,0x1,0x1,0x1,0x1,0x1,
+0x8000069d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -58500,7 +58500,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002294,0x1,0x1,
+0x1,0x1,0x1,0x800006c5,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4875
@@ -58523,7 +58523,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x800003d5,0x1,
+0x1,0x1,0x1,0x1,0x800006d2,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -58536,7 +58536,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002286,0x1,0x1,0x1,0x1,
+0x1,0x800006e3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4878
@@ -58549,7 +58549,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227d,0x1,0x1,0x1,0x1,0x1,
+0x800006eb,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4879
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58598,7 +58598,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002aba,0x1},
+0x1,0x800006f1,0x1},
 // Transitions for state 4883
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58622,7 +58622,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002248,0x1},
+0x1,0x80000731,0x1},
 // Transitions for state 4885
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58742,7 +58742,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002195,0x1,0x1},
+0x8000079a,0x1,0x1},
 // Transitions for state 4895
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58754,7 +58754,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d5,0x1,0x1},
+0x8000079b,0x1,0x1},
 // Transitions for state 4896
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58766,7 +58766,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002195,0x1,0x1},
+0x8000079c,0x1,0x1},
 // Transitions for state 4897
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58873,7 +58873,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002223,0x1,0x1,0x1,0x1,
+0x1,0x800007e1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4906
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -58967,7 +58967,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800029eb,0x1,0x1,0x1,0x1,0x1,
+0x8000007d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -59281,7 +59281,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002913,0x1,0x1,0x1,0x1,
+0x1,0x800001a4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4940
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -59390,7 +59390,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a7,0x1,0x1},
+0x800001b2,0x1,0x1},
 // Transitions for state 4949
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -59417,7 +59417,7 @@
 0x1,0x1,0x1},
 // Transitions for state 4951
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x80002147,0x1,
+0x1,0x1,0x1,0x1,0x8000021b,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -59435,7 +59435,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002147,0x1,0x1,0x1,0x1,0x1,
+0x8000021c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -59484,7 +59484,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002265,0x1,0x1,0x1,0x1,
+0x1,0x8000027c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4957
@@ -59531,7 +59531,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002273,0x1,0x1,0x1,0x1,0x1,
+0x80000282,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -59543,7 +59543,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000210b,0x1,0x1,0x1,0x1,0x1,
+0x800002ad,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -59592,7 +59592,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224e,
+0x1,0x1,0x1,0x1,0x1,0x800002bd,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4966
@@ -59604,7 +59604,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022c2,0x1,0x1,
+0x1,0x1,0x1,0x800002ee,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4967
@@ -59653,7 +59653,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021e4,0x1,0x1,0x1,0x1,
+0x1,0x80000367,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4971
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -59822,7 +59822,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a4,0x1,0x1},
+0x8000037b,0x1,0x1},
 // Transitions for state 4985
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -59855,7 +59855,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b2,0x1,0x1,0x1,0x1,0x1,
+0x8000037e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -59893,7 +59893,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021bf,0x1,0x1,0x1,0x1,
+0x1,0x80000383,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 4991
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -60217,7 +60217,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002262,0x1,0x1,
+0x1,0x1,0x1,0x8000048d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5018
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -60336,7 +60336,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000224f,0x1,0x1,0x1,0x1,
+0x1,0x8000049c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5028
@@ -60360,7 +60360,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002270,0x1,0x1,0x1,0x1,
+0x1,0x800004a7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5030
@@ -60395,7 +60395,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002274,0x1,0x1,0x1,0x1,0x1,
+0x800004ab,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -60684,7 +60684,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000221d,0x1,0x1,0x1,0x1,
+0x1,0x800005b2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5057
@@ -60779,7 +60779,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002309,0x1,0x1,0x1,
+0x1,0x1,0x8000061b,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -60985,7 +60985,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002253,0x1,0x1,0x1,0x1,0x1,
+0x80000635,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5082
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -60997,7 +60997,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002970,0x1,0x1,0x1,
+0x1,0x1,0x80000644,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5083
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61058,7 +61058,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002191,0x1,0x1},
+0x8000068b,0x1,0x1},
 // Transitions for state 5088
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61093,7 +61093,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000228f,0x1,0x1,
+0x1,0x1,0x1,0x800006c1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5091
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61188,7 +61188,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025bf,0x1,0x1,
+0x1,0x1,0x1,0x80000750,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5099
@@ -61201,7 +61201,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025c3,0x1,0x1,
+0x1,0x1,0x1,0x80000751,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5100
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61249,7 +61249,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800023b5,0x1,0x1,
+0x1,0x1,0x1,0x8000078d,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5104
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61345,7 +61345,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228a,0x1,0x1,0x1,0x1,0x1,
+0x800007c7,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5112
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61357,7 +61357,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000228b,0x1,0x1,0x1,0x1,0x1,
+0x800007c9,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5113
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61379,7 +61379,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000007c,0x1,0x1,0x1,0x1,0x1,
+0x800007e2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -61440,7 +61440,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002061,0x1,0x1,
+0x1,0x1,0x1,0x80000040,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5120
@@ -61464,7 +61464,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800025b3,
+0x1,0x1,0x1,0x1,0x1,0x80000078,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5122
@@ -61475,7 +61475,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025b4,0x1,0x1,0x1,0x1,0x1,
+0x8000007f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -61649,7 +61649,7 @@
 0x1,0x1,0x1},
 // Transitions for state 5137
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002146,0x1,0x1,
+0x1,0x1,0x1,0x8000017b,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61669,7 +61669,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022c7,0x1,0x1,0x1,
+0x1,0x1,0x80000180,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5139
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -61739,7 +61739,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002ae4,0x1,0x1,0x1,0x1,0x1,
+0x80000198,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -61802,7 +61802,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d1,0x1,0x1},
+0x8000019e,0x1,0x1},
 // Transitions for state 5150
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x14df,0x1,0x1,0x1,0x1,0x1,
@@ -61969,7 +61969,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002252,0x1,0x1,0x1,0x1,0x1,
+0x8000021d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5164
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62054,7 +62054,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a9,0x1,0x1},
+0x800002b2,0x1,0x1},
 // Transitions for state 5171
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62136,7 +62136,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021a2,0x1,0x1,0x1,0x1,
+0x1,0x80000369,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5178
@@ -62196,7 +62196,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021bc,
+0x1,0x1,0x1,0x1,0x1,0x80000371,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5183
@@ -62293,7 +62293,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000295a,0x1,0x1,0x1,0x1,
+0x1,0x8000037c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5191
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62365,7 +62365,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002952,0x1,0x1,0x1,0x1,
+0x1,0x80000386,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5197
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62388,7 +62388,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002266,0x1,0x1,0x1,0x1,
+0x1,0x80000398,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5199
@@ -62414,7 +62414,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f5,0x1,0x1},
+0x800003c1,0x1,0x1},
 // Transitions for state 5201
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62426,7 +62426,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f8,0x1,0x1},
+0x800003c2,0x1,0x1},
 // Transitions for state 5202
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62438,7 +62438,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f5,0x1,0x1},
+0x800003c3,0x1,0x1},
 // Transitions for state 5203
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62521,7 +62521,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021ab,0x1,0x1,
+0x1,0x1,0x1,0x800003cb,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5210
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -62567,7 +62567,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002221,0x1,0x1,0x1,0x1,0x1,
+0x80000410,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -62699,7 +62699,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002242,0x1,0x1,0x1,0x1,0x1,
+0x80000492,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -62988,7 +62988,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002244,0x1,0x1,0x1,0x1,
+0x1,0x800004c6,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5249
@@ -63011,7 +63011,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002249,0x1,0x1,0x1,0x1,0x1,
+0x800004c8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63049,7 +63049,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022ea,0x1,0x1,
+0x1,0x1,0x1,0x800004fc,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5254
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63107,7 +63107,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000210c,0x1,0x1,0x1,0x1,0x1,
+0x8000058e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63120,7 +63120,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002aaf,0x1,0x1,0x1,0x1,
+0x1,0x8000059d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5260
@@ -63143,7 +63143,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227e,0x1,0x1,0x1,0x1,0x1,
+0x8000059f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63205,7 +63205,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021e5,0x1,0x1,0x1,0x1,
+0x1,0x80000618,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5267
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63338,7 +63338,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a6,0x1,0x1},
+0x80000628,0x1,0x1},
 // Transitions for state 5278
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63371,7 +63371,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b3,0x1,0x1,0x1,0x1,0x1,
+0x8000062b,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63409,7 +63409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021be,0x1,0x1,0x1,0x1,
+0x1,0x80000630,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5284
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63456,7 +63456,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002225,0x1,0x1,0x1,0x1,
+0x1,0x80000689,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5288
@@ -63481,7 +63481,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002216,0x1,0x1,0x1,
+0x1,0x1,0x8000069e,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5290
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63540,7 +63540,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ab0,0x1,0x1,0x1,0x1,
+0x1,0x800006ed,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5295
@@ -63563,7 +63563,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227f,0x1,0x1,0x1,0x1,0x1,
+0x800006ef,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63576,7 +63576,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002287,0x1,0x1,0x1,0x1,
+0x1,0x80000704,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5298
@@ -63613,7 +63613,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025b9,0x1,0x1,
+0x1,0x1,0x1,0x80000754,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5301
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63672,7 +63672,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000296e,0x1,0x1,0x1,
+0x1,0x1,0x8000079d,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5306
@@ -63685,7 +63685,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021bf,0x1,0x1,
+0x1,0x1,0x1,0x8000079e,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5307
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63733,7 +63733,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002acb,0x1,0x1,0x1,0x1,0x1,
+0x800007c8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5311
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63745,7 +63745,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002acc,0x1,0x1,0x1,0x1,0x1,
+0x800007ca,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5312
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63791,7 +63791,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002240,0x1,0x1,0x1,0x1,0x1,
+0x800007e4,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63803,7 +63803,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000200a,0x1,0x1,0x1,0x1,0x1,
+0x800007e5,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -63949,7 +63949,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021b6,0x1,0x1,
+0x1,0x1,0x1,0x80000149,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5329
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -63985,7 +63985,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800002d9,0x1578,0x1,
+0x1,0x1,0x1,0x80000171,0x1578,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5332
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64019,7 +64019,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002306,0x1,0x1,0x1,0x1,0x1,
+0x80000192,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -64115,7 +64115,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022a8,0x1,0x1,0x1,0x1,0x1,
+0x8000019d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -64165,7 +64165,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021ca,0x1,0x1,0x1,
+0x1,0x1,0x800001a7,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5347
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64225,7 +64225,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021bd,0x1,0x1,0x1,0x1,
+0x1,0x800001ac,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5352
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64333,7 +64333,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002aa2,0x1,0x1,0x1,0x1,
+0x1,0x8000027f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5361
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64358,7 +64358,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021aa,0x1,0x1},
+0x800002b3,0x1,0x1},
 // Transitions for state 5363
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64367,7 +64367,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002500,0x1,0x1,0x1,0x1,0x1,
+0x800002b7,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -64378,7 +64378,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002063,0x1,0x1,0x1,
+0x1,0x1,0x800002f1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64393,7 +64393,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002062,0x1,0x1,0x1,
+0x1,0x1,0x800002f2,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5366
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64453,7 +64453,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c3,0x1,0x1,0x1,0x1,
+0x1,0x8000036d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5371
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64477,7 +64477,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021c7,0x1,0x1,0x1,
+0x1,0x1,0x80000372,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5373
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64490,7 +64490,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002194,0x1,0x1},
+0x80000373,0x1,0x1},
 // Transitions for state 5374
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64502,7 +64502,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d4,0x1,0x1},
+0x80000374,0x1,0x1},
 // Transitions for state 5375
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64514,7 +64514,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002194,0x1,0x1},
+0x80000375,0x1,0x1},
 // Transitions for state 5376
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64561,7 +64561,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022cb,0x1,0x1,0x1,
+0x1,0x1,0x8000037d,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5380
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64644,7 +64644,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a7d,0x1,0x1,0x1,0x1,
+0x1,0x8000039d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5387
@@ -64694,7 +64694,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f6,0x1,0x1},
+0x800003c8,0x1,0x1},
 // Transitions for state 5391
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64706,7 +64706,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f9,0x1,0x1},
+0x800003c9,0x1,0x1},
 // Transitions for state 5392
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64718,7 +64718,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f6,0x1,0x1},
+0x800003ca,0x1,0x1},
 // Transitions for state 5393
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64729,7 +64729,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021ac,0x1,0x1,
+0x1,0x1,0x1,0x800003cc,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5394
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64742,7 +64742,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002199,0x1,0x1},
+0x800003d4,0x1,0x1},
 // Transitions for state 5395
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64825,7 +64825,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000226a,0x1,0x1,0x1,
+0x1,0x1,0x80000456,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5402
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64921,7 +64921,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002279,0x1,0x1,0x1,
+0x1,0x1,0x80000498,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5410
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -64981,7 +64981,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002278,0x1,0x1,0x1,0x1,
+0x1,0x800004a8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5415
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65100,7 +65100,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002288,0x1,0x1,0x1,0x1,
+0x1,0x800004be,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5425
@@ -65173,7 +65173,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002224,0x1,0x1,0x1,0x1,
+0x1,0x800004c9,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5431
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65184,7 +65184,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002226,0x1,0x1,0x1,0x1,
+0x1,0x800004e2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5432
@@ -65209,7 +65209,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022eb,0x1,0x1,
+0x1,0x1,0x1,0x800004fe,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5434
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65231,7 +65231,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002018,0x1,0x1,0x1,0x1,0x1,
+0x80000545,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -65269,7 +65269,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000220b,0x1,0x1,
+0x1,0x1,0x1,0x80000606,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5439
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65328,7 +65328,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021a3,0x1,0x1,0x1,0x1,
+0x1,0x8000061a,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5444
@@ -65388,7 +65388,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x800021c0,
+0x1,0x1,0x1,0x1,0x1,0x80000622,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5449
@@ -65449,7 +65449,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000295b,0x1,0x1,0x1,0x1,
+0x1,0x80000629,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5454
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65521,7 +65521,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002953,0x1,0x1,0x1,0x1,
+0x1,0x80000633,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5460
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65534,7 +65534,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002193,0x1,0x1},
+0x80000686,0x1,0x1},
 // Transitions for state 5461
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65546,7 +65546,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002190,0x1,0x1},
+0x80000687,0x1,0x1},
 // Transitions for state 5462
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65593,7 +65593,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002290,0x1,0x1,
+0x1,0x1,0x1,0x800006c3,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5466
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65628,7 +65628,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002245,0x1,0x1,0x1,0x1,
+0x1,0x8000073d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5469
@@ -65641,7 +65641,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b4,0x1,0x1,0x1,0x1,0x1,
+0x80000752,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5470
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65713,7 +65713,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021be,0x1,0x1,
+0x1,0x1,0x1,0x8000079f,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5476
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65726,7 +65726,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002196,0x1,0x1},
+0x800007a1,0x1,0x1},
 // Transitions for state 5477
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65783,7 +65783,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000200b,0x1,0x1,0x1,0x1,0x1,
+0x80000841,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -65796,7 +65796,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025bd,0x1,0x1,
+0x1,0x1,0x1,0x80000077,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5483
@@ -65857,7 +65857,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021ba,0x1,0x1,
+0x1,0x1,0x1,0x800000fb,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5488
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -65903,7 +65903,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002019,0x1,0x1,0x1,0x1,0x1,
+0x8000010d,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -65916,7 +65916,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000222e,0x1,0x1,0x1,0x1,
+0x1,0x80000120,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5493
@@ -65941,7 +65941,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021b7,0x1,0x1,
+0x1,0x1,0x1,0x8000014a,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5495
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66014,7 +66014,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d3,0x1,0x1},
+0x80000195,0x1,0x1},
 // Transitions for state 5501
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66026,7 +66026,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d0,0x1,0x1},
+0x80000196,0x1,0x1},
 // Transitions for state 5502
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66121,7 +66121,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021c3,0x1,0x1,
+0x1,0x1,0x1,0x800001a8,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5510
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66193,7 +66193,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c1,0x1,0x1,0x1,0x1,
+0x1,0x800001af,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5516
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66348,7 +66348,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021bd,0x1,0x1,
+0x1,0x1,0x1,0x80000370,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5529
@@ -66361,7 +66361,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021c6,0x1,0x1,0x1,
+0x1,0x1,0x80000376,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5530
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66397,7 +66397,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000294e,0x1,0x1,0x1,0x1,
+0x1,0x80000379,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5533
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66409,7 +66409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029cf,0x1,0x1,0x1,0x1,
+0x1,0x8000037f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5534
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66445,7 +66445,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002960,0x1,0x1,0x1,0x1,
+0x1,0x80000382,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5537
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66457,7 +66457,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002958,0x1,0x1,0x1,0x1,
+0x1,0x80000384,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5538
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66518,7 +66518,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002198,0x1,0x1},
+0x800003d5,0x1,0x1},
 // Transitions for state 5543
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66590,7 +66590,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021ce,0x1,0x1},
+0x80000478,0x1,0x1},
 // Transitions for state 5549
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66602,7 +66602,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021ae,0x1,0x1},
+0x80000479,0x1,0x1},
 // Transitions for state 5550
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66636,7 +66636,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002271,0x1,0x1,0x1,0x1,
+0x1,0x80000495,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5553
@@ -66683,7 +66683,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002275,0x1,0x1,0x1,0x1,0x1,
+0x8000049a,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -66696,7 +66696,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x1,0x1,0x8000224e,
+0x1,0x1,0x1,0x1,0x1,0x8000049b,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5558
@@ -66707,7 +66707,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ea,0x1,0x1,0x1,0x1,0x1,
+0x800004a3,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -66805,7 +66805,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000228f,0x1,0x1,
+0x1,0x1,0x1,0x800004b9,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5567
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66889,7 +66889,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ec,0x1,0x1,0x1,0x1,0x1,
+0x800004fd,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5574
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -66925,7 +66925,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800023dc,0x1,0x1,0x1,
+0x1,0x1,0x80000565,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5577
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67021,7 +67021,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800021c2,0x1,0x1,0x1,0x1,
+0x1,0x8000061e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5585
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67045,7 +67045,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021c4,0x1,0x1,0x1,
+0x1,0x1,0x80000623,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5587
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67082,7 +67082,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000219d,0x1,0x1},
+0x80000626,0x1,0x1},
 // Transitions for state 5590
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67093,7 +67093,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022cc,0x1,0x1,0x1,
+0x1,0x1,0x8000062a,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5591
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67166,7 +67166,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002192,0x1,0x1},
+0x8000068a,0x1,0x1},
 // Transitions for state 5597
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67212,7 +67212,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800003f5,0x1,0x1,
+0x1,0x1,0x1,0x800006d1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5601
@@ -67237,7 +67237,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022b5,0x1,0x1,0x1,0x1,0x1,
+0x80000755,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5603
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67298,7 +67298,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80002197,0x1,0x1},
+0x800007a2,0x1,0x1},
 // Transitions for state 5608
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67309,7 +67309,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022b2,0x1,0x1,
+0x1,0x1,0x1,0x800007cc,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5609
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67393,7 +67393,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021bb,0x1,0x1,
+0x1,0x1,0x1,0x800000fc,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5616
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67439,7 +67439,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000b4,0x1,0x1,0x1,0x1,0x1,
+0x80000170,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -67463,7 +67463,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x80000060,0x1,0x1,0x1,0x1,0x1,
+0x80000173,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -67475,7 +67475,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800002dc,0x1,0x1,0x1,0x1,0x1,
+0x80000174,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -67550,7 +67550,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d2,0x1,0x1},
+0x8000019c,0x1,0x1},
 // Transitions for state 5629
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67586,7 +67586,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021f5,0x1,0x1},
+0x800001a5,0x1,0x1},
 // Transitions for state 5632
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67597,7 +67597,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021c2,0x1,0x1,
+0x1,0x1,0x1,0x800001a9,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5633
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67667,7 +67667,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025fb,0x1,0x1,0x1,0x1,0x1,
+0x800001e8,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -67717,7 +67717,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800022db,0x1,0x1,0x1,
+0x1,0x1,0x8000027d,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5643
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67728,7 +67728,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002267,0x1,0x1,0x1,0x1,
+0x1,0x8000027e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5644
@@ -67753,7 +67753,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800027e8,0x1,0x1,
+0x1,0x1,0x1,0x80000363,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5646
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67849,7 +67849,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002951,0x1,0x1,0x1,0x1,
+0x1,0x80000381,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5654
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67861,7 +67861,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022da,0x1,0x1,0x1,0x1,
+0x1,0x80000397,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5655
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -67967,7 +67967,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800000a0,0x1,0x1,0x1,0x1,0x1,
+0x80000488,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -68076,7 +68076,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002aaf,0x1,0x1,0x1,0x1,
+0x1,0x800004b3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5673
@@ -68111,7 +68111,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022eb,0x1,0x1,0x1,0x1,0x1,
+0x800004b6,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -68148,7 +68148,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002ab0,0x1,0x1,0x1,0x1,
+0x1,0x800004c0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5679
@@ -68171,7 +68171,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000227f,0x1,0x1,0x1,0x1,0x1,
+0x800004c2,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -68184,7 +68184,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002289,0x1,0x1,0x1,0x1,
+0x1,0x800004c4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5682
@@ -68209,7 +68209,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800022ed,0x1,0x1,0x1,0x1,0x1,
+0x800004ff,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5684
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68328,7 +68328,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800021c1,0x1,0x1,
+0x1,0x1,0x1,0x80000621,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5694
@@ -68353,7 +68353,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021c9,0x1,0x1,0x1,
+0x1,0x1,0x80000625,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5696
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68365,7 +68365,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029d0,0x1,0x1,0x1,0x1,
+0x1,0x8000062c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5697
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68401,7 +68401,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000295c,0x1,0x1,0x1,0x1,
+0x1,0x8000062f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5700
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68413,7 +68413,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002954,0x1,0x1,0x1,0x1,
+0x1,0x80000631,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5701
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68474,7 +68474,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000219e,0x1,0x1},
+0x80000767,0x1,0x1},
 // Transitions for state 5706
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68497,7 +68497,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800023dd,0x1,0x1,0x1,
+0x1,0x1,0x8000078e,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5708
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68510,7 +68510,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021c5,0x1,0x1},
+0x80000799,0x1,0x1},
 // Transitions for state 5709
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68521,7 +68521,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800022b3,0x1,0x1,
+0x1,0x1,0x1,0x800007cd,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5710
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68544,7 +68544,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025be,0x1,0x1,
+0x1,0x1,0x1,0x80000080,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5712
@@ -68557,7 +68557,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025c2,0x1,0x1,
+0x1,0x1,0x1,0x80000081,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5713
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68702,7 +68702,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d5,0x1,0x1},
+0x8000019f,0x1,0x1},
 // Transitions for state 5725
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68713,7 +68713,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002225,0x1,0x1,0x1,0x1,
+0x1,0x800001a0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5726
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68737,7 +68737,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000295e,0x1,0x1,0x1,0x1,
+0x1,0x800001ab,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5728
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68749,7 +68749,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002956,0x1,0x1,0x1,0x1,
+0x1,0x800001ad,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5729
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68795,7 +68795,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025fc,0x1,0x1,0x1,0x1,0x1,
+0x80000227,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -68820,7 +68820,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a7e,0x1,0x1,0x1,0x1,
+0x1,0x80000281,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5735
@@ -68845,7 +68845,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800027e6,0x1,0x1,
+0x1,0x1,0x1,0x8000036b,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5737
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68857,7 +68857,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002961,0x1,0x1,0x1,0x1,
+0x1,0x8000036c,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5738
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68869,7 +68869,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002959,0x1,0x1,0x1,0x1,
+0x1,0x8000036e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5739
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68881,7 +68881,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021cb,0x1,0x1,0x1,
+0x1,0x1,0x80000377,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5740
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -68904,7 +68904,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022b4,0x1,0x1,0x1,0x1,
+0x1,0x80000380,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5742
@@ -68975,7 +68975,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000200b,0x1,0x1,0x1,0x1,0x1,
+0x80000450,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -69037,7 +69037,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000226b,0x1,0x1,0x1,0x1,
+0x1,0x80000497,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5753
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69084,7 +69084,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a7d,0x1,0x1,0x1,0x1,
+0x1,0x800004aa,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5757
@@ -69109,7 +69109,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x80002aa1,0x1,0x1,0x1,
+0x1,0x1,0x800004ad,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5759
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69133,7 +69133,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x8000220c,0x1,0x1,
+0x1,0x1,0x1,0x800004b5,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5761
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69169,7 +69169,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002290,0x1,0x1,
+0x1,0x1,0x1,0x800004bb,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5764
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69192,7 +69192,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002247,0x1,0x1,0x1,0x1,
+0x1,0x800004c7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5766
@@ -69253,7 +69253,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800027e9,0x1,0x1,
+0x1,0x1,0x1,0x80000614,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5771
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69313,7 +69313,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021cc,0x1,0x1,0x1,
+0x1,0x1,0x80000624,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5776
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69337,7 +69337,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000294f,0x1,0x1,0x1,0x1,
+0x1,0x8000062e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5778
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69360,7 +69360,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002291,0x1,0x1,0x1,0x1,
+0x1,0x800006c2,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5780
@@ -69398,7 +69398,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021a0,0x1,0x1},
+0x80000768,0x1,0x1},
 // Transitions for state 5783
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69409,7 +69409,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002758,0x1,0x1,0x1,0x1,
+0x1,0x800007e3,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5784
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69421,7 +69421,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800025b8,0x1,0x1,
+0x1,0x1,0x1,0x80000082,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5785
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69565,7 +69565,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000295f,0x1,0x1,0x1,0x1,
+0x1,0x800001ae,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5797
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69577,7 +69577,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002957,0x1,0x1,0x1,0x1,
+0x1,0x800001b0,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5798
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69638,7 +69638,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f7,0x1,0x1},
+0x800003c4,0x1,0x1},
 // Transitions for state 5803
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69650,7 +69650,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027fa,0x1,0x1},
+0x800003c5,0x1,0x1},
 // Transitions for state 5804
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69662,7 +69662,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f7,0x1,0x1},
+0x800003c6,0x1,0x1},
 // Transitions for state 5805
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69683,7 +69683,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000200b,0x1,0x1,0x1,0x1,0x1,
+0x8000044f,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -69757,7 +69757,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029cf,0x1,0x1,0x1,0x1,
+0x1,0x800004a4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5813
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69876,7 +69876,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000227c,0x1,0x1,0x1,0x1,
+0x1,0x8000059e,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5823
@@ -69888,7 +69888,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x800021cb,0x1,0x1,0x1,
+0x1,0x1,0x80000607,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5824
@@ -69925,7 +69925,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x800027e7,0x1,0x1,
+0x1,0x1,0x1,0x8000061c,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5827
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69937,7 +69937,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000295d,0x1,0x1,0x1,0x1,
+0x1,0x8000061d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5828
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69949,7 +69949,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002955,0x1,0x1,0x1,0x1,
+0x1,0x8000061f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5829
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -69960,7 +69960,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022b5,0x1,0x1,0x1,0x1,
+0x1,0x8000062d,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5830
@@ -69972,7 +69972,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002293,0x1,0x1,
+0x1,0x1,0x1,0x800006c0,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5831
@@ -69996,7 +69996,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000227d,0x1,0x1,0x1,0x1,
+0x1,0x800006ee,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5833
@@ -70094,7 +70094,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f8,0x1,0x1},
+0x80000199,0x1,0x1},
 // Transitions for state 5841
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70129,7 +70129,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002950,0x1,0x1,0x1,0x1,
+0x1,0x800001aa,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5844
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70166,7 +70166,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021c6,0x1,0x1},
+0x80000368,0x1,0x1},
 // Transitions for state 5847
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70178,7 +70178,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021ad,0x1,0x1},
+0x80000378,0x1,0x1},
 // Transitions for state 5848
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70187,7 +70187,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000200b,0x1,0x1,0x1,0x1,0x1,
+0x8000044e,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70236,7 +70236,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002267,0x1,0x1,0x1,0x1,
+0x1,0x80000496,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5853
@@ -70297,7 +70297,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800029d0,0x1,0x1,0x1,0x1,
+0x1,0x800004b7,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5858
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70382,7 +70382,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021c4,0x1,0x1},
+0x80000619,0x1,0x1},
 // Transitions for state 5865
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70392,12 +70392,12 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002292,0x1,0x1,0x1,0x1,
+0x1,0x800006c4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5866
 {0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x1,0x80002145,0x1,0x1,
+0x1,0x1,0x1,0x800000d9,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70478,7 +70478,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800021d4,0x1,0x1},
+0x80000197,0x1,0x1},
 // Transitions for state 5873
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1707,0x1,0x1,0x1,0x1,0x1,
@@ -70502,7 +70502,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027f9,0x1,0x1},
+0x8000019b,0x1,0x1},
 // Transitions for state 5875
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70511,7 +70511,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025ab,0x1,0x1,0x1,0x1,0x1,
+0x800001ea,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70549,7 +70549,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000226b,0x1,0x1,0x1,0x1,
+0x1,0x80000455,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5879
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70561,7 +70561,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002226,0x1,0x1,0x1,0x1,
+0x1,0x8000048f,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5880
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70572,7 +70572,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002a7e,0x1,0x1,0x1,0x1,
+0x1,0x80000499,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5881
@@ -70584,7 +70584,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022ec,0x1,0x1,0x1,0x1,
+0x1,0x800004a5,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5882
@@ -70632,7 +70632,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022e2,0x1,0x1,0x1,0x1,
+0x1,0x800004ba,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5886
@@ -70667,7 +70667,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000201c,0x1,0x1,0x1,0x1,0x1,
+0x80000544,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70680,7 +70680,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x1,0x8000296f,0x1,0x1,0x1,
+0x1,0x1,0x80000608,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5890
@@ -70703,7 +70703,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000201d,0x1,0x1,0x1,0x1,0x1,
+0x8000010c,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70740,7 +70740,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x8000222f,0x1,0x1,0x1,0x1,
+0x1,0x80000193,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5895
@@ -70763,7 +70763,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800025aa,0x1,0x1,0x1,0x1,0x1,
+0x80000228,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70775,7 +70775,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x8000200b,0x1,0x1,0x1,0x1,0x1,
+0x80000451,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70800,7 +70800,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022e0,0x1,0x1,0x1,0x1,
+0x1,0x800004b4,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5900
@@ -70812,7 +70812,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022ed,0x1,0x1,0x1,0x1,
+0x1,0x800004b8,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5901
@@ -70836,7 +70836,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022e1,0x1,0x1,0x1,0x1,
+0x1,0x800004c1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5903
@@ -70871,7 +70871,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800002dd,0x1,0x1,0x1,0x1,0x1,
+0x80000172,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
@@ -70908,7 +70908,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x800022e3,0x1,0x1,0x1,0x1,
+0x1,0x800004bc,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5909
@@ -70957,7 +70957,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002aa2,0x1,0x1,0x1,0x1,
+0x1,0x800004ac,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5913
 {0x1,0x1,0x1,0x1,0x1,0x1,
@@ -70968,7 +70968,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002232,0x1,0x1,0x1,0x1,
+0x1,0x8000010b,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1},
 // Transitions for state 5914
@@ -70994,7 +70994,7 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x800027fa,0x1,0x1},
+0x8000019a,0x1,0x1},
 // Transitions for state 5916
 {0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
@@ -71076,6 +71076,6 @@
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
-0x1,0x80002233,0x1,0x1,0x1,0x1,
+0x1,0x80000128,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1,0x1,0x1,0x1,
 0x1,0x1,0x1}
@@ -0,0 +1,814 @@
+// states = 65, inputs = 256
+// Direct-threaded code of the fused FSM, to be included in the body of lexer_fused_run()
+// This file was automatically generated by fsm2array
+// Please do not edit this file directly
+// Rules to generate this file can be found in the util/ directory
+#if defined(__GNUC__)
+    static const void* FSM__LABELS[65] = { &&FSM_S0, &&FSM_S1, &&FSM_S2, &&FSM_S3, &&FSM_S4, &&FSM_S5, &&FSM_S6, &&FSM_S7, &&FSM_S8, &&FSM_S9, &&FSM_S10, &&FSM_S11, &&FSM_S12, &&FSM_S13, &&FSM_S14, &&FSM_S15, &&FSM_S16, &&FSM_S17, &&FSM_S18, &&FSM_S19, &&FSM_S20, &&FSM_S21, &&FSM_S22, &&FSM_S23, &&FSM_S24, &&FSM_S25, &&FSM_S26, &&FSM_S27, &&FSM_S28, &&FSM_S29, &&FSM_S30, &&FSM_S31, &&FSM_S32, &&FSM_S33, &&FSM_S34, &&FSM_S35, &&FSM_S36, &&FSM_S37, &&FSM_S38, &&FSM_S39, &&FSM_S40, &&FSM_S41, &&FSM_S42, &&FSM_S43, &&FSM_S44, &&FSM_S45, &&FSM_S46, &&FSM_S47, &&FSM_S48, &&FSM_S49, &&FSM_S50, &&FSM_S51, &&FSM_S52, &&FSM_S53, &&FSM_S54, &&FSM_S55, &&FSM_S56, &&FSM_S57, &&FSM_S58, &&FSM_S59, &&FSM_S60, &&FSM_S61, &&FSM_S62, &&FSM_S63, &&FSM_S64 };
+    goto *FSM__LABELS[state];
+#else
+    switch( state ) {
+        case 0: goto FSM_S0;
+        case 1: goto FSM_S1;
+        case 2: goto FSM_S2;
+        case 3: goto FSM_S3;
+        case 4: goto FSM_S4;
+        case 5: goto FSM_S5;
+        case 6: goto FSM_S6;
+        case 7: goto FSM_S7;
+        case 8: goto FSM_S8;
+        case 9: goto FSM_S9;
+        case 10: goto FSM_S10;
+        case 11: goto FSM_S11;
+        case 12: goto FSM_S12;
+        case 13: goto FSM_S13;
+        case 14: goto FSM_S14;
+        case 15: goto FSM_S15;
+        case 16: goto FSM_S16;
+        case 17: goto FSM_S17;
+        case 18: goto FSM_S18;
+        case 19: goto FSM_S19;
+        case 20: goto FSM_S20;
+        case 21: goto FSM_S21;
+        case 22: goto FSM_S22;
+        case 23: goto FSM_S23;
+        case 24: goto FSM_S24;
+        case 25: goto FSM_S25;
+        case 26: goto FSM_S26;
+        case 27: goto FSM_S27;
+        case 28: goto FSM_S28;
+        case 29: goto FSM_S29;
+        case 30: goto FSM_S30;
+        case 31: goto FSM_S31;
+        case 32: goto FSM_S32;
+        case 33: goto FSM_S33;
+        case 34: goto FSM_S34;
+        case 35: goto FSM_S35;
+        case 36: goto FSM_S36;
+        case 37: goto FSM_S37;
+        case 38: goto FSM_S38;
+        case 39: goto FSM_S39;
+        case 40: goto FSM_S40;
+        case 41: goto FSM_S41;
+        case 42: goto FSM_S42;
+        case 43: goto FSM_S43;
+        case 44: goto FSM_S44;
+        case 45: goto FSM_S45;
+        case 46: goto FSM_S46;
+        case 47: goto FSM_S47;
+        case 48: goto FSM_S48;
+        case 49: goto FSM_S49;
+        case 50: goto FSM_S50;
+        case 51: goto FSM_S51;
+        case 52: goto FSM_S52;
+        case 53: goto FSM_S53;
+        case 54: goto FSM_S54;
+        case 55: goto FSM_S55;
+        case 56: goto FSM_S56;
+        case 57: goto FSM_S57;
+        case 58: goto FSM_S58;
+        case 59: goto FSM_S59;
+        case 60: goto FSM_S60;
+        case 61: goto FSM_S61;
+        case 62: goto FSM_S62;
+        case 63: goto FSM_S63;
+        case 64: goto FSM_S64;
+        default: goto FSM_DONE;
+    }
+#endif
+// State 0
+FSM_S0:
+    if( i == len ) { state =0; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S0;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x80000102; state =0; goto FSM_DONE;
+        case 0x3c:
+            *transition =0x80000104; state =0; goto FSM_DONE;
+    }
+// State 1
+FSM_S1:
+    if( i == len ) { state =1; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S1;
+    }
+// State 2
+FSM_S2:
+    if( i == len ) { state =2; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001116; state =2; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S2;
+        case 0x26:
+            *transition =0x80000e2d; state =2; goto FSM_DONE;
+        case 0x3c:
+            i++; goto FSM_S4;
+    }
+// State 3
+FSM_S3:
+    if( i == len ) { state =3; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S3;
+        case 0x3c:
+            i++; goto FSM_S4;
+        case 0x3e:
+            i++; goto FSM_S2;
+    }
+// State 4
+FSM_S4:
+    if( i == len ) { state =4; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =4; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S4;
+        case 0x21:
+            i++; goto FSM_S13;
+        case 0x2f:
+            i++; goto FSM_S8;
+        case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35:
+        case 0x36: case 0x37: case 0x38: case 0x39: case 0x3a: case 0x3f:
+        case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+        case 0x47: case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c:
+        case 0x4d: case 0x4e: case 0x4f: case 0x50: case 0x51: case 0x52:
+        case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+        case 0x59: case 0x5a: case 0x61: case 0x62: case 0x63: case 0x64:
+        case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6a:
+        case 0x6b: case 0x6c: case 0x6d: case 0x6e: case 0x6f: case 0x70:
+        case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+        case 0x77: case 0x78: case 0x79: case 0x7a:
+            *transition =0x80001105; state =4; goto FSM_DONE;
+    }
+// State 5
+FSM_S5:
+    if( i == len ) { state =5; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =5; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x80000307; state =5; goto FSM_DONE;
+        case 0x2f:
+            *transition =0x8000030c; state =5; goto FSM_DONE;
+        case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35:
+        case 0x36: case 0x37: case 0x38: case 0x39: case 0x3a: case 0x3f:
+        case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+        case 0x47: case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c:
+        case 0x4d: case 0x4e: case 0x4f: case 0x50: case 0x51: case 0x52:
+        case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+        case 0x59: case 0x5a: case 0x61: case 0x62: case 0x63: case 0x64:
+        case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6a:
+        case 0x6b: case 0x6c: case 0x6d: case 0x6e: case 0x6f: case 0x70:
+        case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+        case 0x77: case 0x78: case 0x79: case 0x7a:
+            i++; goto FSM_S5;
+        case 0x3e:
+            *transition =0x80130306; state =5; goto FSM_DONE;
+    }
+// State 6
+FSM_S6:
+    if( i == len ) { state =6; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001116; state =6; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S2;
+        case 0x26:
+            *transition =0x80000e2d; state =6; goto FSM_DONE;
+        case 0x3c:
+            i++; goto FSM_S4;
+    }
+// State 7
+FSM_S7:
+    if( i == len ) { state =7; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x8000110e; state =7; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S7;
+        case 0x22: case 0x27: case 0x3d:
+            *transition =0x80001003; state =7; goto FSM_DONE;
+        case 0x2f:
+            i++; goto FSM_S12;
+        case 0x3e:
+            *transition =0x80001306; state =7; goto FSM_DONE;
+    }
+// State 8
+FSM_S8:
+    if( i == len ) { state =8; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =8; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S8;
+        case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35:
+        case 0x36: case 0x37: case 0x38: case 0x39: case 0x3a: case 0x3f:
+        case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+        case 0x47: case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c:
+        case 0x4d: case 0x4e: case 0x4f: case 0x50: case 0x51: case 0x52:
+        case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+        case 0x59: case 0x5a: case 0x61: case 0x62: case 0x63: case 0x64:
+        case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6a:
+        case 0x6b: case 0x6c: case 0x6d: case 0x6e: case 0x6f: case 0x70:
+        case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+        case 0x77: case 0x78: case 0x79: case 0x7a:
+            *transition =0x80001109; state =8; goto FSM_DONE;
+    }
+// State 9
+FSM_S9:
+    if( i == len ) { state =9; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =9; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x8000040a; state =9; goto FSM_DONE;
+        case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35:
+        case 0x36: case 0x37: case 0x38: case 0x39: case 0x3a: case 0x3f:
+        case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+        case 0x47: case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c:
+        case 0x4d: case 0x4e: case 0x4f: case 0x50: case 0x51: case 0x52:
+        case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+        case 0x59: case 0x5a: case 0x61: case 0x62: case 0x63: case 0x64:
+        case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6a:
+        case 0x6b: case 0x6c: case 0x6d: case 0x6e: case 0x6f: case 0x70:
+        case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+        case 0x77: case 0x78: case 0x79: case 0x7a:
+            i++; goto FSM_S9;
+        case 0x3e:
+            *transition =0x8000040b; state =9; goto FSM_DONE;
+    }
+// State 10
+FSM_S10:
+    if( i == len ) { state =10; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S10;
+        case 0x3e:
+            i++; goto FSM_S11;
+    }
+// State 11
+FSM_S11:
+    if( i == len ) { state =11; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001116; state =11; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S2;
+        case 0x3c:
+            i++; goto FSM_S4;
+    }
+// State 12
+FSM_S12:
+    if( i == len ) { state =12; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =12; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S12;
+        case 0x3e:
+            *transition =0x80001406; state =12; goto FSM_DONE;
+    }
+// State 13
+FSM_S13:
+    if( i == len ) { state =13; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =13; goto FSM_DONE;
+        case 0x2d:
+            i++; goto FSM_S31;
+        case 0x44: case 0x64:
+            i++; goto FSM_S23;
+        case 0x5b:
+            i++; goto FSM_S35;
+    }
+// State 14
+FSM_S14:
+    if( i == len ) { state =14; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S14;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x8000070f; state =14; goto FSM_DONE;
+        case 0x22: case 0x27: case 0x3c:
+            *transition =0x80001003; state =14; goto FSM_DONE;
+        case 0x2f:
+            *transition =0x8000060c; state =14; goto FSM_DONE;
+        case 0x3d:
+            *transition =0x80000710; state =14; goto FSM_DONE;
+        case 0x3e:
+            *transition =0x80130606; state =14; goto FSM_DONE;
+    }
+// State 15
+FSM_S15:
+    if( i == len ) { state =15; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x8011060e; state =15; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S15;
+        case 0x22: case 0x27: case 0x3c:
+            *transition =0x80001003; state =15; goto FSM_DONE;
+        case 0x2f:
+            *transition =0x8000060c; state =15; goto FSM_DONE;
+        case 0x3d:
+            i++; goto FSM_S16;
+        case 0x3e:
+            *transition =0x80130606; state =15; goto FSM_DONE;
+    }
+// State 16
+FSM_S16:
+    if( i == len ) { state =16; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001115; state =16; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S16;
+        case 0x22:
+            i++; goto FSM_S19;
+        case 0x26:
+            *transition =0x80000d2d; state =16; goto FSM_DONE;
+        case 0x27:
+            i++; goto FSM_S17;
+        case 0x3c: case 0x60:
+            *transition =0x80001003; state =16; goto FSM_DONE;
+        case 0x3e:
+            *transition =0x80130606; state =16; goto FSM_DONE;
+    }
+// State 17
+FSM_S17:
+    if( i == len ) { state =17; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001112; state =17; goto FSM_DONE;
+        case 0x26:
+            *transition =0x80000d2d; state =17; goto FSM_DONE;
+        case 0x27:
+            *transition =0x80051107; state =17; goto FSM_DONE;
+    }
+// State 18
+FSM_S18:
+    if( i == len ) { state =18; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S18;
+        case 0x26:
+            *transition =0x80000d2d; state =18; goto FSM_DONE;
+        case 0x27:
+            *transition =0x80000507; state =18; goto FSM_DONE;
+    }
+// State 19
+FSM_S19:
+    if( i == len ) { state =19; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001114; state =19; goto FSM_DONE;
+        case 0x22:
+            *transition =0x80051107; state =19; goto FSM_DONE;
+        case 0x26:
+            *transition =0x80000d2d; state =19; goto FSM_DONE;
+    }
+// State 20
+FSM_S20:
+    if( i == len ) { state =20; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S20;
+        case 0x22:
+            *transition =0x80000507; state =20; goto FSM_DONE;
+        case 0x26:
+            *transition =0x80000d2d; state =20; goto FSM_DONE;
+    }
+// State 21
+FSM_S21:
+    if( i == len ) { state =21; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S21;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x80000507; state =21; goto FSM_DONE;
+        case 0x22: case 0x3c: case 0x60:
+            *transition =0x80001003; state =21; goto FSM_DONE;
+        case 0x26:
+            *transition =0x80000d2d; state =21; goto FSM_DONE;
+        case 0x3e:
+            *transition =0x80130506; state =21; goto FSM_DONE;
+    }
+// State 22
+FSM_S22:
+    if( i == len ) { state =22; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S22;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x80000802; state =22; goto FSM_DONE;
+        case 0x26:
+            *transition =0x80000e2d; state =22; goto FSM_DONE;
+        case 0x3c:
+            *transition =0x80090804; state =22; goto FSM_DONE;
+    }
+// State 23
+FSM_S23:
+    if( i == len ) { state =23; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =23; goto FSM_DONE;
+        case 0x4f: case 0x6f:
+            i++; goto FSM_S24;
+    }
+// State 24
+FSM_S24:
+    if( i == len ) { state =24; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =24; goto FSM_DONE;
+        case 0x43: case 0x63:
+            i++; goto FSM_S25;
+    }
+// State 25
+FSM_S25:
+    if( i == len ) { state =25; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =25; goto FSM_DONE;
+        case 0x54: case 0x74:
+            i++; goto FSM_S26;
+    }
+// State 26
+FSM_S26:
+    if( i == len ) { state =26; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =26; goto FSM_DONE;
+        case 0x59: case 0x79:
+            i++; goto FSM_S27;
+    }
+// State 27
+FSM_S27:
+    if( i == len ) { state =27; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =27; goto FSM_DONE;
+        case 0x50: case 0x70:
+            i++; goto FSM_S28;
+    }
+// State 28
+FSM_S28:
+    if( i == len ) { state =28; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =28; goto FSM_DONE;
+        case 0x45: case 0x65:
+            i++; goto FSM_S29;
+    }
+// State 29
+FSM_S29:
+    if( i == len ) { state =29; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =29; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            *transition =0x8000111e; state =29; goto FSM_DONE;
+    }
+// State 30
+FSM_S30:
+    if( i == len ) { state =30; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S30;
+        case 0x3e:
+            *transition =0x80000c06; state =30; goto FSM_DONE;
+    }
+// State 31
+FSM_S31:
+    if( i == len ) { state =31; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =31; goto FSM_DONE;
+        case 0x2d:
+            *transition =0x80001120; state =31; goto FSM_DONE;
+    }
+// State 32
+FSM_S32:
+    if( i == len ) { state =32; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S32;
+        case 0x2d:
+            i++; goto FSM_S33;
+    }
+// State 33
+FSM_S33:
+    if( i == len ) { state =33; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =32; i++; goto FSM_DONE;
+        case 0x2d:
+            i++; goto FSM_S34;
+    }
+// State 34
+FSM_S34:
+    if( i == len ) { state =34; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =32; i++; goto FSM_DONE;
+        case 0x2d:
+            i++; goto FSM_S34;
+        case 0x3e:
+            *transition =0x80000a06; state =34; goto FSM_DONE;
+    }
+// State 35
+FSM_S35:
+    if( i == len ) { state =35; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =35; goto FSM_DONE;
+        case 0x43:
+            i++; goto FSM_S36;
+    }
+// State 36
+FSM_S36:
+    if( i == len ) { state =36; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =36; goto FSM_DONE;
+        case 0x44:
+            i++; goto FSM_S37;
+    }
+// State 37
+FSM_S37:
+    if( i == len ) { state =37; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =37; goto FSM_DONE;
+        case 0x41:
+            i++; goto FSM_S38;
+    }
+// State 38
+FSM_S38:
+    if( i == len ) { state =38; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =38; goto FSM_DONE;
+        case 0x54:
+            i++; goto FSM_S39;
+    }
+// State 39
+FSM_S39:
+    if( i == len ) { state =39; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =39; goto FSM_DONE;
+        case 0x41:
+            i++; goto FSM_S40;
+    }
+// State 40
+FSM_S40:
+    if( i == len ) { state =40; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80001003; state =40; goto FSM_DONE;
+        case 0x5b:
+            i++; goto FSM_S41;
+    }
+// State 41
+FSM_S41:
+    if( i == len ) { state =41; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x8000112a; state =41; goto FSM_DONE;
+        case 0x5d:
+            i++; goto FSM_S43;
+    }
+// State 42
+FSM_S42:
+    if( i == len ) { state =42; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S42;
+        case 0x5d:
+            *transition =0x8000122b; state =42; goto FSM_DONE;
+    }
+// State 43
+FSM_S43:
+    if( i == len ) { state =43; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =42; i++; goto FSM_DONE;
+        case 0x5d:
+            i++; goto FSM_S44;
+    }
+// State 44
+FSM_S44:
+    if( i == len ) { state =44; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =42; i++; goto FSM_DONE;
+        case 0x3e:
+            *transition =0x80000b06; state =44; goto FSM_DONE;
+    }
+// State 45
+FSM_S45:
+    if( i == len ) { state =45; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0x80000f2f; state =45; goto FSM_DONE;
+        case 0x3b:
+            *transition =0x80000f2e; state =45; goto FSM_DONE;
+        case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+        case 0x47: case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c:
+        case 0x4d: case 0x4e: case 0x4f: case 0x50: case 0x51: case 0x52:
+        case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+        case 0x59: case 0x5a: case 0x61: case 0x62: case 0x63: case 0x64:
+        case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6a:
+        case 0x6b: case 0x6c: case 0x6d: case 0x6e: case 0x6f: case 0x70:
+        case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+        case 0x77: case 0x78: case 0x79: case 0x7a:
+            i++; goto FSM_S45;
+    }
+// State 46
+FSM_S46:
+    if( i == len ) { state =46; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =47; i++; goto FSM_DONE;
+    }
+// State 47
+FSM_S47:
+    if( i == len ) { state =47; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S47;
+    }
+// State 48
+FSM_S48:
+    if( i == len ) { state =48; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S48;
+        case 0x22:
+            *transition =0; state =51; i++; goto FSM_DONE;
+        case 0x27:
+            *transition =0; state =49; i++; goto FSM_DONE;
+        case 0x2f:
+            i++; goto FSM_S53;
+        case 0x3c:
+            *transition =0x80001239; state =48; goto FSM_DONE;
+    }
+// State 49
+FSM_S49:
+    if( i == len ) { state =49; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S49;
+        case 0x27:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x5c:
+            i++; goto FSM_S50;
+    }
+// State 50
+FSM_S50:
+    if( i == len ) { state =50; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =49; i++; goto FSM_DONE;
+    }
+// State 51
+FSM_S51:
+    if( i == len ) { state =51; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S51;
+        case 0x22:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x5c:
+            i++; goto FSM_S52;
+    }
+// State 52
+FSM_S52:
+    if( i == len ) { state =52; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =51; i++; goto FSM_DONE;
+    }
+// State 53
+FSM_S53:
+    if( i == len ) { state =53; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x2a:
+            *transition =0; state =55; i++; goto FSM_DONE;
+        case 0x2f:
+            *transition =0; state =54; i++; goto FSM_DONE;
+    }
+// State 54
+FSM_S54:
+    if( i == len ) { state =54; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S54;
+        case 0xa:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x3c:
+            i++; goto FSM_S57;
+    }
+// State 55
+FSM_S55:
+    if( i == len ) { state =55; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            i++; goto FSM_S55;
+        case 0x2a:
+            i++; goto FSM_S56;
+    }
+// State 56
+FSM_S56:
+    if( i == len ) { state =56; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =55; i++; goto FSM_DONE;
+        case 0x2f:
+            *transition =0; state =48; i++; goto FSM_DONE;
+    }
+// State 57
+FSM_S57:
+    if( i == len ) { state =57; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S57;
+        case 0x2f:
+            i++; goto FSM_S58;
+    }
+// State 58
+FSM_S58:
+    if( i == len ) { state =58; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S58;
+        case 0x53: case 0x73:
+            i++; goto FSM_S59;
+    }
+// State 59
+FSM_S59:
+    if( i == len ) { state =59; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x43: case 0x63:
+            i++; goto FSM_S60;
+    }
+// State 60
+FSM_S60:
+    if( i == len ) { state =60; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x52: case 0x72:
+            i++; goto FSM_S61;
+    }
+// State 61
+FSM_S61:
+    if( i == len ) { state =61; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x49: case 0x69:
+            i++; goto FSM_S62;
+    }
+// State 62
+FSM_S62:
+    if( i == len ) { state =62; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x50: case 0x70:
+            i++; goto FSM_S63;
+    }
+// State 63
+FSM_S63:
+    if( i == len ) { state =63; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x54: case 0x74:
+            i++; goto FSM_S64;
+    }
+// State 64
+FSM_S64:
+    if( i == len ) { state =64; goto FSM_DONE; }
+    switch( (unsigned char)buf[i] ) {
+        default:
+            *transition =0; state =48; i++; goto FSM_DONE;
+        case 0x9: case 0xa: case 0xb: case 0xc: case 0xd: case 0x20:
+            i++; goto FSM_S64;
+        case 0x3e:
+            *transition =0x80001506; state =64; goto FSM_DONE;
+    }
+FSM_DONE: ;
@@ -0,0 +1,462 @@
+// states = 65, inputs = 256
+// Resulting array is indexed by [state][class], where class is given by the class map for input+(0)
+// This file was automatically generated by fsm2array
+// Please do not edit this file directly
+// Rules to generate this file can be found in the util/ directory
+// Fused with a second FSM: bits 0-7 hold the next state, bits 8-15 and 16-23 the actions
+// of the second FSM and bit 31 is set if any of these actions is non-zero
+// Transitions for state 0
+{0x0,0x80000102,0x80000102,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,
+0x80000104,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0},
+// Transitions for state 1
+{0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1},
+// Transitions for state 2
+{0x80001116,0x2,0x2,0x80001116,0x80001116,0x80000e2d,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x4,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116},
+// Transitions for state 3
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x4,0x3,0x2,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
+// Transitions for state 4
+{0x80001003,0x4,0x4,0xd,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x8,0x80001105,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001105,0x80001105,0x80001105,
+0x80001105,0x80001105,0x80001105,0x80001105,0x80001105,0x80001105,
+0x80001105,0x80001105,0x80001105,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001105,0x80001105,0x80001105},
+// Transitions for state 5
+{0x80001003,0x80000307,0x80000307,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x8000030c,0x5,0x80001003,
+0x80001003,0x80001003,0x80130306,0x5,0x5,0x5,
+0x5,0x5,0x5,0x5,0x5,0x5,
+0x5,0x5,0x5,0x80001003,0x80001003,0x80001003,
+0x80001003,0x5,0x5,0x5},
+// Transitions for state 6
+{0x80001116,0x2,0x2,0x80001116,0x80001116,0x80000e2d,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x4,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116},
+// Transitions for state 7
+{0x8000110e,0x7,0x7,0x8000110e,0x80001003,0x8000110e,
+0x80001003,0x8000110e,0x8000110e,0xc,0x8000110e,0x8000110e,
+0x8000110e,0x80001003,0x80001306,0x8000110e,0x8000110e,0x8000110e,
+0x8000110e,0x8000110e,0x8000110e,0x8000110e,0x8000110e,0x8000110e,
+0x8000110e,0x8000110e,0x8000110e,0x8000110e,0x8000110e,0x8000110e,
+0x8000110e,0x8000110e,0x8000110e,0x8000110e},
+// Transitions for state 8
+{0x80001003,0x8,0x8,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001109,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001109,0x80001109,0x80001109,
+0x80001109,0x80001109,0x80001109,0x80001109,0x80001109,0x80001109,
+0x80001109,0x80001109,0x80001109,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001109,0x80001109,0x80001109},
+// Transitions for state 9
+{0x80001003,0x8000040a,0x8000040a,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x9,0x80001003,
+0x80001003,0x80001003,0x8000040b,0x9,0x9,0x9,
+0x9,0x9,0x9,0x9,0x9,0x9,
+0x9,0x9,0x9,0x80001003,0x80001003,0x80001003,
+0x80001003,0x9,0x9,0x9},
+// Transitions for state 10
+{0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xb,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa},
+// Transitions for state 11
+{0x80001116,0x2,0x2,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x4,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,0x80001116,
+0x80001116,0x80001116,0x80001116,0x80001116},
+// Transitions for state 12
+{0x80001003,0xc,0xc,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001406,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 13
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x1f,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x17,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x23,0x80001003,0x80001003,
+0x80001003,0x80001003,0x17,0x80001003},
+// Transitions for state 14
+{0xe,0x8000070f,0x8000070f,0xe,0x80001003,0xe,
+0x80001003,0xe,0xe,0x8000060c,0xe,0xe,
+0x80001003,0x80000710,0x80130606,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe},
+// Transitions for state 15
+{0x8011060e,0xf,0xf,0x8011060e,0x80001003,0x8011060e,
+0x80001003,0x8011060e,0x8011060e,0x8000060c,0x8011060e,0x8011060e,
+0x80001003,0x10,0x80130606,0x8011060e,0x8011060e,0x8011060e,
+0x8011060e,0x8011060e,0x8011060e,0x8011060e,0x8011060e,0x8011060e,
+0x8011060e,0x8011060e,0x8011060e,0x8011060e,0x8011060e,0x8011060e,
+0x8011060e,0x8011060e,0x8011060e,0x8011060e},
+// Transitions for state 16
+{0x80001115,0x10,0x10,0x80001115,0x13,0x80000d2d,
+0x11,0x80001115,0x80001115,0x80001115,0x80001115,0x80001115,
+0x80001003,0x80001115,0x80130606,0x80001115,0x80001115,0x80001115,
+0x80001115,0x80001115,0x80001115,0x80001115,0x80001115,0x80001115,
+0x80001115,0x80001115,0x80001115,0x80001115,0x80001115,0x80001115,
+0x80001003,0x80001115,0x80001115,0x80001115},
+// Transitions for state 17
+{0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,0x80000d2d,
+0x80051107,0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,
+0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,
+0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,
+0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,0x80001112,
+0x80001112,0x80001112,0x80001112,0x80001112},
+// Transitions for state 18
+{0x12,0x12,0x12,0x12,0x12,0x80000d2d,
+0x80000507,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12},
+// Transitions for state 19
+{0x80001114,0x80001114,0x80001114,0x80001114,0x80051107,0x80000d2d,
+0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,
+0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,
+0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,
+0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,0x80001114,
+0x80001114,0x80001114,0x80001114,0x80001114},
+// Transitions for state 20
+{0x14,0x14,0x14,0x14,0x80000507,0x80000d2d,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14},
+// Transitions for state 21
+{0x15,0x80000507,0x80000507,0x15,0x80001003,0x80000d2d,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x80001003,0x15,0x80130506,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x80001003,0x15,0x15,0x15},
+// Transitions for state 22
+{0x16,0x80000802,0x80000802,0x16,0x16,0x80000e2d,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x80090804,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16},
+// Transitions for state 23
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x18,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 24
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x19,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x19,0x80001003,0x80001003},
+// Transitions for state 25
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x1a,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x1a},
+// Transitions for state 26
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x1b,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 27
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x1c,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 28
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x1d,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 29
+{0x80001003,0x8000111e,0x8000111e,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 30
+{0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x80000c06,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e},
+// Transitions for state 31
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001120,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 32
+{0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x21,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20},
+// Transitions for state 33
+{0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x22,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20},
+// Transitions for state 34
+{0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x22,0x20,0x20,0x20,
+0x20,0x20,0x80000a06,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20},
+// Transitions for state 35
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x24,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 36
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x25,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 37
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x26,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 38
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x27,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 39
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x28,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 40
+{0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x29,0x80001003,0x80001003,
+0x80001003,0x80001003,0x80001003,0x80001003},
+// Transitions for state 41
+{0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,
+0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,
+0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,
+0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,
+0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x8000112a,0x2b,
+0x8000112a,0x8000112a,0x8000112a,0x8000112a},
+// Transitions for state 42
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x8000122b,
+0x2a,0x2a,0x2a,0x2a},
+// Transitions for state 43
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2c,
+0x2a,0x2a,0x2a,0x2a},
+// Transitions for state 44
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x80000b06,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a},
+// Transitions for state 45
+{0x80000f2f,0x80000f2f,0x80000f2f,0x80000f2f,0x80000f2f,0x80000f2f,
+0x80000f2f,0x80000f2f,0x80000f2f,0x80000f2f,0x80000f2f,0x80000f2e,
+0x80000f2f,0x80000f2f,0x80000f2f,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x80000f2f,0x80000f2f,0x80000f2f,
+0x80000f2f,0x2d,0x2d,0x2d},
+// Transitions for state 46
+{0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f},
+// Transitions for state 47
+{0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f},
+// Transitions for state 48
+{0x30,0x30,0x30,0x30,0x33,0x30,
+0x31,0x30,0x30,0x35,0x30,0x30,
+0x80001239,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 49
+{0x31,0x31,0x31,0x31,0x31,0x31,
+0x30,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x32,0x31,
+0x31,0x31,0x31,0x31},
+// Transitions for state 50
+{0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31},
+// Transitions for state 51
+{0x33,0x33,0x33,0x33,0x30,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x34,0x33,
+0x33,0x33,0x33,0x33},
+// Transitions for state 52
+{0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33},
+// Transitions for state 53
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x37,0x30,0x36,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 54
+{0x36,0x36,0x30,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36,0x36,0x36,
+0x39,0x36,0x36,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36},
+// Transitions for state 55
+{0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x38,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37},
+// Transitions for state 56
+{0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x30,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37},
+// Transitions for state 57
+{0x30,0x39,0x39,0x30,0x30,0x30,
+0x30,0x30,0x30,0x3a,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 58
+{0x30,0x3a,0x3a,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x3b,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 59
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x3c,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x3c,0x30,0x30},
+// Transitions for state 60
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x3d,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 61
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x3e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 62
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x3f,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
+// Transitions for state 63
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x40,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x40},
+// Transitions for state 64
+{0x30,0x40,0x40,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x80001506,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30}
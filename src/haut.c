@@ -15,35 +15,11 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <ctype.h>
 #include "state.h"
 #include "entity.h"
-
-/* This struct contains the internal state of the parser
- * and is opaque to the user of the API */
-struct haut_state {
-    haut_tag_t last_tag;
-    haut_error_t last_error;
-    
-    strfragment_t attr_key_ptr;
-    strbuffer_t attr_key_buffer;
-    
-    // Fragment that points to the current token, 
-    // can point to either token_buffer or token_chunk_ptr
-    strfragment_t token_ptr;
-    // Local copy of the current token (if applicable)
-    strbuffer_t token_buffer;
-    // Fragment that points to the current token in the current chunk
-    strfragment_t token_chunk_ptr;
-    // Offset used when we are parsing an entity (character reference)
-    int entity_token_offset;
-    // Whether we are collecting a token at all (true)
-    // false if token_ptr points to a meaningfull token
-    bool in_token;
-    
-    // Current lexer state and its 'one-entry stack'
-    int lexer_state;
-    int lexer_saved_state;
-};
+#include "scan.h"
+#include "haut_state.h"
 
 //#define DEBUG_PRINT
 
@@ -86,6 +62,13 @@ default_attribute_event       ( struct haut* p, strfragment_t* key, strfragment_
 #endif
 }
 
+void            
+default_attribute_id_event    ( struct haut* p, haut_attr_t attr, strfragment_t* key, strfragment_t* value ){
+#ifdef DEBUG_PRINT
+    printf( "Debug: attribute id: %d\n", attr );
+#endif
+}
+
 void            
 default_comment_event         ( struct haut* p, strfragment_t* text ){
 #ifdef DEBUG_PRINT
@@ -120,8 +103,9 @@ default_script_event          ( struct haut* p, strfragment_t* text ){
 void            
 default_error_event           ( struct haut* p, haut_error_t err ){
 #ifdef DEBUG_PRINT
+    haut_position_t pos =haut_position( p );
     printf( "Debug: Syntax error (%d) on line %d, column %d:\n", (int)err, 
-            p->position.row, p->position.col );
+            pos.row, pos.col );
 
     const int max_width = 20;
     int before = p->position.offset;
@@ -160,12 +144,14 @@ const haut_event_handler_t DEFAULT_EVENT_HANDLER = {
     .script        =default_script_event,
     .cdata         =default_cdata_event,
     .error         =default_error_event,
+    .attribute_id  =default_attribute_id_event,
 };
 
 const haut_opts_t DEFAULT_PARSER_OPTS = {
     .allocator      =default_allocator,
     .deallocator    =default_deallocator,
-    .flags          =FLAG_NONE
+    .flags          =FLAG_NONE,
+    .event_mask     =EVENT_AUTO
 };
 
 const haut_position_t POSITION_BEGIN ={
@@ -174,6 +160,39 @@ const haut_position_t POSITION_BEGIN ={
     .offset        =0
 };
 
+/* For each lexer state in which a token can begin, the event that consumes the token.
+ * Tokens of all other states are element names, which the parser always needs */
+static const uint8_t TOKEN_EVENT[L_N_STATES] = {
+    [L_ELEM_WS]                 =EVENT_ATTRIBUTE,   // Empty quoted value
+    [L_ATTR_KEY]                =EVENT_ATTRIBUTE,
+    [L_ATTR_VALUE]              =EVENT_ATTRIBUTE,
+    [L_ATTR_SINGLE_QUOTE_VALUE] =EVENT_ATTRIBUTE,
+    [L_ATTR_DOUBLE_QUOTE_VALUE] =EVENT_ATTRIBUTE,
+    [L_INNERTEXT]               =EVENT_INNERTEXT,
+    [L_COMMENT]                 =EVENT_COMMENT,
+    [L_DOCTYPE_DECLARATION]     =EVENT_DOCTYPE,
+    [L_CDATA]                   =EVENT_CDATA,
+};
+
+/** Returns true if @p has an attribute_id handler. This handler was added later than the others,
+ *  so it is also considered unset if it is NULL, as in handlers that were initialized without it */
+static inline bool
+has_attribute_id( const haut_t* p ) {
+    return p->events.attribute_id && p->events.attribute_id != DEFAULT_EVENT_HANDLER.attribute_id;
+}
+
+/** Returns true if the tokens for @event are materialized by @p */
+static inline bool
+subscribed( haut_t* p, int event ) {
+    return p->state->event_mask & event;
+}
+
+/** Returns true if the token that begins in @lexer_state is materialized by @p */
+static inline bool
+token_subscribed( haut_t* p, int lexer_state ) {
+    return !TOKEN_EVENT[lexer_state] || subscribed( p, TOKEN_EVENT[lexer_state] );
+}
+
 /** Returns the char corresponding to the current offset in @p */
 static inline char
 current_char( haut_t* p ) {
@@ -186,6 +205,43 @@ at_end( haut_t* p ) {
     return (p->length <= p->position.offset);
 }
 
+/** Advance the offset in @p by @n characters and update the row and column accordingly,
+ *  unless this is left to sync_position() */
+static inline void
+advance_position( haut_t* p, size_t n ) {
+    if( !(p->opts.flags & FLAG_LAZY_POSITION) )
+        scan_lines( p->input + p->position.offset, n, &p->position.row, &p->position.col );
+    p->position.offset +=n;
+}
+
+/** Bring the row and column in @p up to date with the offset, counting the lines since the last time */
+static inline void
+sync_position( haut_t* p ) {
+    size_t from =p->state->position_synced;
+    if( from < p->position.offset )
+        scan_lines( p->input + from, p->position.offset - from, &p->position.row, &p->position.col );
+    p->state->position_synced =p->position.offset;
+}
+
+/** Change the flags in @p, keeping the row and column consistent if FLAG_LAZY_POSITION is toggled */
+static void
+set_flags( haut_t* p, int flags ) {
+    if( (p->opts.flags & FLAG_LAZY_POSITION) && !(flags & FLAG_LAZY_POSITION) )
+        sync_position( p );
+    else if( !(p->opts.flags & FLAG_LAZY_POSITION) && (flags & FLAG_LAZY_POSITION) )
+        p->state->position_synced =p->position.offset;
+    p->opts.flags =flags;
+}
+
+/** If the lexer in @p is in a state that loops on itself, 
+ *  advance @p to the next character that can leave this state */
+static inline void
+skip_self_loop( haut_t* p ) {
+    advance_position( p, lexer_skip( p->state->lexer_state,
+                                     p->input + p->position.offset,
+                                     p->length - p->position.offset ) );
+}
+
 /** Call the error event in @p's event handler, if any */
 static inline void
 emit_error( haut_t* p, int error ) {
@@ -214,6 +270,7 @@ set_token_chunk_end( haut_t* p, int offs ) {
 
 static inline void store_current_token( haut_t* p );
 static inline void clear_current_token( haut_t* p );
+static void push_segment( haut_t* p );
 
 /** Returns true whether @p has a token that is stored locally, as opposed to inside the input buffer */ 
 static inline bool
@@ -227,6 +284,7 @@ static inline void
 begin_token( haut_t* p, int offs ) {
     set_token_chunk_begin( p, offs );
     p->state->token_ptr = p->state->token_chunk_ptr;
+    p->state->segment_buffer.size =0;
 }
 
 /** Ends the current token by either pointing to its position in the input buffer,
@@ -240,6 +298,10 @@ end_token( haut_t* p, int offs ) {
     if( has_stored_token( p ) ) {
         // We have a (partial) token stored locally
         store_current_token( p );
+    } else if( p->state->segment_buffer.size ) {
+        // The token spans chunks and its last segment is in this one
+        push_segment( p );
+        p->state->token_ptr = *(strfragment_t*)p->state->segment_buffer.data;
     } else {
         // The entire token is inside this chunk
         p->state->token_ptr = p->state->token_chunk_ptr;
@@ -259,6 +321,87 @@ store_current_token( haut_t* p ) {
     p->state->token_ptr = strbuffer_toFragment( &p->state->token_buffer );
 }
 
+/** Returns the number of segments of the current token in @p, zero if it does not span chunks */
+static inline size_t
+segment_count( const haut_t* p ) {
+    return p->state->segment_buffer.size / sizeof( strfragment_t );
+}
+
+/** Returns true if the partial token in @p can be kept in the current chunk when it ends,
+ *  instead of being stored locally. Only values and texts are delivered in segments */
+static inline bool
+can_segment_token( haut_t* p ) {
+    if( !(p->opts.flags & FLAG_SEGMENTED_TOKENS) || has_stored_token( p ) )
+        return false;
+    switch( p->state->lexer_state ) {
+        case L_ATTR_VALUE:
+        case L_ATTR_SINGLE_QUOTE_VALUE:
+        case L_ATTR_DOUBLE_QUOTE_VALUE:
+        case L_INNERTEXT:
+            return true;
+        case L_WHITESPACE:
+            // A run of text with FLAG_ACCUMULATE_INNERTEXT
+            return p->state->text_held;
+        default:
+            // The script states, but not those of its close tag
+            return p->state->lexer_state >= L_SCRIPT && p->state->lexer_state < L_SCRIPT_LT;
+    }
+}
+
+/** Add the part of the token pointed to by the token chunk pointer to the segments of the current token.
+ *  Empty parts are left out */
+static void
+push_segment( haut_t* p ) {
+    strbuffer_t* b =&p->state->segment_buffer;
+    if( !p->state->token_chunk_ptr.size )
+        return;
+    strbuffer_grow( b, sizeof( strfragment_t ) );
+    memcpy( b->data + b->size, &p->state->token_chunk_ptr, sizeof( strfragment_t ) );
+    b->size +=sizeof( strfragment_t );
+}
+
+/** Returns the length of the current token in @p up to the current position, including previous chunks */
+static size_t
+token_length( haut_t* p ) {
+    size_t n =(p->input + p->position.offset) - p->state->token_chunk_ptr.data;
+    if( has_stored_token( p ) )
+        return n + p->state->token_buffer.size;
+    const strfragment_t* segments =(const strfragment_t*)p->state->segment_buffer.data;
+    for( size_t i =0; i < segment_count( p ); i++ )
+        n +=segments[i].size;
+    return n;
+}
+
+/** Shorten the completed token in @p to its first @size characters */
+static void
+truncate_token( haut_t* p, size_t size ) {
+    size_t n =segment_count( p );
+    if( !n ) {
+        p->state->token_ptr.size =size;
+        return;
+    }
+    strfragment_t* segments =(strfragment_t*)p->state->segment_buffer.data;
+    size_t i =0;
+    for( ; i < n - 1 && segments[i].size < size; i++ )
+        size -=segments[i].size;
+    segments[i].size =size;
+    p->state->segment_buffer.size =(i + 1) * sizeof( strfragment_t );
+    p->state->token_ptr =segments[0];
+}
+
+/** Copy the segments of the current token in @p to the local token buffer.
+ *  After calling this function, the current token is stored locally */
+static void
+store_segments( haut_t* p ) {
+    const strfragment_t* segments =(const strfragment_t*)p->state->segment_buffer.data;
+    size_t n =segment_count( p );
+    strbuffer_clear( &p->state->token_buffer );
+    for( size_t i =0; i < n; i++ )
+        strbuffer_append( &p->state->token_buffer, segments[i].data, segments[i].size );
+    p->state->segment_buffer.size =0;
+    p->state->token_ptr = strbuffer_toFragment( &p->state->token_buffer );
+}
+
 /** Make a local copy of the data pointed to by attr_key_ptr in @p 
  *  This function is called when parsing an attribute and the key that has been parsed,
  *  needs to be saved - either if the chunk ends or an entity is encountered. */
@@ -276,15 +419,184 @@ store_attr_key( haut_t* p ) {
 static inline void
 clear_current_token( haut_t* p ) {
     strbuffer_clear( &p->state->token_buffer );
+    p->state->segment_buffer.size =0;
     p->state->token_chunk_ptr.size =0;
     p->state->token_ptr = p->state->token_chunk_ptr;
     p->state->in_token =false;
+    p->state->text_held =false;
+}
+
+/** End the skip request in @p, if any, because its start tag has ended */
+static inline void
+end_skip_request( haut_t* p ) {
+    p->state->skip.phase =SKIP_NONE;
+    p->state->event_mask =haut_event_mask( p );
+}
+
+/** Returns true if @c ends the name of the element in an open (@open) or close tag */
+static inline bool
+is_name_end( char c, bool open ) {
+    switch( c ) {
+        case ' ': case '\t': case '\n': case '\f': case '\r': case '>':
+            return true;
+        case '/':
+            return open;
+        default:
+            return false;
+    }
+}
+
+/** Advance @p over the content of the element that is skipped, up to the end of the name in its close tag.
+ *  Only the nesting of elements with the same name is tracked and comments and CDATA are skipped,
+ *  scripts and quoted attribute values inside the subtree are not interpreted.
+ *  When the close tag is found, the lexer continues as if it had just read its name.
+ *  Otherwise, all input is consumed and the scan is resumed by the next call */
+static void
+skip_subtree( haut_t* p ) {
+    struct haut_state* s =p->state;
+    const char* begin =p->input + p->position.offset;
+    const char* end =p->input + p->length;
+    const char* c =begin;
+
+    while( c < end ) {
+        switch( s->skip.phase ) {
+            case SKIP_TEXT:
+                c =memchr( c, '<', end - c );
+                if( !c ) {
+                    c =end;
+                    break;
+                }
+                c++;
+                s->skip.phase =SKIP_TAG_BEGIN;
+                break;
+            case SKIP_TAG_BEGIN:
+                s->skip.matched =0;
+                if( *c == '/' ) {
+                    s->skip.phase =SKIP_CLOSE_NAME;
+                    c++;
+                } else if( *c == '!' ) {
+                    s->skip.phase =SKIP_MARKUP;
+                    c++;
+                } else
+                    s->skip.phase =SKIP_OPEN_NAME;
+                break;
+            case SKIP_OPEN_NAME:
+            case SKIP_CLOSE_NAME: {
+                bool open =s->skip.phase == SKIP_OPEN_NAME;
+                if( s->skip.matched < s->skip.length ) {
+                    // A mismatch is parsed again as text, it may be the next '<'
+                    if( tolower( (unsigned char)*c ) == tolower( (unsigned char)s->skip.name[s->skip.matched] ) ) {
+                        s->skip.matched++;
+                        c++;
+                    } else
+                        s->skip.phase =SKIP_TEXT;
+                    break;
+                }
+                if( !is_name_end( *c, open ) ) {
+                    s->skip.phase =SKIP_TEXT;
+                } else if( open ) {
+                    s->skip.phase =SKIP_OPEN_TAG;
+                    s->skip.matched =0;
+                } else if( --s->skip.depth ) {
+                    s->skip.phase =SKIP_TEXT;
+                } else {
+                    /* This is the close tag of the skipped element: continue lexing its name */
+                    s->skip.phase =SKIP_NONE;
+                    advance_position( p, c - begin );
+                    clear_current_token( p );
+                    strbuffer_append( &s->token_buffer, s->skip.name, s->skip.length );
+                    s->token_ptr =strbuffer_toFragment( &s->token_buffer );
+                    set_token_chunk_begin( p, 0 );
+                    s->lexer_state =L_CLOSE_ELEM;
+                    return;
+                }
+                break;
+            }
+            case SKIP_OPEN_TAG:
+                // Here, @matched is set if the last character was a '/'
+                if( *c == '>' ) {
+                    if( !s->skip.matched )
+                        s->skip.depth++;
+                    s->skip.phase =SKIP_TEXT;
+                } else
+                    s->skip.matched =(*c == '/');
+                c++;
+                break;
+            case SKIP_MARKUP:
+                if( *c == '[' && !s->skip.matched ) {
+                    s->skip.phase =SKIP_CDATA;
+                    c++;
+                    break;
+                }
+                if( *c != '-' ) {
+                    s->skip.phase =SKIP_TEXT;
+                    break;
+                }
+                c++;
+                if( ++s->skip.matched == 2 ) {
+                    s->skip.phase =SKIP_COMMENT;
+                    s->skip.matched =0;
+                }
+                break;
+            case SKIP_COMMENT:
+            case SKIP_CDATA: {
+                // Here, @matched counts the dashes (brackets) before the current character
+                char dash =s->skip.phase == SKIP_COMMENT ? '-' : ']';
+                if( *c == '>' && s->skip.matched >= 2 )
+                    s->skip.phase =SKIP_TEXT;
+                else
+                    s->skip.matched =(*c == dash) ? s->skip.matched + 1 : 0;
+                c++;
+                break;
+            }
+        }
+    }
+    advance_position( p, c - begin );
+}
+
+/** Skip the characters in @p that do not need the FSM: 
+ *  the content of a skipped element and characters that do not change the lexer's state */
+static inline void
+skip_input( haut_t* p ) {
+    if( p->state->skip.phase >= SKIP_TEXT )
+        skip_subtree( p );
+    skip_self_loop( p );
+}
+
+/** Returns true if @lexer_state is part of a run of text */
+static inline bool
+is_text_state( int lexer_state ) {
+    switch( lexer_state ) {
+        case L_WHITESPACE:
+        case L_INNERTEXT:
+        case L_ENTITY:
+        case L_ENTITY_END:
+        case L_ENTITY_END_DIRTY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Emit the run of text that was held in @p, without the whitespace after its last word.
+ *  This is done by the first action after the run, which may be a few characters later */
+static void
+flush_text( haut_t* p ) {
+    end_token( p, 0 );
+    truncate_token( p, p->state->text_size );
+    if( subscribed( p, EVENT_INNERTEXT ) )
+        p->events.innertext( p, &p->state->token_ptr );
+    clear_current_token( p );
 }
 
 /** Given the new state of the parser, performs the action corresponding to the semantics of that state,
  *  Additionally, the lexer's next state may be modified (for example, if it was stored previously). */
 static inline bool
 dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
+    // A run of text that ended in whitespace has ended when the lexer leaves the text
+    if( p->state->text_held && !is_text_state( p->state->lexer_state ) )
+        flush_text( p );
+
     switch( state ) {
         /* Public events */
         default:
@@ -300,8 +612,13 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
         case P_ELEMENT_OPEN:
             end_token( p, 0 );
             p->state->last_tag =decode_tag( p->state->token_ptr.data, p->state->token_ptr.size );
+            // A request for a start tag that never ended
+            if( p->state->skip.phase == SKIP_PENDING )
+                end_skip_request( p );
 
+            p->state->in_element_open =true;
             p->events.element_open( p, p->state->last_tag, &p->state->token_ptr );
+            p->state->in_element_open =false;
             clear_current_token( p );
             break;
 
@@ -315,26 +632,36 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
 
         case P_ATTRIBUTE:
             end_token( p, 0 );
-            p->events.attribute( p, &p->state->attr_key_ptr, &p->state->token_ptr );
+            if( subscribed( p, EVENT_ATTRIBUTE ) )
+                haut_emit_attribute( p, &p->state->attr_key_ptr, &p->state->token_ptr );
             p->state->attr_key_ptr.data = NULL;
             clear_current_token( p );
             break;
         
         case P_ATTRIBUTE_VOID:
             end_token( p, 0 );
-            // The attribute key may already have been stored
-            if( p->state->attr_key_ptr.data != NULL )
-                p->events.attribute( p, &p->state->attr_key_ptr, NULL );
-            // Otherwise we use the current token
-            else
-                p->events.attribute( p, &p->state->token_ptr, NULL );
+            if( subscribed( p, EVENT_ATTRIBUTE ) ) {
+                // The attribute key may already have been stored
+                if( p->state->attr_key_ptr.data != NULL )
+                    haut_emit_attribute( p, &p->state->attr_key_ptr, NULL );
+                // Otherwise we use the current token
+                else
+                    haut_emit_attribute( p, &p->state->token_ptr, NULL );
+            }
             p->state->attr_key_ptr.data = NULL;
             clear_current_token( p );
             break;
 
         case P_INNERTEXT:
+            // With FLAG_ACCUMULATE_INNERTEXT, the token continues with the whitespace after the word
+            if( *next_lexer_state == L_WHITESPACE && (p->opts.flags & FLAG_ACCUMULATE_INNERTEXT) && p->state->in_token ) {
+                p->state->text_size =token_length( p );
+                p->state->text_held =true;
+                break;
+            }
             end_token( p, 0 );
-            p->events.innertext( p, &p->state->token_ptr );
+            if( subscribed( p, EVENT_INNERTEXT ) )
+                p->events.innertext( p, &p->state->token_ptr );
             clear_current_token( p );
             break;
 
@@ -342,7 +669,13 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
             break;
 
         case P_COMMENT:
-            end_token( p, -2 ); // Exclude the trailing --
+            if( !subscribed( p, EVENT_COMMENT ) ) {
+                clear_current_token( p );
+                break;
+            }
+            // The trailing -- may be in a previous chunk, so it is removed after the token has ended
+            end_token( p, 0 );
+            p->state->token_ptr.size -=2; // Exclude the trailing --
             p->state->token_ptr.data++; // Exclude the leading -
             // Double check the new token size
             if( --p->state->token_ptr.size )
@@ -351,32 +684,42 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
             break;
         
         case P_CDATA:
-            p->events.cdata( p, &p->state->token_ptr );
+            if( subscribed( p, EVENT_CDATA ) )
+                p->events.cdata( p, &p->state->token_ptr );
             clear_current_token( p );
             break;
 
         case P_DOCTYPE:
             end_token( p, 0 );
-            p->events.doctype( p, &p->state->token_ptr );
+            if( subscribed( p, EVENT_DOCTYPE ) )
+                p->events.doctype( p, &p->state->token_ptr );
             clear_current_token( p );
             break;
 
         case P_INNERTEXT_ENTITY_BEGIN:
                 p->state->lexer_saved_state = L_INNERTEXT;
         case P_ENTITY_BEGIN:
-            if( !p->state->in_token ) {
+            if( p->state->lexer_state == L_ATTR_EQUALS )
+                p->state->lexer_saved_state = L_ATTR_VALUE;
+            else if( state != P_INNERTEXT_ENTITY_BEGIN )
+                p->state->lexer_saved_state = p->state->lexer_state;
+            // If the surrounding token is not needed, the entity is only collected to validate it
+            if( !token_subscribed( p, p->state->lexer_saved_state ) ) {
+                clear_current_token( p );
+                begin_token( p, 0 );
+                p->state->entity_token_offset =0;
+            } else if( !p->state->in_token ) {
                 begin_token( p, 0 );
                 p->state->entity_token_offset =0;
             } else {
                 set_token_chunk_end( p, 0 );
+                // The entity is decoded into the local copy of the token
+                if( p->state->segment_buffer.size )
+                    store_segments( p );
                 store_current_token( p );       
                 p->state->entity_token_offset = p->state->token_buffer.size;
                 set_token_chunk_begin( p, 0 );
             }
-            if( p->state->lexer_state == L_ATTR_EQUALS )
-                p->state->lexer_saved_state = L_ATTR_VALUE;
-            else if( state != P_INNERTEXT_ENTITY_BEGIN )
-                p->state->lexer_saved_state = p->state->lexer_state;
             break;
 
         case P_ENTITY:
@@ -387,17 +730,21 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
                     p->state->token_ptr.size - p->state->entity_token_offset,
                     p->state->token_ptr.data + p->state->entity_token_offset,
                     p->state->token_ptr.size - p->state->entity_token_offset );*/
-            char32_t entity = decode_entity( 
+            size_t utf8_len;
+            const char* entity = decode_entity_utf8( 
                     p->state->token_ptr.data + p->state->entity_token_offset + 1, 
-                    p->state->token_ptr.size - p->state->entity_token_offset - 1 );
-            if( entity != ENTITY_UNKNOWN ) { 
-                strbuffer_t tmp;
-                u32toUTF8( &tmp, entity );
+                    p->state->token_ptr.size - p->state->entity_token_offset - 1,
+                    &utf8_len );
+            bool keep =token_subscribed( p, p->state->lexer_saved_state );
+            if( !keep ) {
+                if( !entity )
+                    emit_error( p, ERROR_UNKNOWN_ENTITY );
+                clear_current_token( p );
+            } else if( entity ) { 
                 // Append the decoded entity to whatever token we were parsing
                 if( has_stored_token( p ) )
                     p->state->token_buffer.size =p->state->entity_token_offset;
-                strbuffer_append( &p->state->token_buffer, tmp.data, tmp.size );
-                strbuffer_free( &tmp );
+                strbuffer_append( &p->state->token_buffer, entity, utf8_len );
                 p->state->token_ptr = strbuffer_toFragment( &p->state->token_buffer );
                 set_token_chunk_begin( p, 1 );
             } else {
@@ -416,8 +763,9 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
 
             // Apparantly, due to errors in the HTML,
             // we have consumed one too many characters from the input stream
-            if( entity == ENTITY_UNKNOWN || p->state->lexer_state == L_ENTITY_END_DIRTY ) {
-                set_token_chunk_begin( p, 0 );
+            if( !entity || p->state->lexer_state == L_ENTITY_END_DIRTY ) {
+                if( keep )
+                    set_token_chunk_begin( p, 0 );
                 p->state->lexer_state =*next_lexer_state;
                 // Jump back to the parser main loop, 
                 // causing the current character to be parsed again
@@ -427,7 +775,7 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
             break;
 
         case P_ERROR:
-            p->events.error( p, ERROR_SYNTAX_ERROR );
+            emit_error( p, ERROR_SYNTAX_ERROR );
             // For some syntax errors, we actively return the lexer to its previous state,
             // in an attempt to continue the current token dispite the wrong syntax.
             switch( p->state->lexer_state ) {
@@ -448,7 +796,7 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
             break;
 
         case P_TOKEN_BEGIN:
-            if( !p->state->in_token )
+            if( !p->state->in_token && token_subscribed( p, *next_lexer_state ) )
                 begin_token( p, 0 );
             break;
         case P_TOKEN_END:
@@ -456,6 +804,8 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
                 end_token( p, 0 );
             break;
         case P_ATTRIBUTE_KEY:
+            if( !subscribed( p, EVENT_ATTRIBUTE ) )
+                break;
             end_token( p, 0 );
             p->state->attr_key_ptr = p->state->token_ptr;
             if( p->state->token_ptr.data == p->state->token_buffer.data ) {
@@ -463,15 +813,39 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
             }
             break;
         case P_ELEMENT_END:
+            if( p->state->skip.phase == SKIP_PENDING ) {
+                bool is_void =haut_isVoidElement( p->state->last_tag );
+                end_skip_request( p );
+                if( p->state->last_tag == TAG_SCRIPT ) {
+                    /* The lexer already skips scripts, their close tag does not emit an event either */
+                    p->state->skip.phase =SKIP_SCRIPT;
+                    *next_lexer_state =L_SCRIPT;
+                } else if( !is_void ) {
+                    p->state->skip.phase =SKIP_TEXT;
+                    p->state->skip.depth =1;
+                }
+                break;
+            }
             if( p->state->last_tag == TAG_SCRIPT ) {
-                begin_token( p, 1 );
+                if( subscribed( p, EVENT_SCRIPT ) )
+                    begin_token( p, 1 );
                 *next_lexer_state =L_SCRIPT;
             }
             break;
         case P_VOID_ELEMENT_END:
+            if( p->state->skip.phase == SKIP_PENDING )
+                end_skip_request( p );
             break;
         case P_SCRIPT_END:
-            p->events.script( p, &p->state->token_ptr );
+            if( p->state->skip.phase == SKIP_SCRIPT )
+                p->state->skip.phase =SKIP_NONE;
+            else if( subscribed( p, EVENT_SCRIPT ) ) {
+                // A script that ends inside a comment has not ended its token,
+                // it consists of the segments that were saved at the end of previous chunks
+                if( p->state->in_token && p->state->segment_buffer.size )
+                    p->state->token_ptr = *(strfragment_t*)p->state->segment_buffer.data;
+                p->events.script( p, &p->state->token_ptr );
+            }
             clear_current_token( p );
             break;
         case P_RESET_LEXER:
@@ -496,22 +870,43 @@ dispatch_parser_action( haut_t* p, int state, int* next_lexer_state ) {
 
 void
 haut_init(  haut_t* p ) {
+    haut_initOpts( p, DEFAULT_PARSER_OPTS );
+}
+
+void
+haut_initOpts( haut_t* p, haut_opts_t opts ) {
     memset( p, 0, sizeof( haut_t ) );
-    p->opts =DEFAULT_PARSER_OPTS;
+    p->opts =opts;
     p->events =DEFAULT_EVENT_HANDLER;
     p->position =POSITION_BEGIN;
-    p->state = (struct haut_state*)malloc( sizeof( struct haut_state ) );
+    p->state = (struct haut_state*)opts.allocator( opts.allocator_data, sizeof( struct haut_state ) );
     memset( p->state, 0, sizeof( struct haut_state ) );
-    strbuffer_init( &p->state->token_buffer );
-    strbuffer_init( &p->state->attr_key_buffer );
+    p->state->allocator.allocate =opts.allocator;
+    p->state->allocator.deallocate =opts.deallocator;
+    p->state->allocator.userdata =opts.allocator_data;
+    // The buffers call malloc() directly for the default allocator
+    const strallocator_t* a =opts.allocator == default_allocator ? NULL : &p->state->allocator;
+    strbuffer_initAllocator( &p->state->token_buffer, a );
+    strbuffer_initAllocator( &p->state->attr_key_buffer, a );
+    strbuffer_initAllocator( &p->state->segment_buffer, a );
     p->state->lexer_state = L_BEGIN;
 }
 
 void
 haut_destroy( haut_t* p ) {
+    strallocator_t a =p->state->allocator;
     strbuffer_free( &p->state->token_buffer );
     strbuffer_free( &p->state->attr_key_buffer );
-    free( p->state );
+    strbuffer_free( &p->state->segment_buffer );
+    a.deallocate( a.userdata, p->state );
+}
+
+void
+haut_reset( haut_t* p ) {
+    haut_state_reset( p->state );
+    p->input =NULL;
+    p->length =0;
+    p->position =POSITION_BEGIN;
 }
 
 void
@@ -519,42 +914,157 @@ haut_setInput( haut_t* p, const char* buffer, size_t len ) {
     p->input =(char*)buffer;
     p->length =len;
     p->position.offset =0;
+    p->state->position_synced =0;
+    p->state->in_chunk =false;
+}
+
+/** Apply the result of a run of the fused FSM over @n characters that stopped on @transition:
+ *  advance the position and dispatch the parser's actions, if any */
+static inline void
+finish_run( haut_t* p, size_t n, uint32_t transition ) {
+    int next_lexer_state;
+
+    advance_position( p, n );
+    if( at_end( p ) || !(transition & FUSED_ACTION_BIT) ) 
+        return;
+
+    /* We now have two lexer states: the current and the next.
+     * The parser's FSM responded on this transition by generating
+     * one or two actions that semantically describe this transition */
+    next_lexer_state =FUSED_NEXT_STATE( transition );
+
+//        printf( "(%d,%d)\n", p->state->lexer_state, next_lexer_state );
+
+    /* If an action requests so, the current character is parsed again */
+    if( !dispatch_parser_action( p, FUSED_ACTION( transition, 0 ), &next_lexer_state ) )
+        return;
+    if( !dispatch_parser_action( p, FUSED_ACTION( transition, 1 ), &next_lexer_state ) )
+        return;
+    
+    /* Lastly, make the lexer's next state current and advance the counters */
+    p->state->lexer_state =next_lexer_state;
+    advance_position( p, 1 );
+}
+
+/** Prepare @p for parsing: resume it if it was paused and update the event mask.
+ *  Returns false if @p has been stopped */
+static bool
+begin_parse( haut_t* p ) {
+    if( p->state->halt == HALT_STOP )
+        return false;
+    p->state->halt =HALT_NONE;
+    p->state->event_mask =haut_event_mask( p );
+    if( p->state->skip.phase == SKIP_PENDING )
+        p->state->event_mask &=~EVENT_ATTRIBUTE;
+    return true;
+}
+
+static void finish_chunk( haut_t* p );
+
+/** Called whenever parsing returns to the user, either at the end of the input or because it was halted */
+static void
+end_parse( haut_t* p ) {
+    /* A held run of text at the end of the document is not followed by any action that flushes it.
+     * With haut_parseChunk(), the end of the document is marked by an empty chunk */
+    if( p->state->text_held && at_end( p ) && !p->state->more_input
+            && (!p->state->in_chunk || p->length == 0) )
+        flush_text( p );
+    /* The bookkeeping of a chunk can only be done once all of it has been parsed */
+    if( p->state->in_chunk && at_end( p ) )
+        finish_chunk( p );
+    /* The input may not be around anymore when the position is asked for */
+    if( p->opts.flags & FLAG_LAZY_POSITION )
+        sync_position( p );
 }
 
 void
 haut_parse( haut_t* p ) {
-    char c;
-    int next_lexer_state;
-    const char *parser_state;
+    uint32_t transition;
+    size_t n;
+
+    if( !begin_parse( p ) )
+        return;
     
     while( !at_end( p ) ) {
+        /* Skip all characters that would not change the current state of the lexer,
+         * or the entire content of an element that the user is not interested in */
+        skip_input( p );
+        if( at_end( p ) )
+            break;
 
-REREAD:
-        c =current_char( p );
-        /* Insert the character into the lexer's FSM */
-        next_lexer_state =lexer_next_state( p->state->lexer_state, c );
+        /* Run the fused lexer/parser FSM up to the first character whose transition 
+         * requires an action from the parser. All characters before it only change the lexer's state.
+         * The run also ends when the lexer enters a state that can be skipped */
+        n =lexer_fused_run( &p->state->lexer_state, 
+                            p->input + p->position.offset,
+                            p->length - p->position.offset,
+                            &transition );
+        finish_run( p, n, transition );
 
-        /* We now have two lexer states: the current and the next.
-         * The parser's FSM responds on this transition by generating (a)
-         * state(s) that semantically describes this transition */
-        parser_state =parser_next_state( p->state->lexer_state, next_lexer_state );
+        /* One of the handlers has called haut_stop() or haut_pause() */
+        if( p->state->halt )
+            break;
+    }
 
-//        printf( "(%d,%d)\n", p->state->lexer_state, next_lexer_state );
+    end_parse( p );
+}
 
-        /* The parser FSM gives either zero, one or two new states that define serialized actions */
-        for( int k =0; k < 2; k++ ) {
-            if( !dispatch_parser_action( p, parser_state[k], &next_lexer_state ) )
-                goto REREAD;
+/** Prepare the stream of @p for the next run of lexer_fused_run_interleaved(). 
+ *  Returns false if the input of @p is exhausted */
+static bool
+load_stream( haut_t* p, lexer_stream_t* s ) {
+    skip_input( p );
+    if( at_end( p ) || p->state->halt ) {
+        end_parse( p );
+        return false;
+    }
+    s->state =p->state->lexer_state;
+    s->buf =p->input + p->position.offset;
+    s->end =p->input + p->length;
+    return true;
+}
+
+void
+haut_parseInterleaved( haut_t** parsers, int count, int streams ) {
+    lexer_stream_t stream[LEXER_MAX_STREAMS];
+    haut_t* lane[LEXER_MAX_STREAMS];
+    int next =0, n =0;
+
+    if( streams > LEXER_MAX_STREAMS )
+        streams =LEXER_MAX_STREAMS;
+    if( streams < 1 )
+        streams =1;
+
+    for( ;; ) {
+        /* Fill the empty lanes with the next parsers that have input left */
+        while( n < streams && next < count ) {
+            if( begin_parse( parsers[next] ) && load_stream( parsers[next], &stream[n] ) )
+                lane[n++] =parsers[next];
+            next++;
+        }
+        /* Interleaving a single stream only adds overhead */
+        if( n < 2 ) {
+            if( n )
+                haut_parse( lane[0] );
+            if( next == count )
+                break;
+            n =0;
+            continue;
+        }
+
+        int k =lexer_fused_run_interleaved( stream, n );
+
+        /* All other streams have only moved through states without actions, 
+         * their position is brought up to date when they stop */
+        haut_t* p =lane[k];
+        p->state->lexer_state =stream[k].state;
+        finish_run( p, stream[k].buf - (p->input + p->position.offset), stream[k].transition );
+        if( !load_stream( p, &stream[k] ) ) {
+            /* The lane is freed by moving the last lane in its place */
+            n--;
+            lane[k] =lane[n];
+            stream[k] =stream[n];
         }
-        
-        /* Lastly, make the lexer's next state current and advance the counters */
-        p->state->lexer_state =next_lexer_state;
-        p->position.offset++;
-        if( c == '\n' ) {
-            p->position.row++;
-            p->position.col = 1;
-        } else if( c != '\r' )
-            p->position.col++;
     }
 }
 
@@ -562,6 +1072,8 @@ void
 haut_parseChunk( haut_t* p, const char* buffer, size_t len ) {
     /* In this function, we parse a part of the input (chunk)
      * and save the state for future calls */
+    if( p->state->halt == HALT_STOP )
+        return;
     
     haut_setInput( p, buffer, len );
 
@@ -569,24 +1081,191 @@ haut_parseChunk( haut_t* p, const char* buffer, size_t len ) {
      */
     if( p->state->in_token )
         set_token_chunk_begin( p, 0 );
+    p->state->in_chunk =true;
     haut_parse( p );
+}
+
+/** Save the state that refers to the current chunk in @p, after it has been parsed entirely */
+static void
+finish_chunk( haut_t* p ) {
+    p->state->in_chunk =false;
     /* Attributes consist of two tokens (key, value). The key needs to be saved separately
      */
     if( p->state->attr_key_ptr.data && p->state->attr_key_ptr.data != p->state->attr_key_buffer.data ) {
+        // The completed token is the key itself, it is not needed anymore
+        if( !p->state->in_token && p->state->token_ptr.data == p->state->attr_key_ptr.data )
+            clear_current_token( p );
         store_attr_key( p );
     }
     /* Save the current token, if any */
     if( p->state->in_token ) {
         // Partial token
         set_token_chunk_end( p, 0 );
-        store_current_token( p );
+        if( can_segment_token( p ) )
+            push_segment( p );
+        else {
+            if( p->state->segment_buffer.size )
+                store_segments( p );
+            store_current_token( p );
+        }
         set_token_chunk_begin( p, 0 );
     }
     else if( !has_stored_token( p ) && p->state->token_ptr.size ) {
-        // Completed token
-        clear_current_token( p );
-        store_current_token( p );
+        // Completed token, that is kept in place if the caller retains the chunks
+        if( p->opts.flags & FLAG_SEGMENTED_TOKENS )
+            return;
+        if( p->state->segment_buffer.size )
+            store_segments( p );
+        else {
+            strbuffer_clear( &p->state->token_buffer );
+            p->state->token_chunk_ptr =p->state->token_ptr;
+            store_current_token( p );
+        }
+    }
+}
+
+/** Returns 1 if @f points into the token buffer of @s, 2 if it points into the attribute key buffer 
+ *  and 0 if it points elsewhere (into the input). The offset into the buffer is stored in @offs */
+static int
+fragment_origin( const strfragment_t* f, const struct haut_state* s, size_t* offs ) {
+    const strbuffer_t* buffers[2] ={ &s->token_buffer, &s->attr_key_buffer };
+    for( int i =0; i < 2; i++ ) {
+        if( f->data >= buffers[i]->data && f->data <= buffers[i]->data + buffers[i]->capacity ) {
+            *offs =f->data - buffers[i]->data;
+            return i+1;
+        }
+    }
+    *offs =0;
+    return 0;
+}
+
+/** Returns true if @a in state @sa and @b in state @sb refer to the same characters at equivalent locations */
+static bool
+same_fragment( const strfragment_t* a, const struct haut_state* sa, const strfragment_t* b, const struct haut_state* sb ) {
+    size_t offs_a, offs_b;
+    if( a->size != b->size || (a->data == NULL) != (b->data == NULL) )
+        return false;
+    int origin =fragment_origin( a, sa, &offs_a );
+    if( origin != fragment_origin( b, sb, &offs_b ) || offs_a != offs_b )
+        return false;
+    if( origin )
+        return memcmp( a->data, b->data, a->size ) == 0;
+    // An empty fragment in the input is not used, except as the start of the next token
+    return a->data == b->data || a->size == 0;
+}
+
+/** Make @f, that belongs to state @src, point to the equivalent location in @dst */
+static void
+remap_fragment( strfragment_t* f, const struct haut_state* src, struct haut_state* dst ) {
+    size_t offs;
+    switch( fragment_origin( f, src, &offs ) ) {
+        case 1: f->data =dst->token_buffer.data + offs; break;
+        case 2: f->data =dst->attr_key_buffer.data + offs; break;
+        default: break;
+    }
+}
+
+static void
+copy_buffer( strbuffer_t* dst, const strbuffer_t* src ) {
+    strbuffer_reserve( dst, src->capacity );
+    memcpy( dst->data, src->data, src->size + 1 );
+    dst->size =src->size;
+}
+
+void
+haut_state_reset( struct haut_state* s ) {
+    strallocator_t allocator =s->allocator;
+    strbuffer_t token_buffer =s->token_buffer;
+    strbuffer_t attr_key_buffer =s->attr_key_buffer;
+    strbuffer_t segment_buffer =s->segment_buffer;
+    memset( s, 0, sizeof( struct haut_state ) );
+    s->allocator =allocator;
+    s->token_buffer =token_buffer;
+    s->attr_key_buffer =attr_key_buffer;
+    s->segment_buffer =segment_buffer;
+    strbuffer_clear( &s->token_buffer );
+    strbuffer_clear( &s->attr_key_buffer );
+    strbuffer_clear( &s->segment_buffer );
+    s->lexer_state =L_BEGIN;
+}
+
+void
+haut_state_copy( struct haut_state* dst, const struct haut_state* src ) {
+    strbuffer_t token_buffer =dst->token_buffer, attr_key_buffer =dst->attr_key_buffer;
+    strbuffer_t segment_buffer =dst->segment_buffer;
+    copy_buffer( &token_buffer, &src->token_buffer );
+    copy_buffer( &attr_key_buffer, &src->attr_key_buffer );
+    // The segments point into the input, so they are valid for both states
+    copy_buffer( &segment_buffer, &src->segment_buffer );
+
+    strallocator_t allocator =dst->allocator;
+    *dst =*src;
+    dst->allocator =allocator;
+    dst->token_buffer =token_buffer;
+    dst->attr_key_buffer =attr_key_buffer;
+    dst->segment_buffer =segment_buffer;
+    if( dst->attr_key_ptr.data )
+        remap_fragment( &dst->attr_key_ptr, src, dst );
+    remap_fragment( &dst->token_ptr, src, dst );
+    remap_fragment( &dst->token_chunk_ptr, src, dst );
+}
+
+bool
+haut_state_equal( const struct haut_state* a, const struct haut_state* b ) {
+    if( a->lexer_state != b->lexer_state 
+            || a->in_token != b->in_token
+            || a->text_held != b->text_held
+            || (a->text_held && a->text_size != b->text_size)
+            || a->last_tag != b->last_tag )
+        return false;
+    // Skipping depends on the input before the state, so it is never speculated
+    if( a->skip.phase != SKIP_NONE || b->skip.phase != SKIP_NONE )
+        return false;
+    if( a->segment_buffer.size || b->segment_buffer.size )
+        return false;
+    // The entity offset and the saved lexer state are only used until the entity ends
+    if( a->lexer_state == L_ENTITY || a->lexer_state == L_ENTITY_END || a->lexer_state == L_ENTITY_END_DIRTY ) {
+        if( a->entity_token_offset != b->entity_token_offset 
+                || a->lexer_saved_state != b->lexer_saved_state )
+            return false;
     }
+    if( a->token_buffer.size != b->token_buffer.size 
+            || memcmp( a->token_buffer.data, b->token_buffer.data, a->token_buffer.size ) != 0 )
+        return false;
+    if( !same_fragment( &a->token_ptr, a, &b->token_ptr, b ) )
+        return false;
+    if( a->in_token && !same_fragment( &a->token_chunk_ptr, a, &b->token_chunk_ptr, b ) )
+        return false;
+    if( (a->attr_key_ptr.data == NULL) != (b->attr_key_ptr.data == NULL) )
+        return false;
+    if( a->attr_key_ptr.data && !same_fragment( &a->attr_key_ptr, a, &b->attr_key_ptr, b ) )
+        return false;
+    return true;
+}
+
+int
+haut_event_mask( const haut_t* p ) {
+    if( p->opts.event_mask != EVENT_AUTO )
+        return p->opts.event_mask | EVENT_ELEMENT;
+
+    const haut_event_handler_t* e =&p->events;
+    const haut_event_handler_t* d =&DEFAULT_EVENT_HANDLER;
+    int mask =EVENT_ELEMENT;
+    if( e->attribute != d->attribute || has_attribute_id( p ) ) mask |=EVENT_ATTRIBUTE;
+    if( e->comment != d->comment ) mask |=EVENT_COMMENT;
+    if( e->innertext != d->innertext ) mask |=EVENT_INNERTEXT;
+    if( e->cdata != d->cdata ) mask |=EVENT_CDATA;
+    if( e->doctype != d->doctype ) mask |=EVENT_DOCTYPE;
+    if( e->script != d->script ) mask |=EVENT_SCRIPT;
+    return mask;
+}
+
+void
+haut_emit_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    // Only decode the key if it is asked for
+    if( has_attribute_id( p ) )
+        p->events.attribute_id( p, decode_attr( key->data, key->size ), key, value );
+    p->events.attribute( p, key, value );
 }
 
 haut_tag_t
@@ -594,9 +1273,58 @@ haut_currentElementTag( haut_t* p ) {
     return p->state->last_tag;
 }
 
+const strfragment_t*
+haut_tokenSegments( haut_t* p, size_t* count ) {
+    if( p->state->segment_buffer.size ) {
+        *count =segment_count( p );
+        return (const strfragment_t*)p->state->segment_buffer.data;
+    }
+    *count =1;
+    return &p->state->token_ptr;
+}
+
+strfragment_t
+haut_flattenToken( haut_t* p ) {
+    if( p->state->segment_buffer.size )
+        store_segments( p );
+    return p->state->token_ptr;
+}
+
+bool
+haut_retainsInput( const haut_t* p ) {
+    const struct haut_state* s =p->state;
+    if( !(p->opts.flags & FLAG_SEGMENTED_TOKENS) )
+        return false;
+    return s->segment_buffer.size || (s->token_ptr.size && s->token_ptr.data != s->token_buffer.data);
+}
+
+haut_position_t
+haut_position( haut_t* p ) {
+    if( p->opts.flags & FLAG_LAZY_POSITION )
+        sync_position( p );
+    return p->position;
+}
+
+size_t
+haut_allocations( const haut_t* p ) {
+    // One for the state itself
+    return 1 + p->state->token_buffer.allocations + p->state->attr_key_buffer.allocations
+             + p->state->segment_buffer.allocations;
+}
+
+void
+haut_trim( haut_t* p, size_t high_water ) {
+    strbuffer_trim( &p->state->token_buffer, high_water );
+    strbuffer_trim( &p->state->attr_key_buffer, high_water );
+    strbuffer_trim( &p->state->segment_buffer, high_water );
+}
+
 void
 haut_setOpts( haut_t* p, haut_opts_t opts ) {
+    int flags =opts.flags;
+    opts.flags =p->opts.flags;
     p->opts =opts;
+    set_flags( p, flags );
 }
 
 void
@@ -604,13 +1332,54 @@ haut_setEventHandler( haut_t* p, haut_event_handler_t e ) {
     p->events =e;
 }
 
+void
+haut_stop( haut_t* p ) {
+    p->state->halt =HALT_STOP;
+}
+
+void
+haut_pause( haut_t* p ) {
+    if( p->state->halt != HALT_STOP )
+        p->state->halt =HALT_PAUSE;
+}
+
+bool
+haut_skipElement( haut_t* p ) {
+    struct haut_state* s =p->state;
+    if( !s->in_element_open || s->skip.phase != SKIP_NONE || s->token_ptr.size > SKIP_MAX_NAME )
+        return false;
+    memcpy( s->skip.name, s->token_ptr.data, s->token_ptr.size );
+    s->skip.length =s->token_ptr.size;
+    s->skip.phase =SKIP_PENDING;
+    // The attributes of the skipped element are not reported either
+    s->event_mask &=~EVENT_ATTRIBUTE;
+    return true;
+}
+
+bool
+haut_isVoidElement( haut_tag_t tag ) {
+    switch( tag ) {
+        case TAG_AREA: case TAG_BASE: case TAG_BR: case TAG_COL: case TAG_EMBED:
+        case TAG_HR: case TAG_IMG: case TAG_INPUT: case TAG_KEYGEN: case TAG_LINK:
+        case TAG_META: case TAG_PARAM: case TAG_SOURCE: case TAG_TRACK: case TAG_WBR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void
+haut_setEventMask( haut_t* p, int mask ) {
+    p->opts.event_mask =mask;
+}
+
 void
 haut_enable( haut_t* p, haut_flag_t flag ) {
-    p->opts.flags |= flag;
+    set_flags( p, p->opts.flags | flag );
 }
 
 void
 haut_disable( haut_t* p, haut_flag_t flag ) {
-    p->opts.flags &= ~flag;
+    set_flags( p, p->opts.flags & ~flag );
 }
 
@@ -0,0 +1,141 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * Internal header, shared by the parts of the library that need
+ * access to the parser's state. It is not part of the public API.
+ */
+
+#ifndef HAUT_STATE_H
+#define HAUT_STATE_H
+
+#include "../include/haut/haut.h"
+
+/* Reasons for haut_parse() to return before the end of its input */
+enum {
+    HALT_NONE =0,
+    HALT_PAUSE,         // haut_pause(): the next call continues where it left off
+    HALT_STOP           // haut_stop(): all further input is ignored
+};
+
+/* Phases of skipping an element with haut_skipElement(), see skip_subtree() */
+enum {
+    SKIP_NONE =0,
+    SKIP_PENDING,       // Requested, but the start tag has not ended yet
+    SKIP_SCRIPT,        // The lexer skips a script, whose event is suppressed
+    SKIP_TEXT,          // Looking for the next '<'
+    SKIP_TAG_BEGIN,     // After '<'
+    SKIP_OPEN_NAME,     // Matching the name of an open tag
+    SKIP_OPEN_TAG,      // Inside an open tag with the same name, up to its '>'
+    SKIP_CLOSE_NAME,    // Matching the name of a close tag
+    SKIP_MARKUP,        // After '<!'
+    SKIP_COMMENT,       // Inside a comment, up to '-->'
+    SKIP_CDATA          // Inside a CDATA section, up to ']]>'
+};
+
+#define SKIP_MAX_NAME 64
+
+/* This struct contains the internal state of the parser
+ * and is opaque to the user of the API */
+struct haut_state {
+    // The allocator of the parser's options, used by the local buffers
+    strallocator_t allocator;
+
+    haut_tag_t last_tag;
+    haut_error_t last_error;
+    
+    strfragment_t attr_key_ptr;
+    strbuffer_t attr_key_buffer;
+    
+    // Fragment that points to the current token, 
+    // can point to either token_buffer or token_chunk_ptr
+    strfragment_t token_ptr;
+    // Local copy of the current token (if applicable)
+    strbuffer_t token_buffer;
+    // Fragment that points to the current token in the current chunk
+    strfragment_t token_chunk_ptr;
+    // With FLAG_SEGMENTED_TOKENS: the parts of the current token in previous chunks,
+    // stored as an array of strfragment_t, see haut_tokenSegments()
+    strbuffer_t segment_buffer;
+    // With FLAG_ACCUMULATE_INNERTEXT: whether the current token is a run of text that continues
+    // after the whitespace that follows its last word, and its length up to the end of that word
+    bool text_held;
+    size_t text_size;
+    // Offset used when we are parsing an entity (character reference)
+    int entity_token_offset;
+    // Whether we are collecting a token at all (true)
+    // false if token_ptr points to a meaningfull token
+    bool in_token;
+    
+    // Current lexer state and its 'one-entry stack'
+    int lexer_state;
+    int lexer_saved_state;
+
+    // Offset up to which position.row and col are valid, if FLAG_LAZY_POSITION is set
+    size_t position_synced;
+
+    // The effective event mask, updated by haut_parse()
+    int event_mask;
+
+    // One of HALT_*, set by haut_stop() and haut_pause()
+    int halt;
+    // Whether the input is a chunk from haut_parseChunk() that has not been parsed entirely
+    bool in_chunk;
+    // Whether the document continues after the end of the input, set by haut_parseParallel()
+    // while the input ends at a segment boundary
+    bool more_input;
+
+    // Whether the element_open handler is being called, see haut_skipElement()
+    bool in_element_open;
+    // The element that is being skipped
+    struct {
+        int phase;                  // One of SKIP_*
+        int depth;                  // Number of open elements with the same name
+        int matched;                // Characters matched in the current phase
+        int length;
+        char name[SKIP_MAX_NAME];   // The name as it appeared in the start tag
+    } skip;
+};
+
+/* Returns the effective event mask of @p: either the mask in its options, 
+ * or the events whose handlers are set. Always includes EVENT_ELEMENT */
+int
+haut_event_mask( const haut_t* p );
+
+/* Emit the attribute @key with @value (NULL if void) to the handlers of @p:
+ * first to attribute_id with the decoded key, if that handler is set, then to attribute */
+void
+haut_emit_attribute( haut_t* p, strfragment_t* key, strfragment_t* value );
+
+/* Return @s to the state of a freshly initialized parser, but keep its allocator and the memory of its local buffers */
+void
+haut_state_reset( struct haut_state* s );
+
+/* Copy the state @src to @dst, which must have been initialized by haut_init().
+ * Pointers into the local buffers of @src are made to point into those of @dst,
+ * which keeps its own allocator */
+void
+haut_state_copy( struct haut_state* dst, const struct haut_state* src );
+
+/* Parse the inputs of the @count parsers in @parsers, set with haut_setInput(), in a single thread.
+ * Up to @streams (at most 8) documents are lexed in lockstep, so that the latency of
+ * the table lookups of one document is hidden by those of the others.
+ * For every parser, the events are identical to those of haut_parse(),
+ * but the events of different parsers are interleaved.
+ * This is not part of the public API: the parser stops for an action every few characters,
+ * which makes it slower than haut_parse() on one document after another.
+ * It is kept for the test runner and the benchmark, see testing/bench.c */
+void
+haut_parseInterleaved( haut_t** parsers, int count, int streams );
+
+/* Returns true if the parser would behave identically from states @a and @b onwards,
+ * given the same input. Fields that are not used anymore in either state are ignored */
+bool
+haut_state_equal( const struct haut_state* a, const struct haut_state* b );
+
+#endif
@@ -0,0 +1,23 @@
+// inputs = 256, classes = 34
+// Resulting array is indexed by [input+(0)] and gives the class of each input
+// This file was automatically generated by fsm2array
+// Please do not edit this file directly
+// Rules to generate this file can be found in the util/ directory
+#define FSM__N_CLASSES 34
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x1,0x1,0x1,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1,0x3,0x4,0x0,0x0,0x0,0x5,0x6,0x0,0x0,0x7,0x0,0x0,0x8,0x0,0x9,
+0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xb,0xc,0xd,0xe,0xa,
+0x0,0xf,0x10,0x11,0x12,0x13,0x10,0x10,0x10,0x14,0x10,0x10,0x10,0x10,0x10,0x15,
+0x16,0x10,0x17,0x18,0x19,0x10,0x10,0x10,0x10,0x1a,0x10,0x1b,0x1c,0x1d,0x0,0x0,
+0x1e,0x10,0x10,0x1f,0x20,0x13,0x10,0x10,0x10,0x14,0x10,0x10,0x10,0x10,0x10,0x15,
+0x16,0x10,0x17,0x18,0x21,0x10,0x10,0x10,0x10,0x1a,0x10,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0
+
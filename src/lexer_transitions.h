@@ -1,2865 +1,460 @@
 // states = 65, inputs = 256
-// Resulting array is indexed by [state][input+(0)]
+// Resulting array is indexed by [state][class], where class is given by the class map for input+(0)
 // This file was automatically generated by fsm2array
 // Please do not edit this file directly
 // Rules to generate this file can be found in the util/ directory
 // Transitions for state 0
-{"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x2","\x2","\x2",
-"\x2","\x2","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x2","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x4","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0","\x0","\x0",
-"\x0","\x0","\x0","\x0"},
+{0x0,0x2,0x2,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,
+0x4,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0},
 // Transitions for state 1
-{"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1","\x1","\x1",
-"\x1","\x1","\x1","\x1"},
+{0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1},
 // Transitions for state 2
-{"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x2","\x2","\x2",
-"\x2","\x2","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x2","\x16","\x16","\x16",
-"\x16","\x16","\x2d","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x4","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16"},
+{0x16,0x2,0x2,0x16,0x16,0x2d,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x4,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16},
 // Transitions for state 3
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x4","\x3","\x2","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x4,0x3,0x2,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 4
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x4","\x4","\x4",
-"\x4","\x4","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x4","\xd","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x8",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x3",
-"\x3","\x3","\x3","\x5","\x3","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x4,0x4,0xd,0x3,0x3,
+0x3,0x3,0x3,0x8,0x5,0x3,
+0x3,0x3,0x3,0x5,0x5,0x5,
+0x5,0x5,0x5,0x5,0x5,0x5,
+0x5,0x5,0x5,0x3,0x3,0x3,
+0x3,0x5,0x5,0x5},
 // Transitions for state 5
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x7","\x7","\x7",
-"\x7","\x7","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x7","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\xc",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x3",
-"\x3","\x3","\x6","\x5","\x3","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x5","\x5","\x5",
-"\x5","\x5","\x5","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x7,0x7,0x3,0x3,0x3,
+0x3,0x3,0x3,0xc,0x5,0x3,
+0x3,0x3,0x6,0x5,0x5,0x5,
+0x5,0x5,0x5,0x5,0x5,0x5,
+0x5,0x5,0x5,0x3,0x3,0x3,
+0x3,0x5,0x5,0x5},
 // Transitions for state 6
-{"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x2","\x2","\x2",
-"\x2","\x2","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x2","\x16","\x16","\x16",
-"\x16","\x16","\x2d","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x4","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16"},
+{0x16,0x2,0x2,0x16,0x16,0x2d,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x4,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16},
 // Transitions for state 7
-{"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\x7","\x7","\x7",
-"\x7","\x7","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\x7","\xe","\x3","\xe",
-"\xe","\xe","\xe","\x3","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xc",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\x3","\x6","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe"},
+{0xe,0x7,0x7,0xe,0x3,0xe,
+0x3,0xe,0xe,0xc,0xe,0xe,
+0xe,0x3,0x6,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe},
 // Transitions for state 8
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x8","\x8","\x8",
-"\x8","\x8","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x8","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x3",
-"\x3","\x3","\x3","\x9","\x3","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x8,0x8,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x9,0x3,
+0x3,0x3,0x3,0x9,0x9,0x9,
+0x9,0x9,0x9,0x9,0x9,0x9,
+0x9,0x9,0x9,0x3,0x3,0x3,
+0x3,0x9,0x9,0x9},
 // Transitions for state 9
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\xa","\xa","\xa",
-"\xa","\xa","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\xa","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x3",
-"\x3","\x3","\xb","\x9","\x3","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x9","\x9","\x9",
-"\x9","\x9","\x9","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0xa,0xa,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x9,0x3,
+0x3,0x3,0xb,0x9,0x9,0x9,
+0x9,0x9,0x9,0x9,0x9,0x9,
+0x9,0x9,0x9,0x3,0x3,0x3,
+0x3,0x9,0x9,0x9},
 // Transitions for state 10
-{"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xb","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa","\xa","\xa",
-"\xa","\xa","\xa","\xa"},
+{0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xb,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa,0xa,0xa,
+0xa,0xa,0xa,0xa},
 // Transitions for state 11
-{"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x2","\x2","\x2",
-"\x2","\x2","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x2","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x4","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16"},
+{0x16,0x2,0x2,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x4,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16},
 // Transitions for state 12
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\xc","\xc","\xc",
-"\xc","\xc","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\xc","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x6","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0xc,0xc,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x6,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 13
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x1f","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x17","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x23","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x17","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x1f,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x17,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x23,0x3,0x3,
+0x3,0x3,0x17,0x3},
 // Transitions for state 14
-{"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xf","\xf","\xf",
-"\xf","\xf","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xf","\xe","\x3","\xe",
-"\xe","\xe","\xe","\x3","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xc",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\x3","\x10","\x6","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe"},
+{0xe,0xf,0xf,0xe,0x3,0xe,
+0x3,0xe,0xe,0xc,0xe,0xe,
+0x3,0x10,0x6,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe},
 // Transitions for state 15
-{"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xf","\xf","\xf",
-"\xf","\xf","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xf","\xe","\x3","\xe",
-"\xe","\xe","\xe","\x3","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xc",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\x3","\x10","\x6","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe","\xe","\xe",
-"\xe","\xe","\xe","\xe"},
+{0xe,0xf,0xf,0xe,0x3,0xe,
+0x3,0xe,0xe,0xc,0xe,0xe,
+0x3,0x10,0x6,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe,0xe,0xe,
+0xe,0xe,0xe,0xe},
 // Transitions for state 16
-{"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x10","\x10","\x10",
-"\x10","\x10","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x10","\x15","\x13","\x15",
-"\x15","\x15","\x2d","\x11","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x3","\x15","\x6","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x3","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15"},
+{0x15,0x10,0x10,0x15,0x13,0x2d,
+0x11,0x15,0x15,0x15,0x15,0x15,
+0x3,0x15,0x6,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x3,0x15,0x15,0x15},
 // Transitions for state 17
-{"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x2d","\x7","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12"},
+{0x12,0x12,0x12,0x12,0x12,0x2d,
+0x7,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12},
 // Transitions for state 18
-{"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x2d","\x7","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12","\x12","\x12",
-"\x12","\x12","\x12","\x12"},
+{0x12,0x12,0x12,0x12,0x12,0x2d,
+0x7,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12},
 // Transitions for state 19
-{"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x7","\x14",
-"\x14","\x14","\x2d","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14"},
+{0x14,0x14,0x14,0x14,0x7,0x2d,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14},
 // Transitions for state 20
-{"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x7","\x14",
-"\x14","\x14","\x2d","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14","\x14","\x14",
-"\x14","\x14","\x14","\x14"},
+{0x14,0x14,0x14,0x14,0x7,0x2d,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14,0x14,0x14,
+0x14,0x14,0x14,0x14},
 // Transitions for state 21
-{"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x7","\x7","\x7",
-"\x7","\x7","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x7","\x15","\x3","\x15",
-"\x15","\x15","\x2d","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x3","\x15","\x6","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x3","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15","\x15","\x15",
-"\x15","\x15","\x15","\x15"},
+{0x15,0x7,0x7,0x15,0x3,0x2d,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x3,0x15,0x6,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x15,0x15,0x15,0x15,0x15,0x15,
+0x3,0x15,0x15,0x15},
 // Transitions for state 22
-{"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x2","\x2","\x2",
-"\x2","\x2","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x2","\x16","\x16","\x16",
-"\x16","\x16","\x2d","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x4","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16","\x16","\x16",
-"\x16","\x16","\x16","\x16"},
+{0x16,0x2,0x2,0x16,0x16,0x2d,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x4,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16,0x16,0x16,
+0x16,0x16,0x16,0x16},
 // Transitions for state 23
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x18","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x18","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x18,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 24
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x19","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x19","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x19,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x19,0x3,0x3},
 // Transitions for state 25
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x1a","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x1a","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x1a,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x1a},
 // Transitions for state 26
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x1b",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x1b","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x1b,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 27
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x1c","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x1c","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x1c,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 28
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x1d","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x1d",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x1d,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 29
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x1e","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x1e,0x1e,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 30
-{"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x6","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e","\x1e","\x1e",
-"\x1e","\x1e","\x1e","\x1e"},
+{0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x6,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e},
 // Transitions for state 31
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x20","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x20,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 32
-{"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x21","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20"},
+{0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x21,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20},
 // Transitions for state 33
-{"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x22","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20"},
+{0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x22,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20},
 // Transitions for state 34
-{"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x22","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x6","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20","\x20","\x20",
-"\x20","\x20","\x20","\x20"},
+{0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x22,0x20,0x20,0x20,
+0x20,0x20,0x6,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20},
 // Transitions for state 35
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x24","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x24,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 36
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x25","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x25,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 37
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x26",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x26,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 38
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x27","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x27,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 39
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x28",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x28,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 40
-{"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x29","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3","\x3","\x3",
-"\x3","\x3","\x3","\x3"},
+{0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x3,0x3,0x3,
+0x3,0x3,0x3,0x29,0x3,0x3,
+0x3,0x3,0x3,0x3},
 // Transitions for state 41
-{"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2b","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a"},
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2b,
+0x2a,0x2a,0x2a,0x2a},
 // Transitions for state 42
-{"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2b","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a"},
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2b,
+0x2a,0x2a,0x2a,0x2a},
 // Transitions for state 43
-{"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2c","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a"},
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2c,
+0x2a,0x2a,0x2a,0x2a},
 // Transitions for state 44
-{"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x6","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a","\x2a","\x2a",
-"\x2a","\x2a","\x2a","\x2a"},
+{0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x6,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
+0x2a,0x2a,0x2a,0x2a},
 // Transitions for state 45
-{"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2e",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2d","\x2d","\x2d",
-"\x2d","\x2d","\x2d","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f"},
+{0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2e,
+0x2f,0x2f,0x2f,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x2f,0x2f,0x2f,
+0x2f,0x2d,0x2d,0x2d},
 // Transitions for state 46
-{"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f"},
+{0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f},
 // Transitions for state 47
-{"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f","\x2f","\x2f",
-"\x2f","\x2f","\x2f","\x2f"},
+{0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,
+0x2f,0x2f,0x2f,0x2f},
 // Transitions for state 48
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x33","\x30",
-"\x30","\x30","\x30","\x31","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x35",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x39","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x33,0x30,
+0x31,0x30,0x30,0x35,0x30,0x30,
+0x39,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 49
-{"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x30","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x32","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31"},
+{0x31,0x31,0x31,0x31,0x31,0x31,
+0x30,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x32,0x31,
+0x31,0x31,0x31,0x31},
 // Transitions for state 50
-{"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31","\x31","\x31",
-"\x31","\x31","\x31","\x31"},
+{0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31},
 // Transitions for state 51
-{"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x30","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x34","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33"},
+{0x33,0x33,0x33,0x33,0x30,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x34,0x33,
+0x33,0x33,0x33,0x33},
 // Transitions for state 52
-{"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33","\x33","\x33",
-"\x33","\x33","\x33","\x33"},
+{0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33},
 // Transitions for state 53
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x37","\x30","\x30","\x30","\x30","\x36",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x37,0x30,0x36,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 54
-{"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x30","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x39","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36","\x36","\x36",
-"\x36","\x36","\x36","\x36"},
+{0x36,0x36,0x30,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36,0x36,0x36,
+0x39,0x36,0x36,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36,0x36,0x36,
+0x36,0x36,0x36,0x36},
 // Transitions for state 55
-{"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x38","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37"},
+{0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x38,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37},
 // Transitions for state 56
-{"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x30",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37","\x37","\x37",
-"\x37","\x37","\x37","\x37"},
+{0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x30,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37,0x37,0x37,
+0x37,0x37,0x37,0x37},
 // Transitions for state 57
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x39","\x39","\x39",
-"\x39","\x39","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x39","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x3a",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x39,0x39,0x30,0x30,0x30,
+0x30,0x30,0x30,0x3a,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 58
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x3a","\x3a","\x3a",
-"\x3a","\x3a","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x3a","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x3b",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x3b","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x3a,0x3a,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x3b,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 59
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x3c","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x3c","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x3c,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x3c,0x30,0x30},
 // Transitions for state 60
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x3d","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x3d","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x3d,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 61
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x3e","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x3e","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x3e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 62
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x3f","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x3f","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x3f,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30},
 // Transitions for state 63
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x40","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x40","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"},
+{0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x40,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x40},
 // Transitions for state 64
-{"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x40","\x40","\x40",
-"\x40","\x40","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x40","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x6","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30","\x30","\x30",
-"\x30","\x30","\x30","\x30"}
+{0x30,0x40,0x40,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x6,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30}
@@ -0,0 +1,432 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements haut_parseParallel(): speculative parsing of a single
+ * document by multiple threads.
+ *
+ * The document is split into segments. Each segment, except the first, is parsed by
+ * a worker thread that has to guess the state of the parser at the beginning of its segment.
+ * It does so by parsing a stretch of input before the segment (the lookback) from a fresh state;
+ * the lexer FSM has few states and quickly converges to the true state, typically within one tag.
+ * The worker records the state in which its segment begins, together with all events in it.
+ *
+ * The calling thread parses the first segment itself. For every next segment it compares
+ * its own state at the boundary to the state guessed by the worker: if they are equal,
+ * the recorded events are replayed and the parser continues from the worker's final state.
+ * Otherwise the speculation failed and the segment is simply parsed again.
+ * Either way, the events are identical to those of haut_parse() and emitted in document order.
+ */
+
+#include "../include/haut/haut.h"
+#include "haut_state.h"
+#include "state.h"
+#include "scan.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#define HAUT_THREADS
+#include <pthread.h>
+#endif
+
+/* Segments smaller than this are not worth a thread */
+#ifndef HAUT_PARALLEL_MIN_SEGMENT
+#define HAUT_PARALLEL_MIN_SEGMENT (256*1024)
+#endif
+
+/* Number of characters before its segment that a worker parses to find the state of the parser */
+#ifndef HAUT_PARALLEL_LOOKBACK
+#define HAUT_PARALLEL_LOOKBACK (16*1024)
+#endif
+
+typedef enum {
+    RECORD_DOCUMENT_BEGIN,
+    RECORD_DOCUMENT_END,
+    RECORD_ELEMENT_OPEN,
+    RECORD_ELEMENT_CLOSE,
+    RECORD_ATTRIBUTE,
+    RECORD_COMMENT,
+    RECORD_INNERTEXT,
+    RECORD_CDATA,
+    RECORD_DOCTYPE,
+    RECORD_SCRIPT,
+    RECORD_ERROR
+} record_type_t;
+
+typedef enum {
+    FRAGMENT_NULL,
+    FRAGMENT_INPUT,         // The fragment points into the input buffer
+    FRAGMENT_COPY           // The fragment was copied to the segment's local buffer
+} fragment_origin_t;
+
+typedef struct {
+    fragment_origin_t origin;
+    size_t offset;
+    size_t size;
+} recorded_fragment_t;
+
+/* A single event, as it was emitted by a worker */
+typedef struct {
+    record_type_t type;
+    int value;                      // The tag or error, if applicable
+    size_t offset;                  // Offset in the input at the time of the event
+    recorded_fragment_t fragment[2];
+} record_t;
+
+typedef struct {
+    const char* input;
+    size_t input_length;
+    size_t lookback, begin, end;    // Offsets of the lookback, the segment and its end
+    haut_opts_t opts;               // Those of the calling thread's parser, with the worker's own allocator instance
+    strallocator_t allocator;       // The same allocator, for the records and the local buffers
+    bool forked;                    // Whether opts.allocator_data was created by allocator_fork
+
+    haut_t parser;
+    struct haut_state start;        // The state of the parser at the beginning of the segment
+    bool recording;
+    bool failed;                    // Whether the allocator or the records could not be allocated
+
+    record_t* records;
+    size_t num_records, capacity;
+    strbuffer_t copies;             // Local copies of fragments that were not in the input
+#ifdef HAUT_THREADS
+    pthread_t thread;
+    bool threaded;
+#endif
+} segment_t;
+
+/* Recording event handlers, used by the workers */
+
+static record_t*
+new_record( haut_t* p, record_type_t type, int value ) {
+    segment_t* s =(segment_t*)p->userdata;
+    if( !s->recording )
+        return NULL;
+    if( s->num_records == s->capacity ) {
+        size_t capacity =s->capacity ? s->capacity * 2 : 1024;
+        record_t* records =(record_t*)s->allocator.allocate( s->allocator.userdata, capacity * sizeof( record_t ) );
+        if( !records ) {
+            // The segment is parsed again by the calling thread instead
+            s->failed =true;
+            s->recording =false;
+            haut_stop( p );
+            return NULL;
+        }
+        if( s->records ) {
+            memcpy( records, s->records, s->num_records * sizeof( record_t ) );
+            s->allocator.deallocate( s->allocator.userdata, s->records );
+        }
+        s->records =records;
+        s->capacity =capacity;
+    }
+    record_t* r =&s->records[s->num_records++];
+    memset( r, 0, sizeof( record_t ) );
+    r->type =type;
+    r->value =value;
+    r->offset =p->position.offset;
+    return r;
+}
+
+static void
+record_fragment( haut_t* p, record_t* r, int i, const strfragment_t* f ) {
+    segment_t* s =(segment_t*)p->userdata;
+    if( !r || !f ) return;
+    r->fragment[i].size =f->size;
+    if( f->data >= s->input && f->data + f->size <= s->input + s->input_length ) {
+        r->fragment[i].origin =FRAGMENT_INPUT;
+        r->fragment[i].offset =f->data - s->input;
+    } else {
+        r->fragment[i].origin =FRAGMENT_COPY;
+        r->fragment[i].offset =s->copies.size;
+        strbuffer_grow( &s->copies, f->size );
+        memcpy( s->copies.data + s->copies.size, f->data, f->size );
+        s->copies.size +=f->size;
+    }
+}
+
+static void
+record_document_begin( haut_t* p ) {
+    new_record( p, RECORD_DOCUMENT_BEGIN, 0 );
+}
+
+static void
+record_document_end( haut_t* p ) {
+    new_record( p, RECORD_DOCUMENT_END, 0 );
+}
+
+static void
+record_element_open( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    record_fragment( p, new_record( p, RECORD_ELEMENT_OPEN, tag ), 0, name );
+}
+
+static void
+record_element_close( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    record_fragment( p, new_record( p, RECORD_ELEMENT_CLOSE, tag ), 0, name );
+}
+
+static void
+record_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    record_t* r =new_record( p, RECORD_ATTRIBUTE, 0 );
+    record_fragment( p, r, 0, key );
+    record_fragment( p, r, 1, value );
+}
+
+#define RECORD_TEXT_EVENT( name, type ) \
+    static void name( haut_t* p, strfragment_t* text ) { record_fragment( p, new_record( p, type, 0 ), 0, text ); }
+
+RECORD_TEXT_EVENT( record_comment, RECORD_COMMENT )
+RECORD_TEXT_EVENT( record_innertext, RECORD_INNERTEXT )
+RECORD_TEXT_EVENT( record_cdata, RECORD_CDATA )
+RECORD_TEXT_EVENT( record_doctype, RECORD_DOCTYPE )
+RECORD_TEXT_EVENT( record_script, RECORD_SCRIPT )
+
+static void
+record_error( haut_t* p, haut_error_t err ) {
+    new_record( p, RECORD_ERROR, err );
+}
+
+static const haut_event_handler_t RECORDING_EVENT_HANDLER = {
+    .document_begin=record_document_begin,
+    .document_end  =record_document_end,
+    .element_open  =record_element_open,
+    .element_close =record_element_close,
+    .attribute     =record_attribute,
+    .comment       =record_comment,
+    .innertext     =record_innertext,
+    .doctype       =record_doctype,
+    .script        =record_script,
+    .cdata         =record_cdata,
+    .error         =record_error,
+};
+
+/* Workers */
+
+static void*
+parse_segment( void* arg ) {
+    segment_t* s =(segment_t*)arg;
+
+    haut_initOpts( &s->parser, s->opts );
+    s->parser.events =RECORDING_EVENT_HANDLER;
+    s->parser.userdata =s;
+    s->parser.opts.flags |=FLAG_LAZY_POSITION;
+    // The events at the end of the segment are those of the next segment's start state
+    s->parser.state->more_input =true;
+
+    /* Start right after a '>', which most likely ends a tag */
+    const char* gt =memchr( s->input + s->lookback, '>', s->begin - s->lookback );
+    if( gt )
+        s->lookback =gt - s->input + 1;
+
+    haut_setInput( &s->parser, s->input, s->begin );
+    s->parser.position.offset =s->lookback;
+    s->parser.state->position_synced =s->lookback;
+    s->parser.state->lexer_state =L_ELEM_END;
+    haut_parse( &s->parser );
+
+    haut_state_copy( &s->start, s->parser.state );
+
+    s->recording =true;
+    s->parser.length =s->end;
+    haut_parse( &s->parser );
+    return NULL;
+}
+
+static void
+free_segment( segment_t* s ) {
+    if( s->parser.state )
+        haut_destroy( &s->parser );
+    strbuffer_free( &s->start.token_buffer );
+    strbuffer_free( &s->start.attr_key_buffer );
+    strbuffer_free( &s->start.segment_buffer );
+    strbuffer_free( &s->copies );
+    if( s->records )
+        s->allocator.deallocate( s->allocator.userdata, s->records );
+    if( s->forked )
+        s->opts.allocator_join( s->opts.allocator_data );
+}
+
+/** Advance the offset in @p to @offset, updating the row and column unless FLAG_LAZY_POSITION is set */
+static void
+move_to( haut_t* p, size_t offset ) {
+    if( !(p->opts.flags & FLAG_LAZY_POSITION) )
+        scan_lines( p->input + p->position.offset, offset - p->position.offset, &p->position.row, &p->position.col );
+    p->position.offset =offset;
+}
+
+static strfragment_t
+replay_fragment( haut_t* p, segment_t* s, const recorded_fragment_t* f ) {
+    strfragment_t frag;
+    frag.size =f->size;
+    frag.data =(f->origin == FRAGMENT_INPUT ? p->input : s->copies.data) + f->offset;
+    return frag;
+}
+
+/** Emit the events recorded by the worker of @s on @p and continue from the worker's final state.
+ *  Returns false if one of the handlers halted the parser */
+static bool
+replay_segment( haut_t* p, segment_t* s ) {
+    for( size_t i =0; i < s->num_records; i++ ) {
+        const record_t* r =&s->records[i];
+        strfragment_t a =replay_fragment( p, s, &r->fragment[0] );
+        strfragment_t b =replay_fragment( p, s, &r->fragment[1] );
+        move_to( p, r->offset );
+
+        switch( r->type ) {
+            case RECORD_DOCUMENT_BEGIN:
+                p->events.document_begin( p );
+                break;
+            case RECORD_DOCUMENT_END:
+                p->events.document_end( p );
+                break;
+            case RECORD_ELEMENT_OPEN:
+                p->state->last_tag =r->value;
+                p->events.element_open( p, r->value, &a );
+                break;
+            case RECORD_ELEMENT_CLOSE:
+                p->state->last_tag =r->value;
+                p->events.element_close( p, r->value, &a );
+                break;
+            case RECORD_ATTRIBUTE:
+                haut_emit_attribute( p, &a, r->fragment[1].origin == FRAGMENT_NULL ? NULL : &b );
+                break;
+            case RECORD_COMMENT:
+                p->events.comment( p, &a );
+                break;
+            case RECORD_INNERTEXT:
+                p->events.innertext( p, &a );
+                break;
+            case RECORD_CDATA:
+                p->events.cdata( p, &a );
+                break;
+            case RECORD_DOCTYPE:
+                p->events.doctype( p, &a );
+                break;
+            case RECORD_SCRIPT:
+                p->events.script( p, &a );
+                break;
+            case RECORD_ERROR:
+                p->state->last_error =r->value;
+                if( p->events.error != NULL )
+                    p->events.error( p, r->value );
+                break;
+        }
+        if( p->state->halt )
+            return false;
+    }
+    move_to( p, s->end );
+
+    size_t position_synced =p->state->position_synced;
+    haut_state_copy( p->state, s->parser.state );
+    p->state->position_synced =position_synced;
+    return true;
+}
+
+void
+haut_parseParallel( haut_t* p, const char* buffer, size_t len, int nthreads ) {
+    size_t segment_size =nthreads > 0 ? len / nthreads : len;
+#ifndef HAUT_THREADS
+    nthreads =1;
+#endif
+    if( p->state->halt == HALT_STOP )
+        return;
+    if( nthreads < 2 || segment_size < HAUT_PARALLEL_MIN_SEGMENT ) {
+        haut_setInput( p, buffer, len );
+        haut_parse( p );
+        if( p->state->halt )
+            haut_stop( p );
+        return;
+    }
+
+    /* Segment zero is parsed by the calling thread, all others by a worker */
+    const int workers =nthreads - 1;
+    segment_t* segments =(segment_t*)p->opts.allocator( p->opts.allocator_data, workers * sizeof( segment_t ) );
+    if( !segments ) {
+        haut_setInput( p, buffer, len );
+        haut_parse( p );
+        if( p->state->halt )
+            haut_stop( p );
+        return;
+    }
+    memset( segments, 0, workers * sizeof( segment_t ) );
+
+    haut_opts_t opts =p->opts;
+    // Only record the events that the calling thread's parser would emit
+    opts.event_mask =haut_event_mask( p );
+
+    for( int i =0; i < workers; i++ ) {
+        segment_t* s =&segments[i];
+        s->input =buffer;
+        s->input_length =len;
+        s->begin =(i+1) * segment_size;
+        s->end =(i == workers-1) ? len : (i+2) * segment_size;
+        s->lookback =s->begin > HAUT_PARALLEL_LOOKBACK ? s->begin - HAUT_PARALLEL_LOOKBACK : 0;
+        s->opts =opts;
+        // Every worker allocates from an instance of its own, if there is a fork function
+        if( opts.allocator_fork ) {
+            s->opts.allocator_data =opts.allocator_fork( opts.allocator_data );
+            s->forked =s->opts.allocator_data != NULL;
+            // Without an allocator, the segment is parsed by the calling thread instead
+            if( !s->forked ) {
+                s->failed =true;
+                continue;
+            }
+        }
+        s->allocator.allocate =s->opts.allocator;
+        s->allocator.deallocate =s->opts.deallocator;
+        s->allocator.userdata =s->opts.allocator_data;
+        // As in haut_initOpts(), the buffers call malloc() directly for the default allocator
+        const strallocator_t* a =s->opts.allocator == DEFAULT_PARSER_OPTS.allocator ? NULL : &s->allocator;
+        strbuffer_initAllocator( &s->start.token_buffer, a );
+        strbuffer_initAllocator( &s->start.attr_key_buffer, a );
+        strbuffer_initAllocator( &s->start.segment_buffer, a );
+        strbuffer_initAllocator( &s->copies, a );
+#ifdef HAUT_THREADS
+        s->threaded =pthread_create( &s->thread, NULL, parse_segment, s ) == 0;
+        if( !s->threaded )
+#endif
+            parse_segment( s );
+    }
+
+    haut_setInput( p, buffer, segments[0].begin );
+    p->state->more_input =true;
+    haut_parse( p );
+    bool halted =p->state->halt;
+
+    for( int i =0; i < workers; i++ ) {
+        segment_t* s =&segments[i];
+#ifdef HAUT_THREADS
+        if( s->threaded )
+            pthread_join( s->thread, NULL );
+#endif
+        /* Once halted, the remaining segments are only cleaned up */
+        if( !halted ) {
+            p->length =s->end;
+            if( !s->failed && haut_state_equal( p->state, &s->start ) )
+                halted =!replay_segment( p, s );
+            else {
+                haut_parse( p );
+                halted =p->state->halt;
+            }
+        }
+        free_segment( s );
+    }
+    /* Now that the end of the document has been reached, a held run of text can be delivered */
+    p->state->more_input =false;
+    if( !halted ) {
+        haut_parse( p );
+        halted =p->state->halt;
+    }
+    /* A paused parse cannot be continued, since the parser's state may be that of an earlier segment */
+    if( halted )
+        haut_stop( p );
+
+    p->opts.deallocator( p->opts.allocator_data, segments );
+    /* As haut_parse() does, leave the row and column up to date */
+    haut_position( p );
+}
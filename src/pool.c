@@ -0,0 +1,81 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements the parser pool: a small stack of released parsers in thread-local storage.
+ */
+
+#include "../include/haut/pool.h"
+#include "haut_state.h"
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+typedef struct {
+    haut_t* parsers[HAUT_POOL_SIZE];
+    int count;
+} pool_t;
+
+static THREAD_LOCAL pool_t _pool;
+
+/** Returns true if the memory of @p is managed by the allocator in @opts */
+static bool
+same_allocator( const haut_t* p, const haut_opts_t* opts ) {
+    const strallocator_t* a =&p->state->allocator;
+    return a->allocate == opts->allocator
+        && a->deallocate == opts->deallocator
+        && a->userdata == opts->allocator_data;
+}
+
+/** Destroy @p and free the parser object itself, both with its own allocator */
+static void
+free_parser( haut_t* p ) {
+    strallocator_t a =p->state->allocator;
+    haut_destroy( p );
+    a.deallocate( a.userdata, p );
+}
+
+haut_t*
+haut_poolAcquire( haut_opts_t opts ) {
+    for( int i =_pool.count - 1; i >= 0; i-- ) {
+        haut_t* p =_pool.parsers[i];
+        if( !same_allocator( p, &opts ) )
+            continue;
+        // Fill the gap with the last parser of the pool
+        _pool.parsers[i] =_pool.parsers[--_pool.count];
+        haut_reset( p );
+        p->opts =opts;
+        p->events =DEFAULT_EVENT_HANDLER;
+        p->userdata =NULL;
+        return p;
+    }
+
+    haut_t* p =(haut_t*)opts.allocator( opts.allocator_data, sizeof( haut_t ) );
+    if( p )
+        haut_initOpts( p, opts );
+    return p;
+}
+
+void
+haut_poolRelease( haut_t* p ) {
+    if( _pool.count == HAUT_POOL_SIZE ) {
+        free_parser( p );
+        return;
+    }
+    _pool.parsers[_pool.count++] =p;
+}
+
+void
+haut_poolClear( void ) {
+    while( _pool.count )
+        free_parser( _pool.parsers[--_pool.count] );
+}
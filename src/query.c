@@ -0,0 +1,575 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements the query API: CSS selectors matched on the parser's events.
+ *
+ * Every compound selector (such as `ul.menu') is a state of a non-deterministic automaton.
+ * Each open element has two sets of states, as bitmasks: the states that can be matched by
+ * any of its descendants and those that can only be matched by its children.
+ * When the start tag of an element is complete, every state that is available from its parent
+ * and matches the element enables the next compound of its selector, or reports a match
+ * if it was the last one. Only the attributes of elements that can match are stored.
+ */
+
+#include "../include/haut/query.h"
+#include "../include/haut/state_machine.h"
+#include "../include/haut/tag.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+#define QUERY_MAX_COMPOUNDS 64
+
+#define BIT( k ) ((uint64_t)1 << (k))
+
+/* Kinds of tests of a compound selector */
+enum {
+    TEST_ID,
+    TEST_CLASS,
+    TEST_ATTR,
+    TEST_ATTR_VALUE
+};
+
+typedef struct {
+    int kind;
+    strfragment_t key;
+    strfragment_t value;
+} test_t;
+
+typedef struct {
+    bool any;                   // `*' or no element name
+    haut_tag_t tag;
+    strfragment_t name;         // Only compared if @tag is TAG_UNKNOWN
+    int first_test, n_tests;
+    bool child;                 // Related to the previous compound by `>' rather than a descendant
+    bool last;                  // The last compound of its selector
+    int selector;
+} compound_t;
+
+/* An attribute of an open element, as offsets into the store */
+typedef struct {
+    size_t key, key_size;
+    size_t value, value_size;
+    bool has_value;
+} attr_t;
+
+typedef struct {
+    haut_tag_t tag;
+    size_t name, name_size;     // Offset of the name in the store, if it was stored
+    size_t store_mark;          // Size of the store before this element
+    size_t first_attr, n_attrs;
+    size_t text_mark;           // Size of the text before this element, if it matched
+    uint64_t desc, child;       // States available to the descendants and children of this element
+    uint64_t matched;           // Last compounds that matched this element
+} entry_t;
+
+struct haut_query {
+    char* source;               // Copy of the selectors, the compounds point into it
+    compound_t compounds[QUERY_MAX_COMPOUNDS];
+    int n_compounds;
+    test_t* tests;
+    int n_tests;
+    size_t tests_capacity;
+    uint64_t initial;           // First compounds of every selector
+
+    haut_match_event callback;
+    void* userdata;
+
+    entry_t* stack;
+    size_t depth, stack_capacity;
+    bool pending;               // The top element's start tag may still have attributes
+    attr_t* attrs;
+    size_t n_attrs, attrs_capacity;
+    strbuffer_t store;          // Names and attributes of the open elements
+    strbuffer_t text;           // Innertext of the open elements that matched
+    int collecting;             // Number of open elements that matched
+    haut_query_attribute_t* report;
+    size_t report_capacity;
+};
+
+/** Make room for @n elements of @size in the array @*ptr of @*capacity elements */
+static void
+reserve( void** ptr, size_t* capacity, size_t n, size_t size ) {
+    if( n <= *capacity )
+        return;
+    *capacity =*capacity ? *capacity * 2 : 16;
+    if( *capacity < n )
+        *capacity =n;
+    *ptr =realloc( *ptr, *capacity * size );
+}
+
+static void
+truncate_buffer( strbuffer_t* b, size_t size ) {
+    b->size =size;
+    b->data[size] =0;
+}
+
+static bool
+same_name( const char* a, size_t a_size, const char* b, size_t b_size ) {
+    if( a_size != b_size )
+        return false;
+    for( size_t i =0; i < a_size; i++ )
+        if( tolower( (unsigned char)a[i] ) != tolower( (unsigned char)b[i] ) )
+            return false;
+    return true;
+}
+
+/* Selector compiler */
+
+static bool
+is_ident( char c ) {
+    return isalnum( (unsigned char)c ) || c == '-' || c == '_' || (unsigned char)c >= 0x80;
+}
+
+static const char*
+skip_ws( const char* s ) {
+    while( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\r' || *s == '\f' )
+        s++;
+    return s;
+}
+
+/** Parse an identifier at @s into @f. Returns the end of the identifier, or NULL if there is none */
+static const char*
+parse_ident( const char* s, strfragment_t* f ) {
+    const char* begin =s;
+    while( is_ident( *s ) )
+        s++;
+    strfragment_set( f, begin, s - begin );
+    return f->size ? s : NULL;
+}
+
+/** Returns the tag of the element name @f, like the parser would decode it */
+static haut_tag_t
+selector_tag( const strfragment_t* f ) {
+    // decode_tag() only accepts the characters that the lexer allows in an element name
+    for( size_t i =0; i < f->size; i++ )
+        if( f->data[i] < TAG__FIRST_CHAR || f->data[i] > TAG__LAST_CHAR )
+            return TAG_UNKNOWN;
+    return decode_tag( f->data, f->size );
+}
+
+static void
+add_test( haut_query_t* q, const test_t* t ) {
+    reserve( (void**)&q->tests, &q->tests_capacity, q->n_tests + 1, sizeof( test_t ) );
+    q->tests[q->n_tests++] =*t;
+}
+
+/** Parse the compound selector at @s into @c. Returns the end of it, or NULL on a syntax error */
+static const char*
+parse_compound( haut_query_t* q, const char* s, compound_t* c ) {
+    bool empty =true;
+    c->any =true;
+    c->first_test =q->n_tests;
+
+    if( *s == '*' ) {
+        s++;
+        empty =false;
+    } else if( is_ident( *s ) ) {
+        s =parse_ident( s, &c->name );
+        c->any =false;
+        c->tag =selector_tag( &c->name );
+        empty =false;
+    }
+
+    for( ;; ) {
+        test_t t;
+        memset( &t, 0, sizeof( test_t ) );
+        if( *s == '#' || *s == '.' ) {
+            t.kind =(*s == '#') ? TEST_ID : TEST_CLASS;
+            if( !(s =parse_ident( s + 1, &t.value )) )
+                return NULL;
+        } else if( *s == '[' ) {
+            t.kind =TEST_ATTR;
+            if( !(s =parse_ident( skip_ws( s + 1 ), &t.key )) )
+                return NULL;
+            s =skip_ws( s );
+            if( *s == '=' ) {
+                t.kind =TEST_ATTR_VALUE;
+                s =skip_ws( s + 1 );
+                if( *s == '"' || *s == '\'' ) {
+                    const char* end =strchr( s + 1, *s );
+                    if( !end )
+                        return NULL;
+                    strfragment_set( &t.value, s + 1, end - s - 1 );
+                    s =end + 1;
+                } else if( !(s =parse_ident( s, &t.value )) )
+                    return NULL;
+                s =skip_ws( s );
+            }
+            if( *s++ != ']' )
+                return NULL;
+        } else
+            break;
+        add_test( q, &t );
+        c->n_tests++;
+        empty =false;
+    }
+    return empty ? NULL : s;
+}
+
+static bool
+compile( haut_query_t* q ) {
+    const char* s =q->source;
+    int selector =0;
+    bool first =true, child =false;
+
+    for( ;; ) {
+        if( q->n_compounds == QUERY_MAX_COMPOUNDS )
+            return false;
+        compound_t* c =&q->compounds[q->n_compounds];
+        memset( c, 0, sizeof( compound_t ) );
+        c->child =child;
+        c->selector =selector;
+        if( first )
+            q->initial |=BIT( q->n_compounds );
+
+        if( !(s =parse_compound( q, skip_ws( s ), c )) )
+            return false;
+        q->n_compounds++;
+
+        /* A combinator, the next selector or the end */
+        const char* next =skip_ws( s );
+        if( *next == '\0' || *next == ',' ) {
+            c->last =true;
+            if( *next == '\0' )
+                return true;
+            s =next + 1;
+            selector++;
+            first =true;
+            child =false;
+            continue;
+        }
+        if( *next == '>' ) {
+            child =true;
+            s =next + 1;
+        } else if( next != s ) {
+            child =false;
+            s =next;
+        } else
+            return false;
+        first =false;
+    }
+}
+
+/* Matching */
+
+static inline entry_t*
+top( haut_query_t* q ) {
+    return &q->stack[q->depth - 1];
+}
+
+static inline const char*
+stored( const haut_query_t* q, size_t offs ) {
+    return q->store.data + offs;
+}
+
+static bool
+match_tag( const haut_query_t* q, const compound_t* c, const entry_t* e ) {
+    if( c->any )
+        return true;
+    if( c->tag != e->tag )
+        return false;
+    return c->tag != TAG_UNKNOWN || same_name( c->name.data, c->name.size, stored( q, e->name ), e->name_size );
+}
+
+/** Returns the first attribute of @e with the name @key, or NULL */
+static const attr_t*
+find_attr( const haut_query_t* q, const entry_t* e, const strfragment_t* key ) {
+    for( size_t i =e->first_attr; i < e->first_attr + e->n_attrs; i++ ) {
+        const attr_t* a =&q->attrs[i];
+        if( same_name( stored( q, a->key ), a->key_size, key->data, key->size ) )
+            return a;
+    }
+    return NULL;
+}
+
+/** Returns true if the whitespace separated list @list of @size characters contains @word */
+static bool
+has_word( const char* list, size_t size, const strfragment_t* word ) {
+    const char* end =list + size;
+    while( list < end ) {
+        while( list < end && isspace( (unsigned char)*list ) )
+            list++;
+        const char* begin =list;
+        while( list < end && !isspace( (unsigned char)*list ) )
+            list++;
+        if( (size_t)(list - begin) == word->size && memcmp( begin, word->data, word->size ) == 0 )
+            return true;
+    }
+    return false;
+}
+
+static bool
+match_compound( const haut_query_t* q, const compound_t* c, const entry_t* e ) {
+    static const strfragment_t ID ={ "id", 2 }, CLASS ={ "class", 5 };
+
+    if( !match_tag( q, c, e ) )
+        return false;
+    for( int i =c->first_test; i < c->first_test + c->n_tests; i++ ) {
+        const test_t* t =&q->tests[i];
+        const attr_t* a =find_attr( q, e, t->kind == TEST_ID ? &ID : t->kind == TEST_CLASS ? &CLASS : &t->key );
+        if( !a )
+            return false;
+        switch( t->kind ) {
+            case TEST_ID:
+            case TEST_ATTR_VALUE:
+                if( a->value_size != t->value.size || memcmp( stored( q, a->value ), t->value.data, a->value_size ) != 0 )
+                    return false;
+                break;
+            case TEST_CLASS:
+                if( !has_word( stored( q, a->value ), a->value_size, &t->value ) )
+                    return false;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+/** Call the callback of @q for every selector that matched @e */
+static void
+report_match( haut_query_t* q, entry_t* e ) {
+    reserve( (void**)&q->report, &q->report_capacity, e->n_attrs, sizeof( haut_query_attribute_t ) );
+    for( size_t i =0; i < e->n_attrs; i++ ) {
+        const attr_t* a =&q->attrs[e->first_attr + i];
+        strfragment_set( &q->report[i].key, stored( q, a->key ), a->key_size );
+        strfragment_set( &q->report[i].value, a->has_value ? stored( q, a->value ) : NULL, a->value_size );
+    }
+
+    haut_match_t m;
+    m.tag =e->tag;
+    strfragment_set( &m.name, stored( q, e->name ), e->name_size );
+    m.attributes =q->report;
+    m.attribute_count =e->n_attrs;
+    // Unless it is empty, the text of a nested match begins with the space that separates it from the text before it
+    size_t text =e->text_mark;
+    if( text && text < q->text.size )
+        text++;
+    strfragment_set( &m.text, q->text.data + text, q->text.size - text );
+    for( int k =0; k < q->n_compounds; k++ ) {
+        if( e->matched & BIT( k ) ) {
+            m.selector =q->compounds[k].selector;
+            q->callback( q, &m, q->userdata );
+        }
+    }
+}
+
+/** Close the top element of @q */
+static void
+pop_element( haut_query_t* q ) {
+    entry_t* e =top( q );
+    if( e->matched ) {
+        report_match( q, e );
+        if( --q->collecting == 0 )
+            truncate_buffer( &q->text, 0 );
+    }
+    truncate_buffer( &q->store, e->store_mark );
+    q->n_attrs =e->first_attr;
+    q->depth--;
+}
+
+/** Match the top element of @q, now that all of its attributes are known */
+static void
+match_element( haut_query_t* q ) {
+    entry_t* e =top( q );
+    entry_t* parent =q->depth > 1 ? e - 1 : NULL;
+    uint64_t available =parent ? parent->desc | parent->child : q->initial;
+
+    e->desc =parent ? parent->desc : q->initial;
+    e->child =0;
+    e->matched =0;
+    for( int k =0; k < q->n_compounds; k++ ) {
+        const compound_t* c =&q->compounds[k];
+        if( !(available & BIT( k )) || !match_compound( q, c, e ) )
+            continue;
+        if( c->last )
+            e->matched |=BIT( k );
+        else if( q->compounds[k+1].child )
+            e->child |=BIT( k+1 );
+        else
+            e->desc |=BIT( k+1 );
+    }
+
+    if( e->matched ) {
+        e->text_mark =q->text.size;
+        q->collecting++;
+    } else {
+        // The attributes are only needed to report a match
+        truncate_buffer( &q->store, e->name + e->name_size );
+        q->n_attrs =e->first_attr;
+        e->n_attrs =0;
+    }
+}
+
+/** Finish the start tag of the top element of @q, if that has not been done yet */
+static void
+end_start_tag( haut_query_t* q ) {
+    if( !q->pending )
+        return;
+    q->pending =false;
+    match_element( q );
+    if( haut_isVoidElement( top( q )->tag ) )
+        pop_element( q );
+}
+
+/* Event handlers */
+
+static void
+query_element_open( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    haut_query_t* q =(haut_query_t*)p->userdata;
+    end_start_tag( q );
+
+    reserve( (void**)&q->stack, &q->stack_capacity, q->depth + 1, sizeof( entry_t ) );
+    entry_t* parent =q->depth ? top( q ) : NULL;
+    entry_t* e =&q->stack[q->depth++];
+    memset( e, 0, sizeof( entry_t ) );
+    e->tag =tag;
+    e->store_mark =q->store.size;
+    e->first_attr =q->n_attrs;
+    e->name =q->store.size;
+    // The name is needed to close an unknown element
+    if( tag == TAG_UNKNOWN ) {
+        strbuffer_append( &q->store, name->data, name->size );
+        e->name_size =name->size;
+    }
+
+    /* Only an element that matches the tag of an available compound needs its attributes */
+    uint64_t available =parent ? parent->desc | parent->child : q->initial;
+    for( int k =0; k < q->n_compounds; k++ ) {
+        if( (available & BIT( k )) && match_tag( q, &q->compounds[k], e ) ) {
+            q->pending =true;
+            break;
+        }
+    }
+    if( q->pending ) {
+        if( tag != TAG_UNKNOWN ) {
+            strbuffer_append( &q->store, name->data, name->size );
+            e->name_size =name->size;
+        }
+        return;
+    }
+
+    e->desc =parent ? parent->desc : q->initial;
+    if( haut_isVoidElement( tag ) )
+        pop_element( q );
+}
+
+static void
+query_element_close( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    haut_query_t* q =(haut_query_t*)p->userdata;
+    end_start_tag( q );
+
+    for( size_t i =q->depth; i-- > 0; ) {
+        const entry_t* e =&q->stack[i];
+        if( e->tag == tag && (tag != TAG_UNKNOWN || same_name( stored( q, e->name ), e->name_size, name->data, name->size )) ) {
+            while( q->depth > i )
+                pop_element( q );
+            return;
+        }
+    }
+}
+
+/** Append the value or text @f of the current token in @p to @b,
+ *  including the segments that follow it if the token spans chunks */
+static void
+append_token( strbuffer_t* b, haut_t* p, const strfragment_t* f ) {
+    size_t count;
+    const strfragment_t* segments =haut_tokenSegments( p, &count );
+    if( count == 1 )
+        strbuffer_append( b, f->data, f->size );
+    else
+        for( size_t i =0; i < count; i++ )
+            strbuffer_append( b, segments[i].data, segments[i].size );
+}
+
+static void
+query_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    haut_query_t* q =(haut_query_t*)p->userdata;
+    if( !q->pending )
+        return;
+
+    reserve( (void**)&q->attrs, &q->attrs_capacity, q->n_attrs + 1, sizeof( attr_t ) );
+    attr_t* a =&q->attrs[q->n_attrs++];
+    a->key =q->store.size;
+    a->key_size =key->size;
+    strbuffer_append( &q->store, key->data, key->size );
+    a->has_value =value && value->data;
+    a->value =q->store.size;
+    if( a->has_value )
+        append_token( &q->store, p, value );
+    a->value_size =q->store.size - a->value;
+    top( q )->n_attrs++;
+}
+
+static void
+query_innertext( haut_t* p, strfragment_t* text ) {
+    haut_query_t* q =(haut_query_t*)p->userdata;
+    end_start_tag( q );
+    if( !q->collecting )
+        return;
+    if( q->text.size )
+        strbuffer_append( &q->text, " ", 1 );
+    append_token( &q->text, p, text );
+}
+
+/* */
+
+haut_query_t*
+haut_queryCompile( const char* selectors, haut_match_event callback, void* userdata ) {
+    haut_query_t* q =(haut_query_t*)calloc( 1, sizeof( haut_query_t ) );
+    size_t len =strlen( selectors );
+    q->source =(char*)malloc( len + 1 );
+    memcpy( q->source, selectors, len + 1 );
+    q->callback =callback;
+    q->userdata =userdata;
+    strbuffer_init( &q->store );
+    strbuffer_init( &q->text );
+    if( !compile( q ) ) {
+        haut_queryFree( q );
+        return NULL;
+    }
+    return q;
+}
+
+void
+haut_queryFree( haut_query_t* q ) {
+    strbuffer_free( &q->store );
+    strbuffer_free( &q->text );
+    free( q->source );
+    free( q->tests );
+    free( q->stack );
+    free( q->attrs );
+    free( q->report );
+    free( q );
+}
+
+void
+haut_queryAttach( haut_query_t* q, haut_t* p ) {
+    q->depth =0;
+    q->pending =false;
+    q->n_attrs =0;
+    q->collecting =0;
+    truncate_buffer( &q->store, 0 );
+    truncate_buffer( &q->text, 0 );
+
+    p->userdata =q;
+    p->events.element_open =query_element_open;
+    p->events.element_close =query_element_close;
+    p->events.attribute =query_attribute;
+    p->events.innertext =query_innertext;
+}
+
+void
+haut_queryFinish( haut_query_t* q ) {
+    end_start_tag( q );
+    while( q->depth )
+        pop_element( q );
+}
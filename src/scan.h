@@ -0,0 +1,220 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file contains the (vectorized) byte scanning routines that are used
+ * to skip through the input in bulk, instead of one character at a time.
+ * SSE2 is used when available (always on x86-64), SSSE3 and AVX2 when the compiler
+ * is told to target them (e.g. -mssse3 or -mavx2). Otherwise, plain C is used.
+ */
+
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVX2__)
+#define SCAN_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__SSSE3__)
+#define SCAN_SSSE3
+#include <tmmintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define inline __inline
+#endif
+
+/* Maximum number of characters in the list of a scan_set_t */
+#define SCAN_MAX_SET 8
+
+/* A set of characters, written in three representations that suit different instruction sets.
+ * Tables of these sets are generated by fsm2array (option -x) */
+typedef struct {
+    int size;                   // Number of characters in @list, or -1 if the set does not fit in it
+    unsigned char below;        // All characters below this value are also part of the set
+    char list[SCAN_MAX_SET];
+    uint32_t mask[8];           // Bit (c % 32) of mask[c / 32] is set if character c is in the set
+    int nibbles;                // Non-zero if the set can be tested with the nibble tables:
+    uint8_t nibble_lo[16];      //  c is in the set if nibble_lo[c & 0xf] & nibble_hi[c >> 4] is non-zero
+    uint8_t nibble_hi[16];
+} scan_set_t;
+
+static inline int
+scan_popcount( unsigned int x ) {
+#if defined(__GNUC__)
+    return __builtin_popcount( x );
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    return (((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#endif
+}
+
+/* Index of the lowest set bit, @x must not be zero */
+static inline int
+scan_lowest_bit( unsigned int x ) {
+#if defined(__GNUC__)
+    return __builtin_ctz( x );
+#elif defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward( &i, x );
+    return (int)i;
+#else
+    int i =0;
+    while( !(x & 1) ) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+/* Index of the highest set bit, @x must not be zero */
+static inline int
+scan_highest_bit( unsigned int x ) {
+#if defined(__GNUC__)
+    return 31 - __builtin_clz( x );
+#elif defined(_MSC_VER)
+    unsigned long i;
+    _BitScanReverse( &i, x );
+    return (int)i;
+#else
+    int i =0;
+    while( x >>= 1 ) i++;
+    return i;
+#endif
+}
+
+/** Returns non-zero if @c is in @set */
+static inline int
+scan_in_set( const scan_set_t* set, unsigned char c ) {
+    return set->mask[c >> 5] & (1U << (c & 31));
+}
+
+/* Returns the number of characters in @buf (at most @len) that precede
+ * the first occurrence of any of the characters in @set.
+ * The nibble tables are used if possible with SSSE3 and AVX2, the list with SSE2.
+ * Everything that remains is tested against the mask */
+static inline size_t
+scan_for_set( const char* buf, size_t len, const scan_set_t* set ) {
+    size_t i =0;
+    const int n =set->size;
+    // A zero threshold is never matched, one below it matches all characters up to the threshold
+    const unsigned char upto =set->below ? set->below - 1 : 0;
+#if defined(SCAN_AVX2)
+    if( set->nibbles ) {
+        const __m256i lo =_mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i*)set->nibble_lo ) );
+        const __m256i hi =_mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i*)set->nibble_hi ) );
+        const __m256i low_nibble =_mm256_set1_epi8( 0x0f );
+
+        for( ; i + 32 <= len; i += 32 ) {
+            __m256i v =_mm256_loadu_si256( (const __m256i*)(buf + i) );
+            __m256i l =_mm256_shuffle_epi8( lo, _mm256_and_si256( v, low_nibble ) );
+            __m256i h =_mm256_shuffle_epi8( hi, _mm256_and_si256( _mm256_srli_epi16( v, 4 ), low_nibble ) );
+            __m256i m =_mm256_cmpeq_epi8( _mm256_and_si256( l, h ), _mm256_setzero_si256() );
+            unsigned int mask =~(unsigned int)_mm256_movemask_epi8( m );
+            if( mask )
+                return i + scan_lowest_bit( mask );
+        }
+    } else if( n >= 0 ) {
+        __m256i s32[SCAN_MAX_SET];
+        const __m256i u32 =_mm256_set1_epi8( (char)upto );
+        for( int k =0; k < n; k++ )
+            s32[k] =_mm256_set1_epi8( set->list[k] );
+
+        for( ; i + 32 <= len; i += 32 ) {
+            __m256i v =_mm256_loadu_si256( (const __m256i*)(buf + i) );
+            __m256i m =set->below ? _mm256_cmpeq_epi8( _mm256_min_epu8( v, u32 ), v ) : _mm256_setzero_si256();
+            for( int k =0; k < n; k++ )
+                m =_mm256_or_si256( m, _mm256_cmpeq_epi8( v, s32[k] ) );
+            unsigned int mask =(unsigned int)_mm256_movemask_epi8( m );
+            if( mask )
+                return i + scan_lowest_bit( mask );
+        }
+    }
+#endif
+#if defined(SCAN_SSSE3)
+    if( set->nibbles ) {
+        const __m128i lo =_mm_loadu_si128( (const __m128i*)set->nibble_lo );
+        const __m128i hi =_mm_loadu_si128( (const __m128i*)set->nibble_hi );
+        const __m128i low_nibble =_mm_set1_epi8( 0x0f );
+
+        for( ; i + 16 <= len; i += 16 ) {
+            __m128i v =_mm_loadu_si128( (const __m128i*)(buf + i) );
+            __m128i l =_mm_shuffle_epi8( lo, _mm_and_si128( v, low_nibble ) );
+            __m128i h =_mm_shuffle_epi8( hi, _mm_and_si128( _mm_srli_epi16( v, 4 ), low_nibble ) );
+            __m128i m =_mm_cmpeq_epi8( _mm_and_si128( l, h ), _mm_setzero_si128() );
+            unsigned int mask =~(unsigned int)_mm_movemask_epi8( m ) & 0xffff;
+            if( mask )
+                return i + scan_lowest_bit( mask );
+        }
+    }
+#endif
+#if defined(SCAN_SSE2)
+    if( n >= 0 ) {
+        __m128i s16[SCAN_MAX_SET];
+        const __m128i u16 =_mm_set1_epi8( (char)upto );
+        for( int k =0; k < n; k++ )
+            s16[k] =_mm_set1_epi8( set->list[k] );
+
+        for( ; i + 16 <= len; i += 16 ) {
+            __m128i v =_mm_loadu_si128( (const __m128i*)(buf + i) );
+            __m128i m =set->below ? _mm_cmpeq_epi8( _mm_min_epu8( v, u16 ), v ) : _mm_setzero_si128();
+            for( int k =0; k < n; k++ )
+                m =_mm_or_si128( m, _mm_cmpeq_epi8( v, s16[k] ) );
+            unsigned int mask =(unsigned int)_mm_movemask_epi8( m );
+            if( mask )
+                return i + scan_lowest_bit( mask );
+        }
+    }
+#endif
+    for( ; i < len; i++ ) {
+        if( scan_in_set( set, buf[i] ) )
+            return i;
+    }
+    return len;
+}
+
+/* Update @row and @col for the @len characters in @buf.
+ * Every newline increments the row and resets the column to one,
+ * all other characters except carriage returns increment the column. */
+static inline void
+scan_lines( const char* buf, size_t len, unsigned int* row, unsigned int* col ) {
+    size_t i =0;
+#if defined(SCAN_SSE2)
+    const __m128i nl =_mm_set1_epi8( '\n' );
+    const __m128i cr =_mm_set1_epi8( '\r' );
+
+    for( ; i + 16 <= len; i += 16 ) {
+        __m128i v =_mm_loadu_si128( (const __m128i*)(buf + i) );
+        unsigned int nl_mask =(unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( v, nl ) );
+        unsigned int cr_mask =(unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( v, cr ) );
+        if( nl_mask ) {
+            // Only the characters after the last newline count towards the column
+            int last =scan_highest_bit( nl_mask );
+            *row +=scan_popcount( nl_mask );
+            *col =1 + (15 - last) - scan_popcount( cr_mask >> (last + 1) );
+        } else
+            *col +=16 - scan_popcount( cr_mask );
+    }
+#endif
+    for( ; i < len; i++ ) {
+        if( buf[i] == '\n' ) {
+            (*row)++;
+            *col =1;
+        } else if( buf[i] != '\r' )
+            (*col)++;
+    }
+}
+
+#endif
@@ -0,0 +1,371 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements the binary event stream: the parser's events are written by a set of
+ * internal event handlers, that append a record to the stream for every event.
+ * See haut/serial.h for the format.
+ */
+
+#include "../include/haut/serial.h"
+#include "../include/haut/tag.h"
+#include "../include/haut/attr.h"
+#include "haut_state.h"
+#include <string.h>
+
+static const char SERIAL_MAGIC[4] ={ 'H', 'A', 'U', 'T' };
+
+/* Largest encoding of a varint, of the kind and ids of a record */
+#define VARINT_MAX 10
+#define RECORD_OVERHEAD (1 + 2 * VARINT_MAX)
+
+/** Make room for a record of at most @size bytes in @out and return where it begins */
+static uint8_t*
+begin_record( strbuffer_t* out, size_t size ) {
+    strbuffer_grow( out, size );
+    return (uint8_t*)out->data + out->size;
+}
+
+/** Complete the record in @out that ends at @end */
+static void
+end_record( strbuffer_t* out, uint8_t* end ) {
+    out->size =(char*)end - out->data;
+    out->data[out->size] =0;
+}
+
+/** Write @v as a varint at @b and return the end of it */
+static uint8_t*
+put_varint( uint8_t* b, uint64_t v ) {
+    while( v >= 0x80 ) {
+        *b++ =(uint8_t)v | 0x80;
+        v >>=7;
+    }
+    *b++ =(uint8_t)v;
+    return b;
+}
+
+/** Write @f as a string at @b and return the end of it */
+static uint8_t*
+put_string( uint8_t* b, const strfragment_t* f ) {
+    b =put_varint( b, f->size );
+    memcpy( b, f->data, f->size );
+    return b + f->size;
+}
+
+static uint8_t*
+put_u32( uint8_t* b, uint32_t v ) {
+    for( int i =0; i < 4; i++, v >>=8 )
+        *b++ =(uint8_t)v;
+    return b;
+}
+
+static uint32_t
+get_u32( const uint8_t* b ) {
+    return b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24;
+}
+
+/** Append a record of @kind with the id @id, if @kind has one, and the string @f */
+static void
+write_token( haut_t* p, int kind, uint32_t id, const strfragment_t* f ) {
+    strbuffer_t* out =(strbuffer_t*)p->userdata;
+    uint8_t* b =begin_record( out, RECORD_OVERHEAD + f->size );
+    *b++ =kind;
+    if( kind == SERIAL_ELEMENT_OPEN || kind == SERIAL_ELEMENT_CLOSE )
+        b =put_varint( b, id );
+    end_record( out, put_string( b, f ) );
+}
+
+/** Append a record of @kind without fields */
+static void
+write_kind( haut_t* p, int kind ) {
+    strbuffer_t* out =(strbuffer_t*)p->userdata;
+    uint8_t* b =begin_record( out, 1 );
+    *b++ =kind;
+    end_record( out, b );
+}
+
+/* Writing event handlers */
+
+static void
+write_document_begin( haut_t* p ) {
+    write_kind( p, SERIAL_DOCUMENT_BEGIN );
+}
+
+static void
+write_document_end( haut_t* p ) {
+    write_kind( p, SERIAL_DOCUMENT_END );
+}
+
+static void
+write_element_open( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    write_token( p, SERIAL_ELEMENT_OPEN, tag, name );
+}
+
+static void
+write_element_close( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    write_token( p, SERIAL_ELEMENT_CLOSE, tag, name );
+}
+
+static void
+write_attribute_id( haut_t* p, haut_attr_t attr, strfragment_t* key, strfragment_t* value ) {
+    strbuffer_t* out =(strbuffer_t*)p->userdata;
+    uint8_t* b =begin_record( out, 2 * RECORD_OVERHEAD + key->size + (value ? value->size : 0) );
+    *b++ =value ? SERIAL_ATTRIBUTE : SERIAL_ATTRIBUTE_VOID;
+    b =put_varint( b, attr );
+    b =put_string( b, key );
+    if( value )
+        b =put_string( b, value );
+    end_record( out, b );
+}
+
+static void
+write_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    // Written by write_attribute_id()
+}
+
+static void
+write_comment( haut_t* p, strfragment_t* text ) {
+    write_token( p, SERIAL_COMMENT, 0, text );
+}
+
+static void
+write_innertext( haut_t* p, strfragment_t* text ) {
+    write_token( p, SERIAL_INNERTEXT, 0, text );
+}
+
+static void
+write_cdata( haut_t* p, strfragment_t* text ) {
+    write_token( p, SERIAL_CDATA, 0, text );
+}
+
+static void
+write_doctype( haut_t* p, strfragment_t* text ) {
+    write_token( p, SERIAL_DOCTYPE, 0, text );
+}
+
+static void
+write_script( haut_t* p, strfragment_t* text ) {
+    write_token( p, SERIAL_SCRIPT, 0, text );
+}
+
+static void
+write_error( haut_t* p, haut_error_t err ) {
+    strbuffer_t* out =(strbuffer_t*)p->userdata;
+    uint8_t* b =begin_record( out, RECORD_OVERHEAD );
+    *b++ =SERIAL_ERROR;
+    b =put_varint( b, err );
+    end_record( out, put_varint( b, p->position.offset ) );
+}
+
+static const haut_event_handler_t SERIAL_EVENT_HANDLER = {
+    .document_begin=write_document_begin,
+    .document_end  =write_document_end,
+    .element_open  =write_element_open,
+    .element_close =write_element_close,
+    .attribute     =write_attribute,
+    .comment       =write_comment,
+    .innertext     =write_innertext,
+    .doctype       =write_doctype,
+    .script        =write_script,
+    .cdata         =write_cdata,
+    .error         =write_error,
+    .attribute_id  =write_attribute_id,
+};
+
+/* Reading */
+
+/** Read a varint from @r into @v. Returns false if there is none */
+static bool
+get_varint( haut_serial_reader_t* r, uint64_t* v ) {
+    uint64_t x =0;
+    for( int shift =0; r->ptr < r->end && shift < 64; shift +=7 ) {
+        uint8_t b =*r->ptr++;
+        x |=(uint64_t)(b & 0x7f) << shift;
+        if( !(b & 0x80) ) {
+            *v =x;
+            return true;
+        }
+    }
+    r->status =SERIAL_BAD_RECORD;
+    return false;
+}
+
+/** Read a varint of at most 32 bits from @r into @v. Returns false if there is none */
+static bool
+get_id( haut_serial_reader_t* r, uint32_t* v ) {
+    uint64_t x;
+    if( !get_varint( r, &x ) )
+        return false;
+    if( x > UINT32_MAX ) {
+        r->status =SERIAL_BAD_RECORD;
+        return false;
+    }
+    *v =(uint32_t)x;
+    return true;
+}
+
+/** Read a string from @r into @f. Returns false if there is none */
+static bool
+get_string( haut_serial_reader_t* r, strfragment_t* f ) {
+    uint64_t n;
+    if( !get_varint( r, &n ) )
+        return false;
+    if( n > (uint64_t)(r->end - r->ptr) ) {
+        r->status =SERIAL_BAD_RECORD;
+        return false;
+    }
+    f->data =(const char*)r->ptr;
+    f->size =n;
+    r->ptr +=n;
+    return true;
+}
+
+/* */
+
+void
+haut_parseToSerial( haut_t* p, const char* buffer, size_t len, strbuffer_t* out ) {
+    haut_event_handler_t events =p->events;
+    void* userdata =p->userdata;
+
+    uint8_t* b =begin_record( out, HAUT_SERIAL_HEADER_SIZE );
+    memcpy( b, SERIAL_MAGIC, sizeof( SERIAL_MAGIC ) );
+    b +=sizeof( SERIAL_MAGIC );
+    *b++ =HAUT_SERIAL_VERSION;
+    b =put_u32( b, TAG__HASH );
+    end_record( out, put_u32( b, ATTR__HASH ) );
+
+    p->events =SERIAL_EVENT_HANDLER;
+    p->userdata =out;
+    haut_setInput( p, buffer, len );
+    haut_parse( p );
+    p->events =events;
+    p->userdata =userdata;
+
+    b =begin_record( out, 1 );
+    *b++ =SERIAL_END;
+    end_record( out, b );
+}
+
+haut_serial_status_t
+haut_serialOpen( haut_serial_reader_t* r, const void* data, size_t size ) {
+    const uint8_t* b =(const uint8_t*)data;
+    r->ptr =b + HAUT_SERIAL_HEADER_SIZE;
+    r->end =b + size;
+    if( size < HAUT_SERIAL_HEADER_SIZE || memcmp( b, SERIAL_MAGIC, sizeof( SERIAL_MAGIC ) ) != 0 )
+        r->status =SERIAL_BAD_MAGIC;
+    else if( b[4] != HAUT_SERIAL_VERSION )
+        r->status =SERIAL_BAD_VERSION;
+    else if( get_u32( b + 5 ) != TAG__HASH || get_u32( b + 9 ) != ATTR__HASH )
+        r->status =SERIAL_BAD_NUMBERING;
+    else
+        r->status =SERIAL_OK;
+    return r->status;
+}
+
+bool
+haut_serialNext( haut_serial_reader_t* r, haut_serial_record_t* rec ) {
+    if( r->status != SERIAL_OK )
+        return false;
+    if( r->ptr == r->end ) {
+        // The stream ends without SERIAL_END
+        r->status =SERIAL_BAD_RECORD;
+        return false;
+    }
+
+    rec->kind =*r->ptr++;
+    switch( rec->kind ) {
+        case SERIAL_END:
+            // Stay at the end, so that every following call returns false as well
+            r->ptr--;
+            return false;
+        case SERIAL_ELEMENT_OPEN:
+        case SERIAL_ELEMENT_CLOSE:
+            return get_id( r, &rec->id ) && get_string( r, &rec->text );
+        case SERIAL_ATTRIBUTE:
+            return get_id( r, &rec->id ) && get_string( r, &rec->text ) && get_string( r, &rec->value );
+        case SERIAL_ATTRIBUTE_VOID:
+            rec->value.data =NULL;
+            rec->value.size =0;
+            return get_id( r, &rec->id ) && get_string( r, &rec->text );
+        case SERIAL_COMMENT:
+        case SERIAL_INNERTEXT:
+        case SERIAL_CDATA:
+        case SERIAL_DOCTYPE:
+        case SERIAL_SCRIPT:
+            return get_string( r, &rec->text );
+        case SERIAL_ERROR: {
+            uint64_t offset;
+            if( !get_id( r, &rec->id ) || !get_varint( r, &offset ) )
+                return false;
+            rec->offset =offset;
+            return true;
+        }
+        case SERIAL_DOCUMENT_BEGIN:
+        case SERIAL_DOCUMENT_END:
+            return true;
+        default:
+            r->status =SERIAL_BAD_RECORD;
+            return false;
+    }
+}
+
+haut_serial_status_t
+haut_serialReplay( const void* data, size_t size, haut_t* p ) {
+    haut_serial_reader_t r;
+    haut_serial_record_t rec;
+    if( haut_serialOpen( &r, data, size ) != SERIAL_OK )
+        return r.status;
+
+    while( p->state->halt != HALT_STOP && haut_serialNext( &r, &rec ) ) {
+        switch( rec.kind ) {
+            case SERIAL_DOCUMENT_BEGIN:
+                p->events.document_begin( p );
+                break;
+            case SERIAL_DOCUMENT_END:
+                p->events.document_end( p );
+                break;
+            case SERIAL_ELEMENT_OPEN:
+                p->state->last_tag =rec.id;
+                p->events.element_open( p, rec.id, &rec.text );
+                break;
+            case SERIAL_ELEMENT_CLOSE:
+                p->state->last_tag =rec.id;
+                p->events.element_close( p, rec.id, &rec.text );
+                break;
+            case SERIAL_ATTRIBUTE:
+                haut_emit_attribute( p, &rec.text, &rec.value );
+                break;
+            case SERIAL_ATTRIBUTE_VOID:
+                haut_emit_attribute( p, &rec.text, NULL );
+                break;
+            case SERIAL_COMMENT:
+                p->events.comment( p, &rec.text );
+                break;
+            case SERIAL_INNERTEXT:
+                p->events.innertext( p, &rec.text );
+                break;
+            case SERIAL_CDATA:
+                p->events.cdata( p, &rec.text );
+                break;
+            case SERIAL_DOCTYPE:
+                p->events.doctype( p, &rec.text );
+                break;
+            case SERIAL_SCRIPT:
+                p->events.script( p, &rec.text );
+                break;
+            case SERIAL_ERROR:
+                p->state->last_error =rec.id;
+                if( p->events.error != NULL )
+                    p->events.error( p, rec.id );
+                break;
+            default:
+                break;
+        }
+    }
+    return r.status;
+}
@@ -152,4 +152,11 @@
 #define P_RESET_LEXER           24      /* Set the lexer state by looking at the current character (again) */
 #define P_SAVE_TOKEN            25      /* Save the current token to a separate buffer - we do this already in streaming mode */
 
+/* Fused lexer/parser transitions (see fused_transitions.h)
+ * Each transition packs the next lexer state with up to two parser actions */
+
+#define FUSED_ACTION_BIT        0x80000000      /* Set if at least one of the parser actions is not P_NONE */
+#define FUSED_NEXT_STATE(t)     ((int)((t) & 0xff))
+#define FUSED_ACTION(t,k)       ((int)(((t) >> (8 + 8*(k))) & 0xff))
+
 #endif
@@ -7,20 +7,47 @@
 
 #include "../include/haut/state_machine.h"
 #include "../include/haut/tag.h"
+#include "../include/haut/attr.h"
 #include "state.h"
 #include "entity.h"
+#include "scan.h"
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
 #pragma pack(1)
 
 #define INPUT_BITS 8 // for now
 
-static const char* _lexer_transition[L_N_STATES][1<<INPUT_BITS] = {
+/* If non-zero, lexer_fused_run() uses the code generated by fsm2array (-g) 
+ * instead of the table-driven FSM */
+#ifndef HAUT_LEXER_CODEGEN
+#define HAUT_LEXER_CODEGEN 0
+#endif
+
+/* If non-zero, decode_tag() looks up the name in the perfect hash generated by gen_tags (-h)
+ * instead of running the tag FSM over it. On the names of crawled pages (see testing/bench_tags.c),
+ * the FSM is slightly faster */
+#ifndef HAUT_TAG_HASH
+#define HAUT_TAG_HASH 0
+#endif
+
+static const uint8_t _lexer_class[1<<INPUT_BITS] = {
     /* Here the output of the FSM-generator is inserted
-     * Given a combination of current state and input character, 
-     * this array gives the next state of the tokenizer */
+     * The lexer only distinguishes a few dozen classes of characters,
+     * this array maps each input character to its class. It also defines FSM__N_CLASSES */
+#include "lexer_classes.h"
+};
+
+enum { LEXER_N_CLASSES =FSM__N_CLASSES };
+#undef FSM__N_CLASSES
+
+static const uint8_t _lexer_transition[L_N_STATES][LEXER_N_CLASSES] = {
+    /* Here the output of the FSM-generator is inserted
+     * Given a combination of current state and character class, 
+     * this array gives the next state of the tokenizer.
+     * Each cell is a single byte, so the table fits in a few kilobytes */
 #include "lexer_transitions.h"
 };
 
@@ -48,18 +75,61 @@ static const char* _parser_transition[L_N_STATES][L_N_STATES] = {
     #include "parser_transitions.h"
 };
 
+static const uint32_t _fused_transition[L_N_STATES][LEXER_N_CLASSES] = {
+    /* Here the output of the FSM-generator is inserted
+     * This is the composition of the lexer and the parser FSM:
+     * given the current state and character class, each cell holds the next
+     * state of the lexer together with the parser's actions for that transition */
+#include "fused_transitions.h"
+};
+
+static const scan_set_t _lexer_exit_set[L_N_STATES] = {
+    /* Here the output of the FSM-generator is inserted
+     * For each lexer state, this array gives the set of characters that leave the state
+     * or cause a parser action. States with a list (size >= 0) loop on themselves for
+     * nearly every character and are skipped by scanning for their exit set */
+#include "lexer_exit_sets.h"
+};
+
+#if HAUT_TAG_HASH
+typedef struct {
+    char name[16];                      // Zero-padded, in lower case
+    uint8_t length;
+    uint16_t id;
+} ph_entry_t;
+
+/* Here the output of gen_tags is inserted
+ * It defines the displacement of each bucket and the name in each slot of the hash table */
+#include "tag_hash.h"
+#else
 static uint16_t _tag_transition[][TAG__N_INPUTS] = {
     #include "tag_transitions.h"
 };
+#endif
+
+static uint16_t _attr_transition[][ATTR__N_INPUTS] = {
+    #include "attr_transitions.h"
+};
 
 static uint32_t _entity_transitions[][ENTITY__N_INPUTS] = {
     #include "entity_transitions.h"
 };
 
+typedef struct {
+    char32_t codepoint;                 // The first codepoint of the entity
+    uint8_t length;
+    char utf8[ENTITY__MAX_UTF8+1];      // The UTF-8 encoding of all its codepoints
+} entity_t;
+
+/* Indexed by the accepting states of _entity_transitions */
+static const entity_t _entities[ENTITY__N] = {
+    #include "entity_table.h"
+};
+
 
 int 
 lexer_next_state( int lexer_state, char c ) {
-    return _lexer_transition[lexer_state][(unsigned char)c][0];
+    return _lexer_transition[lexer_state][_lexer_class[(unsigned char)c]];
 }
 
 const char* 
@@ -67,6 +137,120 @@ parser_next_state( int lexer_state, int next_lexer_state ) {
     return _parser_transition[lexer_state][next_lexer_state];
 }
 
+#if HAUT_LEXER_CODEGEN
+
+size_t
+lexer_fused_run( int* lexer_state, const char* buf, size_t len, uint32_t* transition ) {
+    int state =*lexer_state;
+    size_t i =0;
+
+    /* Here the output of the FSM-generator is inserted
+     * This is the same FSM as _fused_transition, but written as code
+     * with one label per state and a direct jump for each transition */
+#include "fused_codegen.h"
+
+    *lexer_state =state;
+    return i;
+}
+
+#else
+
+size_t
+lexer_fused_run( int* lexer_state, const char* buf, size_t len, uint32_t* transition ) {
+    int state =*lexer_state;
+    size_t i =0;
+
+    for( ; i < len; i++ ) {
+        uint32_t t =_fused_transition[state][_lexer_class[(unsigned char)buf[i]]];
+        // The common case: no parser action, just move to the next state
+        if( t & FUSED_ACTION_BIT ) {
+            *transition =t;
+            break;
+        }
+        int next =FUSED_NEXT_STATE( t );
+        // Leave the rest of a skippable state to lexer_skip()
+        if( next != state && _lexer_exit_set[next].size >= 0 ) {
+            state =next;
+            *transition =0;
+            i++;
+            break;
+        }
+        state =next;
+    }
+
+    *lexer_state =state;
+    return i;
+}
+
+#endif
+
+int
+lexer_fused_run_interleaved( lexer_stream_t* streams, int n ) {
+    /* Each round advances every stream by one character. The streams do not depend on each other,
+     * so the lookups of one round can be in flight at the same time. The stopping conditions are
+     * the same as in lexer_fused_run() */
+    for( ;; ) {
+        for( int k =0; k < n; k++ ) {
+            lexer_stream_t* s =&streams[k];
+            if( s->buf == s->end ) {
+                s->transition =0;
+                return k;
+            }
+            uint32_t t =_fused_transition[s->state][_lexer_class[(unsigned char)*s->buf]];
+            if( t & FUSED_ACTION_BIT ) {
+                s->transition =t;
+                return k;
+            }
+            int next =FUSED_NEXT_STATE( t );
+            s->buf++;
+            if( next != s->state && _lexer_exit_set[next].size >= 0 ) {
+                s->state =next;
+                s->transition =0;
+                return k;
+            }
+            s->state =next;
+        }
+    }
+}
+
+size_t
+lexer_skip( int lexer_state, const char* buf, size_t len ) {
+    const scan_set_t* set =&_lexer_exit_set[lexer_state];
+    if( set->size < 0 )
+        return 0;
+    return scan_for_set( buf, len, set );
+}
+
+#if HAUT_TAG_HASH
+/** Returns @c in lower case, if it is an ASCII letter */
+static inline uint32_t
+fold_char( unsigned char c ) {
+    return c | ((unsigned)(c - 'A') < 26u) << 5;
+}
+
+int 
+decode_tag( const char* str, size_t len ) {
+    if( len == 0 || len > TAG__PH_MAX_LENGTH )
+        return TAG_UNKNOWN;
+
+    /* The hash of the length and the first, second and last character selects the only name
+     * that @str can be, which is then compared to @str in its entirety.
+     * The characters are packed in one word and folded to lower case at once by setting bit 5 of
+     * every byte, which leaves the letters, digits and '-' of the names themselves unchanged */
+    uint32_t key =((unsigned char)str[0] | (unsigned char)str[len > 1] << 8 
+                | (uint32_t)(unsigned char)str[len-1] << 16 | 0x202020) | (uint32_t)len << 24;
+    uint32_t bucket =(key * TAG__PH_MULTIPLIER1) >> (32 - TAG__PH_BUCKET_BITS);
+    const ph_entry_t* e =&_tag_ph_entries[(((key * TAG__PH_MULTIPLIER2) >> 16) + _tag_ph_displacement[bucket]) % TAG__PH_SIZE];
+    if( e->length != len )
+        return TAG_UNKNOWN;
+
+    // Most names are in lower case already
+    for( size_t i =0; i < len; i++ )
+        if( str[i] != e->name[i] && fold_char( str[i] ) != (unsigned char)e->name[i] )
+            return TAG_UNKNOWN;
+    return e->id;
+}
+#else
 int 
 decode_tag( const char* str, size_t len ) {
 
@@ -75,11 +259,9 @@ decode_tag( const char* str, size_t len ) {
     //printf( "decode_tag: `%.*s'\n", (int)len, str );
 
     for( size_t i =0; i < len; i++ ) {
-        // This is the dangerous part: we expect str[i] to be 
-        // in the range [TAG__FIRST_CHAR, TAG__LAST_CHAR]
-        
-//        if( str[i] < TAG__FIRST_CHAR || str[i] > TAG__LAST_CHAR ) break;
-        
+        // The lexer ends a name on whitespace, '/' and '>', but any other character can occur in it
+        if( str[i] < TAG__FIRST_CHAR || str[i] > TAG__LAST_CHAR )
+            return TAG_UNKNOWN;
         state = _tag_transition[state][str[i]-TAG__FIRST_CHAR];
     }
     
@@ -89,9 +271,30 @@ decode_tag( const char* str, size_t len ) {
 
     return TAG_UNKNOWN;
 }
+#endif
+
+int 
+decode_attr( const char* str, size_t len ) {
+
+    int state =ATTR_NONE;
+
+    for( size_t i =0; i < len; i++ ) {
+        // Unlike tag names, attribute names can contain almost any character
+        if( str[i] < ATTR__FIRST_CHAR || str[i] > ATTR__LAST_CHAR ) 
+            return ATTR_UNKNOWN;
+        state = _attr_transition[state][str[i]-ATTR__FIRST_CHAR];
+    }
+    
+    state = _attr_transition[state][ATTR__EOF];
+    if( state < ATTR__N )
+        return state; 
+
+    return ATTR_UNKNOWN;
+}
 
-char32_t 
-decode_entity( const char* str, size_t len ) {
+/** Returns the index of the entity @str in _entities, or ENTITY_UNKNOWN */
+static inline int
+entity_index( const char* str, size_t len ) {
 
     int state =ENTITY_NONE;
 
@@ -111,3 +314,20 @@ decode_entity( const char* str, size_t len ) {
     }
     return ENTITY_UNKNOWN;
 }
+
+char32_t 
+decode_entity( const char* str, size_t len ) {
+    int index =entity_index( str, len );
+    if( index == ENTITY_UNKNOWN )
+        return ENTITY_UNKNOWN;
+    return _entities[index].codepoint;
+}
+
+const char*
+decode_entity_utf8( const char* str, size_t len, size_t* utf8_len ) {
+    int index =entity_index( str, len );
+    if( index == ENTITY_UNKNOWN )
+        return NULL;
+    *utf8_len =_entities[index].length;
+    return _entities[index].utf8;
+}
@@ -16,6 +16,7 @@
 #endif
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
+#define MAX(a,b) (((a)>(b))?(a):(b))
 
 void 
 strfragment_set( strfragment_t* str, const char* buf, size_t len ) {
@@ -58,9 +59,44 @@ strfragment_nicmp(strfragment_t* str1, const char* str2, size_t len) {
 
 #define BLOCK_SIZE 64
 
+/** Allocate @size bytes for @d, using its allocator if it has one */
+static char*
+buffer_allocate( strbuffer_t* d, size_t size ) {
+    d->allocations++;
+    if( d->allocator )
+        return (char*)d->allocator->allocate( d->allocator->userdata, size );
+    return (char*)malloc( size );
+}
+
+/** Change the capacity of @d to @newcap bytes, keeping its contents up to the new capacity */
+static void
+buffer_resize( strbuffer_t* d, size_t newcap ) {
+    if( d->allocator ) {
+        // There is no reallocate function, but we know how much of the old memory is used
+        char* data =buffer_allocate( d, newcap );
+        assert( data != NULL );
+        memcpy( data, d->data, MIN( d->size + 1, newcap ) );
+        d->allocator->deallocate( d->allocator->userdata, d->data );
+        d->data =data;
+    } else {
+        d->allocations++;
+        d->data =realloc( d->data, newcap );
+        assert( d->data != NULL );
+    }
+    d->capacity =newcap;
+}
+
 void
 strbuffer_init( strbuffer_t* d ) {
-    d->data =malloc( BLOCK_SIZE );
+    strbuffer_initAllocator( d, NULL );
+}
+
+void
+strbuffer_initAllocator( strbuffer_t* d, const strallocator_t* allocator ) {
+    d->allocator =allocator;
+    d->allocations =0;
+    d->data =buffer_allocate( d, BLOCK_SIZE );
+    assert( d->data != NULL );
     d->data[0] =0;
     d->size =0;
     d->capacity =BLOCK_SIZE;
@@ -68,21 +104,27 @@ strbuffer_init( strbuffer_t* d ) {
 
 void
 strbuffer_free( strbuffer_t* d ) {
-    free( d->data );
+    if( d->allocator )
+        d->allocator->deallocate( d->allocator->userdata, d->data );
+    else
+        free( d->data );
     d->size =0;
 }
 
 void 
 strbuffer_clear( strbuffer_t* d ) {
-    if( d->capacity > BLOCK_SIZE ) {
-        d->data =realloc( d->data, BLOCK_SIZE );
-        assert( d->data != NULL );
-        d->capacity =BLOCK_SIZE;
-    }
+    // The memory is kept, use strbuffer_trim() to release it
     d->size =0;
     d->data[0] =0;
 }
 
+void
+strbuffer_trim( strbuffer_t* d, size_t high_water ) {
+    size_t newcap =((MAX( d->size + 1, high_water ) + BLOCK_SIZE - 1) / BLOCK_SIZE) * BLOCK_SIZE;
+    if( newcap < d->capacity )
+        buffer_resize( d, newcap );
+}
+
 size_t
 strbuffer_grow( strbuffer_t* d, size_t add ) {
     return strbuffer_reserve( d, d->size + add );
@@ -95,11 +137,11 @@ strbuffer_reserve( strbuffer_t* d, size_t total ) {
     
     // Reallocate if total exceeds capacity
     if( total + 1 > d->capacity ) {
-        size_t newcap =((total + 1) / BLOCK_SIZE + 1) * BLOCK_SIZE;
-        d->data =realloc( d->data, newcap );
-        assert( d->data != NULL );
+        // Grow geometrically, so that a token that is appended to piece by piece
+        // only causes a logarithmic number of allocations
+        size_t newcap =MAX( ((total + 1) / BLOCK_SIZE + 1) * BLOCK_SIZE, d->capacity * 2 );
+        buffer_resize( d, newcap );
         d->data[d->size] =0;
-        d->capacity =newcap;
     }
     return d->capacity;
 }
@@ -153,32 +195,40 @@ strbuffer_toFragment( strbuffer_t* str ) {
     return frag;
 }
 
+/** Returns the number of bytes of the UTF-8 encoding of @c, or zero if @c is not Unicode */
+static int
+utf8_length( char32_t c ) {
+    // Unicode codepoints can either expand to 1, 2, 3 or 4 UTF-8 values
+    if( c < 0x80 )
+        return 1;
+    else if( c < 0x800 )
+        return 2;
+    else if( c < 0x10000 )
+        return 3;
+    else if( c <= 0x10FFFF )
+        return 4;
+    return 0;
+}
+
 bool
 u32toUTF8( strbuffer_t* d, char32_t c ) {
-    // Unicode codepoints can either expand to 1, 2, 3 or 4 UTF-8 values
-    int length =0;
-    if( c < 0x80 ) {
-        length =1;
-    } else if( c < 0x800 ) { 
-        length =2;
-    } else if( c < 0x10000 ) {
-        length =3;
-    } else if( c <= 0x10FFFF ) {
-        length =4;
-    } else
+    int length =utf8_length( c );
+    if( !length )
         return false; // Not Unicode
 
     // Allocate the correct number of bytes
     d->data = (char*)malloc( sizeof(char) * length+1 );
     d->size =length;
     d->capacity =length+1;
+    d->allocator =NULL;
+    d->allocations =1;
 
     return u32toUTF8_at( d, 0, c );
 }
 
 bool
 u32toUTF8_at( strbuffer_t* d, int offset, char32_t c ) {
-    char* ptr = d->data;
+    char* ptr = d->data + offset;
 
     // Multi-byte sequences a made up of six-bit groups in the codepoint,
     // OR'ed with 0x80 they make a byte.
@@ -209,3 +259,14 @@ u32toUTF8_at( strbuffer_t* d, int offset, char32_t c ) {
         return false;
     return true;
 }
+
+bool
+strbuffer_appendUTF8( strbuffer_t* d, char32_t c ) {
+    int length =utf8_length( c );
+    if( !length )
+        return false;
+    strbuffer_grow( d, length );
+    u32toUTF8_at( d, d->size, c );
+    d->size +=length;
+    return true;
+}
@@ -0,0 +1,170 @@
+/* This file was automatically generated by gen_tags.c from `../html5_tags.in' 
+ * Please do not edit this file in any way 
+ * The includer defines ph_entry_t as { char name[16]; uint8_t length; uint16_t id; }
+ */
+
+#define TAG__PH_SIZE 150
+#define TAG__PH_BUCKET_BITS 6
+#define TAG__PH_MAX_LENGTH 16
+#define TAG__PH_MULTIPLIER1 0xdaa66d13u
+#define TAG__PH_MULTIPLIER2 0xb9984a71u
+
+static const uint8_t _tag_ph_displacement[1 << TAG__PH_BUCKET_BITS] = {
+    0, 8, 3, 0, 3, 4, 8, 21, 20, 2, 6, 2, 22, 0, 32, 0,
+    3, 42, 33, 0, 6, 0, 4, 9, 3, 38, 5, 11, 3, 49, 2, 0,
+    4, 30, 3, 5, 13, 1, 0, 56, 11, 40, 1, 7, 4, 0, 0, 2,
+    1, 41, 13, 2, 5, 21, 14, 11, 0, 137, 5, 2, 62, 2, 77, 107
+};
+
+static const ph_entry_t _tag_ph_entries[TAG__PH_SIZE] = {
+    { "time", 4, TAG_TIME },
+    { "desc", 4, TAG_DESC },
+    { "data", 4, TAG_DATA },
+    { "form", 4, TAG_FORM },
+    { "mark", 4, TAG_MARK },
+    { "li", 2, TAG_LI },
+    { "var", 3, TAG_VAR },
+    { "ins", 3, TAG_INS },
+    { "progress", 8, TAG_PROGRESS },
+    { "aside", 5, TAG_ASIDE },
+    { "acronym", 7, TAG_ACRONYM },
+    { "track", 5, TAG_TRACK },
+    { "bgsound", 7, TAG_BGSOUND },
+    { "mo", 2, TAG_MO },
+    { "footer", 6, TAG_FOOTER },
+    { "hr", 2, TAG_HR },
+    { "tfoot", 5, TAG_TFOOT },
+    { "optgroup", 8, TAG_OPTGROUP },
+    { "object", 6, TAG_OBJECT },
+    { "option", 6, TAG_OPTION },
+    { "rp", 2, TAG_RP },
+    { "rb", 2, TAG_RB },
+    { "header", 6, TAG_HEADER },
+    { "br", 2, TAG_BR },
+    { "cite", 4, TAG_CITE },
+    { "ms", 2, TAG_MS },
+    { "dt", 2, TAG_DT },
+    { "s", 1, TAG_S },
+    { "label", 5, TAG_LABEL },
+    { "image", 5, TAG_IMAGE },
+    { "meta", 4, TAG_META },
+    { "select", 6, TAG_SELECT },
+    { "table", 5, TAG_TABLE },
+    { "center", 6, TAG_CENTER },
+    { "canvas", 6, TAG_CANVAS },
+    { "dd", 2, TAG_DD },
+    { "multicol", 8, TAG_MULTICOL },
+    { "frame", 5, TAG_FRAME },
+    { "xmp", 3, TAG_XMP },
+    { "hgroup", 6, TAG_HGROUP },
+    { "plaintext", 9, TAG_PLAINTEXT },
+    { "video", 5, TAG_VIDEO },
+    { "main", 4, TAG_MAIN },
+    { "marquee", 7, TAG_MARQUEE },
+    { "samp", 4, TAG_SAMP },
+    { "figcaption", 10, TAG_FIGCAPTION },
+    { "script", 6, TAG_SCRIPT },
+    { "listing", 7, TAG_LISTING },
+    { "meter", 5, TAG_METER },
+    { "colgroup", 8, TAG_COLGROUP },
+    { "keygen", 6, TAG_KEYGEN },
+    { "div", 3, TAG_DIV },
+    { "dir", 3, TAG_DIR },
+    { "nobr", 4, TAG_NOBR },
+    { "rt", 2, TAG_RT },
+    { "applet", 6, TAG_APPLET },
+    { "html", 4, TAG_HTML },
+    { "legend", 6, TAG_LEGEND },
+    { "mn", 2, TAG_MN },
+    { "button", 6, TAG_BUTTON },
+    { "textarea", 8, TAG_TEXTAREA },
+    { "malignmark", 10, TAG_MALIGNMARK },
+    { "em", 2, TAG_EM },
+    { "output", 6, TAG_OUTPUT },
+    { "address", 7, TAG_ADDRESS },
+    { "img", 3, TAG_IMG },
+    { "mglyph", 6, TAG_MGLYPH },
+    { "small", 5, TAG_SMALL },
+    { "td", 2, TAG_TD },
+    { "ul", 2, TAG_UL },
+    { "noembed", 7, TAG_NOEMBED },
+    { "figure", 6, TAG_FIGURE },
+    { "font", 4, TAG_FONT },
+    { "noframes", 8, TAG_NOFRAMES },
+    { "menu", 4, TAG_MENU },
+    { "param", 5, TAG_PARAM },
+    { "fieldset", 8, TAG_FIELDSET },
+    { "embed", 5, TAG_EMBED },
+    { "h1", 2, TAG_H1 },
+    { "th", 2, TAG_TH },
+    { "map", 3, TAG_MAP },
+    { "foreignobject", 13, TAG_FOREIGNOBJECT },
+    { "head", 4, TAG_HEAD },
+    { "col", 3, TAG_COL },
+    { "big", 3, TAG_BIG },
+    { "pre", 3, TAG_PRE },
+    { "input", 5, TAG_INPUT },
+    { "bdo", 3, TAG_BDO },
+    { "base", 4, TAG_BASE },
+    { "tbody", 5, TAG_TBODY },
+    { "basefont", 8, TAG_BASEFONT },
+    { "ol", 2, TAG_OL },
+    { "blink", 5, TAG_BLINK },
+    { "p", 1, TAG_P },
+    { "body", 4, TAG_BODY },
+    { "q", 1, TAG_Q },
+    { "i", 1, TAG_I },
+    { "blockquote", 10, TAG_BLOCKQUOTE },
+    { "sub", 3, TAG_SUB },
+    { "h2", 2, TAG_H2 },
+    { "spacer", 6, TAG_SPACER },
+    { "b", 1, TAG_B },
+    { "style", 5, TAG_STYLE },
+    { "h4", 2, TAG_H4 },
+    { "h3", 2, TAG_H3 },
+    { "dl", 2, TAG_DL },
+    { "menuitem", 8, TAG_MENUITEM },
+    { "strong", 6, TAG_STRONG },
+    { "h5", 2, TAG_H5 },
+    { "del", 3, TAG_DEL },
+    { "span", 4, TAG_SPAN },
+    { "ruby", 4, TAG_RUBY },
+    { "strike", 6, TAG_STRIKE },
+    { "caption", 7, TAG_CAPTION },
+    { "noscript", 8, TAG_NOSCRIPT },
+    { "mi", 2, TAG_MI },
+    { "abbr", 4, TAG_ABBR },
+    { "math", 4, TAG_MATH },
+    { "a", 1, TAG_A },
+    { "isindex", 7, TAG_ISINDEX },
+    { "h6", 2, TAG_H6 },
+    { "audio", 5, TAG_AUDIO },
+    { "nav", 3, TAG_NAV },
+    { "wbr", 3, TAG_WBR },
+    { "template", 8, TAG_TEMPLATE },
+    { "annotation-xml", 14, TAG_ANNOTATION_XML },
+    { "dfn", 3, TAG_DFN },
+    { "details", 7, TAG_DETAILS },
+    { "source", 6, TAG_SOURCE },
+    { "tr", 2, TAG_TR },
+    { "mtext", 5, TAG_MTEXT },
+    { "sup", 3, TAG_SUP },
+    { "code", 4, TAG_CODE },
+    { "article", 7, TAG_ARTICLE },
+    { "thead", 5, TAG_THEAD },
+    { "u", 1, TAG_U },
+    { "iframe", 6, TAG_IFRAME },
+    { "datalist", 8, TAG_DATALIST },
+    { "tt", 2, TAG_TT },
+    { "link", 4, TAG_LINK },
+    { "area", 4, TAG_AREA },
+    { "rtc", 3, TAG_RTC },
+    { "bdi", 3, TAG_BDI },
+    { "title", 5, TAG_TITLE },
+    { "section", 7, TAG_SECTION },
+    { "nextid", 6, TAG_NEXTID },
+    { "kbd", 3, TAG_KBD },
+    { "svg", 3, TAG_SVG },
+    { "summary", 7, TAG_SUMMARY },
+    { "frameset", 8, TAG_FRAMESET },
+};
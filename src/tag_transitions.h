@@ -1,4 +1,4 @@
-// states = 658, inputs = 75
+// states = 658, inputs = 76
 // Resulting array is indexed by [state][input+(-47)]
 // This file was automatically generated by fsm2array
 // Please do not edit this file directly
@@ -16,7 +16,7 @@
 0xa5,0xa0,0x97,0x98,0xaa,0x97,
 0xa9,0x9b,0x9c,0x9e,0xa2,0xa1,
 0xa7,0xab,0x9d,0x99,0xa3,0xa8,
-0xac,0xad,0x97},
+0xac,0xad,0x97,0x97},
 // Transitions for state 1
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -30,7 +30,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 2
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -44,7 +44,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 3
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -58,7 +58,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 4
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -72,7 +72,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 5
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -86,7 +86,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 6
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -100,7 +100,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 7
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -114,7 +114,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 8
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -128,7 +128,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 9
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -142,7 +142,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 10
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -156,7 +156,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 11
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -170,7 +170,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 12
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -184,7 +184,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 13
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -198,7 +198,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 14
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -212,7 +212,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 15
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -226,7 +226,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 16
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -240,7 +240,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 17
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -254,7 +254,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 18
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -268,7 +268,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 19
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -282,7 +282,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 20
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -296,7 +296,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 21
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -310,7 +310,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 22
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -324,7 +324,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 23
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -338,7 +338,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 24
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -352,7 +352,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 25
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -366,7 +366,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 26
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -380,7 +380,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 27
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -394,7 +394,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 28
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -408,7 +408,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 29
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -422,7 +422,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 30
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -436,7 +436,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 31
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -450,7 +450,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 32
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -464,7 +464,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 33
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -478,7 +478,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 34
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -492,7 +492,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 35
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -506,7 +506,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 36
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -520,7 +520,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 37
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -534,7 +534,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 38
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -548,7 +548,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 39
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -562,7 +562,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 40
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -576,7 +576,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 41
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -590,7 +590,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 42
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -604,7 +604,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 43
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -618,7 +618,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 44
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -632,7 +632,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 45
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -646,7 +646,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 46
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -660,7 +660,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 47
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -674,7 +674,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 48
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -688,7 +688,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 49
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -702,7 +702,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 50
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -716,7 +716,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 51
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -730,7 +730,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 52
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -744,7 +744,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 53
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -758,7 +758,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 54
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -772,7 +772,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 55
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -786,7 +786,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 56
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -800,7 +800,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 57
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -814,7 +814,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 58
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -828,7 +828,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 59
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -842,7 +842,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 60
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -856,7 +856,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 61
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -870,7 +870,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 62
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -884,7 +884,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 63
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -898,7 +898,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 64
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -912,7 +912,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 65
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -926,7 +926,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 66
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -940,7 +940,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 67
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -954,7 +954,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 68
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -968,7 +968,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 69
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -982,7 +982,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 70
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -996,7 +996,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 71
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1010,7 +1010,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 72
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1024,7 +1024,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 73
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1038,7 +1038,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 74
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1052,7 +1052,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 75
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1066,7 +1066,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 76
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1080,7 +1080,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 77
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1094,7 +1094,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 78
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1108,7 +1108,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 79
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1122,7 +1122,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 80
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1136,7 +1136,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 81
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1150,7 +1150,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 82
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1164,7 +1164,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 83
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1178,7 +1178,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 84
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1192,7 +1192,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 85
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1206,7 +1206,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 86
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1220,7 +1220,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 87
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1234,7 +1234,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 88
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1248,7 +1248,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 89
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1262,7 +1262,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 90
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1276,7 +1276,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 91
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1290,7 +1290,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 92
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1304,7 +1304,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 93
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1318,7 +1318,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 94
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1332,7 +1332,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 95
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1346,7 +1346,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 96
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1360,7 +1360,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 97
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1374,7 +1374,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 98
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1388,7 +1388,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 99
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1402,7 +1402,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 100
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1416,7 +1416,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 101
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1430,7 +1430,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 102
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1444,7 +1444,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 103
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1458,7 +1458,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 104
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1472,7 +1472,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 105
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1486,7 +1486,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 106
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1500,7 +1500,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 107
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1514,7 +1514,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 108
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1528,7 +1528,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 109
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1542,7 +1542,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 110
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1556,7 +1556,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 111
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1570,7 +1570,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 112
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1584,7 +1584,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 113
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1598,7 +1598,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 114
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1612,7 +1612,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 115
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1626,7 +1626,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 116
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1640,7 +1640,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 117
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1654,7 +1654,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 118
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1668,7 +1668,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 119
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1682,7 +1682,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 120
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1696,7 +1696,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 121
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1710,7 +1710,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 122
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1724,7 +1724,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 123
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1738,7 +1738,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 124
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1752,7 +1752,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 125
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1766,7 +1766,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 126
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1780,7 +1780,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 127
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1794,7 +1794,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 128
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1808,7 +1808,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 129
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1822,7 +1822,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 130
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1836,7 +1836,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 131
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1850,7 +1850,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 132
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1864,7 +1864,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 133
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1878,7 +1878,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 134
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1892,7 +1892,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 135
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1906,7 +1906,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 136
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1920,7 +1920,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 137
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1934,7 +1934,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 138
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1948,7 +1948,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 139
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1962,7 +1962,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 140
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1976,7 +1976,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 141
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -1990,7 +1990,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 142
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2004,7 +2004,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 143
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2018,7 +2018,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 144
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2032,7 +2032,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 145
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2046,7 +2046,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 146
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2060,7 +2060,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 147
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2074,7 +2074,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 148
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2088,7 +2088,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 149
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2102,7 +2102,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 150
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2116,7 +2116,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 151
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2130,7 +2130,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 152
 {0x97,0x97,0xbd,0xbe,0xbf,0xc0,
 0xc1,0xc2,0x97,0x97,0x97,0x97,
@@ -2144,7 +2144,7 @@
 0xaf,0x97,0xc3,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0xc6,0x97,0xae,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 153
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2158,7 +2158,7 @@
 0xb7,0xf9,0x97,0xf8,0xb0,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0xec,0x97,0x10d,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 154
 {0x3a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2172,7 +2172,7 @@
 0x97,0x97,0x103,0x97,0x10a,0x97,
 0x97,0xc8,0x97,0x97,0xb8,0x97,
 0x97,0xe1,0x97,0x97,0xfd,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 155
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2186,7 +2186,7 @@
 0xfb,0x97,0x97,0x97,0xb2,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 156
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2200,7 +2200,7 @@
 0xb3,0x97,0xf3,0x97,0xee,0x97,
 0x97,0x97,0x97,0xf0,0xef,0x97,
 0x97,0x97,0xf1,0xf2,0x10c,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 157
 {0x2c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2214,7 +2214,7 @@
 0xba,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0xd2,0x97,0xeb,0xe0,
 0x97,0x97,0x97,0xb4,0xdb,0xf5,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 158
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2228,7 +2228,7 @@
 0x107,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0xb6,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 159
 {0x28,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2242,7 +2242,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0xf4,0x97,0x101,
 0x97,0xb9,0xbc,0x97,0xea,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 160
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2256,7 +2256,7 @@
 0x97,0x97,0x97,0x97,0xce,0x97,
 0x97,0x97,0x97,0x97,0xc4,0x97,
 0x97,0x104,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 161
 {0x1a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2270,7 +2270,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x108,0x97,0x97,0x97,0x97,
 0x97,0xc7,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 162
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2284,7 +2284,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0xc9,0x97,0x97,0x97,0xfe,
 0x97,0x97,0x97,0x97,0x100,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 163
 {0x3b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2298,7 +2298,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0xca,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 164
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2312,7 +2312,7 @@
 0xe4,0xd4,0x97,0x97,0xd0,0x97,
 0x97,0xcb,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0xcc,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 165
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2326,7 +2326,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0xd1,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 166
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2340,7 +2340,7 @@
 0x10b,0x97,0x97,0x97,0xd3,0x97,
 0x97,0x97,0x97,0x97,0xd7,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 167
 {0x2e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2354,7 +2354,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 168
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2368,7 +2368,7 @@
 0x97,0x97,0x97,0x97,0xe9,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 169
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2382,7 +2382,7 @@
 0xff,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 170
 {0x39,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2396,7 +2396,7 @@
 0x97,0xe6,0x97,0x97,0x97,0x97,
 0x97,0x97,0xe5,0xe3,0x97,0x97,
 0x97,0x97,0x105,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 171
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2410,7 +2410,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0xde,
 0x97,0x97,0x97,0xdd,0xdc,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 172
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2424,7 +2424,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 173
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2438,7 +2438,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x106,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 174
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2452,7 +2452,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x10e,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 175
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2466,7 +2466,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 176
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2480,7 +2480,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x12b,0x97,0x97,0x97,
 0x97,0x97,0x97,0x110,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 177
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2494,7 +2494,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x111,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 178
 {0x20,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2508,7 +2508,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x112,0x97,0x97,
 0x97,0x97,0x16a,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 179
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2522,7 +2522,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x162,0x97,0x97,
 0x97,0x97,0x97,0x113,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 180
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2536,7 +2536,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x125,0x97,0x97,0x97,0x97,
-0x97,0x97,0x114},
+0x97,0x97,0x114,0x97},
 // Transitions for state 181
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2550,7 +2550,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x115,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 182
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2564,7 +2564,7 @@
 0x16d,0x168,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x116,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 183
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2578,7 +2578,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x117,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x15c,0x97},
+0x97,0x15c,0x97,0x97},
 // Transitions for state 184
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2592,7 +2592,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 185
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2606,7 +2606,7 @@
 0x146,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x119,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 186
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2620,7 +2620,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x15a,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 187
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2634,7 +2634,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x11b,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 188
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2648,7 +2648,7 @@
 0x97,0x97,0x97,0x97,0x11c,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 189
 {0x10,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2662,7 +2662,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 190
 {0x11,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2676,7 +2676,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 191
 {0x12,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2690,7 +2690,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 192
 {0x13,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2704,7 +2704,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 193
 {0x14,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2718,7 +2718,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 194
 {0x15,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2732,7 +2732,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 195
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2746,7 +2746,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x11d,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 196
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2760,7 +2760,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x172,0x11e,0x97,
 0x97,0x14d,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 197
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2774,7 +2774,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 198
 {0x1b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2788,7 +2788,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 199
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2802,7 +2802,7 @@
 0x120,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x15f,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 200
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2816,7 +2816,7 @@
 0x97,0x97,0x97,0x97,0x170,0x97,
 0x97,0x97,0x97,0x97,0x121,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 201
 {0x1e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2830,7 +2830,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 202
 {0x1f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2844,7 +2844,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 203
 {0x21,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2858,7 +2858,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 204
 {0x22,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2872,7 +2872,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 205
 {0x23,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2886,7 +2886,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 206
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2900,7 +2900,7 @@
 0x155,0x97,0x122,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 207
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2914,7 +2914,7 @@
 0x97,0x97,0x97,0x97,0x123,0x97,
 0x97,0x14a,0x97,0x97,0x97,0x145,
 0x97,0x132,0x97,0x147,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 208
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2928,7 +2928,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x166,0x97,0x97,0x97,0x124,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 209
 {0x29,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2942,7 +2942,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 210
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2956,7 +2956,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 211
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2970,7 +2970,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x127,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 212
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2984,7 +2984,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x128,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 213
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -2998,7 +2998,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 214
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3012,7 +3012,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x12a,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 215
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3026,7 +3026,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x151,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 216
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3040,7 +3040,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x12d,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 217
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3054,7 +3054,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x12e,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 218
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3068,7 +3068,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 219
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3082,7 +3082,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x161,0x97,0x97,0x131,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 220
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3096,7 +3096,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 221
 {0x3e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3110,7 +3110,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 222
 {0x3f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3124,7 +3124,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 223
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3138,7 +3138,7 @@
 0x97,0x97,0x97,0x97,0x134,0x97,
 0x97,0x97,0x97,0x97,0x135,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 224
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3152,7 +3152,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 225
 {0x43,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3166,7 +3166,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 226
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3180,7 +3180,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x137,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 227
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3194,7 +3194,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x158,
 0x97,0x97,0x138,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 228
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3208,7 +3208,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x139,0x97,0x97,0x97,0x97,
 0x97,0x97,0x14e,0x160,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 229
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3222,7 +3222,7 @@
 0x97,0x97,0x13b,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 230
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3236,7 +3236,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x13c,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 231
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3250,7 +3250,7 @@
 0x97,0x97,0x97,0x97,0x97,0x13e,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 232
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3264,7 +3264,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x13f,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 233
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3278,7 +3278,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 234
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3292,7 +3292,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 235
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3306,7 +3306,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x142,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 236
 {0x67,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3320,7 +3320,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 237
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3334,7 +3334,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x144,0x97,0x150,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 238
 {0x55,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3348,7 +3348,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 239
 {0x56,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3362,7 +3362,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 240
 {0x57,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3376,7 +3376,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 241
 {0x58,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3390,7 +3390,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 242
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3404,7 +3404,7 @@
 0x148,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 243
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3418,7 +3418,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x149,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 244
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3432,7 +3432,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x14b,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 245
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3446,7 +3446,7 @@
 0x97,0x97,0x14c,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 246
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3460,7 +3460,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 247
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3474,7 +3474,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x152,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 248
 {0x69,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3488,7 +3488,7 @@
 0x153,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 249
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3502,7 +3502,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x154,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 250
 {0x68,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3516,7 +3516,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 251
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3530,7 +3530,7 @@
 0x97,0x97,0x156,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 252
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3544,7 +3544,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 253
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3558,7 +3558,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x159,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 254
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3572,7 +3572,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x15b,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 255
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3586,7 +3586,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x15d},
+0x97,0x97,0x15d,0x97},
 // Transitions for state 256
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3600,7 +3600,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x15e,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 257
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3614,7 +3614,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x163,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 258
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3628,7 +3628,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x164,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 259
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3642,7 +3642,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x165,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 260
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3656,7 +3656,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 261
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3670,7 +3670,7 @@
 0x97,0x97,0x97,0x97,0x169,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 262
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3684,7 +3684,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x16b,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 263
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3698,7 +3698,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x16c,0x97},
+0x97,0x16c,0x97,0x97},
 // Transitions for state 264
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3712,7 +3712,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 265
 {0x8a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3726,7 +3726,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 266
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3740,7 +3740,7 @@
 0x97,0x97,0x16f,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 267
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3754,7 +3754,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x171,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 268
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3768,7 +3768,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x173,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 269
 {0x95,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3782,7 +3782,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 270
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3796,7 +3796,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x176,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 271
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3810,7 +3810,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 272
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3824,7 +3824,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x178,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 273
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3838,7 +3838,7 @@
 0x179,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 274
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3852,7 +3852,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x17a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 275
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3866,7 +3866,7 @@
 0x1bb,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 276
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3880,7 +3880,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x17c,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 277
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3894,7 +3894,7 @@
 0x97,0x97,0x97,0x97,0x17d,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 278
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3908,7 +3908,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 279
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3922,7 +3922,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x17f,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 280
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3936,7 +3936,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x180},
+0x97,0x97,0x180,0x97},
 // Transitions for state 281
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3950,7 +3950,7 @@
 0x97,0x97,0x97,0x97,0x181,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 282
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3964,7 +3964,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x182,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 283
 {0xe,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3978,7 +3978,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 284
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -3992,7 +3992,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 285
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4006,7 +4006,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x184,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 286
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4020,7 +4020,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x185,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 287
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4034,7 +4034,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x186,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 288
 {0x1c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4048,7 +4048,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 289
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4062,7 +4062,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 290
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4076,7 +4076,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x188,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 291
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4090,7 +4090,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x18a,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 292
 {0x27,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4104,7 +4104,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 293
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4118,7 +4118,7 @@
 0x97,0x97,0x97,0x97,0x1c9,0x97,
 0x97,0x97,0x97,0x97,0x18b,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 294
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4132,7 +4132,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x18c,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 295
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4146,7 +4146,7 @@
 0x18d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 296
 {0x2f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4160,7 +4160,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 297
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4174,7 +4174,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x18e,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 298
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4188,7 +4188,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 299
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4202,7 +4202,7 @@
 0x190,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 300
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4216,7 +4216,7 @@
 0x191,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 301
 {0x34,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4230,7 +4230,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 302
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4244,7 +4244,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x192,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 303
 {0x36,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4258,7 +4258,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 304
 {0x37,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4272,7 +4272,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 305
 {0x38,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4286,7 +4286,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 306
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4300,7 +4300,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x193,0x97,0x97,0x97,0x97,0x97,
 0x1cd,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 307
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4314,7 +4314,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x194},
+0x97,0x97,0x194,0x97},
 // Transitions for state 308
 {0x40,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4328,7 +4328,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 309
 {0x41,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4342,7 +4342,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 310
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4356,7 +4356,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x195,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 311
 {0x44,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4370,7 +4370,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 312
 {0x45,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4384,7 +4384,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 313
 {0x46,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4398,7 +4398,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 314
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4412,7 +4412,7 @@
 0x97,0x97,0x196,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 315
 {0x48,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4426,7 +4426,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 316
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4440,7 +4440,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 317
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4454,7 +4454,7 @@
 0x198,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 318
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4468,7 +4468,7 @@
 0x199,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 319
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4482,7 +4482,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 320
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4496,7 +4496,7 @@
 0x19b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 321
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4510,7 +4510,7 @@
 0x97,0x97,0x97,0x97,0x19c,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 322
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4524,7 +4524,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x19d,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 323
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4538,7 +4538,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 324
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4552,7 +4552,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x19f,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 325
 {0x52,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4566,7 +4566,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 326
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4580,7 +4580,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 327
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4594,7 +4594,7 @@
 0x97,0x97,0x97,0x1a1,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 328
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4608,7 +4608,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x1a2,0x97},
+0x97,0x1a2,0x97,0x97},
 // Transitions for state 329
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4622,7 +4622,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x1a3},
+0x97,0x97,0x1a3,0x97},
 // Transitions for state 330
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4636,7 +4636,7 @@
 0x97,0x97,0x97,0x97,0x1a4,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 331
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4650,7 +4650,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1a5,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 332
 {0x5d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4664,7 +4664,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 333
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4678,7 +4678,7 @@
 0x1a6,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x1ae,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 334
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4692,7 +4692,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 335
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4706,7 +4706,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1a8,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 336
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4720,7 +4720,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1a9,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 337
 {0x63,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4734,7 +4734,7 @@
 0x97,0x97,0x1aa,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 338
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4748,7 +4748,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 339
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4762,7 +4762,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 340
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4776,7 +4776,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1ad,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 341
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4790,7 +4790,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1af,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 342
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4804,7 +4804,7 @@
 0x1b0,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 343
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4818,7 +4818,7 @@
 0x1b1,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 344
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4832,7 +4832,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1b2,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 345
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4846,7 +4846,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1b3,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 346
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4860,7 +4860,7 @@
 0x1b4,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 347
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4874,7 +4874,7 @@
 0x97,0x97,0x1b5,0x97,0x1b6,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 348
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4888,7 +4888,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1b7,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 349
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4902,7 +4902,7 @@
 0x97,0x97,0x1b8,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 350
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4916,7 +4916,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x1b9,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 351
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4930,7 +4930,7 @@
 0x97,0x97,0x1ba,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 352
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4944,7 +4944,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 353
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4958,7 +4958,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x1bd,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 354
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4972,7 +4972,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1be,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 355
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -4986,7 +4986,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1bf,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 356
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5000,7 +5000,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1c0,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 357
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5014,7 +5014,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1c1,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 358
 {0x80,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5028,7 +5028,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 359
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5042,7 +5042,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x1c2,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 360
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5056,7 +5056,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1c3,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 361
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5070,7 +5070,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1c4,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 362
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5084,7 +5084,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1c5,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 363
 {0x86,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5098,7 +5098,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 364
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5112,7 +5112,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1c6,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 365
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5126,7 +5126,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x1c7,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 366
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5140,7 +5140,7 @@
 0x97,0x97,0x97,0x97,0x1c8,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 367
 {0x8d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5154,7 +5154,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 368
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5168,7 +5168,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1ca,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 369
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5182,7 +5182,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1cb,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 370
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5196,7 +5196,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1cc,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 371
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5210,7 +5210,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1ce,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 372
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5224,7 +5224,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1cf,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 373
 {0x96,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5238,7 +5238,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 374
 {0x1,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5252,7 +5252,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 375
 {0x2,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5266,7 +5266,7 @@
 0x1da,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 376
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5280,7 +5280,7 @@
 0x1d1,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 377
 {0x4,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5294,7 +5294,7 @@
 0x97,0x213,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 378
 {0x5,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5308,7 +5308,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 379
 {0x6,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5322,7 +5322,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 380
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5336,7 +5336,7 @@
 0x1d2,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 381
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5350,7 +5350,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x1d3,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 382
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5364,7 +5364,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1d4,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 383
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5378,7 +5378,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1d5,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 384
 {0xb,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5392,7 +5392,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 385
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5406,7 +5406,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 386
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5420,7 +5420,7 @@
 0x97,0x97,0x97,0x97,0x1d7,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 387
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5434,7 +5434,7 @@
 0x1d8,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 388
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5448,7 +5448,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1d9,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 389
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5462,7 +5462,7 @@
 0x1db,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 390
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5476,7 +5476,7 @@
 0x1dc,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 391
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5490,7 +5490,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x1dd,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 392
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5504,7 +5504,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1de,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 393
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5518,7 +5518,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 394
 {0x26,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5532,7 +5532,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 395
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5546,7 +5546,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1e0,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 396
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5560,7 +5560,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1e1,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 397
 {0x2d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5574,7 +5574,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 398
 {0x30,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5588,7 +5588,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 399
 {0x31,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5602,7 +5602,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1fd,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 400
 {0x32,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5616,7 +5616,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 401
 {0x33,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5630,7 +5630,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 402
 {0x35,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5644,7 +5644,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 403
 {0x3c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5658,7 +5658,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 404
 {0x3d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5672,7 +5672,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 405
 {0x42,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5686,7 +5686,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 406
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5700,7 +5700,7 @@
 0x1e2,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 407
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5714,7 +5714,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x1e3,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 408
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5728,7 +5728,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 409
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5742,7 +5742,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 410
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5756,7 +5756,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x1e6,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 411
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5770,7 +5770,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1e7,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 412
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5784,7 +5784,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1e8,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 413
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5798,7 +5798,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 414
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5812,7 +5812,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x1ea,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 415
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5826,7 +5826,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 416
 {0x53,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5840,7 +5840,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 417
 {0x54,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5854,7 +5854,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 418
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5868,7 +5868,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1ec,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 419
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5882,7 +5882,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x1ed,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 420
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5896,7 +5896,7 @@
 0x97,0x97,0x1ee,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 421
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5910,7 +5910,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1ef,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 422
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5924,7 +5924,7 @@
 0x97,0x97,0x97,0x97,0x1f0,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 423
 {0x5f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5938,7 +5938,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 424
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5952,7 +5952,7 @@
 0x1f1,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 425
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5966,7 +5966,7 @@
 0x97,0x97,0x97,0x97,0x1f2,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 426
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5980,7 +5980,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1f3,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 427
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -5994,7 +5994,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x1f4},
+0x97,0x97,0x1f4,0x97},
 // Transitions for state 428
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6008,7 +6008,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 429
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6022,7 +6022,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1f6,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 430
 {0x6a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6036,7 +6036,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 431
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6050,7 +6050,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 432
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6064,7 +6064,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1f8,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 433
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6078,7 +6078,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1f9,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 434
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6092,7 +6092,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x1fa,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 435
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6106,7 +6106,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1fb,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 436
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6120,7 +6120,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 437
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6134,7 +6134,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x1fe,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 438
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6148,7 +6148,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x1ff,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 439
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6162,7 +6162,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 440
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6176,7 +6176,7 @@
 0x201,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 441
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6190,7 +6190,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x202,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 442
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6204,7 +6204,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x203,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 443
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6218,7 +6218,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x204,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 444
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6232,7 +6232,7 @@
 0x97,0x97,0x97,0x97,0x205,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 445
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6246,7 +6246,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 446
 {0x7b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6260,7 +6260,7 @@
 0x97,0x97,0x97,0x97,0x207,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 447
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6274,7 +6274,7 @@
 0x208,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 448
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6288,7 +6288,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x209,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 449
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6302,7 +6302,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x20a,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 450
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6316,7 +6316,7 @@
 0x20b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 451
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6330,7 +6330,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 452
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6344,7 +6344,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 453
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6358,7 +6358,7 @@
 0x97,0x97,0x97,0x97,0x20e,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 454
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6372,7 +6372,7 @@
 0x97,0x97,0x97,0x97,0x20f,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 455
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6386,7 +6386,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 456
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6400,7 +6400,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x211,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 457
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6414,7 +6414,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x212,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 458
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6428,7 +6428,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x214,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 459
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6442,7 +6442,7 @@
 0x215,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 460
 {0x90,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6456,7 +6456,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 461
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6470,7 +6470,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x216,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 462
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6484,7 +6484,7 @@
 0x97,0x97,0x97,0x97,0x217,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 463
 {0x93,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6498,7 +6498,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 464
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6512,7 +6512,7 @@
 0x218,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 465
 {0x3,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6526,7 +6526,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 466
 {0x7,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6540,7 +6540,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 467
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6554,7 +6554,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x219,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 468
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6568,7 +6568,7 @@
 0x97,0x97,0x97,0x97,0x21a,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 469
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6582,7 +6582,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 470
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6596,7 +6596,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x21c,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 471
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6610,7 +6610,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x21d,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 472
 {0xf,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6624,7 +6624,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 473
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6638,7 +6638,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x21e,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 474
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6652,7 +6652,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x21f,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 475
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6666,7 +6666,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x220,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 476
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6680,7 +6680,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x221,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 477
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6694,7 +6694,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x222,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 478
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6708,7 +6708,7 @@
 0x223,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 479
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6722,7 +6722,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x224,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 480
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6736,7 +6736,7 @@
 0x97,0x97,0x225,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 481
 {0x2b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6750,7 +6750,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 482
 {0x47,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6764,7 +6764,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 483
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6778,7 +6778,7 @@
 0x226,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 484
 {0x4a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6792,7 +6792,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 485
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6806,7 +6806,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x227,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 486
 {0x4c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6820,7 +6820,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 487
 {0x4d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6834,7 +6834,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 488
 {0x4e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6848,7 +6848,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 489
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6862,7 +6862,7 @@
 0x228,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 490
 {0x50,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6876,7 +6876,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 491
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6890,7 +6890,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x229,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 492
 {0x59,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6904,7 +6904,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 493
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6918,7 +6918,7 @@
 0x97,0x97,0x97,0x22a,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 494
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6932,7 +6932,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x22b,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 495
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6946,7 +6946,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 496
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6960,7 +6960,7 @@
 0x97,0x97,0x22d,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 497
 {0x60,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6974,7 +6974,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 498
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -6988,7 +6988,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x22e,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 499
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7002,7 +7002,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x22f,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 500
 {0x64,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7016,7 +7016,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 501
 {0x65,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7030,7 +7030,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 502
 {0x66,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7044,7 +7044,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 503
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7058,7 +7058,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x230,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 504
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7072,7 +7072,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 505
 {0x6d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7086,7 +7086,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 506
 {0x6e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7100,7 +7100,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 507
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7114,7 +7114,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x232,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 508
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7128,7 +7128,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x233,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 509
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7142,7 +7142,7 @@
 0x97,0x97,0x97,0x97,0x234,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 510
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7156,7 +7156,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x235,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 511
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7170,7 +7170,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x236,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 512
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7184,7 +7184,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x237,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 513
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7198,7 +7198,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x238,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 514
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7212,7 +7212,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x239,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 515
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7226,7 +7226,7 @@
 0x23a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 516
 {0x78,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7240,7 +7240,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 517
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7254,7 +7254,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x23b,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 518
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7268,7 +7268,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x23c,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 519
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7282,7 +7282,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x23d,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 520
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7296,7 +7296,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x23e,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 521
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7310,7 +7310,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x23f},
+0x97,0x97,0x23f,0x97},
 // Transitions for state 522
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7324,7 +7324,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x240,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 523
 {0x81,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7338,7 +7338,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x241,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 524
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7352,7 +7352,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x242,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 525
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7366,7 +7366,7 @@
 0x243,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 526
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7380,7 +7380,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x244,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 527
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7394,7 +7394,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 528
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7408,7 +7408,7 @@
 0x246,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 529
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7422,7 +7422,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x247,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 530
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7436,7 +7436,7 @@
 0x248,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 531
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7450,7 +7450,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x249,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 532
 {0x8e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7464,7 +7464,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 533
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7478,7 +7478,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x24a,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 534
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7492,7 +7492,7 @@
 0x24b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 535
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7506,7 +7506,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 536
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7520,7 +7520,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x24d,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 537
 {0x8,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7534,7 +7534,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 538
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7548,7 +7548,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x24e,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 539
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7562,7 +7562,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x24f,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 540
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7576,7 +7576,7 @@
 0x250,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 541
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7590,7 +7590,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x251,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 542
 {0x16,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7604,7 +7604,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 543
 {0x17,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7618,7 +7618,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 544
 {0x18,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7632,7 +7632,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 545
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7646,7 +7646,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x252,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 546
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7660,7 +7660,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x253,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 547
 {0x24,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7674,7 +7674,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 548
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7688,7 +7688,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x254,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 549
 {0x2a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7702,7 +7702,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 550
 {0x49,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7716,7 +7716,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 551
 {0x4b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7730,7 +7730,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 552
 {0x4f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7744,7 +7744,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 553
 {0x51,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7758,7 +7758,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 554
 {0x5a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7772,7 +7772,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 555
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7786,7 +7786,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x255,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 556
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7800,7 +7800,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x256,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 557
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7814,7 +7814,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x257,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 558
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7828,7 +7828,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x258,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 559
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7842,7 +7842,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x259,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 560
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7856,7 +7856,7 @@
 0x25a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 561
 {0x6c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7870,7 +7870,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 562
 {0x6f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7884,7 +7884,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 563
 {0x70,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7898,7 +7898,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 564
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7912,7 +7912,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x25b,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 565
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7926,7 +7926,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x25c,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 566
 {0x73,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7940,7 +7940,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 567
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7954,7 +7954,7 @@
 0x25d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 568
 {0x75,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7968,7 +7968,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 569
 {0x76,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7982,7 +7982,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 570
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -7996,7 +7996,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x25e,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 571
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8010,7 +8010,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x25f,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 572
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8024,7 +8024,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x260},
+0x97,0x97,0x260,0x97},
 // Transitions for state 573
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8038,7 +8038,7 @@
 0x261,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 574
 {0x7d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8052,7 +8052,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 575
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8066,7 +8066,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x262,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 576
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8080,7 +8080,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 577
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8094,7 +8094,7 @@
 0x264,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 578
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8108,7 +8108,7 @@
 0x265,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 579
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8122,7 +8122,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x266,0x97},
+0x97,0x266,0x97,0x97},
 // Transitions for state 580
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8136,7 +8136,7 @@
 0x97,0x97,0x267,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 581
 {0x87,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8150,7 +8150,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 582
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8164,7 +8164,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 583
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8178,7 +8178,7 @@
 0x269,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 584
 {0x8b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8192,7 +8192,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 585
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8206,7 +8206,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x26a,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 586
 {0x8f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8220,7 +8220,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 587
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8234,7 +8234,7 @@
 0x26b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 588
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8248,7 +8248,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x26c,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 589
 {0x94,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8262,7 +8262,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 590
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8276,7 +8276,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x26d,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 591
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8290,7 +8290,7 @@
 0x26e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 592
 {0xc,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8304,7 +8304,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 593
 {0xd,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8318,7 +8318,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 594
 {0x19,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8332,7 +8332,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 595
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8346,7 +8346,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x26f,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 596
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8360,7 +8360,7 @@
 0x97,0x97,0x97,0x97,0x270,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 597
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8374,7 +8374,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 598
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8388,7 +8388,7 @@
 0x97,0x97,0x97,0x97,0x272,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 599
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8402,7 +8402,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x273,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 600
 {0x61,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8416,7 +8416,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 601
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8430,7 +8430,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x274,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 602
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8444,7 +8444,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x275,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 603
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8458,7 +8458,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x276,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 604
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8472,7 +8472,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x277,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 605
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8486,7 +8486,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 606
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8500,7 +8500,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x279,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 607
 {0x79,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8514,7 +8514,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 608
 {0x7a,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8528,7 +8528,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 609
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8542,7 +8542,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x27a,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 610
 {0x7e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8556,7 +8556,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 611
 {0x7f,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8570,7 +8570,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 612
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8584,7 +8584,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x27b,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 613
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8598,7 +8598,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x27c,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 614
 {0x84,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8612,7 +8612,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 615
 {0x85,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8626,7 +8626,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 616
 {0x88,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8640,7 +8640,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 617
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8654,7 +8654,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x27d,0x97},
+0x97,0x27d,0x97,0x97},
 // Transitions for state 618
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8668,7 +8668,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x27e,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 619
 {0x91,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8682,7 +8682,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 620
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8696,7 +8696,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x27f,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 621
 {0x9,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8710,7 +8710,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 622
 {0xa,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8724,7 +8724,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 623
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8738,7 +8738,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x280,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 624
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8752,7 +8752,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x281,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 625
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8766,7 +8766,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x282,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 626
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8780,7 +8780,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x283,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 627
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8794,7 +8794,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 628
 {0x62,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8808,7 +8808,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 629
 {0x6b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8822,7 +8822,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 630
 {0x71,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8836,7 +8836,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 631
 {0x72,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8850,7 +8850,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 632
 {0x74,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8864,7 +8864,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 633
 {0x77,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8878,7 +8878,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 634
 {0x7c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8892,7 +8892,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 635
 {0x82,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8906,7 +8906,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 636
 {0x83,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8920,7 +8920,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 637
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8934,7 +8934,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x285,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 638
 {0x8c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8948,7 +8948,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 639
 {0x92,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8962,7 +8962,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 640
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8976,7 +8976,7 @@
 0x286,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 641
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -8990,7 +8990,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x287,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 642
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9004,7 +9004,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x288,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 643
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9018,7 +9018,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x289,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 644
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9032,7 +9032,7 @@
 0x97,0x97,0x97,0x97,0x97,0x28a,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 645
 {0x89,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9046,7 +9046,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 646
 {0x1d,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9060,7 +9060,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 647
 {0x25,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9074,7 +9074,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 648
 {0x5b,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9088,7 +9088,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 649
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9102,7 +9102,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 650
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9116,7 +9116,7 @@
 0x28c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 651
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9130,7 +9130,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x28d,0x97},
+0x97,0x28d,0x97,0x97},
 // Transitions for state 652
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9144,7 +9144,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 653
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9158,7 +9158,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x28f,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 654
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9172,7 +9172,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x290,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 655
 {0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9186,7 +9186,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x291,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 656
 {0x5e,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9200,7 +9200,7 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97},
+0x97,0x97,0x97,0x97},
 // Transitions for state 657
 {0x5c,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
@@ -9214,4 +9214,4 @@
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
 0x97,0x97,0x97,0x97,0x97,0x97,
-0x97,0x97,0x97}
+0x97,0x97,0x97,0x97}
@@ -0,0 +1,362 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ *
+ * This file implements the tape API: the parser's events are recorded by a set of
+ * internal event handlers, that append a record to the tape for every event.
+ */
+
+#include "../include/haut/tape.h"
+#include "haut_state.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define TAPE_INITIAL_CAPACITY 256
+#define TAPE_INITIAL_STRINGS 1024
+
+/* The userdata of the parser while it records to a tape */
+typedef struct {
+    haut_tape_t* tape;
+    const char* input;
+    size_t length;
+} recorder_t;
+
+static void*
+heap_allocate( void* userdata, size_t size ) {
+    return malloc( size );
+}
+
+static void
+heap_deallocate( void* userdata, void* ptr ) {
+    free( ptr );
+}
+
+/** Make room for at least @needed elements of @elem_size bytes in the buffer @data of @t,
+ *  which has @capacity elements and @used of them in use. Returns false if @t is fixed or out of memory */
+static bool
+reserve( haut_tape_t* t, void** data, size_t* capacity, size_t used, size_t needed, size_t elem_size, size_t initial ) {
+    if( needed <= *capacity )
+        return true;
+    if( t->fixed )
+        return false;
+    size_t n =*capacity ? *capacity * 2 : initial;
+    while( n < needed )
+        n *=2;
+    void* d =t->allocator.allocate( t->allocator.userdata, n * elem_size );
+    if( !d )
+        return false;
+    if( *data ) {
+        memcpy( d, *data, used * elem_size );
+        t->allocator.deallocate( t->allocator.userdata, *data );
+    }
+    *data =d;
+    *capacity =n;
+    return true;
+}
+
+/** Mark the tape of @p as truncated and stop parsing */
+static void
+overflow( haut_t* p ) {
+    recorder_t* r =(recorder_t*)p->userdata;
+    r->tape->truncated =true;
+    haut_stop( p );
+}
+
+/** Append @n records to the tape of @p and return the first, or NULL if there is no space left */
+static haut_tape_record_t*
+new_records( haut_t* p, size_t n ) {
+    haut_tape_t* t =((recorder_t*)p->userdata)->tape;
+    if( !reserve( t, (void**)&t->records, &t->capacity, t->count, t->count + n,
+                  sizeof( haut_tape_record_t ), TAPE_INITIAL_CAPACITY ) ) {
+        overflow( p );
+        return NULL;
+    }
+    haut_tape_record_t* rec =&t->records[t->count];
+    t->count +=n;
+    return rec;
+}
+
+/** Fill in @rec with @kind and @id, and let it refer to the characters of @f:
+ *  in the input if they are there, otherwise in a copy in the string area.
+ *  Returns false if there is no space left for the copy */
+static bool
+set_record( haut_t* p, haut_tape_record_t* rec, int kind, int id, const strfragment_t* f ) {
+    recorder_t* r =(recorder_t*)p->userdata;
+    haut_tape_t* t =r->tape;
+    rec->kind =kind;
+    rec->flags =0;
+    rec->id =id;
+    rec->length =f->size;
+    if( f->data >= r->input && f->data + f->size <= r->input + r->length ) {
+        rec->offset =f->data - r->input;
+        return true;
+    }
+    // Offsets into the string area are 32-bit as well
+    if( t->strings_size + f->size > UINT32_MAX
+            || !reserve( t, (void**)&t->strings, &t->strings_capacity, t->strings_size, t->strings_size + f->size,
+                  1, TAPE_INITIAL_STRINGS ) ) {
+        overflow( p );
+        return false;
+    }
+    memcpy( t->strings + t->strings_size, f->data, f->size );
+    rec->flags =TAPE_STRING;
+    rec->offset =t->strings_size;
+    t->strings_size +=f->size;
+    return true;
+}
+
+/** Append a record without characters, at the current position of @p */
+static void
+record_position( haut_t* p, int kind, int id ) {
+    haut_tape_record_t* rec =new_records( p, 1 );
+    if( !rec )
+        return;
+    rec->kind =kind;
+    rec->flags =0;
+    rec->id =id;
+    rec->offset =p->position.offset;
+    rec->length =0;
+}
+
+/** Append a record for the token @f */
+static void
+record_token( haut_t* p, int kind, int id, const strfragment_t* f ) {
+    haut_tape_record_t* rec =new_records( p, 1 );
+    if( rec && !set_record( p, rec, kind, id, f ) )
+        // The record can not be completed and is removed again
+        ((recorder_t*)p->userdata)->tape->count--;
+}
+
+/* Recording event handlers */
+
+static void
+record_document_begin( haut_t* p ) {
+    record_position( p, TAPE_DOCUMENT_BEGIN, 0 );
+}
+
+static void
+record_document_end( haut_t* p ) {
+    record_position( p, TAPE_DOCUMENT_END, 0 );
+}
+
+static void
+record_element_open( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    record_token( p, TAPE_ELEMENT_OPEN, tag, name );
+}
+
+static void
+record_element_close( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    record_token( p, TAPE_ELEMENT_CLOSE, tag, name );
+}
+
+static void
+record_attribute_id( haut_t* p, haut_attr_t attr, strfragment_t* key, strfragment_t* value ) {
+    // The attribute and its value are appended at once, so that a full tape does not split them
+    size_t n =value ? 2 : 1;
+    haut_tape_record_t* rec =new_records( p, n );
+    if( !rec )
+        return;
+    if( !set_record( p, rec, TAPE_ATTRIBUTE, attr, key ) 
+            || (value && !set_record( p, rec + 1, TAPE_VALUE, 0, value )) ) {
+        ((recorder_t*)p->userdata)->tape->count -=n;
+        return;
+    }
+    if( !value )
+        rec->flags |=TAPE_VOID;
+}
+
+static void
+record_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    // Recorded by record_attribute_id()
+}
+
+static void
+record_comment( haut_t* p, strfragment_t* text ) {
+    record_token( p, TAPE_COMMENT, 0, text );
+}
+
+static void
+record_innertext( haut_t* p, strfragment_t* text ) {
+    record_token( p, TAPE_INNERTEXT, 0, text );
+}
+
+static void
+record_cdata( haut_t* p, strfragment_t* text ) {
+    record_token( p, TAPE_CDATA, 0, text );
+}
+
+static void
+record_doctype( haut_t* p, strfragment_t* text ) {
+    record_token( p, TAPE_DOCTYPE, 0, text );
+}
+
+static void
+record_script( haut_t* p, strfragment_t* text ) {
+    record_token( p, TAPE_SCRIPT, 0, text );
+}
+
+static void
+record_error( haut_t* p, haut_error_t err ) {
+    record_position( p, TAPE_ERROR, err );
+}
+
+static const haut_event_handler_t TAPE_EVENT_HANDLER = {
+    .document_begin=record_document_begin,
+    .document_end  =record_document_end,
+    .element_open  =record_element_open,
+    .element_close =record_element_close,
+    .attribute     =record_attribute,
+    .comment       =record_comment,
+    .innertext     =record_innertext,
+    .doctype       =record_doctype,
+    .script        =record_script,
+    .cdata         =record_cdata,
+    .error         =record_error,
+    .attribute_id  =record_attribute_id,
+};
+
+/* */
+
+void
+haut_tapeInit( haut_tape_t* t, const strallocator_t* allocator ) {
+    memset( t, 0, sizeof( haut_tape_t ) );
+    if( allocator )
+        t->allocator =*allocator;
+    else {
+        t->allocator.allocate =heap_allocate;
+        t->allocator.deallocate =heap_deallocate;
+    }
+}
+
+void
+haut_tapeInitFixed( haut_tape_t* t, haut_tape_record_t* records, size_t capacity, char* strings, size_t strings_capacity ) {
+    memset( t, 0, sizeof( haut_tape_t ) );
+    t->records =records;
+    t->capacity =capacity;
+    t->strings =strings;
+    t->strings_capacity =strings_capacity;
+    t->fixed =true;
+}
+
+void
+haut_tapeFree( haut_tape_t* t ) {
+    if( !t->fixed ) {
+        if( t->records )
+            t->allocator.deallocate( t->allocator.userdata, t->records );
+        if( t->strings )
+            t->allocator.deallocate( t->allocator.userdata, t->strings );
+    }
+    t->records =NULL;
+    t->strings =NULL;
+    t->count =t->capacity =0;
+    t->strings_size =t->strings_capacity =0;
+}
+
+void
+haut_tapeClear( haut_tape_t* t ) {
+    t->count =0;
+    t->strings_size =0;
+    t->truncated =false;
+}
+
+bool
+haut_parseToTape( haut_t* p, const char* buffer, size_t len, haut_tape_t* t ) {
+    // The offsets of the records can not refer beyond 4 GiB
+    if( len > UINT32_MAX ) {
+        t->truncated =true;
+        return false;
+    }
+    recorder_t r ={ t, buffer, len };
+    haut_event_handler_t events =p->events;
+    void* userdata =p->userdata;
+
+    p->events =TAPE_EVENT_HANDLER;
+    p->userdata =&r;
+    haut_setInput( p, buffer, len );
+    haut_parse( p );
+    p->events =events;
+    p->userdata =userdata;
+    return !t->truncated;
+}
+
+/** Returns the event in haut_event_mask_t of records of @kind, or 0 if they are always replayed */
+static int
+kind_event( int kind ) {
+    switch( kind ) {
+        case TAPE_ATTRIBUTE:    return EVENT_ATTRIBUTE;
+        case TAPE_COMMENT:      return EVENT_COMMENT;
+        case TAPE_INNERTEXT:    return EVENT_INNERTEXT;
+        case TAPE_CDATA:        return EVENT_CDATA;
+        case TAPE_DOCTYPE:      return EVENT_DOCTYPE;
+        case TAPE_SCRIPT:       return EVENT_SCRIPT;
+        default:                return 0;
+    }
+}
+
+void
+haut_tapeReplay( const haut_tape_t* t, const char* input, haut_t* p ) {
+    // As the parser does, only emit the events in the event mask of @p
+    int mask =haut_event_mask( p );
+    for( size_t i =0; i < t->count && p->state->halt != HALT_STOP; i++ ) {
+        const haut_tape_record_t* r =&t->records[i];
+        strfragment_t f =haut_tapeString( t, input, r );
+
+        if( kind_event( r->kind ) & ~mask ) {
+            // The value of an attribute is skipped along with it
+            if( r->kind == TAPE_ATTRIBUTE && !(r->flags & TAPE_VOID) )
+                i++;
+            continue;
+        }
+
+        switch( r->kind ) {
+            case TAPE_DOCUMENT_BEGIN:
+                p->events.document_begin( p );
+                break;
+            case TAPE_DOCUMENT_END:
+                p->events.document_end( p );
+                break;
+            case TAPE_ELEMENT_OPEN:
+                p->state->last_tag =r->id;
+                p->events.element_open( p, r->id, &f );
+                break;
+            case TAPE_ELEMENT_CLOSE:
+                p->state->last_tag =r->id;
+                p->events.element_close( p, r->id, &f );
+                break;
+            case TAPE_ATTRIBUTE:
+                if( r->flags & TAPE_VOID )
+                    haut_emit_attribute( p, &f, NULL );
+                else {
+                    strfragment_t v =haut_tapeString( t, input, &t->records[++i] );
+                    haut_emit_attribute( p, &f, &v );
+                }
+                break;
+            case TAPE_COMMENT:
+                p->events.comment( p, &f );
+                break;
+            case TAPE_INNERTEXT:
+                p->events.innertext( p, &f );
+                break;
+            case TAPE_CDATA:
+                p->events.cdata( p, &f );
+                break;
+            case TAPE_DOCTYPE:
+                p->events.doctype( p, &f );
+                break;
+            case TAPE_SCRIPT:
+                p->events.script( p, &f );
+                break;
+            case TAPE_ERROR:
+                p->state->last_error =r->id;
+                if( p->events.error != NULL )
+                    p->events.error( p, r->id );
+                break;
+        }
+    }
+}
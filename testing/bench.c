@@ -0,0 +1,496 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * This file is part of the Haut test-suite.
+ * The purpose of this benchmark is to measure the throughput of the parser
+ *  in MB/s. The input is either a list of HTML-files given on the commandline,
+ *  or a synthetic corpus that mimics the composition of crawled pages
+ *  (markup, attributes, inline scripts, comments, entities and text).
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2019
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <haut/haut.h>
+#include <haut/batch.h>
+#include <haut/query.h>
+#include <haut/dom.h>
+#include <haut/serial.h>
+#include "../src/haut_state.h"
+
+/* Usage:
+ * bench [-n iterations] [-s size in MB] [-c chunk size] [-t threads] [-b threads] [-i streams] [-l] [-w] [-a] [-k element] [-q selectors] [-d] [-r] [-e] [html-file ...]
+ * -t parses the input with haut_parseParallel() instead of haut_parse()
+ * -b splits the input in documents at every <!DOCTYPE and parses them with haut_parseBatch()
+ * -i splits the input likewise and parses them with haut_parseInterleaved() in a single thread
+ * -l enables FLAG_LAZY_POSITION
+ * -w enables FLAG_ACCUMULATE_INNERTEXT, so a run of text is a single event instead of one per word
+ * -a only counts attributes, like a link extractor would; the event mask skips all other tokens
+ * -k skips the content of all elements with the given name using haut_skipElement()
+ * -q counts the elements that match the CSS selectors with the query API instead
+ * -d builds a DOM with haut_parseToDom() instead, and counts its nodes
+ * -r stores the events with haut_parseToSerial() first, and times replaying them with haut_serialReplay()
+ * -e makes the synthetic corpus entity-dense
+ */
+
+#define DEFAULT_ITERATIONS 10
+#define DEFAULT_CORPUS_SIZE 8
+
+typedef struct {
+    char* data;
+    size_t size;
+    size_t capacity;
+} corpus_t;
+
+typedef struct {
+    size_t events;
+    size_t bytes;
+} counters_t;
+
+static void
+corpus_append( corpus_t* c, const char* str ) {
+    size_t len =strlen( str );
+    if( c->size + len > c->capacity ) {
+        c->capacity =(c->size + len) * 2;
+        c->data =realloc( c->data, c->capacity );
+    }
+    memcpy( c->data + c->size, str, len );
+    c->size +=len;
+}
+
+/* Small deterministic pseudo random generator, so every run uses the same corpus */
+static unsigned int
+next_rand( unsigned int* seed ) {
+    *seed =*seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+static const char* WORDS[] = {
+    "the", "parser", "of", "tokens", "and", "a", "finite", "state", "machine", "is",
+    "fast", "crawler", "pages", "with", "text", "in", "many", "languages", "to", "data",
+    "café", "naïve", "Leiden", "University", "streaming", "for", "example,", "links.",
+    NULL
+};
+
+static const char* ENTITIES[] = {
+    "&amp;", "&nbsp;", "&lt;", "&gt;", "&quot;", "&eacute;", "&copy;", NULL
+};
+
+/* If set, every other word of the synthetic corpus is an entity */
+static int entity_dense =0;
+
+static const char*
+pick( const char** list, unsigned int* seed ) {
+    int n =0;
+    while( list[n] ) n++;
+    return list[next_rand( seed ) % n];
+}
+
+static void
+generate_paragraph( corpus_t* c, unsigned int* seed ) {
+    char buf[256];
+    int words =10 + next_rand( seed ) % 60;
+    corpus_append( c, "<p class=\"text\">" );
+    for( int i =0; i < words; i++ ) {
+        int r =next_rand( seed ) % 40;
+        if( r == 0 ) {
+            snprintf( buf, sizeof(buf), "<a href=\"/article/%u?ref=home&amp;page=%u\" title='Read more'>%s</a> ",
+                    next_rand( seed ), next_rand( seed ) % 100, pick( WORDS, seed ) );
+            corpus_append( c, buf );
+        } else if( r == 1 || (entity_dense && r % 2) ) {
+            corpus_append( c, pick( ENTITIES, seed ) );
+            corpus_append( c, " " );
+        } else if( r == 2 ) {
+            corpus_append( c, "<strong>" );
+            corpus_append( c, pick( WORDS, seed ) );
+            corpus_append( c, "</strong> " );
+        } else {
+            corpus_append( c, pick( WORDS, seed ) );
+            corpus_append( c, (r % 11) ? " " : "\n" );
+        }
+    }
+    corpus_append( c, "</p>\n" );
+}
+
+/* Generates a single page of a few kilobytes */
+static void
+generate_page( corpus_t* c, unsigned int* seed ) {
+    char buf[256];
+    corpus_append( c, "<!DOCTYPE html>\n<html lang=en>\n<head>\n<meta charset=\"utf-8\">\n" );
+    corpus_append( c, "<title>Benchmark page</title>\n" );
+    corpus_append( c, "<link rel=\"stylesheet\" href=\"/static/style.css?v=3\">\n" );
+    corpus_append( c, "<script type=\"text/javascript\">\n"
+                      "// Analytics snippet\n"
+                      "var _q = _q || []; _q.push(['setAccount', 'UA-000000-1']);\n"
+                      "function load(url) { var s = document.createElement('script'); /* async */\n"
+                      "  s.src = \"https://cdn.example.com/\" + url; if (a < b) { s.async = true; }\n"
+                      "  document.head.appendChild(s); }\n"
+                      "</script>\n</head>\n" );
+    corpus_append( c, "<body class=\"home page\" id=main>\n<!-- Navigation -->\n<nav><ul>\n" );
+    int items =3 + next_rand( seed ) % 8;
+    for( int i =0; i < items; i++ ) {
+        snprintf( buf, sizeof(buf), "<li class=\"menu-item\"><a href=\"/section/%u\" data-id=%u>%s</a></li>\n",
+                next_rand( seed ), i, pick( WORDS, seed ) );
+        corpus_append( c, buf );
+    }
+    corpus_append( c, "</ul></nav>\n<div class=\"content\">\n" );
+    int paragraphs =2 + next_rand( seed ) % 10;
+    for( int i =0; i < paragraphs; i++ ) {
+        if( next_rand( seed ) % 4 == 0 ) {
+            snprintf( buf, sizeof(buf), "<img src=\"/img/%u.jpg\" alt=\"Image %u\" width=640 height=480/>\n",
+                    next_rand( seed ), i );
+            corpus_append( c, buf );
+        }
+        generate_paragraph( c, seed );
+    }
+    corpus_append( c, "</div>\n<footer><p>&copy; 2018 Example &mdash; All rights reserved</p></footer>\n" );
+    corpus_append( c, "</body>\n</html>\n" );
+}
+
+static void
+generate_corpus( corpus_t* c, size_t size ) {
+    unsigned int seed =42;
+    while( c->size < size )
+        generate_page( c, &seed );
+}
+
+static int
+read_file( corpus_t* c, const char* filename ) {
+    FILE* file =fopen( filename, "rb" );
+    if( !file ) {
+        fprintf( stderr, "ERROR: Could not open `%s'\n", filename );
+        return -1;
+    }
+    char buf[4096];
+    size_t len;
+    while( (len =fread( buf, 1, sizeof(buf)-1, file )) > 0 ) {
+        buf[len] =0;
+        if( c->size + len > c->capacity ) {
+            c->capacity =(c->size + len) * 2;
+            c->data =realloc( c->data, c->capacity );
+        }
+        memcpy( c->data + c->size, buf, len );
+        c->size +=len;
+    }
+    fclose( file );
+    return 0;
+}
+
+/* Counting event handlers; a realistic consumer always does at least this much */
+
+static void
+count_element( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    counters_t* c =(counters_t*)p->userdata;
+    c->events++; c->bytes +=name->size;
+}
+
+/* If set, the name of the elements whose content is skipped */
+static const char* skip_element =NULL;
+
+static void
+count_open( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    count_element( p, tag, name );
+    if( skip_element && strlen( skip_element ) == name->size && memcmp( skip_element, name->data, name->size ) == 0 )
+        haut_skipElement( p );
+}
+
+static void
+count_attribute( haut_t* p, strfragment_t* key, strfragment_t* value ) {
+    counters_t* c =(counters_t*)p->userdata;
+    c->events++; c->bytes +=key->size + (value ? value->size : 0);
+}
+
+static void
+count_text( haut_t* p, strfragment_t* text ) {
+    counters_t* c =(counters_t*)p->userdata;
+    c->events++; c->bytes +=text->size;
+}
+
+/* If set, only the attribute handler is installed */
+static int attributes_only =0;
+
+/* If set, a DOM is built instead of counting the events */
+static int build_dom =0;
+
+/* If set, the events are replayed from a binary stream instead of parsed */
+static int replay_serial =0;
+
+/* If set, the selectors that are matched instead of counting the events */
+static const char* query_selectors =NULL;
+
+static void
+count_match( haut_query_t* q, const haut_match_t* match, void* userdata ) {
+    counters_t* c =(counters_t*)userdata;
+    c->events++; c->bytes +=match->text.size;
+}
+
+static haut_event_handler_t
+counting_handler() {
+    haut_event_handler_t e =DEFAULT_EVENT_HANDLER;
+    e.attribute =count_attribute;
+    if( attributes_only )
+        return e;
+    e.element_open =count_open;
+    e.element_close =count_element;
+    e.innertext =count_text;
+    e.comment =count_text;
+    e.script =count_text;
+    e.doctype =count_text;
+    e.cdata =count_text;
+    return e;
+}
+
+static double
+now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void
+run_benchmark( const char* name, corpus_t* corpus, int iterations, size_t chunk_size, int threads, int flags ) {
+    counters_t counters;
+    double best =0.0;
+    size_t allocations =0;
+
+    for( int i =0; i < iterations; i++ ) {
+        haut_t p;
+        haut_init( &p );
+        if( flags )
+            haut_enable( &p, flags );
+        memset( &counters, 0, sizeof( counters_t ) );
+        p.userdata =&counters;
+        p.events =counting_handler();
+        haut_query_t* q =NULL;
+        if( query_selectors ) {
+            p.events =DEFAULT_EVENT_HANDLER;
+            q =haut_queryCompile( query_selectors, count_match, &counters );
+            haut_queryAttach( q, &p );
+        }
+        haut_dom_t dom;
+        haut_domInit( &dom, NULL );
+        strbuffer_t stream;
+        strbuffer_init( &stream );
+        if( replay_serial ) {
+            // The stream is written by another parser, so that p is only used for the replay
+            haut_t w;
+            haut_init( &w );
+            if( flags )
+                haut_enable( &w, flags );
+            haut_parseToSerial( &w, corpus->data, corpus->size, &stream );
+            haut_destroy( &w );
+        }
+
+        double begin =now();
+        if( replay_serial ) {
+            haut_serialReplay( stream.data, stream.size, &p );
+        } else if( build_dom ) {
+            haut_parseToDom( &p, corpus->data, corpus->size, &dom );
+            counters.events =dom.count;
+        } else if( chunk_size ) {
+            for( size_t offs =0; offs < corpus->size; offs +=chunk_size ) {
+                size_t len =corpus->size - offs;
+                haut_parseChunk( &p, corpus->data + offs, len < chunk_size ? len : chunk_size );
+            }
+        } else if( threads ) {
+            haut_parseParallel( &p, corpus->data, corpus->size, threads );
+        } else {
+            haut_setInput( &p, corpus->data, corpus->size );
+            haut_parse( &p );
+        }
+        if( q )
+            haut_queryFinish( q );
+        double elapsed =now() - begin;
+        allocations =haut_allocations( &p );
+        haut_destroy( &p );
+        if( q )
+            haut_queryFree( q );
+        haut_domFree( &dom );
+        strbuffer_free( &stream );
+
+        double mbs =(corpus->size / (1024.0 * 1024.0)) / elapsed;
+        if( mbs > best ) best =mbs;
+    }
+
+    printf( "%-24s %10zu bytes %10zu events %10.1f MB/s (%zu allocations)\n",
+            name, corpus->size, counters.events, best, allocations );
+}
+
+/* Splits the corpus in documents at every <!DOCTYPE. Returns the number of documents in @docs */
+static size_t
+split_documents( corpus_t* corpus, haut_document_t** docs ) {
+    size_t count =0, capacity =0;
+    const char* doc =corpus->data;
+    const char* end =corpus->data + corpus->size;
+    *docs =NULL;
+    while( doc < end ) {
+        const char* next =doc + 1;
+        while( next < end && !(*next == '<' && end - next >= 9 && memcmp( next, "<!DOCTYPE", 9 ) == 0) )
+            next++;
+        if( count == capacity ) {
+            capacity =capacity ? capacity * 2 : 64;
+            *docs =realloc( *docs, capacity * sizeof( haut_document_t ) );
+        }
+        (*docs)[count].buffer =doc;
+        (*docs)[count].length =next - doc;
+        count++;
+        doc =next;
+    }
+    return count;
+}
+
+/* Every document has its own counters, so the handlers need no synchronization */
+static void
+run_batch_benchmark( const char* name, corpus_t* corpus, int iterations, int threads, int flags ) {
+    haut_document_t* docs;
+    size_t count =split_documents( corpus, &docs );
+    counters_t* counters =malloc( count * sizeof( counters_t ) );
+    for( size_t i =0; i < count; i++ )
+        docs[i].userdata =&counters[i];
+
+    haut_event_handler_t events =counting_handler();
+    haut_opts_t opts =DEFAULT_PARSER_OPTS;
+    opts.flags =flags;
+    haut_batch_stats_t stats, best;
+    memset( &best, 0, sizeof( haut_batch_stats_t ) );
+
+    for( int i =0; i < iterations; i++ ) {
+        memset( counters, 0, count * sizeof( counters_t ) );
+        haut_parseBatch( docs, count, &events, opts, threads, &stats );
+        if( stats.throughput > best.throughput ) best =stats;
+    }
+
+    size_t events_total =0;
+    for( size_t i =0; i < count; i++ )
+        events_total +=counters[i].events;
+    printf( "%-24s %10zu bytes %10zu events %10.1f MB/s (%zu documents, %d threads, %zu steals)\n",
+            name, corpus->size, events_total, best.throughput, best.documents, best.threads, best.steals );
+    free( counters );
+    free( docs );
+}
+
+/* Parses the documents of the corpus in a single thread, @streams at a time */
+static void
+run_interleaved_benchmark( const char* name, corpus_t* corpus, int iterations, int streams, int flags ) {
+    haut_document_t* docs;
+    size_t count =split_documents( corpus, &docs );
+    haut_t* parsers =malloc( count * sizeof( haut_t ) );
+    haut_t** list =malloc( count * sizeof( haut_t* ) );
+    counters_t counters;
+    double best =0.0;
+
+    for( int i =0; i < iterations; i++ ) {
+        memset( &counters, 0, sizeof( counters_t ) );
+        for( size_t j =0; j < count; j++ ) {
+            haut_init( &parsers[j] );
+            if( flags )
+                haut_enable( &parsers[j], flags );
+            parsers[j].userdata =&counters;
+            parsers[j].events =counting_handler();
+            haut_setInput( &parsers[j], docs[j].buffer, docs[j].length );
+            list[j] =&parsers[j];
+        }
+
+        double begin =now();
+        haut_parseInterleaved( list, count, streams );
+        double elapsed =now() - begin;
+        for( size_t j =0; j < count; j++ )
+            haut_destroy( &parsers[j] );
+
+        double mbs =(corpus->size / (1024.0 * 1024.0)) / elapsed;
+        if( mbs > best ) best =mbs;
+    }
+
+    printf( "%-24s %10zu bytes %10zu events %10.1f MB/s (%zu documents, %d streams)\n",
+            name, corpus->size, counters.events, best, count, streams );
+    free( list );
+    free( parsers );
+    free( docs );
+}
+
+static void
+run( const char* name, corpus_t* corpus, int iterations, size_t chunk_size, int threads, int batch_threads, int streams, int flags ) {
+    if( batch_threads )
+        run_batch_benchmark( name, corpus, iterations, batch_threads, flags );
+    else if( streams )
+        run_interleaved_benchmark( name, corpus, iterations, streams, flags );
+    else
+        run_benchmark( name, corpus, iterations, chunk_size, threads, flags );
+}
+
+int
+main( int argc, char** argv ) {
+    int iterations =DEFAULT_ITERATIONS;
+    size_t corpus_size =DEFAULT_CORPUS_SIZE;
+    size_t chunk_size =0;
+    int threads =0;
+    int batch_threads =0;
+    int streams =0;
+    int flags =FLAG_NONE;
+    int files =0;
+
+    for( int i =1; i < argc; i++ ) {
+        if( strcmp( argv[i], "-n" ) == 0 && i+1 < argc )
+            iterations =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-s" ) == 0 && i+1 < argc )
+            corpus_size =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-c" ) == 0 && i+1 < argc )
+            chunk_size =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-t" ) == 0 && i+1 < argc )
+            threads =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-b" ) == 0 && i+1 < argc )
+            batch_threads =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-i" ) == 0 && i+1 < argc )
+            streams =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-l" ) == 0 )
+            flags |=FLAG_LAZY_POSITION;
+        else if( strcmp( argv[i], "-w" ) == 0 )
+            flags |=FLAG_ACCUMULATE_INNERTEXT;
+        else if( strcmp( argv[i], "-a" ) == 0 )
+            attributes_only =1;
+        else if( strcmp( argv[i], "-d" ) == 0 )
+            build_dom =1;
+        else if( strcmp( argv[i], "-r" ) == 0 )
+            replay_serial =1;
+        else if( strcmp( argv[i], "-e" ) == 0 )
+            entity_dense =1;
+        else if( strcmp( argv[i], "-k" ) == 0 && i+1 < argc )
+            skip_element =argv[++i];
+        else if( strcmp( argv[i], "-q" ) == 0 && i+1 < argc ) {
+            query_selectors =argv[++i];
+            haut_query_t* q =haut_queryCompile( query_selectors, count_match, NULL );
+            if( !q ) {
+                fprintf( stderr, "ERROR: Invalid selector `%s'\n", query_selectors );
+                return 1;
+            }
+            haut_queryFree( q );
+        }
+        else {
+            corpus_t corpus;
+            memset( &corpus, 0, sizeof( corpus_t ) );
+            if( read_file( &corpus, argv[i] ) == 0 )
+                run( argv[i], &corpus, iterations, chunk_size, threads, batch_threads, streams, flags );
+            free( corpus.data );
+            files++;
+        }
+    }
+
+    if( !files ) {
+        /* No input files given, use the synthetic corpus instead */
+        corpus_t corpus;
+        memset( &corpus, 0, sizeof( corpus_t ) );
+        generate_corpus( &corpus, corpus_size * 1024 * 1024 );
+        run( entity_dense ? "synthetic (entities)" : "synthetic", &corpus, iterations, chunk_size, threads, batch_threads, streams, flags );
+        free( corpus.data );
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * Haut - a lightweight html tokenizer
+ *
+ * https://github.com/mickymuis/haut-html
+ *
+ * Micky Faas <micky@edukitty.org>
+ * Copyright 2017-2018
+ * Leiden Institute of Advanced Computer Science, The Netherlands
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <haut/haut.h>
+#include <haut/state_machine.h>
+#include <haut/tag.h>
+
+/* Usage:
+ * bench_tags [-n iterations] [html-file ...]
+ * Times decode_tag() on a stream of element names. Without files, the names are drawn from
+ * the frequencies below, otherwise they are those of the start and end tags in the files.
+ * Build with -DHAUT_TAG_HASH=0 or 1 to compare the tag FSM and the perfect hash.
+ */
+
+/* The default of state_machine.c */
+#ifndef HAUT_TAG_HASH
+#define HAUT_TAG_HASH 0
+#endif
+
+#define DEFAULT_ITERATIONS 10
+#define STREAM_LENGTH (1 << 20)
+
+/* Approximate number of occurrences per 1000 elements on crawled pages, after the element
+ * counts of the HTTP Archive. Names that are not HTML5 elements (such as those of SVG)
+ * are decoded as TAG_UNKNOWN, a few names appear in upper case */
+static const struct {
+    const char* name;
+    int weight;
+} FREQUENCIES[] = {
+    { "div", 260 }, { "a", 140 }, { "span", 110 }, { "li", 70 }, { "img", 35 },
+    { "path", 30 }, { "p", 30 }, { "script", 25 }, { "i", 20 }, { "meta", 18 },
+    { "link", 15 }, { "ul", 15 }, { "option", 15 }, { "td", 14 }, { "br", 13 },
+    { "svg", 12 }, { "tr", 8 }, { "input", 8 }, { "button", 8 }, { "h3", 7 },
+    { "h2", 7 }, { "strong", 7 }, { "source", 6 }, { "g", 6 }, { "style", 5 },
+    { "label", 5 }, { "b", 5 }, { "use", 4 }, { "picture", 3 }, { "h4", 3 },
+    { "section", 3 }, { "noscript", 3 }, { "nav", 2 }, { "form", 2 }, { "small", 2 },
+    { "em", 2 }, { "iframe", 2 }, { "th", 2 }, { "header", 1 }, { "footer", 1 },
+    { "h1", 1 }, { "article", 1 }, { "figure", 1 }, { "select", 1 }, { "table", 1 },
+    { "tbody", 1 }, { "title", 1 }, { "html", 1 }, { "head", 1 }, { "body", 1 },
+    { "DIV", 2 }, { "TD", 1 }, { "FONT", 1 }, { "textarea", 1 }, { "blockquote", 1 },
+};
+
+#define N_FREQUENCIES (sizeof( FREQUENCIES ) / sizeof( FREQUENCIES[0] ))
+
+typedef struct {
+    strfragment_t* names;
+    size_t count;
+    size_t capacity;
+} stream_t;
+
+static void
+stream_append( stream_t* s, const char* data, size_t size ) {
+    if( s->count == s->capacity ) {
+        s->capacity =s->capacity ? s->capacity * 2 : 1024;
+        s->names =realloc( s->names, s->capacity * sizeof( strfragment_t ) );
+    }
+    s->names[s->count].data =data;
+    s->names[s->count].size =size;
+    s->count++;
+}
+
+/* Fills the stream with names drawn from FREQUENCIES, with a fixed seed */
+static void
+stream_generate( stream_t* s ) {
+    int total =0;
+    for( size_t i =0; i < N_FREQUENCIES; i++ )
+        total +=FREQUENCIES[i].weight;
+    uint32_t seed =12345;
+    while( s->count < STREAM_LENGTH ) {
+        seed =seed * 1103515245 + 12345;
+        int r =(seed >> 8) % total;
+        size_t i =0;
+        for( ; r >= FREQUENCIES[i].weight; i++ )
+            r -=FREQUENCIES[i].weight;
+        stream_append( s, FREQUENCIES[i].name, strlen( FREQUENCIES[i].name ) );
+    }
+}
+
+static void
+collect_element( haut_t* p, haut_tag_t tag, strfragment_t* name ) {
+    stream_append( (stream_t*)p->userdata, name->data, name->size );
+}
+
+/* Appends the names of the start and end tags in @buffer to the stream,
+ * @buffer must remain valid as long as the stream is used */
+static void
+stream_collect( stream_t* s, const char* buffer, size_t len ) {
+    haut_t p;
+    haut_init( &p );
+    p.userdata =s;
+    p.events.element_open =collect_element;
+    p.events.element_close =collect_element;
+    haut_setInput( &p, buffer, len );
+    haut_parse( &p );
+    haut_destroy( &p );
+}
+
+static char*
+read_file( const char* filename, size_t* size ) {
+    FILE* f =fopen( filename, "rb" );
+    if( !f ) {
+        fprintf( stderr, "ERROR: Could not open `%s'\n", filename );
+        return NULL;
+    }
+    fseek( f, 0, SEEK_END );
+    *size =ftell( f );
+    fseek( f, 0, SEEK_SET );
+    char* data =malloc( *size );
+    if( fread( data, 1, *size, f ) != *size ) {
+        fprintf( stderr, "ERROR: Could not read `%s'\n", filename );
+        free( data );
+        data =NULL;
+    }
+    fclose( f );
+    return data;
+}
+
+static double
+now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Keeps the calls to decode_tag() from being optimized away */
+static volatile size_t sink;
+
+static void
+run_benchmark( const char* name, stream_t* s, int iterations ) {
+    double best =0.0;
+    size_t unknown =0;
+    for( int i =0; i < iterations; i++ ) {
+        size_t sum =0;
+        unknown =0;
+        double begin =now();
+        for( size_t j =0; j < s->count; j++ ) {
+            int tag =decode_tag( s->names[j].data, s->names[j].size );
+            sum +=tag;
+            unknown +=tag == TAG_UNKNOWN;
+        }
+        double elapsed =now() - begin;
+        sink =sum;
+        if( !best || elapsed < best ) best =elapsed;
+    }
+
+    printf( "%-24s %10zu names %10zu unknown %8.2f ns/name (%s)\n",
+            name, s->count, unknown, best * 1e9 / s->count, HAUT_TAG_HASH ? "perfect hash" : "FSM" );
+}
+
+int
+main( int argc, char** argv ) {
+    int iterations =DEFAULT_ITERATIONS;
+    stream_t s;
+    memset( &s, 0, sizeof( stream_t ) );
+    char** files =calloc( argc, sizeof( char* ) );
+    int n_files =0;
+
+    for( int i =1; i < argc; i++ ) {
+        if( strcmp( argv[i], "-n" ) == 0 && i+1 < argc )
+            iterations =atoi( argv[++i] );
+        else {
+            size_t size;
+            char* data =read_file( argv[i], &size );
+            if( !data )
+                return 1;
+            stream_collect( &s, data, size );
+            files[n_files++] =data;
+        }
+    }
+
+    if( n_files )
+        run_benchmark( "files", &s, iterations );
+    else {
+        stream_generate( &s );
+        run_benchmark( "tag frequencies", &s, iterations );
+    }
+
+    for( int i =0; i < n_files; i++ )
+        free( files[i] );
+    free( files );
+    free( s.names );
+    return 0;
+}
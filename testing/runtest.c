@@ -13,12 +13,11 @@
 #include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
+#include <haut/pool.h>
 #include "test.h"
 
 #define RESULT_STRING( r ) ((r) ? "[PASSED]" : "[FAILED]") 
 
-#define DEFAULT_FLAGS true, false, false
-
 bool
 processFile( const char* filename, flags_t flags ) {
 
@@ -74,7 +73,7 @@ processFile( const char* filename, flags_t flags ) {
 
 int
 main( int argc, char** argv ) {
-    flags_t flags = { DEFAULT_FLAGS };
+    flags_t flags = { .stop_on_error = true };
     int error =0;
     
     for( int i =1; i < argc; i++ ) {
@@ -85,6 +84,40 @@ main( int argc, char** argv ) {
             flags.generate =true;
         else if( strcmp( argv[i], "-s" ) == 0 )
             flags.stream =true;
+        else if( strcmp( argv[i], "-e" ) == 0 )
+            flags.segmented =true;
+        else if( strcmp( argv[i], "-j" ) == 0 && i+1 < argc )
+            flags.threads =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-b" ) == 0 && i+1 < argc )
+            flags.batch =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-i" ) == 0 && i+1 < argc )
+            flags.streams =atoi( argv[++i] );
+        else if( strcmp( argv[i], "-q" ) == 0 && i+1 < argc )
+            flags.query =argv[++i];
+        else if( strcmp( argv[i], "-k" ) == 0 && i+1 < argc )
+            flags.skip =argv[++i];
+        else if( strcmp( argv[i], "-c" ) == 0 && i+1 < argc ) {
+            flags.stream =true;
+            flags.chunk_size =atoi( argv[++i] );
+        } else if( strcmp( argv[i], "-m" ) == 0 && i+1 < argc ) {
+            flags.mask =true;
+            flags.event_mask =atoi( argv[++i] );
+        } else if( strcmp( argv[i], "-l" ) == 0 )
+            flags.lazy_position =true;
+        else if( strcmp( argv[i], "-p" ) == 0 )
+            flags.pause =true;
+        else if( strcmp( argv[i], "-a" ) == 0 )
+            flags.arena =true;
+        else if( strcmp( argv[i], "-r" ) == 0 )
+            flags.reuse =true;
+        else if( strcmp( argv[i], "-t" ) == 0 )
+            flags.tape =true;
+        else if( strcmp( argv[i], "-w" ) == 0 )
+            flags.accumulate =true;
+        else if( strcmp( argv[i], "-x" ) == 0 )
+            flags.serial =true;
+        else if( strcmp( argv[i], "-d" ) == 0 )
+            flags.dom =true;
         else {
         // Everything else is treated as a filename
             bool result =processFile( argv[i], flags );
@@ -98,6 +131,8 @@ main( int argc, char** argv ) {
             }
         }
     }
+    // The parsers that were reused between the tests
+    haut_poolClear();
     
     return error;
 }
@@ -13,21 +13,35 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <ctype.h>
 #include <haut/haut.h>
 #include <haut/tag.h>
-
-/* Tests if the current generated output buffer matches the buffer of
- * expectations at the current offset. The current offset is advanced afterwards. */
-void
-expect( haut_t* p, const char* fmt, ... ) {
-    va_list ap;
-    va_start( ap, fmt );
-    test_t* t =(test_t*)p->userdata;
-
+#include <haut/arena.h>
+#include <haut/pool.h>
+#include <haut/tape.h>
+#include <haut/serial.h>
+#include <haut/batch.h>
+#include <haut/query.h>
+#include <haut/dom.h>
+#include "../src/haut_state.h"
+
+/* In stream mode, the input is split into chunks of this many bytes, unless another size is given */
+#define STREAM_CHUNK_SIZE 3
+/* In batch mode, the input is parsed this many times */
+#define BATCH_DOCUMENTS 8
+/* In interleaved mode, the input is parsed this many more times than there are streams */
+#define INTERLEAVED_EXTRA 2
+/* The maximum number of streams of haut_parseInterleaved(), see src/haut_state.h */
+#define INTERLEAVED_MAX_STREAMS 8
+
+/* Tests if the current generated output buffer of @t matches the buffer of
+ * expectations at the current offset. The current offset is advanced afterwards.
+ * On a mismatch, the parser @p is stopped */
+static void
+vexpect( test_t* t, haut_t* p, const char* fmt, va_list ap ) {
     if( t->flags.generate ) {
         /* Only generate expectations; simply print the output from the parser */
         vprintf( fmt, ap );
-        va_end( ap );
         return;
     }
 
@@ -39,23 +53,77 @@ expect( haut_t* p, const char* fmt, ... ) {
     /* Fill the output buffer with the variable arguments send by the callee */
     char* output =t->output_buf.data;
     size_t len = vsnprintf( output, t->output_buf.capacity, fmt, ap );
-    va_end( ap );
     
-    if( len > t->expect_size - t->expect_ptr ) {
+    if( t->mismatch ) {
+        // Only the first mismatch is reported
+        return;
+    }
+    else if( len > t->expect_size - t->expect_ptr ) {
         fprintf( stderr, "Error\n-----\n Unexpected: %.*s\n", (int)len, output );
-        // We need to escape the parser's mainloop using a long jump
-        longjmp( t->return_on_mismatch, 1 );
+        t->mismatch =true;
+        haut_stop( p );
+        return;
     }
     // If we mismatch the expectation and the output, we need to throw an error.
     else if( strncmp( expect, output, len ) != 0 ) {
 
+        haut_position_t pos =haut_position( p );
         fprintf( stderr, "Error\n-----\n Expected: %.*s\n Got:      %s\n On line %d, column %d\n",
-                 (int)len, expect, output, p->position.row, p->position.col );
-        // We need to escape the parser's mainloop using a long jump
-        longjmp( t->return_on_mismatch, 1 );
+                 (int)len, expect, output, pos.row, pos.col );
+        t->mismatch =true;
+        haut_stop( p );
+        return;
     }
     // Advance the pointer to point at the next expectation
     t->expect_ptr += len;
+    // Return to beginTest(), which continues the parser
+    if( t->flags.pause || (t->pause_countdown && --t->pause_countdown == 0) )
+        haut_pause( p );
+}
+
+/* Tests the output of the event handlers of @p, whose userdata is the test */
+void
+expect( haut_t* p, const char* fmt, ... ) {
+    va_list ap;
+    va_start( ap, fmt );
+    vexpect( (test_t*)p->userdata, p, fmt, ap );
+    va_end( ap );
+}
+
+/* Tests the output for @t, whose parser has other userdata (such as a query) */
+static void
+expect_test( test_t* t, const char* fmt, ... ) {
+    va_list ap;
+    va_start( ap, fmt );
+    vexpect( t, t->parser, fmt, ap );
+    va_end( ap );
+}
+
+/* Tests if all expectations have been met at the end of the input.
+ * Only whitespace may be left in the buffer of expectations */
+static void
+expect_end( test_t* t ) {
+    if( t->flags.generate || t->mismatch )
+        return;
+    const char* rest =t->expect_buf + t->expect_ptr;
+    size_t len =t->expect_size - t->expect_ptr;
+    while( len && isspace( (unsigned char)rest[len-1] ) )
+        len--;
+    if( len ) {
+        fprintf( stderr, "Error\n-----\n Missing: %.*s\n", (int)len, rest );
+        t->mismatch =true;
+    }
+}
+
+/* Returns the entire token of which @f is the first segment.
+ * With segmented tokens, values and texts that span chunks are delivered in segments */
+static strfragment_t
+token( haut_t* p, strfragment_t* f ) {
+    size_t count;
+    haut_tokenSegments( p, &count );
+    if( count > 1 )
+        return haut_flattenToken( p );
+    return *f;
 }
 
 /* Callback functions for the haut event handler below.
@@ -90,7 +158,14 @@ test_element_open_close    ( struct haut* p, haut_tag_t tag, strfragment_t* name
 
 void            
 test_element_open_event    ( struct haut* p, haut_tag_t tag, strfragment_t* name ){
+    test_t* t =(test_t*)p->userdata;
     test_element_open_close( p, tag, name, false );
+
+    /* Skip the elements with the given name, the next event should be their close tag */
+    if( t->flags.skip && name->size == strlen( t->flags.skip ) && strfragment_icmp( name, t->flags.skip ) ) {
+        if( haut_skipElement( p ) )
+            expect( p, "SKIP\n" );
+    }
 }
 
 void            
@@ -98,15 +173,30 @@ test_element_close_event   ( struct haut* p, haut_tag_t tag, strfragment_t* name
     test_element_open_close( p, tag, name, true );
 }
 
+void            
+test_attribute_id_event    ( struct haut* p, haut_attr_t attr, strfragment_t* key, strfragment_t* value ){
+    test_t* t =(test_t*)p->userdata;
+    t->attr_key =key;
+    t->attr_id =attr;
+}
+
 void            
 test_attribute_event       ( struct haut* p, strfragment_t* key, strfragment_t* value ){
-    static const char* format = "ARGUMENT %.*s \"%.*s\"\n";
-    static const char* format_void = "ARGUMENT %.*s VOID\n";
+    static const char* format = "ARGUMENT %.*s ATTR %d \"%.*s\"\n";
+    static const char* format_void = "ARGUMENT %.*s ATTR %d VOID\n";
+    test_t* t =(test_t*)p->userdata;
+
+    if( t->attr_key != key ) {
+        expect( p, "ATTRIBUTE ID MISSING FOR %.*s\n", (int)key->size, key->data );
+        return;
+    }
+    t->attr_key =NULL;
 
     if( value == NULL ) {
-        expect( p, format_void, (int)key->size, key->data );
+        expect( p, format_void, (int)key->size, key->data, t->attr_id );
     } else {
-        expect( p, format, (int)key->size, key->data, (int)value->size, value->data );
+        strfragment_t v =token( p, value );
+        expect( p, format, (int)key->size, key->data, t->attr_id, (int)v.size, v.data );
     }
 }
 
@@ -121,7 +211,8 @@ void
 test_innertext_event       ( struct haut* p, strfragment_t* text ){
     static const char* format = "INNERTEXT %.*s\n";
 
-    expect( p, format, (int)text->size, text->data );
+    strfragment_t t =token( p, text );
+    expect( p, format, (int)t.size, t.data );
 }
 
 void            
@@ -140,7 +231,8 @@ void
 test_script_event          ( struct haut* p, strfragment_t* text ){
     static const char* format = "SCRIPT %.*s\n";
 
-    expect( p, format, (int)text->size, text->data );
+    strfragment_t t =token( p, text );
+    expect( p, format, (int)t.size, t.data );
 }
 
 void            
@@ -162,6 +254,54 @@ test_error_event           ( struct haut* p, haut_error_t err ){
     printf( "^\n" );*/
 }
 
+/* Called by the query of the test for every element that matched */
+static void
+test_match_event( haut_query_t* q, const haut_match_t* match, void* userdata ) {
+    test_t* t =(test_t*)userdata;
+    if( match->tag == TAG_UNKNOWN )
+        expect_test( t, "MATCH %d NAME %.*s\n", match->selector, (int)match->name.size, match->name.data );
+    else
+        expect_test( t, "MATCH %d TAG %d\n", match->selector, (int)match->tag );
+    for( size_t i =0; i < match->attribute_count; i++ ) {
+        const haut_query_attribute_t* a =&match->attributes[i];
+        if( a->value.data == NULL )
+            expect_test( t, "ARGUMENT %.*s VOID\n", (int)a->key.size, a->key.data );
+        else
+            expect_test( t, "ARGUMENT %.*s \"%.*s\"\n", (int)a->key.size, a->key.data, (int)a->value.size, a->value.data );
+    }
+    expect_test( t, "TEXT %.*s\n", (int)match->text.size, match->text.data );
+}
+
+/* Reports the nodes of @d in document order, which is the order of their indices.
+ * Every node is reported with its links, so that both the structure of the tree
+ * and the way it is stored are tested. DOM_NONE is reported as -1 */
+static void
+test_dom( test_t* t, const haut_dom_t* d ) {
+    static const char* kinds[] ={ "DOCUMENT", "ELEMENT", "TEXT", "COMMENT", "DOCTYPE" };
+
+    for( haut_node_t n =0; n < d->count; n++ ) {
+        strfragment_t text =haut_domString( d, d->text[n] );
+        expect_test( t, "NODE %d %s TAG %d PARENT %d FIRST %d NEXT %d \"%.*s\"\n",
+            (int)n, kinds[d->kind[n]], (int)d->tag[n],
+            (int)d->parent[n], (int)d->first_child[n], (int)d->next_sibling[n],
+            (int)text.size, text.data );
+        for( uint32_t a =d->first_attr[n]; a < d->first_attr[n] + d->attr_count[n]; a++ ) {
+            strfragment_t key =haut_domString( d, d->attr_key[a] );
+            if( d->attr_value[a].offset == DOM_NONE ) {
+                expect_test( t, "ATTRIBUTE %d ATTR %d KEY %u+%u %.*s VOID\n",
+                    (int)a, (int)d->attr_id[a], d->attr_key[a].offset, d->attr_key[a].length,
+                    (int)key.size, key.data );
+            } else {
+                strfragment_t value =haut_domString( d, d->attr_value[a] );
+                expect_test( t, "ATTRIBUTE %d ATTR %d KEY %u+%u %.*s VALUE %u+%u \"%.*s\"\n",
+                    (int)a, (int)d->attr_id[a], d->attr_key[a].offset, d->attr_key[a].length,
+                    (int)key.size, key.data, d->attr_value[a].offset, d->attr_value[a].length,
+                    (int)value.size, value.data );
+            }
+        }
+    }
+}
+
 /* Describes the event handler structure. We need to catch all events emitted. */
 static const haut_event_handler_t TEST_EVENT_HANDLER = {
     .document_begin=test_document_begin_event,
@@ -175,37 +315,250 @@ static const haut_event_handler_t TEST_EVENT_HANDLER = {
     .script        =test_script_event,
     .cdata         =test_cdata_event,
     .error         =test_error_event,
+    .attribute_id  =test_attribute_id_event,
 };
 
+/* Returns the options of the parsers of @t, allocating from @arena if it is not NULL */
+static haut_opts_t
+test_opts( test_t* t, haut_arena_t* arena ) {
+    haut_opts_t opts =DEFAULT_PARSER_OPTS;
+    if( arena )
+        opts =haut_arenaOpts( arena, opts );
+    if( t->flags.lazy_position )
+        opts.flags |=FLAG_LAZY_POSITION;
+    if( t->flags.accumulate )
+        opts.flags |=FLAG_ACCUMULATE_INNERTEXT;
+    return opts;
+}
+
+/* Initializes the @count tests in @copies as copies of @t, that have not begun yet */
+static void
+copy_test( test_t* copies, int count, const test_t* t ) {
+    for( int i =0; i < count; i++ ) {
+        copies[i] =*t;
+        strbuffer_init( &copies[i].output_buf );
+        strbuffer_reserve( &copies[i].output_buf, t->expect_size );
+    }
+}
+
+/* Frees the @count tests in @copies. Returns true if all of them met all expectations */
+static bool
+finish_copies( test_t* copies, int count ) {
+    bool passed =true;
+    for( int i =0; i < count; i++ ) {
+        expect_end( &copies[i] );
+        passed =passed && !copies[i].mismatch;
+        strbuffer_free( &copies[i].output_buf );
+    }
+    return passed;
+}
+
+/* Parses BATCH_DOCUMENTS copies of the input of @t with haut_parseBatch() and tests each of them.
+ * With the arena flag, all workers allocate from a single arena */
+static bool
+batchTest( test_t* t ) {
+    test_t copies[BATCH_DOCUMENTS];
+    haut_document_t docs[BATCH_DOCUMENTS];
+    haut_arena_t* arena =t->flags.arena ? haut_arenaCreate( 256 ) : NULL;
+
+    copy_test( copies, BATCH_DOCUMENTS, t );
+    for( int i =0; i < BATCH_DOCUMENTS; i++ ) {
+        docs[i].buffer =t->input_buf;
+        docs[i].length =t->input_size;
+        docs[i].userdata =&copies[i];
+    }
+    haut_parseBatch( docs, BATCH_DOCUMENTS, &TEST_EVENT_HANDLER, test_opts( t, arena ), t->flags.batch, NULL );
+
+    if( arena )
+        haut_arenaDestroy( arena );
+    return finish_copies( copies, BATCH_DOCUMENTS );
+}
+
+/* Parses copies of the input of @t with haut_parseInterleaved() on t->flags.streams streams
+ * and tests each of them. There are INTERLEAVED_EXTRA more copies than streams, so that the lanes
+ * of the copies that are done are filled again. Copy i is first parsed up to its i-th event
+ * by haut_parse(), so that the streams are not in the same state all the time */
+static bool
+interleavedTest( test_t* t ) {
+    test_t copies[INTERLEAVED_MAX_STREAMS + INTERLEAVED_EXTRA];
+    haut_t parsers[INTERLEAVED_MAX_STREAMS + INTERLEAVED_EXTRA];
+    haut_t* ptrs[INTERLEAVED_MAX_STREAMS + INTERLEAVED_EXTRA];
+    int count =(t->flags.streams < INTERLEAVED_MAX_STREAMS ? t->flags.streams : INTERLEAVED_MAX_STREAMS) + INTERLEAVED_EXTRA;
+    haut_arena_t* arena =t->flags.arena ? haut_arenaCreate( 256 ) : NULL;
+
+    copy_test( copies, count, t );
+    for( int i =0; i < count; i++ ) {
+        haut_t* p =ptrs[i] =&parsers[i];
+        haut_initOpts( p, test_opts( t, arena ) );
+        p->userdata =&copies[i];
+        p->events =TEST_EVENT_HANDLER;
+        haut_setInput( p, t->input_buf, t->input_size );
+        if( i ) {
+            copies[i].pause_countdown =i;
+            haut_parse( p );
+            copies[i].pause_countdown =0;
+        }
+    }
+    haut_parseInterleaved( ptrs, count, t->flags.streams );
+
+    for( int i =0; i < count; i++ )
+        haut_destroy( &parsers[i] );
+    if( arena )
+        haut_arenaDestroy( arena );
+    return finish_copies( copies, count );
+}
+
 /* Starts parsing the input_buf from @t and tests 
  * the parser's output against expect_buf.
  * Returns true if all expectations are met.*/
 bool
 beginTest( test_t* t ) {
-    bool pass =true;
-
-    haut_t p;
-    haut_init( &p );
-    p.userdata =(void*)t;
-    p.events =TEST_EVENT_HANDLER;
+    /* The modes that parse the input more than once */
+    if( t->flags.batch && !t->flags.generate )
+        return batchTest( t );
+    if( t->flags.streams && !t->flags.generate )
+        return interleavedTest( t );
+
+    haut_t parser, *p =&parser;
+    haut_arena_t* arena =NULL;
+    if( t->flags.arena ) {
+        // Small blocks, so that the buffers outgrow them
+        arena =haut_arenaCreate( 256 );
+        haut_initOpts( p, haut_arenaOpts( arena, DEFAULT_PARSER_OPTS ) );
+    } else if( t->flags.reuse ) {
+        // The parser of the previous test, if any
+        p =haut_poolAcquire( DEFAULT_PARSER_OPTS );
+    } else
+        haut_init( p );
+    p->userdata =(void*)t;
+    p->events =TEST_EVENT_HANDLER;
+    t->parser =p;
+    if( t->flags.lazy_position )
+        haut_enable( p, FLAG_LAZY_POSITION );
+    if( t->flags.accumulate )
+        haut_enable( p, FLAG_ACCUMULATE_INNERTEXT );
+    if( t->flags.mask && t->flags.event_mask != EVENT_AUTO ) {
+        /* The handlers of all events are set, but only those in the mask may be called.
+         * There is no error handler, which is valid */
+        haut_setEventMask( p, t->flags.event_mask );
+        p->events.error =NULL;
+    } else if( t->flags.mask ) {
+        /* Only set the element handlers with haut_setEventHandler() and the others afterwards.
+         * The mask is derived from the handlers when parsing begins, so all events are emitted */
+        haut_event_handler_t e =DEFAULT_EVENT_HANDLER;
+        e.element_open =TEST_EVENT_HANDLER.element_open;
+        e.element_close =TEST_EVENT_HANDLER.element_close;
+        haut_setEventHandler( p, e );
+        haut_setEventMask( p, EVENT_AUTO );
+        p->events.attribute =TEST_EVENT_HANDLER.attribute;
+        p->events.attribute_id =TEST_EVENT_HANDLER.attribute_id;
+        p->events.comment =TEST_EVENT_HANDLER.comment;
+        p->events.innertext =TEST_EVENT_HANDLER.innertext;
+        p->events.cdata =TEST_EVENT_HANDLER.cdata;
+        p->events.doctype =TEST_EVENT_HANDLER.doctype;
+        p->events.script =TEST_EVENT_HANDLER.script;
+    }
 
     strbuffer_init( &t->output_buf );
     strbuffer_reserve( &t->output_buf, t->expect_size );
 
-    /* Set the buffer */
-    haut_setInput( &p, (char*)t->input_buf, t->input_size );
-
-    if( setjmp( t->return_on_mismatch ) != 0 ) {
-        /* An expectation was not met when parsing */
-        pass =false;
+    /* Instead of the events, report the elements that match the selectors */
+    haut_query_t* query =NULL;
+    if( t->flags.query ) {
+        query =haut_queryCompile( t->flags.query, test_match_event, t );
+        if( query ) {
+            p->events =DEFAULT_EVENT_HANDLER;
+            haut_queryAttach( query, p );
+        }
+        else {
+            expect_test( t, "INVALID SELECTOR\n" );
+            haut_stop( p );
+        }
+    }
 
+    if( t->flags.dom ) {
+        /* Build the tree, then report its nodes */
+        haut_dom_t dom;
+        haut_domInit( &dom, NULL );
+        if( !haut_parseToDom( p, t->input_buf, t->input_size, &dom ) ) {
+            fprintf( stderr, "Error\n-----\n Out of memory while building the DOM\n" );
+            t->mismatch =true;
+        } else
+            test_dom( t, &dom );
+        haut_domFree( &dom );
+    } else if( t->flags.tape ) {
+        /* Record the tokens first, then call the event handlers for them */
+        haut_tape_t tape;
+        haut_tapeInit( &tape, NULL );
+        // Record all tokens, so that the event mask of the test is applied by the replay
+        int event_mask =p->opts.event_mask;
+        p->opts.event_mask =EVENT_ALL;
+        haut_parseToTape( p, t->input_buf, t->input_size, &tape );
+        p->opts.event_mask =event_mask;
+        haut_tapeReplay( &tape, t->input_buf, p );
+        haut_tapeFree( &tape );
+    } else if( t->flags.serial ) {
+        /* Store the events in a binary stream first, then call the event handlers for them */
+        strbuffer_t stream;
+        strbuffer_init( &stream );
+        haut_parseToSerial( p, t->input_buf, t->input_size, &stream );
+        if( haut_serialReplay( stream.data, stream.size, p ) != SERIAL_OK ) {
+            fprintf( stderr, "Error\n-----\n Invalid event stream\n" );
+            t->mismatch =true;
+        }
+        strbuffer_free( &stream );
+    } else if( t->flags.threads ) {
+        /* Parse the input with speculative workers. In build/runtest_parallel, 
+         * even the small inputs of the tests are split into segments */
+        haut_parseParallel( p, t->input_buf, t->input_size, t->flags.threads );
+    } else if( t->flags.stream || t->flags.segmented ) {
+        /* Feed the input in small chunks. Normally every chunk is copied to the same buffer,
+         * so the parser has to copy the tokens that span chunks. With segmented tokens,
+         * the input is retained until the end and the tokens are not copied */
+        size_t chunk_size =t->flags.chunk_size ? t->flags.chunk_size : STREAM_CHUNK_SIZE;
+        char* chunk =malloc( chunk_size );
+        if( t->flags.segmented )
+            haut_enable( p, FLAG_SEGMENTED_TOKENS );
+        for( size_t offs =0; offs < t->input_size && !t->mismatch; offs +=chunk_size ) {
+            size_t len =t->input_size - offs;
+            if( len > chunk_size )
+                len =chunk_size;
+            if( t->flags.segmented )
+                haut_parseChunk( p, t->input_buf + offs, len );
+            else {
+                memcpy( chunk, t->input_buf + offs, len );
+                haut_parseChunk( p, chunk, len );
+            }
+            while( t->flags.pause && !t->mismatch && p->position.offset < p->length )
+                haut_parse( p );
+        }
+        // The empty chunk that ends the document
+        if( !t->mismatch )
+            haut_parseChunk( p, chunk, 0 );
+        free( chunk );
     } else {
-        /* Begin the parsing */
-        haut_parse( &p );
+        /* Set the buffer */
+        haut_setInput( p, (char*)t->input_buf, t->input_size );
+
+        /* Begin the parsing, the parser is stopped as soon as an expectation is not met */
+        haut_parse( p );
+        while( t->flags.pause && !t->mismatch && p->position.offset < p->length )
+            haut_parse( p );
+    }
+
+    if( query ) {
+        haut_queryFinish( query );
+        haut_queryFree( query );
     }
+    expect_end( t );
 
     /* Clean up */
-    haut_destroy( &p );
+    if( t->flags.reuse )
+        haut_poolRelease( p );
+    else
+        haut_destroy( p );
+    if( arena )
+        haut_arenaDestroy( arena );
     strbuffer_free( &t->output_buf );
-    return pass;
+    return !t->mismatch;
 }
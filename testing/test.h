@@ -12,13 +12,29 @@
 #define TEST_H
 
 #include <stdbool.h>
-#include <setjmp.h>
-#include <haut/string_util.h>
+#include <haut/haut.h>
 
 typedef struct {
     bool stop_on_error;
     bool generate;
     bool stream;
+    bool lazy_position;
+    bool pause;
+    bool arena;
+    bool reuse;
+    bool tape;
+    bool accumulate;
+    bool serial;
+    bool segmented;
+    int threads;            // Parse with haut_parseParallel() on this many threads, if not zero
+    int batch;              // Parse copies of the input with haut_parseBatch() on this many threads, if not zero
+    int streams;            // Parse copies of the input with haut_parseInterleaved() on this many streams, if not zero
+    bool mask;              // Set event_mask with haut_setEventMask(), for EVENT_AUTO the handlers are set late
+    int event_mask;
+    const char* skip;       // Skip the elements with this name with haut_skipElement(), if not NULL
+    int chunk_size;         // The size of the chunks in stream mode, if not zero
+    const char* query;      // Report the matches of these selectors instead of the events, if not NULL
+    bool dom;               // Build a DOM with haut_parseToDom() and report its nodes instead of the events
 } flags_t;
 
 typedef struct {
@@ -31,8 +47,14 @@ typedef struct {
     flags_t flags;
 
     /* These variables are used internally by the test functions */
-    jmp_buf return_on_mismatch;
+    haut_t* parser;
+    bool mismatch;
     strbuffer_t output_buf;
+    // The key and id passed to the attribute_id handler, which must precede the attribute handler
+    const strfragment_t* attr_key;
+    int attr_id;
+    // If not zero, the parser is paused once this many more expectations have been met
+    int pause_countdown;
 
 } test_t;
 
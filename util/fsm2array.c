@@ -29,7 +29,8 @@ typedef enum {
     
 typedef enum {
     ARRAY_INT,      // Type { 1, 2, 3 }
-    ARRAY_CHAR      // Type "\x1\x2\x3"
+    ARRAY_CHAR,     // Type "\x1\x2\x3"
+    ARRAY_BYTE      // Type 0x1 (exactly one action per transition, suitable for uint8_t)
 } array_type_t;
 
 typedef struct {
@@ -39,16 +40,33 @@ typedef struct {
     int input_base;
     // Number of action arrays written per line of output
     int line_width;
+    // File containing a second FSM, indexed by [state][next state], to fuse with the input
+    const char* fuse_file;
+    // Print the set of inputs that leave each state instead of the transitions
+    int exit_sets;
+    // If set, inputs are grouped in equivalence classes and the class map is written to this file
+    const char* class_file;
+    // Print C code that runs the (fused) FSM instead of an array
+    int codegen;
 } options_t;
 
-#define DEFAULT_OPTS { .array_type =ARRAY_CHAR, .input_base =0, .line_width =6 }
+#define DEFAULT_OPTS { .array_type =ARRAY_CHAR, .input_base =0, .line_width =6, .fuse_file =NULL, .exit_sets =0, .class_file =NULL, .codegen =0 }
 static const char* HELP_TEXT = "fsm2array - Generate C-style array from finite-state-machine transitions\n\
 \n\
 Options:\n\
 \t-c\tSet output mode to character array (e.g. \"\\x1\\x2\\x3\") (Default)\n\
 \t-i\tSet output mode to integer array (e.g. {1,2,3})\n\
+\t-u\tSet output mode to byte values (e.g. 0x1), requires exactly one action per transition\n\
 \t-b <n>\tIf the values of the input do not begin at zero, an offset can be substracted. Default: 0\n\
 \t-w <n>\tNumber of array elements per line of output\n\
+\t-p <file>\tFuse with the FSM in <file> that is indexed by [state][next state] (e.g. the parser).\n\
+\t\tEach element packs the next state and up to two actions into a 32-bit integer.\n\
+\t-e <file>\tGroup the inputs that behave the same in every state into equivalence classes.\n\
+\t\tThe resulting array is indexed by [state][class], the map from input to class is written to <file>.\n\
+\t-x\tPrint for each state the set of inputs that leave the state (or cause an action of the FSM given by -p).\n\
+\t\tEach set is written as a list, a 256-bit mask and nibble lookup tables (see src/scan.h).\n\
+\t-g\tPrint C code with one label per state that runs the FSM fused with -p, instead of an array.\n\
+\t\tThe code behaves like lexer_fused_run() in src/state_machine.c and is meant to be included there.\n\
 \t-h\tThis help.\n\
 Input is read from stdin and output is written to stdout, by default.\n";
 
@@ -56,7 +74,7 @@ int
 parse_cmd_opts( options_t* opts, int argc, char* const* argv ) {
     int c;
 
-    while ((c = getopt (argc, argv, "icb:w:h")) != -1)  {
+    while ((c = getopt (argc, argv, "icub:w:p:e:xgh")) != -1)  {
         switch( c ) {
             case 'i':
                 opts->array_type =ARRAY_INT;
@@ -64,17 +82,32 @@ parse_cmd_opts( options_t* opts, int argc, char* const* argv ) {
             case 'c':
                 opts->array_type =ARRAY_CHAR;
                 break;
+            case 'u':
+                opts->array_type =ARRAY_BYTE;
+                break;
             case 'b':
                 opts->input_base =atoi( optarg );
                 break;
             case 'w':
                 opts->line_width =atoi( optarg );
                 break;
+            case 'p':
+                opts->fuse_file =optarg;
+                break;
+            case 'e':
+                opts->class_file =optarg;
+                break;
+            case 'x':
+                opts->exit_sets =1;
+                break;
+            case 'g':
+                opts->codegen =1;
+                break;
             case 'h':
                 fprintf( stderr, "%s\n", HELP_TEXT );
                 return -1;
             case '?':
-                if( optopt == 'f' || optopt == 'w' )
+                if( optopt == 'b' || optopt == 'w' || optopt == 'p' || optopt == 'e' )
                     fprintf( stderr, "ERROR: Option -%c required an argument. Try -h (help)\n", optopt );
                 else
                     fprintf( stderr, "ERROR: Option -%c invalid. Try -h (help)\n", optopt );
@@ -115,6 +148,10 @@ typedef struct generated_state generated_state_t;
 
 static void
 print_array( int* A, size_t length, size_t max_length, options_t* opts ) {
+    if( opts->array_type ==ARRAY_BYTE ) {
+        printf( "0x%x", length ? A[0] : 0 );
+        return;
+    }
     if( opts->array_type ==ARRAY_INT ) {
         if( max_length != 1 )
             printf( "{" );
@@ -400,38 +437,34 @@ cont:
     while(s) { generated_state_t* tmp =s->next; free(s); s =tmp; }
 }
 
-int
-main( int argc, char * const*argv ) {
-    // Check the commandline arguments
-    options_t opts = DEFAULT_OPTS;
-    if( parse_cmd_opts( &opts, argc, argv ) != 0 )
-        return -1;
+typedef struct {
+    int numstates;
+    int numinputs;
+    size_t max_actions; // The largest number of actions encountered
+    state_table_t* transitions;
+} fsm_t;
+
+/* Read an FSM in fsm2array notation from @in and expand its input strings.
+ * Returns zero on success */
+static int
+read_fsm( FILE* in, options_t* opts, fsm_t* fsm ) {
+    memset( fsm, 0, sizeof( fsm_t ) );
 
     // Read the number of states and number of inputs from the first line
     // Expected syntax: `<states> <inputs>'
-    int numstates =0, numinputs =0;
-    size_t max_actions =0; // The largest number of actions encoutered
-
-    /*char buf[2];
-    fread( buf, 1, 2, stdin );
-    if( buf[0] == '/' && ( buf[1] == '/' || buf[1] == '&' ) ) {
-        scanf( "%d%d", &numstates, &numinputs );
-    }*/
-
-    scanf( "%%! %d%d", &numstates, &numinputs );
-    if( !numstates || !numinputs ) {
+    fscanf( in, "%%! %d%d", &fsm->numstates, &fsm->numinputs );
+    if( !fsm->numstates || !fsm->numinputs ) {
         fprintf( stderr, "ERROR: Specify number of states and number of input values on the first line\n" );
         return -1;
     }
 
-
-    // Read each state transition from the standard input
+    // Read each state transition from the input
     // Expected syntax: `<state>, <input> => { <new state>, <option 1>, ... <option n> }'
     
     state_table_t* transition_list =NULL;
     state_table_t* string_transition_list =NULL;
 
-    while( !feof( stdin ) ) {
+    while( !feof( in ) ) {
         // Create an empty transition
         state_table_t* n =(state_table_t*)malloc( sizeof( state_table_t ) );
         memset( n, 0, sizeof( state_table_t ) );
@@ -439,9 +472,10 @@ main( int argc, char * const*argv ) {
         // Split the input line into the part before the => and the part after
         int ret;
         char* state, *input;
-        if( ( (ret = scanf( " %m[0-9*^] , %ms => { ", &state, &input ) ) != 2 )
+        if( ( (ret = fscanf( in, " %m[0-9*^] , %ms => { ", &state, &input ) ) != 2 )
                 || !state
                 || !input ) {
+            free( n );
             if( ret == EOF ) break;
             fprintf( stderr, "ERROR: Syntax error\n" );
             return -1;
@@ -452,15 +486,15 @@ main( int argc, char * const*argv ) {
         action[0] =0;
         size_t action_length =0;
 
-        while( !feof( stdin ) ) {
+        while( !feof( in ) ) {
             int value =0;
-            if( scanf( "%d , ", &value ) != 1 ) {
-                scanf( "}" );
+            if( fscanf( in, "%d , ", &value ) != 1 ) {
+                fscanf( in, "}" );
                 break;
             }
 
-            if( value > 255 && opts.array_type == ARRAY_CHAR ) {
-                fprintf( stderr, "ERROR: Specified action `%d' does not fit specified type (char) try `-i'\n", value );
+            if( value > 255 && opts->array_type != ARRAY_INT ) {
+                fprintf( stderr, "ERROR: Specified action `%d' does not fit specified type (char or byte) try `-i'\n", value );
                 return -1;
             }
             
@@ -469,9 +503,14 @@ main( int argc, char * const*argv ) {
             action[action_length] =0;
         }
 
+        if( action_length > 1 && opts->array_type == ARRAY_BYTE ) {
+            fprintf( stderr, "ERROR: Byte output (-u) allows only one action per transition in `%s %s => ...'\n", state, input );
+            return -1;
+        }
+
         n->action =action;
         n->action_length =action_length;
-        max_actions =(action_length>max_actions) ? action_length : max_actions;
+        fsm->max_actions =(action_length>fsm->max_actions) ? action_length : fsm->max_actions;
 
         // Tokenize the state and input buffers
         //
@@ -479,13 +518,13 @@ main( int argc, char * const*argv ) {
         n->state_opts =tokenize ( state, &n->state, &dummy);
         n->input_opts =tokenize( input, &n->input, &n->input_string );
 
-        if( !(n->state_opts & IS_WILDCARD) && n->state >= numstates ) { 
+        if( !(n->state_opts & IS_WILDCARD) && n->state >= fsm->numstates ) { 
             fprintf( stderr, "ERROR: State out-of-range in `%s %s => ...'\n", state, input );
             return -1;
         }
         if( !(n->input_opts & (IS_WILDCARD | TOKEN_STRING) ) &&
-                ( ((n->input - opts.input_base) >= numinputs )
-                  || ((n->input - opts.input_base) < 0 ) ) ) {
+                ( ((n->input - opts->input_base) >= fsm->numinputs )
+                  || ((n->input - opts->input_base) < 0 ) ) ) {
             fprintf( stderr, "ERROR: Input out-of-range in `%s %s => ...' (check the -b flag)\n", state, input );
             return -1;
         }
@@ -517,43 +556,551 @@ main( int argc, char * const*argv ) {
     }
 
     // Transitions with input specified as string must be expanded first
-    expand_input_strings( transition_list, string_transition_list, &numstates );
+    expand_input_strings( transition_list, string_transition_list, &fsm->numstates );
+
+    fsm->transitions =transition_list;
+    return 0;
+}
+
+static void
+free_fsm( fsm_t* fsm ) {
+    state_table_t* n = fsm->transitions;
+    while( n ) {
+        state_table_t *tmp =n;
+        n = n->next;
+        free( tmp->action );
+        free( tmp );
+    }
+    fsm->transitions =NULL;
+}
+
+/* Inputs that have the same transition in every state form an equivalence class */
+typedef struct {
+    int numclasses;
+    int* class_of;  // The class of each input
+    int* first;     // The first input of each class, which represents the class in the array
+} classes_t;
+
+static void
+print_generated_notice( FILE* out ) {
+    fprintf( out, "// This file was automatically generated by fsm2array\n// Please do not edit this file directly\n// Rules to generate this file can be found in the util/ directory\n" );
+}
 
-    printf( "// states = %d, inputs = %d\n", numstates, numinputs );
-    printf( "// Resulting array is indexed by [state][input+(%d)]\n", -opts.input_base );
-    printf( "// This file was automatically generated by fsm2array\n// Please do not edit this file directly\n// Rules to generate this file can be found in the util/ directory\n" );
+static void
+print_header( fsm_t* fsm, classes_t* classes, options_t* opts ) {
+    printf( "// states = %d, inputs = %d\n", fsm->numstates, fsm->numinputs );
+    if( classes )
+        printf( "// Resulting array is indexed by [state][class], where class is given by the class map for input+(%d)\n", -opts->input_base );
+    else
+        printf( "// Resulting array is indexed by [state][input+(%d)]\n", -opts->input_base );
+    print_generated_notice( stdout );
+}
+
+/* Number of columns per state in the resulting array and the input that represents column @k */
+#define NUM_COLUMNS( fsm, classes ) ((classes) ? (classes)->numclasses : (fsm)->numinputs)
+#define COLUMN_INPUT( classes, k ) ((classes) ? (classes)->first[k] : (k))
 
-    // Cycle through all state-input combinations and generate C-array syntax
-    for( int i =0; i < numstates; i++ ) {
+/* Cycle through all state-input combinations and generate C-array syntax */
+static int
+print_transitions( fsm_t* fsm, classes_t* classes, options_t* opts ) {
+    print_header( fsm, classes, opts );
+
+    const int columns =NUM_COLUMNS( fsm, classes );
+    for( int i =0; i < fsm->numstates; i++ ) {
         printf( "// Transitions for state %d\n", i );
         printf( "{" );
-        for( int j =0; j < numinputs; j++ ) {
-            state_table_t *t = find_transition( transition_list, i, j, &opts );
+        for( int k =0; k < columns; k++ ) {
+            int j =COLUMN_INPUT( classes, k );
+            state_table_t *t = find_transition( fsm->transitions, i, j, opts );
             if( !t ) {
                 fprintf( stderr, "ERROR: No transition defined for (%d, %d)\n", i,j );
                 return -1;
             }
-            print_array( t->action, t->action_length, max_actions, &opts );
-            if( j != numinputs-1 )
+            print_array( t->action, t->action_length, fsm->max_actions, opts );
+            if( k != columns-1 )
                 printf( "," );
-            if( !((j+1) % opts.line_width ) )
+            if( !((k+1) % opts->line_width ) )
                 printf( "\n" );
         }
-        if( i != numstates-1 )
+        if( i != fsm->numstates-1 )
             printf( "},\n" );
         else
             printf( "}\n" );
     }
+    return 0;
+}
 
-    // Cleanup
-    state_table_t* n = transition_list;
-    while( n ) {
-        state_table_t *tmp =n;
-        n = n->next;
-        free( tmp->action );
-        free( tmp );
+/* Compose transition (@state, @input) of the FSM @fsm with a second FSM @events that is indexed 
+ * by [state][next state], such as the parser FSM. The resulting @value packs the next state of @fsm (bits 0-7)
+ * with the first two actions of @events (bits 8-15 and 16-23). Bit 31 is set whenever either
+ * of these actions is non-zero, so a single test tells whether any action is required. 
+ * Returns zero on success */
+static int
+fuse_transition( fsm_t* fsm, fsm_t* events, int state, int input, options_t* opts, unsigned int* value ) {
+    options_t events_opts =*opts;
+    events_opts.input_base =0;
+
+    state_table_t *t = find_transition( fsm->transitions, state, input, opts );
+    if( !t || !t->action_length ) {
+        fprintf( stderr, "ERROR: No transition defined for (%d, %d)\n", state, input );
+        return -1;
+    }
+    int next =t->action[0];
+    if( next > 255 ) {
+        fprintf( stderr, "ERROR: State `%d' does not fit in a fused transition\n", next );
+        return -1;
     }
 
+    state_table_t *e = find_transition( events->transitions, state, next, &events_opts );
+    if( !e ) {
+        fprintf( stderr, "ERROR: No transition defined for (%d, %d) in the second FSM\n", state, next );
+        return -1;
+    }
+    *value =next;
+    for( int k =0; k < e->action_length; k++ ) {
+        if( k >= 2 && e->action[k] ) {
+            fprintf( stderr, "ERROR: At most two actions can be fused for (%d, %d)\n", state, next );
+            return -1;
+        }
+        if( k >= 2 ) continue;
+        if( e->action[k] > 127 ) {
+            fprintf( stderr, "ERROR: Action `%d' does not fit in a fused transition\n", e->action[k] );
+            return -1;
+        }
+        *value |= e->action[k] << (8 + 8*k);
+    }
+    if( *value & 0xffff00 )
+        *value |= 1U << 31;
+    return 0;
+}
 
+static int
+check_fusable( fsm_t* fsm, fsm_t* events ) {
+    if( events->numstates != fsm->numstates || events->numinputs != fsm->numstates ) {
+        fprintf( stderr, "ERROR: The second FSM must be indexed by [%d][%d]\n", fsm->numstates, fsm->numstates );
+        return -1;
+    }
     return 0;
 }
+
+/* Print the composition of the FSM @fsm with a second FSM @events, see fuse_transition() */
+static int
+print_fused( fsm_t* fsm, fsm_t* events, classes_t* classes, options_t* opts ) {
+    if( check_fusable( fsm, events ) != 0 )
+        return -1;
+
+    print_header( fsm, classes, opts );
+    printf( "// Fused with a second FSM: bits 0-7 hold the next state, bits 8-15 and 16-23 the actions\n" );
+    printf( "// of the second FSM and bit 31 is set if any of these actions is non-zero\n" );
+
+    const int columns =NUM_COLUMNS( fsm, classes );
+    for( int i =0; i < fsm->numstates; i++ ) {
+        printf( "// Transitions for state %d\n", i );
+        printf( "{" );
+        for( int k =0; k < columns; k++ ) {
+            unsigned int value;
+            if( fuse_transition( fsm, events, i, COLUMN_INPUT( classes, k ), opts, &value ) != 0 )
+                return -1;
+
+            printf( "0x%x", value );
+            if( k != columns-1 )
+                printf( "," );
+            if( !((k+1) % opts->line_width ) )
+                printf( "\n" );
+        }
+        if( i != fsm->numstates-1 )
+            printf( "},\n" );
+        else
+            printf( "}\n" );
+    }
+    return 0;
+}
+
+#define EXIT_LIST_MAX 8         // Must equal SCAN_MAX_SET in src/scan.h
+#define EXIT_BELOW_MAX 0x21     // Only control characters and space may be added to a set
+
+/* Compute the set @exits of input characters that leave @state of @fsm or, if @events is given, 
+ * cause an action of @events. Control characters may be added to the set in order to keep
+ * the number of other characters as short as possible: all characters below @below are in the set.
+ * Returns the number of characters in the set from @below onwards, or -1 on error */
+static int
+find_exit_set( fsm_t* fsm, fsm_t* events, int state, options_t* opts, int exits[256], int* below ) {
+    memset( exits, 0, sizeof(int) * 256 );
+    for( int j =0; j < fsm->numinputs; j++ ) {
+        unsigned int value;
+        if( events ) {
+            if( fuse_transition( fsm, events, state, j, opts, &value ) != 0 )
+                return -1;
+            exits[j+opts->input_base] =(value & 0xff) != state || (value & (1U << 31));
+        } else {
+            state_table_t *t = find_transition( fsm->transitions, state, j, opts );
+            if( !t || !t->action_length ) {
+                fprintf( stderr, "ERROR: No transition defined for (%d, %d)\n", state, j );
+                return -1;
+            }
+            exits[j+opts->input_base] =t->action[0] != state;
+        }
+    }
+
+    // Choose the threshold that results in the shortest list
+    int size =0;
+    *below =0;
+    for( int c =0; c < 256; c++ ) size +=exits[c];
+    for( int b =1; b <= EXIT_BELOW_MAX; b++ ) {
+        if( !exits[b-1] ) continue;
+        int n =0;
+        for( int c =b; c < 256; c++ ) n +=exits[c];
+        if( n < size ) { size =n; *below =b; }
+    }
+    for( int c =0; c < *below; c++ ) exits[c] =1;
+    return size;
+}
+
+/* Print, for each state of @fsm, the set of input characters that leave the state.
+ * If @events is given, characters that loop on the state but cause an action of @events are included as well.
+ * Each set is written as an initializer of scan_set_t (see src/scan.h) in three representations:
+ * - A list of at most EXIT_LIST_MAX characters plus a threshold below which all characters are in the set.
+ *   The threshold is chosen to keep the list as short as possible. Control characters are thereby 
+ *   added to the set, which does no harm as a set may be larger than strictly necessary.
+ *   If the list does not fit, its size is -1 and the state is not meant to be skipped by scanning.
+ * - A 256-bit mask.
+ * - Two nibble lookup tables: c is in the set iff lo[c & 0xf] & hi[c >> 4] is non-zero.
+ *   This is only possible if the set has at most eight different high-nibble 'rows', 
+ *   otherwise the tables are zero and a flag is cleared. */
+static int
+print_exit_sets( fsm_t* fsm, fsm_t* events, options_t* opts ) {
+    if( events && check_fusable( fsm, events ) != 0 )
+        return -1;
+    if( fsm->numinputs + opts->input_base > 256 ) {
+        fprintf( stderr, "ERROR: Exit sets require the inputs to be bytes\n" );
+        return -1;
+    }
+
+    print_header( fsm, NULL, opts );
+    printf( "// For each state the set of characters that leave it, or cause an action.\n" );
+    printf( "// Each element is { list size, below, { list }, { 256-bit mask }, nibbles, { nibble lo }, { nibble hi } }\n" );
+
+    for( int i =0; i < fsm->numstates; i++ ) {
+        int exits[256], below;
+        int size =find_exit_set( fsm, events, i, opts, exits, &below );
+        if( size < 0 )
+            return -1;
+
+        printf( "// Exit set for state %d\n", i );
+        if( size > EXIT_LIST_MAX ) {
+            printf( "{ -1, 0x0, { 0 }, " );
+        } else {
+            printf( "{ %d, 0x%x, { ", size, below );
+            int n =0;
+            for( int c =below; c < 256; c++ )
+                if( exits[c] ) printf( n++ ? ",0x%x" : "0x%x", c );
+            if( !n ) printf( "0" );
+            printf( " }, " );
+        }
+
+        printf( "{ " );
+        for( int w =0; w < 8; w++ ) {
+            unsigned int mask =0;
+            for( int b =0; b < 32; b++ )
+                if( exits[w*32+b] ) mask |= 1U << b;
+            printf( w ? ",0x%x" : "0x%x", mask );
+        }
+        printf( " },\n  " );
+
+        // Each distinct row of low nibbles is assigned a bit
+        unsigned int rows[8];
+        int numrows =0, nibbles =1;
+        unsigned int lo[16] ={0}, hi[16] ={0};
+        for( int h =0; h < 16 && nibbles; h++ ) {
+            unsigned int row =0;
+            for( int l =0; l < 16; l++ )
+                if( exits[h*16+l] ) row |= 1U << l;
+            if( !row ) continue;
+            int r =0;
+            while( r < numrows && rows[r] != row ) r++;
+            if( r == numrows ) {
+                if( numrows == 8 ) { nibbles =0; break; }
+                rows[numrows++] =row;
+            }
+            hi[h] =1U << r;
+            for( int l =0; l < 16; l++ )
+                if( row & (1U << l) ) lo[l] |= 1U << r;
+        }
+        printf( "%d, { ", nibbles );
+        for( int l =0; l < 16; l++ )
+            printf( l ? ",0x%x" : "0x%x", nibbles ? lo[l] : 0 );
+        printf( " }, { " );
+        for( int h =0; h < 16; h++ )
+            printf( h ? ",0x%x" : "0x%x", nibbles ? hi[h] : 0 );
+        if( i != fsm->numstates-1 )
+            printf( " } },\n" );
+        else
+            printf( " } }\n" );
+    }
+    return 0;
+}
+
+/* What happens to the generated code of a state on a particular input character */
+typedef struct {
+    enum { OUTCOME_GOTO, OUTCOME_STOP, OUTCOME_ACTION } type;
+    unsigned int value; // The next state, or the fused transition for OUTCOME_ACTION
+} outcome_t;
+
+/* Print the FSM @fsm fused with @events as C code with one label per state, for inclusion in a function body.
+ * The code behaves exactly like the table-driven lexer_fused_run() in src/state_machine.c:
+ * it expects the variables `state', `i', `buf', `len' and `transition' and leaves `state' and `i' updated.
+ * Entry into the current state uses computed goto with GCC-compatible compilers, a switch otherwise.
+ * Within the code, each transition is a direct jump to the label of the next state */
+static int
+print_codegen( fsm_t* fsm, fsm_t* events, options_t* opts ) {
+    if( !events ) {
+        fprintf( stderr, "ERROR: Code generation requires a second FSM to fuse with (-p)\n" );
+        return -1;
+    }
+    if( fsm->numinputs != 256 || opts->input_base != 0 ) {
+        fprintf( stderr, "ERROR: Code generation requires the inputs to be bytes\n" );
+        return -1;
+    }
+
+    // The run stops after entering a state that is skipped by scanning, see print_exit_sets()
+    int* skippable =malloc( sizeof(int) * fsm->numstates );
+    for( int i =0; i < fsm->numstates; i++ ) {
+        int exits[256], below;
+        int size =find_exit_set( fsm, events, i, opts, exits, &below );
+        if( size < 0 ) {
+            free( skippable );
+            return -1;
+        }
+        skippable[i] =size <= EXIT_LIST_MAX;
+    }
+
+    printf( "// states = %d, inputs = %d\n", fsm->numstates, fsm->numinputs );
+    printf( "// Direct-threaded code of the fused FSM, to be included in the body of lexer_fused_run()\n" );
+    print_generated_notice( stdout );
+
+    printf( "#if defined(__GNUC__)\n" );
+    printf( "    static const void* FSM__LABELS[%d] = {", fsm->numstates );
+    for( int i =0; i < fsm->numstates; i++ )
+        printf( "%s&&FSM_S%d", i ? ", " : " ", i );
+    printf( " };\n    goto *FSM__LABELS[state];\n#else\n    switch( state ) {\n" );
+    for( int i =0; i < fsm->numstates; i++ )
+        printf( "        case %d: goto FSM_S%d;\n", i, i );
+    printf( "        default: goto FSM_DONE;\n    }\n#endif\n" );
+
+    for( int i =0; i < fsm->numstates; i++ ) {
+        outcome_t outcome[256];
+        for( int c =0; c < 256; c++ ) {
+            unsigned int value;
+            if( fuse_transition( fsm, events, i, c, opts, &value ) != 0 ) {
+                free( skippable );
+                return -1;
+            }
+            int next =value & 0xff;
+            if( value & (1U << 31) ) {
+                outcome[c].type =OUTCOME_ACTION; outcome[c].value =value;
+            } else if( next != i && skippable[next] ) {
+                outcome[c].type =OUTCOME_STOP; outcome[c].value =next;
+            } else {
+                outcome[c].type =OUTCOME_GOTO; outcome[c].value =next;
+            }
+        }
+
+        // The most frequent outcome becomes the default case
+        int count[256] ={0}, group[256], def =0;
+        for( int c =0; c < 256; c++ ) {
+            group[c] =c;
+            for( int d =0; d < c; d++ ) {
+                if( outcome[d].type == outcome[c].type && outcome[d].value == outcome[c].value ) {
+                    group[c] =group[d];
+                    break;
+                }
+            }
+            if( ++count[group[c]] > count[def] )
+                def =group[c];
+        }
+
+        printf( "// State %d\nFSM_S%d:\n", i, i );
+        printf( "    if( i == len ) { state =%d; goto FSM_DONE; }\n", i );
+        printf( "    switch( (unsigned char)buf[i] ) {\n" );
+        for( int g =0; g < 256; g++ ) {
+            if( group[g] != g || !count[g] ) continue;
+            if( g == def ) 
+                printf( "        default:\n" );
+            else {
+                int n =0;
+                for( int c =g; c < 256; c++ ) {
+                    if( group[c] != g ) continue;
+                    printf( "%scase 0x%x:", n == 0 ? "        " : (n % opts->line_width ? " " : "\n        "), c );
+                    n++;
+                }
+                printf( "\n" );
+            }
+            switch( outcome[g].type ) {
+                case OUTCOME_ACTION:
+                    printf( "            *transition =0x%x; state =%d; goto FSM_DONE;\n", outcome[g].value, i );
+                    break;
+                case OUTCOME_STOP:
+                    printf( "            *transition =0; state =%d; i++; goto FSM_DONE;\n", outcome[g].value );
+                    break;
+                case OUTCOME_GOTO:
+                    printf( "            i++; goto FSM_S%d;\n", outcome[g].value );
+                    break;
+            }
+        }
+        printf( "    }\n" );
+    }
+    printf( "FSM_DONE: ;\n" );
+
+    free( skippable );
+    return 0;
+}
+
+/* Returns non-zero if transitions @a and @b of the same FSM have the same actions */
+static int
+same_transition( state_table_t* a, state_table_t* b ) {
+    if( a == b ) return 1;
+    if( a->action_length != b->action_length ) return 0;
+    return memcmp( a->action, b->action, sizeof(int) * a->action_length ) == 0;
+}
+
+/* Group the inputs of @fsm (fused with @events, if given) into classes of inputs
+ * that have the same transition in every state. Classes are numbered in order of their first input.
+ * Returns zero on success */
+static int
+compute_classes( fsm_t* fsm, fsm_t* events, options_t* opts, classes_t* classes ) {
+    const int states =fsm->numstates, inputs =fsm->numinputs;
+    // Look up every transition once, so the columns can be compared quickly
+    state_table_t** table =malloc( sizeof(state_table_t*) * states * inputs );
+    unsigned int* fused =malloc( sizeof(unsigned int) * states * inputs );
+    int ret =0;
+
+    for( int i =0; i < states && !ret; i++ ) {
+        for( int j =0; j < inputs; j++ ) {
+            if( events ) {
+                if( (ret =fuse_transition( fsm, events, i, j, opts, &fused[i*inputs+j] )) != 0 )
+                    break;
+            } else {
+                table[i*inputs+j] =find_transition( fsm->transitions, i, j, opts );
+                if( !table[i*inputs+j] ) {
+                    fprintf( stderr, "ERROR: No transition defined for (%d, %d)\n", i,j );
+                    ret =-1;
+                    break;
+                }
+            }
+        }
+    }
+
+    classes->numclasses =0;
+    classes->class_of =malloc( sizeof(int) * inputs );
+    classes->first =malloc( sizeof(int) * inputs );
+
+    for( int j =0; j < inputs && !ret; j++ ) {
+        int c =0;
+        for( ; c < classes->numclasses; c++ ) {
+            int k =classes->first[c], i =0;
+            for( ; i < states; i++ ) {
+                if( events ? fused[i*inputs+j] != fused[i*inputs+k] 
+                           : !same_transition( table[i*inputs+j], table[i*inputs+k] ) )
+                    break;
+            }
+            if( i == states ) break;
+        }
+        if( c == classes->numclasses )
+            classes->first[classes->numclasses++] =j;
+        classes->class_of[j] =c;
+    }
+
+    free( table );
+    free( fused );
+    return ret;
+}
+
+/* Write the map from input to class to @filename. 
+ * Besides the array elements, the file defines FSM__N_CLASSES, the number of classes */
+static int
+write_classes( classes_t* classes, fsm_t* fsm, const char* filename, options_t* opts ) {
+    FILE* out =fopen( filename, "w" );
+    if( !out ) {
+        fprintf( stderr, "ERROR: Could not open `%s' for writing\n", filename );
+        return -1;
+    }
+    fprintf( out, "// inputs = %d, classes = %d\n", fsm->numinputs, classes->numclasses );
+    fprintf( out, "// Resulting array is indexed by [input+(%d)] and gives the class of each input\n", -opts->input_base );
+    print_generated_notice( out );
+    fprintf( out, "#define FSM__N_CLASSES %d\n", classes->numclasses );
+    for( int j =0; j < fsm->numinputs; j++ ) {
+        fprintf( out, "0x%x", classes->class_of[j] );
+        if( j != fsm->numinputs-1 )
+            fprintf( out, "," );
+        if( !((j+1) % 16 ) )
+            fprintf( out, "\n" );
+    }
+    fprintf( out, "\n" );
+    fclose( out );
+    return 0;
+}
+
+int
+main( int argc, char * const*argv ) {
+    // Check the commandline arguments
+    options_t opts = DEFAULT_OPTS;
+    if( parse_cmd_opts( &opts, argc, argv ) != 0 )
+        return -1;
+
+    fsm_t fsm;
+    if( read_fsm( stdin, &opts, &fsm ) != 0 )
+        return -1;
+
+    int ret =0;
+    fsm_t events;
+    fsm_t* fuse_with =NULL;
+    if( opts.fuse_file ) {
+        // Read the second FSM that is fused with the first one
+        FILE* file =fopen( opts.fuse_file, "r" );
+        if( !file ) {
+            fprintf( stderr, "ERROR: Could not open `%s'\n", opts.fuse_file );
+            return -1;
+        }
+        options_t events_opts =opts;
+        events_opts.array_type =ARRAY_INT;
+        events_opts.input_base =0;
+        ret =read_fsm( file, &events_opts, &events );
+        fclose( file );
+        if( ret != 0 )
+            return -1;
+        fuse_with =&events;
+        if( check_fusable( &fsm, fuse_with ) != 0 )
+            return -1;
+    }
+
+    classes_t classes;
+    classes_t* use_classes =NULL;
+    if( opts.class_file && !opts.exit_sets && !opts.codegen ) {
+        ret =compute_classes( &fsm, fuse_with, &opts, &classes );
+        if( ret == 0 )
+            ret =write_classes( &classes, &fsm, opts.class_file, &opts );
+        use_classes =&classes;
+    }
+
+    if( ret == 0 ) {
+        if( opts.exit_sets )
+            ret =print_exit_sets( &fsm, fuse_with, &opts );
+        else if( opts.codegen )
+            ret =print_codegen( &fsm, fuse_with, &opts );
+        else if( fuse_with )
+            ret =print_fused( &fsm, fuse_with, use_classes, &opts );
+        else
+            ret =print_transitions( &fsm, use_classes, &opts );
+    }
+
+    // Cleanup
+    if( use_classes ) {
+        free( classes.class_of );
+        free( classes.first );
+    }
+    if( fuse_with )
+        free_fsm( &events );
+    free_fsm( &fsm );
+
+    return ret;
+}
@@ -45,12 +45,14 @@
 
 /*
  * Generate an FSM and C-header from a collection of HTML-entity definitions
- * in JSON format.
+ * in JSON format. The FSM accepts with the index of the entity in a table
+ * of codepoints and their pre-encoded UTF-8 strings, which is written to
+ * the table file.
  *
  * Compile with
  *         gcc -o gen_entities gen_entities.c json.c -lm
  *
- * USAGE: ./gen_entities <input json file> <output header> <output fsm file>
+ * USAGE: ./gen_entities <input json file> <output header> <output fsm file> <output table file>
  */
 
 // The range of input ASCII characters, 
@@ -60,8 +62,8 @@
 #define NUM_STATES 2 // Only `none' and `unknown', rest is filled later
 #define SUCCESS_BIT 1UL << 31 // Most significant bit is used to signal 'decode success'
 
-#define ONLY_ONE_CODEPOINT
 #define ENUM_PREFIX "ENTITY_"
+#define MAX_UTF8 16 // Upper bound on the encoded length of a single entity
 
 void
 str_to_sym( char* str ) {
@@ -77,12 +79,37 @@ str_to_sym( char* str ) {
 typedef struct {
     FILE* fsm_file;
     FILE* header_file;
+    FILE* table_file;
     uint32_t mask;
     int count;
+    int max_utf8;
 } gen_entities_state_t;
 
+/* Write the UTF-8 encoding of codepoint @c to @buf, returns the number of bytes */
 static int
-process_codepoints( gen_entities_state_t* state, json_value* value ) {
+encode_utf8( char* buf, uint32_t c ) {
+    if( c < 0x80 ) {
+        buf[0] =c;
+        return 1;
+    } else if( c < 0x800 ) {
+        buf[0] =0xC0 | (c >> 6);
+        buf[1] =0x80 | (c & 0x3F);
+        return 2;
+    } else if( c < 0x10000 ) {
+        buf[0] =0xE0 | (c >> 12);
+        buf[1] =0x80 | ((c >> 6) & 0x3F);
+        buf[2] =0x80 | (c & 0x3F);
+        return 3;
+    }
+    buf[0] =0xF0 | (c >> 18);
+    buf[1] =0x80 | ((c >> 12) & 0x3F);
+    buf[2] =0x80 | ((c >> 6) & 0x3F);
+    buf[3] =0x80 | (c & 0x3F);
+    return 4;
+}
+
+static int
+process_codepoints( gen_entities_state_t* state, json_value* value, const char* name ) {
     if (value == NULL) {
         return 1;
     }
@@ -90,35 +117,40 @@ process_codepoints( gen_entities_state_t* state, json_value* value ) {
         fprintf( stderr, "ERROR: expected array `codepoints' " );
         return 1;
     }
-    fprintf( state->fsm_file, "{ " );
-
+    /* The FSM accepts with the index in the table, which starts after `none' and `unknown' */
+    fprintf( state->fsm_file, "{ %" PRIu64 " }\n", (NUM_STATES + state->count) | SUCCESS_BIT );
 
-    int length, x;
+    int length, x, size =0;
     length = value->u.object.length;
+    char utf8[MAX_UTF8];
 
     for (x = 0; x < length; x++) {
         if( value->u.array.values[x]->type != json_integer ) {
             fprintf( stderr, "ERROR: expected integer in array `codepoints' " );
             return 1;
         }
-        fprintf( state->fsm_file, "%" PRId64 "", value->u.array.values[x]->u.integer | SUCCESS_BIT );
-
+        if( size + 4 > MAX_UTF8 ) {
+            fprintf( stderr, "ERROR: too many codepoints " );
+            return 1;
+        }
+        size +=encode_utf8( utf8 + size, value->u.array.values[x]->u.integer );
         state->mask |=(value->u.array.values[x]->u.integer);
-        state->count ++;
-
-#ifdef ONLY_ONE_CODEPOINT
-        break;
-#endif
-        if( x != length-1 )
-            fprintf( state->fsm_file, ", ");
     }
-    fprintf( state->fsm_file, " }\n" );
+    if( size > state->max_utf8 )
+        state->max_utf8 =size;
+
+    /* Each row of the table holds the first codepoint and the encoding of all codepoints */
+    fprintf( state->table_file, "{ 0x%" PRIx64 ", %d, \"", length ? value->u.array.values[0]->u.integer : 0, size );
+    for( x = 0; x < size; x++ )
+        fprintf( state->table_file, "\\x%02x", (unsigned char)utf8[x] );
+    fprintf( state->table_file, "\" }, // %s\n", name );
+    state->count ++;
     return 0;
 
 }
 
 static int
-process_entity_object( gen_entities_state_t* state, json_value* value ) {
+process_entity_object( gen_entities_state_t* state, json_value* value, const char* name ) {
     if (value == NULL) {
         return 1;
     }
@@ -131,7 +163,7 @@ process_entity_object( gen_entities_state_t* state, json_value* value ) {
     for (x = 0; x < length; x++) {
         /* Each object contains two members: "codepoints" and "characters" */
         if( strcmp( value->u.object.values[x].name, "codepoints" ) == 0 ) {
-            if( process_codepoints(state, value->u.object.values[x].value) != 0 )
+            if( process_codepoints(state, value->u.object.values[x].value, name) != 0 )
                 return 1;
             return 0;
         }
@@ -155,6 +187,7 @@ generateFSM( gen_entities_state_t* state, json_value* value ) {
     /* Generate the header for the FSM file */
     fprintf( state->fsm_file, "%%! %d %d\n\n", NUM_STATES, LAST_CHAR - FIRST_CHAR ); 
     fprintf( state->fsm_file, "**, ** => { 1 }\n" );
+    fprintf( state->table_file, "{ 0, 0, \"\" }, // none\n{ 0, 0, \"\" }, // unknown\n" );
 
     /* Process each JSON object member to produce an FSM transition from entity string to codepoint */
     for (x = 0; x < length; x++) {
@@ -163,7 +196,7 @@ generateFSM( gen_entities_state_t* state, json_value* value ) {
             continue;
         }
         fprintf( state->fsm_file, "0, \"%.*s\" => ", (int)strlen(name)-2, name+1);
-        if( process_entity_object( state, value->u.object.values[x].value ) != 0 ) {
+        if( process_entity_object( state, value->u.object.values[x].value, name ) != 0 ) {
             fprintf( stderr, "in `%s'\n", name);
             return 1;
         }
@@ -177,25 +210,27 @@ main(int argc, char** argv)
     enum FILES {
         JSON_FILE,
         HEADER_FILE,
-        FSM_FILE
+        FSM_FILE,
+        TABLE_FILE
     };
     
-    char* filename[3];
-    FILE *files[3];
+    char* filename[4];
+    FILE *files[4];
     struct stat filestatus;
     int file_size;
     char* file_contents;
     json_char* json;
     json_value* value;
 
-    if (argc != 4) {
-        fprintf(stderr, "%s <json html entities file> <output header-file> <output fsm-file>\n", argv[0]);
+    if (argc != 5) {
+        fprintf(stderr, "%s <json html entities file> <output header-file> <output fsm-file> <output table-file>\n", argv[0]);
         return 1;
     }
 
     filename[JSON_FILE] = argv[1];
     filename[HEADER_FILE] = argv[2];
     filename[FSM_FILE] = argv[3];
+    filename[TABLE_FILE] = argv[4];
 
     /* Check the existence fo the input file and determine its size */
     if ( stat(filename[JSON_FILE], &filestatus) != 0) {
@@ -210,8 +245,8 @@ main(int argc, char** argv)
         return 1;
     }
 
-    /* Open all three files */
-    for( int i =0; i < 3; i++ ) {
+    /* Open all four files */
+    for( int i =0; i < 4; i++ ) {
         files[i] =fopen( filename[i], i==0 ? "rt" : "w" );
         if( !files[i]) {
             fprintf( stderr, "ERROR: Could not open `%s'\n", filename[i] );
@@ -223,6 +258,10 @@ main(int argc, char** argv)
 /* This file was automatically generated by gen_entities.c from `%s' \n\
  * Please do not edit this file in any way \n\
  */\n\n", filename[JSON_FILE] );
+    fprintf( files[TABLE_FILE], "\
+// This file was automatically generated by gen_entities.c from `%s'\n\
+// Please do not edit this file in any way\n\
+// { first codepoint, length of the UTF-8 encoding, UTF-8 encoding of all codepoints }\n", filename[JSON_FILE] );
 
     /* Read the input JSON file */
     if ( fread(file_contents, file_size, 1, files[JSON_FILE]) != 1 ) {
@@ -247,7 +286,8 @@ main(int argc, char** argv)
     gen_entities_state_t state;
     state.fsm_file = files[FSM_FILE];
     state.header_file = files[HEADER_FILE];
-    state.count = state.mask =0;
+    state.table_file = files[TABLE_FILE];
+    state.count = state.mask = state.max_utf8 =0;
     generateFSM(&state, value);
     
     /* Generate a C header to define some usefull constants.
@@ -258,7 +298,8 @@ main(int argc, char** argv)
     fprintf( files[HEADER_FILE], "#define %sNONE %d\n", ENUM_PREFIX, 0 );
     fprintf( files[HEADER_FILE], "#define %sUNKNOWN %d\n\n", ENUM_PREFIX, 1 );
     fprintf( files[HEADER_FILE], "#define %sSUCCESS_BIT 0x%lx\n\n", ENUM_PREFIX, SUCCESS_BIT );
-    fprintf( files[HEADER_FILE], "#define %s_N %d\n", ENUM_PREFIX, ++(state.count) );
+    fprintf( files[HEADER_FILE], "#define %s_N %d\n", ENUM_PREFIX, NUM_STATES + state.count );
+    fprintf( files[HEADER_FILE], "#define %s_MAX_UTF8 %d\n", ENUM_PREFIX, state.max_utf8 );
     fprintf( files[HEADER_FILE], "#define %s_N_INPUTS %d\n", ENUM_PREFIX, LAST_CHAR - FIRST_CHAR );
     fprintf( files[HEADER_FILE], "#define %s_EOF %d\n", ENUM_PREFIX, 0 );
     fprintf( files[HEADER_FILE], "#define %s_FIRST_CHAR %d\n", ENUM_PREFIX, FIRST_CHAR );
@@ -270,6 +311,7 @@ main(int argc, char** argv)
     free(file_contents);
     fclose( files[HEADER_FILE] );
     fclose( files[FSM_FILE] );
+    fclose( files[TABLE_FILE] );
 
     fprintf( stderr, "Used bits: 0x%x\n", state.mask );
     return 0;
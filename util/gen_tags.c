@@ -1,16 +1,133 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <stdint.h>
+#include <string.h>
 
+// Defaults, for tag names
 #define ENUM_PREFIX "TAG_"
 // The range of HTML basic ASCII characters, a-z A-Z 0-9 < > ; : / ?
+// The first character terminates every name in the FSM and can not be part of a name itself
 #define FIRST_CHAR 47 // '/'
 #define LAST_CHAR 122 // 'z'
 
+// The perfect hash (-h) distributes the names over 2^PH_BUCKET_BITS buckets
+// and compares names of at most PH_MAX_LENGTH characters
+#define PH_BUCKET_BITS 6
+#define PH_MAX_LENGTH 16
+#define MAX_NAMES 1024
+
+/* FNV-1a hash of @str, continued from @hash */
+uint32_t
+hash_str( uint32_t hash, const char* str ) {
+    while( *str != 0 ) {
+        hash ^=(unsigned char)*str++;
+        hash *=16777619u;
+    }
+    return hash;
+}
+
+/* The key of the perfect hash: the length and the first, second and last character of @str,
+ * folded to lower case by setting bit 5. This must be computed in the same way as decode_tag() does */
+uint32_t
+ph_key( const char* str, size_t len ) {
+    return ((unsigned char)str[0] | (unsigned char)str[len > 1] << 8 
+         | (uint32_t)(unsigned char)str[len-1] << 16 | 0x202020) | (uint32_t)len << 24;
+}
+
+/* Search multipliers and a displacement per bucket, such that every name gets its own slot in a table
+ * of exactly @n slots: the slot of a key is ((key * m2) >> 16) + displacement[(key * m1) >> (32 - PH_BUCKET_BITS)]
+ * modulo @n. On success, @slots maps every slot to the index of its name */
+int
+ph_search( char** names, int n, uint32_t* m1, uint32_t* m2, int* displacement, int* slots ) {
+    const int n_buckets =1 << PH_BUCKET_BITS;
+    int bucket[MAX_NAMES], order[1 << PH_BUCKET_BITS], size[1 << PH_BUCKET_BITS];
+
+    for( uint32_t seed =1; seed < 100000; seed++ ) {
+        *m1 =(0x9e3779b1u * seed) | 1;
+        *m2 =(0x85ebca6bu * seed + 0x27d4eb2fu) | 1;
+        memset( size, 0, sizeof( size ) );
+        for( int i =0; i < n; i++ ) {
+            bucket[i] =(ph_key( names[i], strlen( names[i] ) ) * *m1) >> (32 - PH_BUCKET_BITS);
+            size[bucket[i]]++;
+        }
+        // The largest buckets are placed first, while most slots are still free
+        for( int b =0; b < n_buckets; b++ ) order[b] =b;
+        for( int b =1; b < n_buckets; b++ )
+            for( int c =b; c > 0 && size[order[c]] > size[order[c-1]]; c-- ) {
+                int tmp =order[c]; order[c] =order[c-1]; order[c-1] =tmp;
+            }
+        for( int i =0; i < n; i++ ) slots[i] =-1;
+
+        int b =0;
+        for( ; b < n_buckets; b++ ) {
+            int d =0;
+            for( ; d < n; d++ ) {
+                int fits =1;
+                for( int i =0; i < n && fits; i++ ) {
+                    if( bucket[i] != order[b] ) continue;
+                    int s =(((ph_key( names[i], strlen( names[i] ) ) * *m2) >> 16) + d) % n;
+                    if( slots[s] != -1 ) fits =0;
+                    else slots[s] =i;
+                }
+                if( fits ) break;
+                // Undo the slots of this bucket and try the next displacement
+                for( int s =0; s < n; s++ )
+                    if( slots[s] != -1 && bucket[slots[s]] == order[b] ) slots[s] =-1;
+            }
+            if( d == n ) break;
+            displacement[order[b]] =d;
+        }
+        if( b == n_buckets ) return 1;
+    }
+    return 0;
+}
+
+/* Write the perfect hash of @names to @file, for names with the enumeration prefix @prefix */
+int
+write_ph( FILE* file, const char* source, char** names, char** syms, int n, const char* prefix ) {
+    uint32_t m1, m2;
+    int displacement[1 << PH_BUCKET_BITS] ={ 0 }, slots[MAX_NAMES];
+    if( !ph_search( names, n, &m1, &m2, displacement, slots ) ) {
+        fprintf( stderr, "ERROR: Could not find a perfect hash\n" );
+        return -1;
+    }
+
+    char lower[64];
+    size_t i =0;
+    for( ; prefix[i] && i < sizeof( lower ) - 1; i++ ) lower[i] =tolower( prefix[i] );
+    lower[i] =0;
+
+    fprintf( file, "\
+/* This file was automatically generated by gen_tags.c from `%s' \n\
+ * Please do not edit this file in any way \n\
+ * The includer defines ph_entry_t as { char name[%d]; uint8_t length; uint16_t id; }\n\
+ */\n\n", source, PH_MAX_LENGTH );
+    fprintf( file, "#define %s_PH_SIZE %d\n", prefix, n );
+    fprintf( file, "#define %s_PH_BUCKET_BITS %d\n", prefix, PH_BUCKET_BITS );
+    fprintf( file, "#define %s_PH_MAX_LENGTH %d\n", prefix, PH_MAX_LENGTH );
+    fprintf( file, "#define %s_PH_MULTIPLIER1 0x%08xu\n", prefix, m1 );
+    fprintf( file, "#define %s_PH_MULTIPLIER2 0x%08xu\n\n", prefix, m2 );
+
+    fprintf( file, "static const %s _%sph_displacement[1 << %s_PH_BUCKET_BITS] = {", 
+             n <= 256 ? "uint8_t" : "uint16_t", lower, prefix );
+    for( int b =0; b < (1 << PH_BUCKET_BITS); b++ )
+        fprintf( file, "%s%d%s", b % 16 ? " " : "\n    ", displacement[b], b < (1 << PH_BUCKET_BITS) - 1 ? "," : "" );
+    fprintf( file, "\n};\n\n" );
+
+    fprintf( file, "static const ph_entry_t _%sph_entries[%s_PH_SIZE] = {\n", lower, prefix );
+    for( int s =0; s < n; s++ )
+        fprintf( file, "    { \"%s\", %d, %s%s },\n", 
+                 names[slots[s]], (int)strlen( names[slots[s]] ), prefix, syms[slots[s]] );
+    fprintf( file, "};\n" );
+    return 0;
+}
+
 void
 str_to_sym( char* str ) {
     while( *str != 0 ) {
-        if( *str == '-' || *str == '.' || *str == '/' )
+        if( *str == '-' || *str == '.' || *str == '/' || *str == ':' )
             *str = '_';
         else
             *str =toupper(*str);
@@ -20,11 +137,25 @@ str_to_sym( char* str ) {
 
 int
 main( int argc, char** argv ) {
-    if( argc != 4 ) {
-        fprintf( stderr, "Usage: gen_tags <file containing tagnames> <output header-file> <output fsm-file>\n" );
+    // Optionally, a perfect hash of the names is written as well
+    const char* ph_file =NULL;
+    if( argc > 2 && strcmp( argv[1], "-h" ) == 0 ) {
+        ph_file =argv[2];
+        argv +=2;
+        argc -=2;
+    }
+
+    if( argc != 4 && argc != 6 ) {
+        fprintf( stderr, "Usage: gen_tags [-h <output hash-file>] <file containing tagnames> <output header-file> <output fsm-file> [<prefix> <first char>]\n" );
         return -1;
     }
 
+    // Other lists of names (such as attributes) use their own prefix,
+    // and a lower first character if their names contain characters below '/'
+    const char* prefix =argc == 6 ? argv[4] : ENUM_PREFIX;
+    const int first_char =argc == 6 ? atoi( argv[5] ) : FIRST_CHAR;
+    const int n_inputs =LAST_CHAR - first_char + 1;
+
     enum FILES {
         TAG_FILE,
         HEADER_FILE,
@@ -53,18 +184,22 @@ main( int argc, char** argv ) {
     }
 
     fprintf( files[FSM_FILE], "#include \"%s\"\n", argv[2] );
-    fprintf( files[FSM_FILE], "%%! %s_N %d\n\n", ENUM_PREFIX, LAST_CHAR - FIRST_CHAR );
-    fprintf( files[FSM_FILE], "**, ** => { %sUNKNOWN }\n\n", ENUM_PREFIX );
+    fprintf( files[FSM_FILE], "%%! %s_N %d\n\n", prefix, n_inputs );
+    fprintf( files[FSM_FILE], "**, ** => { %sUNKNOWN }\n\n", prefix );
     str_to_sym( argv[2] );
     fprintf( files[HEADER_FILE], "#ifndef %s\n", argv[2] );
     fprintf( files[HEADER_FILE], "#define %s\n\n", argv[2] );
-    fprintf( files[HEADER_FILE], "#define %sNONE 0\n", ENUM_PREFIX );
+    fprintf( files[HEADER_FILE], "#define %sNONE 0\n", prefix );
 
     // Read the tags from the tag-file
     // For each tag, we output a #define to the header file
     // and a matching transition to the fsm file
 
     int n_tags =0;
+    char* names[MAX_NAMES];
+    char* syms[MAX_NAMES];
+    // Hash of all names in order, which changes whenever the numbering does
+    uint32_t hash =2166136261u;
 
     while( !feof( files[TAG_FILE] ) ) {
 
@@ -74,19 +209,37 @@ main( int argc, char** argv ) {
 
         // Transition
         fprintf( files[FSM_FILE], "%sNONE, \"%s%c\"i => ",
-                ENUM_PREFIX,
+                prefix,
                 tag,
-                FIRST_CHAR );
+                first_char );
 
+        hash =hash_str( hash_str( hash, tag ), " " );
+        if( ph_file ) {
+            if( n_tags == MAX_NAMES || strlen( tag ) > PH_MAX_LENGTH ) {
+                fprintf( stderr, "ERROR: Too many names or `%s' is too long for the perfect hash\n", tag );
+                return -1;
+            }
+            for( char* c =tag; *c; c++ ) {
+                *c =tolower( *c );
+                // decode_tag() folds names to lower case by setting bit 5 of their characters
+                if( (*c | 0x20) != *c ) {
+                    fprintf( stderr, "ERROR: `%s' contains a character that the perfect hash can not fold\n", tag );
+                    return -1;
+                }
+            }
+            names[n_tags] =strdup( tag );
+        }
         str_to_sym( tag );
+        if( ph_file )
+            syms[n_tags] =strdup( tag );
         
         fprintf( files[FSM_FILE], "{ %s%s }\n",
-                ENUM_PREFIX,
+                prefix,
                 tag );
 
         // Header #define
         fprintf( files[HEADER_FILE], "#define %s%s %d\n", 
-                ENUM_PREFIX, tag, ++n_tags );
+                prefix, tag, ++n_tags );
 
 
         free( tag );
@@ -94,14 +247,27 @@ main( int argc, char** argv ) {
 
     // Write the UNKNOWN and `count' macros
 
-    fprintf( files[HEADER_FILE], "#define %sUNKNOWN %d\n\n", ENUM_PREFIX, ++n_tags );
-    fprintf( files[HEADER_FILE], "#define %s_N %d\n", ENUM_PREFIX, ++n_tags );
-    fprintf( files[HEADER_FILE], "#define %s_N_INPUTS %d\n", ENUM_PREFIX, LAST_CHAR - FIRST_CHAR );
-    fprintf( files[HEADER_FILE], "#define %s_EOF %d\n", ENUM_PREFIX, 0 );
-    fprintf( files[HEADER_FILE], "#define %s_FIRST_CHAR %d\n", ENUM_PREFIX, FIRST_CHAR );
-    fprintf( files[HEADER_FILE], "#define %s_LAST_CHAR %d\n/* */\n", ENUM_PREFIX, LAST_CHAR );
+    fprintf( files[HEADER_FILE], "#define %sUNKNOWN %d\n\n", prefix, ++n_tags );
+    fprintf( files[HEADER_FILE], "#define %s_N %d\n", prefix, ++n_tags );
+    fprintf( files[HEADER_FILE], "#define %s_N_INPUTS %d\n", prefix, n_inputs );
+    fprintf( files[HEADER_FILE], "#define %s_EOF %d\n", prefix, 0 );
+    fprintf( files[HEADER_FILE], "#define %s_FIRST_CHAR %d\n", prefix, first_char );
+    fprintf( files[HEADER_FILE], "#define %s_LAST_CHAR %d\n", prefix, LAST_CHAR );
+    fprintf( files[HEADER_FILE], "#define %s_HASH 0x%08xu\n/* */\n", prefix, hash );
     fprintf( files[HEADER_FILE], "#endif\n" );
 
+    if( ph_file ) {
+        FILE* file =fopen( ph_file, "w" );
+        if( !file ) {
+            fprintf( stderr, "ERROR: Could not open `%s'\n", ph_file );
+            return -1;
+        }
+        int result =write_ph( file, argv[1], names, syms, n_tags - 2, prefix );
+        fclose( file );
+        if( result )
+            return result;
+    }
+
     // Cleanup and exit
 
     for( int i =0; i < 3; i++ ) fclose( files[i] );